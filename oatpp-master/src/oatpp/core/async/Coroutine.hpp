@@ -25,10 +25,12 @@
 #ifndef oatpp_async_Coroutine_hpp
 #define oatpp_async_Coroutine_hpp
 
+#include "./CoroutineArena.hpp"
 #include "./Error.hpp"
 
 #include "oatpp/core/data/IODefinitions.hpp"
 
+#include "oatpp/core/collection/MPSCQueue.hpp"
 #include "oatpp/core/collection/FastQueue.hpp"
 #include "oatpp/core/base/memory/MemoryPool.hpp"
 #include "oatpp/core/base/Environment.hpp"
@@ -374,6 +376,7 @@ public:
  */
 class AbstractCoroutine : public oatpp::base::Countable {
   friend oatpp::collection::FastQueue<AbstractCoroutine>;
+  friend oatpp::collection::MPSCQueue<AbstractCoroutine>;
   friend Processor;
   friend CoroutineStarter;
   friend worker::Worker;
@@ -521,12 +524,11 @@ public:
 public:
 
   static void* operator new(std::size_t sz) {
-    return ::operator new(sz);
+    return CoroutineArena::allocate(sz);
   }
 
   static void operator delete(void* ptr, std::size_t sz) {
-    (void)sz;
-    ::operator delete(ptr);
+    CoroutineArena::deallocate(ptr, sz);
   }
 
 public:
@@ -718,12 +720,11 @@ public:
 public:
 
   static void* operator new(std::size_t sz) {
-    return ::operator new(sz);
+    return CoroutineArena::allocate(sz);
   }
 
   static void operator delete(void* ptr, std::size_t sz) {
-    (void)sz;
-    ::operator delete(ptr);
+    CoroutineArena::deallocate(ptr, sz);
   }
 public:
 
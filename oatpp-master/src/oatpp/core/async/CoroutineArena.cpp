@@ -0,0 +1,179 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "CoroutineArena.hpp"
+
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+#include <list>
+#include <mutex>
+#include <vector>
+
+namespace oatpp { namespace async {
+
+namespace {
+
+/*
+ * Registry and its arenas are intentionally leaked. Coroutines may be freed during static destruction
+ * (by detached executors or by globals destroyed later) - arenas have to outlive all of them.
+ */
+class Registry {
+public:
+
+  oatpp::concurrency::SpinLock lock;
+  std::vector<CoroutineArena*> arenas;
+  std::list<CoroutineArena*> freeArenas;
+
+  static Registry& getInstance() {
+    static Registry* registry = new Registry();
+    return *registry;
+  }
+
+};
+
+}
+
+CoroutineArena::CoroutineArena(const std::string& name)
+  : m_allocations(0)
+  , m_oversizedAllocations(0)
+{
+  for(v_int32 i = 0; i < SIZE_CLASSES_COUNT; i ++) {
+    v_int32 entrySize = MIN_ENTRY_SIZE << i;
+    m_pools[i] = new oatpp::base::memory::MemoryPool(name + "<" + oatpp::utils::conversion::int32ToStdStr(entrySize) + ">",
+                                                     entrySize, CHUNK_MEMORY_SIZE / entrySize);
+  }
+}
+
+CoroutineArena::~CoroutineArena() {
+  for(v_int32 i = 0; i < SIZE_CLASSES_COUNT; i ++) {
+    delete m_pools[i];
+  }
+}
+
+v_int32 CoroutineArena::getSizeClass(std::size_t size) {
+  v_int32 sizeClass = 0;
+  std::size_t entrySize = MIN_ENTRY_SIZE;
+  while(entrySize < size) {
+    entrySize <<= 1;
+    sizeClass ++;
+  }
+  return sizeClass;
+}
+
+void* CoroutineArena::obtain(std::size_t size) {
+  m_allocations.fetch_add(1, std::memory_order_relaxed);
+  if(size > MAX_ENTRY_SIZE) {
+    m_oversizedAllocations.fetch_add(1, std::memory_order_relaxed);
+    return ::operator new(size);
+  }
+  return m_pools[getSizeClass(size)]->obtain();
+}
+
+CoroutineArena::Stats CoroutineArena::getStats() {
+  Stats stats;
+  stats.allocations = m_allocations.load(std::memory_order_relaxed);
+  stats.heapAllocations = m_oversizedAllocations.load(std::memory_order_relaxed);
+  for(v_int32 i = 0; i < SIZE_CLASSES_COUNT; i ++) {
+    stats.heapAllocations += m_pools[i]->getSize() / (CHUNK_MEMORY_SIZE / m_pools[i]->getEntrySize());
+  }
+  return stats;
+}
+
+CoroutineArena* CoroutineArena::acquire() {
+  auto& registry = Registry::getInstance();
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(registry.lock);
+  if(!registry.freeArenas.empty()) {
+    auto arena = registry.freeArenas.front();
+    registry.freeArenas.pop_front();
+    return arena;
+  }
+  auto arena = new CoroutineArena("CoroutineArena_" + oatpp::utils::conversion::int32ToStdStr((v_int32) registry.arenas.size()));
+  registry.arenas.push_back(arena);
+  return arena;
+}
+
+void CoroutineArena::release(CoroutineArena* arena) {
+  auto& registry = Registry::getInstance();
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(registry.lock);
+  registry.freeArenas.push_back(arena);
+}
+
+CoroutineArena* CoroutineArena::getDefaultArena() {
+  static CoroutineArena* arena = acquire();
+  return arena;
+}
+
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+CoroutineArena*& CoroutineArena::threadArena() {
+  static thread_local CoroutineArena* arena = nullptr;
+  return arena;
+}
+
+void CoroutineArena::setThreadArena(CoroutineArena* arena) {
+  threadArena() = arena;
+}
+
+void* CoroutineArena::allocate(std::size_t size) {
+  CoroutineArena* arena = threadArena();
+  if(arena == nullptr) {
+    arena = getDefaultArena();
+  }
+  return arena->obtain(size);
+}
+#else
+CoroutineArena*& CoroutineArena::threadArena() {
+  static CoroutineArena* arena = nullptr;
+  return arena;
+}
+
+void CoroutineArena::setThreadArena(CoroutineArena* arena) {
+  (void)arena;
+}
+
+void* CoroutineArena::allocate(std::size_t size) {
+  return getDefaultArena()->obtain(size);
+}
+#endif
+
+void CoroutineArena::deallocate(void* ptr, std::size_t size) {
+  if(size > MAX_ENTRY_SIZE) {
+    ::operator delete(ptr);
+  } else {
+    oatpp::base::memory::MemoryPool::free(ptr);
+  }
+}
+
+CoroutineArena::Stats CoroutineArena::getTotalStats() {
+  Stats result = {0, 0};
+  auto& registry = Registry::getInstance();
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(registry.lock);
+  for(auto arena : registry.arenas) {
+    auto stats = arena->getStats();
+    result.allocations += stats.allocations;
+    result.heapAllocations += stats.heapAllocations;
+  }
+  return result;
+}
+
+}}
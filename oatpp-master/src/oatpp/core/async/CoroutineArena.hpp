@@ -0,0 +1,163 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_CoroutineArena_hpp
+#define oatpp_async_CoroutineArena_hpp
+
+#include "oatpp/core/base/memory/MemoryPool.hpp"
+
+#include <atomic>
+#include <string>
+
+namespace oatpp { namespace async {
+
+/**
+ * Size-class memory arena for coroutines and coroutine submissions. <br>
+ * Each &id:oatpp::async::Processor; owns one arena, so coroutines created on processor thread are allocated
+ * without taking locks shared with other processors. Arenas consist of &id:oatpp::base::memory::MemoryPool;s,
+ * so memory can be freed from any thread - it goes back to the pool it was obtained from. <br>
+ * Arenas are never destroyed - not even at program exit, since coroutines may be freed during static destruction.
+ * When processor is destroyed its arena is returned to the registry and is reused by the next processor.
+ */
+class CoroutineArena {
+public:
+
+  /**
+   * Number of size classes. Size classes are 64, 128, ..., 4096 bytes.
+   */
+  static constexpr v_int32 SIZE_CLASSES_COUNT = 7;
+
+  /**
+   * Smallest size class in bytes.
+   */
+  static constexpr v_int32 MIN_ENTRY_SIZE = 64;
+
+  /**
+   * Largest size class in bytes. Bigger objects are allocated with global `operator new`.
+   */
+  static constexpr v_int32 MAX_ENTRY_SIZE = MIN_ENTRY_SIZE << (SIZE_CLASSES_COUNT - 1);
+
+  /**
+   * Approximate memory size of one chunk of each size class pool.
+   */
+  static constexpr v_int32 CHUNK_MEMORY_SIZE = 16 * 1024;
+
+public:
+
+  /**
+   * Arena statistics.
+   */
+  struct Stats {
+
+    /**
+     * Number of allocations served.
+     */
+    v_int64 allocations;
+
+    /**
+     * Number of allocations which went to heap - pool chunk allocations plus objects bigger than &l:CoroutineArena::MAX_ENTRY_SIZE;.
+     */
+    v_int64 heapAllocations;
+
+  };
+
+private:
+  static CoroutineArena* getDefaultArena();
+  static CoroutineArena*& threadArena();
+  static v_int32 getSizeClass(std::size_t size);
+private:
+  oatpp::base::memory::MemoryPool* m_pools[SIZE_CLASSES_COUNT];
+  std::atomic<v_int64> m_allocations;
+  std::atomic<v_int64> m_oversizedAllocations;
+private:
+  void* obtain(std::size_t size);
+public:
+
+  /**
+   * Constructor.
+   * @param name - arena name. Used as a prefix for names of memory pools.
+   */
+  CoroutineArena(const std::string& name);
+
+  /**
+   * Deleted copy-constructor.
+   */
+  CoroutineArena(const CoroutineArena&) = delete;
+
+  /**
+   * Non-virtual destructor.
+   */
+  ~CoroutineArena();
+
+  /**
+   * Get arena statistics.
+   * @return - &l:CoroutineArena::Stats;.
+   */
+  Stats getStats();
+
+public:
+
+  /**
+   * Take unused arena from registry or create a new one.
+   * @return - pointer to &l:CoroutineArena;.
+   */
+  static CoroutineArena* acquire();
+
+  /**
+   * Return arena to registry.
+   * @param arena - arena previously obtained by &l:CoroutineArena::acquire ();.
+   */
+  static void release(CoroutineArena* arena);
+
+  /**
+   * Set arena used for allocations made on the current thread.
+   * @param arena - arena or `nullptr` to use default arena shared by threads which are not processors.
+   */
+  static void setThreadArena(CoroutineArena* arena);
+
+  /**
+   * Allocate memory in the arena of the current thread.
+   * @param size - size in bytes.
+   * @return - pointer to allocated memory.
+   */
+  static void* allocate(std::size_t size);
+
+  /**
+   * Free memory allocated by &l:CoroutineArena::allocate ();. Can be called from any thread.
+   * @param ptr - pointer to memory.
+   * @param size - the same size which was passed to &l:CoroutineArena::allocate ();.
+   */
+  static void deallocate(void* ptr, std::size_t size);
+
+  /**
+   * Get statistics summed for all arenas ever created.
+   * @return - &l:CoroutineArena::Stats;.
+   */
+  static Stats getTotalStats();
+
+};
+
+}}
+
+#endif // oatpp_async_CoroutineArena_hpp
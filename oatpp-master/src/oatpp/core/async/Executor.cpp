@@ -24,16 +24,20 @@
 
 #include "Executor.hpp"
 #include "oatpp/core/async/worker/IOEventWorker.hpp"
+#include "oatpp/core/async/worker/IOUringWorker.hpp"
 #include "oatpp/core/async/worker/IOWorker.hpp"
 #include "oatpp/core/async/worker/TimerWorker.hpp"
 
+#include <algorithm>
+
 namespace oatpp { namespace async {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Executor::SubmissionProcessor
 
-Executor::SubmissionProcessor::SubmissionProcessor()
+Executor::SubmissionProcessor::SubmissionProcessor(Executor* stealGroup)
   : worker::Worker(worker::Worker::Type::PROCESSOR)
+  , m_stealGroup(stealGroup)
   , m_isRunning(true)
 {
   m_thread = std::thread(&Executor::SubmissionProcessor::run, this);
@@ -45,9 +49,26 @@ oatpp::async::Processor& Executor::SubmissionProcessor::getProcessor() {
 
 void Executor::SubmissionProcessor::run() {
   
+  std::chrono::microseconds stealInterval = STEAL_INTERVAL;
+
   while(m_isRunning) {
-    m_processor.waitForTasks();
+
+    if(m_stealGroup == nullptr) {
+      m_processor.waitForTasks();
+    } else if(!m_processor.waitForTasks(stealInterval)) {
+      if(m_stealGroup->stealTasks(m_processor)) {
+        stealInterval = STEAL_INTERVAL;
+      } else if(stealInterval < STEAL_INTERVAL_MAX) {
+        /* Nothing to steal - back off so that idle processors don't spin */
+        stealInterval = std::min(stealInterval * 2, STEAL_INTERVAL_MAX);
+      }
+      continue;
+    }
+
+    stealInterval = STEAL_INTERVAL;
+
     while (m_processor.iterate(100)) {}
+
   }
   
 }
@@ -79,21 +100,41 @@ void Executor::SubmissionProcessor::detach() {
 // Executor
 
 const v_int32 Executor::THREAD_NUM_DEFAULT = OATPP_ASYNC_EXECUTOR_THREAD_NUM_DEFAULT;
-
-Executor::Executor(v_int32 processorWorkersCount, v_int32 ioWorkersCount, v_int32 timerWorkersCount, bool useIOEventWorker)
+const std::chrono::microseconds Executor::STEAL_INTERVAL = std::chrono::microseconds(1000);
+const std::chrono::microseconds Executor::STEAL_INTERVAL_MAX = std::chrono::microseconds(100 * 1000);
+
+Executor::Executor(v_int32 processorWorkersCount,
+                   v_int32 ioWorkersCount,
+                   v_int32 timerWorkersCount,
+                   v_int32 ioWorkerType,
+                   bool useWorkStealing,
+                   v_int32 timerWorkerType)
   : m_balancer(0)
+  , m_stealGroupReady(false)
 {
 
+  Executor* stealGroup = (useWorkStealing && processorWorkersCount > 1) ? this : nullptr;
+
   for(v_int32 i = 0; i < processorWorkersCount; i ++) {
-    m_processorWorkers.push_back(std::make_shared<SubmissionProcessor>());
+    m_processorWorkers.push_back(std::make_shared<SubmissionProcessor>(stealGroup));
   }
 
   m_allWorkers.insert(m_allWorkers.end(), m_processorWorkers.begin(), m_processorWorkers.end());
 
+  if(ioWorkerType == IO_WORKER_TYPE_URING && !worker::IOUringWorker::isSupported()) {
+    OATPP_LOGW("[oatpp::async::Executor::Executor()]", "io_uring is not supported. Falling back to IOEventWorker.");
+    ioWorkerType = IO_WORKER_TYPE_EVENT;
+  }
+
   std::vector<std::shared_ptr<worker::Worker>> ioWorkers;
-  if(useIOEventWorker) {
+  if(ioWorkerType == IO_WORKER_TYPE_URING) {
+    for (v_int32 i = 0; i < ioWorkersCount; i++) {
+      ioWorkers.push_back(std::make_shared<worker::IOUringWorker>());
+    }
+  } else if(ioWorkerType == IO_WORKER_TYPE_EVENT || ioWorkerType == IO_WORKER_TYPE_EVENT_PERSISTENT) {
+    bool persistent = (ioWorkerType == IO_WORKER_TYPE_EVENT_PERSISTENT);
     for (v_int32 i = 0; i < ioWorkersCount; i++) {
-      ioWorkers.push_back(std::make_shared<worker::IOEventWorkerForeman>());
+      ioWorkers.push_back(std::make_shared<worker::IOEventWorkerForeman>(persistent));
     }
   } else {
     for (v_int32 i = 0; i < ioWorkersCount; i++) {
@@ -103,13 +144,19 @@ Executor::Executor(v_int32 processorWorkersCount, v_int32 ioWorkersCount, v_int3
 
   linkWorkers(ioWorkers);
 
+  worker::TimerWorker::Backend timerBackend = (timerWorkerType == TIMER_WORKER_TYPE_MIN_HEAP) ?
+                                              worker::TimerWorker::Backend::MIN_HEAP :
+                                              worker::TimerWorker::Backend::LINEAR_SCAN;
+
   std::vector<std::shared_ptr<worker::Worker>> timerWorkers;
   for(v_int32 i = 0; i < timerWorkersCount; i++) {
-    timerWorkers.push_back(std::make_shared<worker::TimerWorker>());
+    timerWorkers.push_back(std::make_shared<worker::TimerWorker>(std::chrono::milliseconds(100), timerBackend));
   }
 
   linkWorkers(timerWorkers);
 
+  m_stealGroupReady = true;
+
 }
 
 Executor::~Executor() {
@@ -154,6 +201,34 @@ void Executor::linkWorkers(const std::vector<std::shared_ptr<worker::Worker>>& w
 
 }
 
+bool Executor::stealTasks(Processor& thief) {
+
+  if(!m_stealGroupReady) {
+    return false;
+  }
+
+  Processor* victim = nullptr;
+  v_int32 victimTasks = 1;
+
+  for(auto& worker : m_processorWorkers) {
+    auto& processor = worker->getProcessor();
+    v_int32 tasks = processor.getRunnableCount();
+    if(&processor != &thief && tasks > victimTasks) {
+      victim = &processor;
+      victimTasks = tasks;
+    }
+  }
+
+  if(victim == nullptr) {
+    return false;
+  }
+
+  /* Even if nothing was stolen right now, victim was asked to donate tasks - retry soon */
+  thief.stealTasks(*victim);
+  return true;
+
+}
+
 void Executor::join() {
   for(auto& worker : m_allWorkers) {
     worker->join();
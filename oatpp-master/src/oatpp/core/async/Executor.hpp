@@ -51,11 +51,12 @@ private:
   private:
     oatpp::async::Processor m_processor;
   private:
+    Executor* m_stealGroup;
     bool m_isRunning;
   private:
     std::thread m_thread;
   public:
-    SubmissionProcessor();
+    SubmissionProcessor(Executor* stealGroup);
   public:
 
     template<typename CoroutineType, typename ... Args>
@@ -84,29 +85,81 @@ public:
    * Default number of threads to run coroutines.
    */
   static const v_int32 THREAD_NUM_DEFAULT;
+
+  /**
+   * Use &id:oatpp::async::worker::IOWorker; for I/O.
+   */
+  static constexpr const v_int32 IO_WORKER_TYPE_NAIVE = 0;
+
+  /**
+   * Use &id:oatpp::async::worker::IOEventWorker; for I/O. I/O handles are re-armed on every wait.
+   */
+  static constexpr const v_int32 IO_WORKER_TYPE_EVENT = 1;
+
+  /**
+   * Use &id:oatpp::async::worker::IOEventWorker; for I/O. I/O handles are kept registered in the event queue (edge-triggered).
+   * Falls back to &l:Executor::IO_WORKER_TYPE_EVENT; where persistent mode is not supported.
+   */
+  static constexpr const v_int32 IO_WORKER_TYPE_EVENT_PERSISTENT = 2;
+
+  /**
+   * Use &id:oatpp::async::worker::IOUringWorker; for I/O.
+   * Falls back to &l:Executor::IO_WORKER_TYPE_EVENT; if `io_uring` is not available.
+   */
+  static constexpr const v_int32 IO_WORKER_TYPE_URING = 3;
+
+  /**
+   * Use &id:oatpp::async::worker::TimerWorker; with &id:oatpp::async::worker::TimerWorker::Backend::LINEAR_SCAN; timer queue.
+   */
+  static constexpr const v_int32 TIMER_WORKER_TYPE_LINEAR_SCAN = 0;
+
+  /**
+   * Use &id:oatpp::async::worker::TimerWorker; with &id:oatpp::async::worker::TimerWorker::Backend::MIN_HEAP; timer queue.
+   */
+  static constexpr const v_int32 TIMER_WORKER_TYPE_MIN_HEAP = 1;
+
+  /**
+   * How long idle processor sleeps between attempts to steal tasks from peers when work-stealing is enabled.
+   */
+  static const std::chrono::microseconds STEAL_INTERVAL;
+
+  /**
+   * Maximum sleep of idle processor between attempts to steal tasks. <br>
+   * While there is nothing to steal the sleep interval doubles from &l:Executor::STEAL_INTERVAL; up to this value.
+   */
+  static const std::chrono::microseconds STEAL_INTERVAL_MAX;
 private:
   std::atomic<v_word32> m_balancer;
+  std::atomic<bool> m_stealGroupReady;
 private:
   std::vector<std::shared_ptr<SubmissionProcessor>> m_processorWorkers;
   std::vector<std::shared_ptr<worker::Worker>> m_allWorkers;
 private:
   void linkWorkers(const std::vector<std::shared_ptr<worker::Worker>>& workers);
+  bool stealTasks(Processor& thief);
 public:
 
   /**
    * Constructor.
    * @param processorWorkersCount - number of data processing workers.
-   * @param ioWorkersCount - number of I/O processing workers.
+   * @param ioWorkersCount - number of I/O processing workers. Each has its own event queue.
+   * I/O handles are pinned to a worker by hash.
    * @param timerWorkersCount - number of timer processing workers.
+   * @param ioWorkerType - one of &l:Executor::IO_WORKER_TYPE_NAIVE;, &l:Executor::IO_WORKER_TYPE_EVENT;,
+   * &l:Executor::IO_WORKER_TYPE_EVENT_PERSISTENT;, &l:Executor::IO_WORKER_TYPE_URING;.
+   * @param useWorkStealing - let idle processors steal ready coroutines from busy ones.
+   * @param timerWorkerType - one of &l:Executor::TIMER_WORKER_TYPE_LINEAR_SCAN;, &l:Executor::TIMER_WORKER_TYPE_MIN_HEAP;.
    */
   Executor(v_int32 processorWorkersCount = THREAD_NUM_DEFAULT,
            v_int32 ioWorkersCount = 1,
            v_int32 timerWorkersCount = 1,
 #if defined(WIN32) || defined(_WIN32)
-           bool useIOEventWorker = false
+           v_int32 ioWorkerType = IO_WORKER_TYPE_NAIVE,
 #else
-           bool useIOEventWorker = true
+           v_int32 ioWorkerType = IO_WORKER_TYPE_EVENT,
 #endif
+           bool useWorkStealing = false,
+           v_int32 timerWorkerType = TIMER_WORKER_TYPE_LINEAR_SCAN
           );
 
   /**
@@ -28,6 +28,21 @@
 
 namespace oatpp { namespace async {
 
+Processor::Processor()
+  : m_sleeping(false)
+  , m_arena(CoroutineArena::acquire())
+  , m_stealRequested(false)
+  , m_running(true)
+  , m_tasksCounter(0)
+  , m_submissionsCounter(0)
+  , m_readyCounter(0)
+{}
+
+Processor::~Processor() {
+  m_queue.clear();
+  CoroutineArena::release(m_arena);
+}
+
 void Processor::addWorker(const std::shared_ptr<worker::Worker>& worker) {
 
   switch(worker->getType()) {
@@ -51,9 +66,10 @@ void Processor::addWorker(const std::shared_ptr<worker::Worker>& worker) {
 
 void Processor::popIOTask(AbstractCoroutine* coroutine) {
   if(m_ioPopQueues.size() > 0) {
-    auto &queue = m_ioPopQueues[(++m_ioBalancer) % m_ioPopQueues.size()];
+    // Pin I/O handle to the same worker so that event-based workers keep their registrations warm.
+    auto handleHash = static_cast<v_word64>(coroutine->_SCH_A.getIOHandle());
+    auto &queue = m_ioPopQueues[handleHash % m_ioPopQueues.size()];
     queue.pushBack(coroutine);
-    //m_ioWorkers[(++m_ioBalancer) % m_ioWorkers.size()]->pushOneTask(coroutine);
   } else {
     throw std::runtime_error("[oatpp::async::Processor::popIOTasks()]: Error. Processor has no I/O workers.");
   }
@@ -111,26 +127,121 @@ void Processor::addCoroutine(AbstractCoroutine* coroutine) {
 }
 
 void Processor::pushOneTask(AbstractCoroutine* coroutine) {
-  {
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-    m_pushList.pushBack(coroutine);
-  }
-  m_taskCondition.notify_one();
+  m_pushQueue.push(coroutine);
+  wakeUp();
 }
 
 void Processor::pushTasks(oatpp::collection::FastQueue<AbstractCoroutine>& tasks) {
-  {
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-    collection::FastQueue<AbstractCoroutine>::moveAll(tasks, m_pushList);
+  m_pushQueue.pushAll(tasks);
+  wakeUp();
+}
+
+bool Processor::hasIncomingTasks() const {
+  return !m_taskQueue.empty() || !m_pushQueue.empty() || !m_stealQueue.empty();
+}
+
+void Processor::wakeUp() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if(m_sleeping.load(std::memory_order_relaxed)) {
+    std::lock_guard<std::mutex> lock(m_sleepMutex);
+    m_sleepCondition.notify_one();
   }
-  m_taskCondition.notify_one();
 }
 
 void Processor::waitForTasks() {
 
-  std::unique_lock<oatpp::concurrency::SpinLock> lock(m_taskLock);
-  while (m_pushList.first == nullptr && m_taskList.empty() && m_running) {
-    m_taskCondition.wait(lock);
+  std::unique_lock<std::mutex> lock(m_sleepMutex);
+  m_sleeping.store(true, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  while (!hasIncomingTasks() && m_running) {
+    m_sleepCondition.wait(lock);
+  }
+  m_sleeping.store(false, std::memory_order_relaxed);
+
+}
+
+bool Processor::waitForTasks(const std::chrono::duration<v_int64, std::micro>& timeout) {
+
+  std::unique_lock<std::mutex> lock(m_sleepMutex);
+  m_sleeping.store(true, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  bool result = m_sleepCondition.wait_for(lock, timeout, [this] {
+    return hasIncomingTasks() || !m_running;
+  });
+  m_sleeping.store(false, std::memory_order_relaxed);
+  return result;
+
+}
+
+v_int32 Processor::stealTasks(Processor& victim) {
+
+  if(&victim == this) {
+    return 0;
+  }
+
+  oatpp::collection::FastQueue<TaskSubmission> submissions;
+  oatpp::collection::FastQueue<AbstractCoroutine> stolen;
+  oatpp::collection::FastQueue<AbstractCoroutine> returned;
+
+  /* Take whole queues - splitting them would put part of the tasks behind the newer ones */
+
+  victim.m_stealQueue.popAll(stolen);
+  victim.m_pushQueue.popAll(returned);
+  victim.m_taskQueue.popAll(submissions);
+
+  oatpp::collection::FastQueue<AbstractCoroutine>::moveAll(returned, stolen);
+
+  if(stolen.first == nullptr && submissions.first == nullptr) {
+    victim.m_stealRequested = true;
+    return 0;
+  }
+
+  v_int32 count = stolen.count + submissions.count;
+
+  auto curr = stolen.first;
+  while(curr != nullptr) {
+    curr->_PP = this;
+    curr = curr->_ref;
+  }
+
+  m_tasksCounter += count;
+  victim.m_tasksCounter -= count;
+  m_submissionsCounter += submissions.count;
+  victim.m_submissionsCounter -= submissions.count;
+
+  m_taskQueue.pushAll(submissions);
+  m_pushQueue.pushAll(stolen);
+  wakeUp();
+
+  return count;
+
+}
+
+void Processor::donateTasks() {
+
+  m_stealRequested = false;
+
+  /* Donate the newer half of ready coroutines, so that the older ones keep running here first */
+
+  v_int32 keep = m_queue.count - m_queue.count / 2;
+  if(keep < m_queue.count) {
+
+    auto lastKept = m_queue.first;
+    for(v_int32 i = 1; i < keep; i ++) {
+      lastKept = lastKept->_ref;
+    }
+
+    oatpp::collection::FastQueue<AbstractCoroutine> donated;
+    donated.first = lastKept->_ref;
+    donated.last = m_queue.last;
+    donated.count = m_queue.count - keep;
+
+    lastKept->_ref = nullptr;
+    m_queue.last = lastKept;
+    m_queue.count = keep;
+
+    m_stealQueue.pushAll(donated);
+
   }
 
 }
@@ -152,50 +263,39 @@ void Processor::popTasks() {
 }
 
 void Processor::consumeAllTasks() {
-  for(auto& submission : m_taskList) {
+  oatpp::collection::FastQueue<TaskSubmission> submissions;
+  m_submissionsCounter -= m_taskQueue.popAll(submissions);
+  while(submissions.first != nullptr) {
+    std::unique_ptr<TaskSubmission> submission(submissions.popFront());
     auto coroutine = submission->createCoroutine();
     coroutine->_PP = this;
     m_queue.pushBack(coroutine);
   }
-  m_taskList.clear();
 }
 
 void Processor::pushQueues() {
 
-  static constexpr v_int32 MAX_BATCH_SIZE = 1000;
-
-  if(!m_taskList.empty()) {
-    if (m_taskList.size() < MAX_BATCH_SIZE && m_queue.first != nullptr) {
-      std::unique_lock<oatpp::concurrency::SpinLock> lock(m_taskLock, std::try_to_lock);
-      if (lock.owns_lock()) {
-        consumeAllTasks();
-      }
-    } else {
-      std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-      consumeAllTasks();
-    }
+  if(!m_stealQueue.empty() && (m_queue.first == nullptr || !m_taskQueue.empty() || !m_pushQueue.empty())) {
+    /* Nobody took donated coroutines. Take them back before newer tasks arrive to keep the order. */
+    m_stealQueue.popAll(m_queue);
   }
 
-  if(m_pushList.first != nullptr) {
-    if (m_pushList.count < MAX_BATCH_SIZE && m_queue.first != nullptr) {
-      std::unique_lock<oatpp::concurrency::SpinLock> lock(m_taskLock, std::try_to_lock);
-      if (lock.owns_lock()) {
-        while(m_pushList.first != nullptr) {
-          addCoroutine(m_pushList.popFront());
-        }
-      }
-    } else {
-      std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-      while(m_pushList.first != nullptr) {
-        addCoroutine(m_pushList.popFront());
-      }
-    }
+  consumeAllTasks();
+
+  oatpp::collection::FastQueue<AbstractCoroutine> returned;
+  m_pushQueue.popAll(returned);
+  while(returned.first != nullptr) {
+    addCoroutine(returned.popFront());
   }
 
+  m_readyCounter.store(m_queue.count, std::memory_order_relaxed);
+
 }
 
 bool Processor::iterate(v_int32 numIterations) {
 
+  CoroutineArena::setThreadArena(m_arena);
+
   pushQueues();
 
   for(v_int32 i = 0; i < numIterations; i++) {
@@ -255,22 +355,30 @@ bool Processor::iterate(v_int32 numIterations) {
 
   end_loop:
 
+  if(m_stealRequested) {
+    donateTasks();
+  }
+
+  m_readyCounter.store(m_queue.count, std::memory_order_relaxed);
+
   popTasks();
   
-  return m_queue.first != nullptr || m_pushList.first != nullptr || !m_taskList.empty();
+  return m_queue.first != nullptr || hasIncomingTasks();
   
 }
 
 void Processor::stop() {
-  {
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-    m_running = false;
-  }
-  m_taskCondition.notify_one();
+  m_running = false;
+  std::lock_guard<std::mutex> lock(m_sleepMutex);
+  m_sleepCondition.notify_one();
 }
 
 v_int32 Processor::getTasksCount() {
   return m_tasksCounter.load();
 }
 
+v_int32 Processor::getRunnableCount() {
+  return m_submissionsCounter.load(std::memory_order_relaxed) + m_readyCounter.load(std::memory_order_relaxed);
+}
+
 }}
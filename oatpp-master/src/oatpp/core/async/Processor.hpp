@@ -26,10 +26,10 @@
 #define oatpp_async_Processor_hpp
 
 #include "./Coroutine.hpp"
+#include "oatpp/core/collection/MPSCQueue.hpp"
 #include "oatpp/core/collection/FastQueue.hpp"
 
 #include <mutex>
-#include <list>
 #include <vector>
 #include <condition_variable>
 
@@ -44,6 +44,8 @@ class Processor {
 private:
 
   class TaskSubmission {
+  public:
+    TaskSubmission* _ref = nullptr;
   public:
     virtual ~TaskSubmission() {};
     virtual AbstractCoroutine* createCoroutine() = 0;
@@ -73,6 +75,14 @@ private:
       : m_params(std::make_tuple(params...))
     {}
 
+    static void* operator new(std::size_t sz) {
+      return CoroutineArena::allocate(sz);
+    }
+
+    static void operator delete(void* ptr, std::size_t sz) {
+      CoroutineArena::deallocate(ptr, sz);
+    }
+
     virtual AbstractCoroutine* createCoroutine() {
       return creator(typename SequenceGenerator<sizeof...(Args)>::type());
     }
@@ -92,25 +102,48 @@ private:
   std::vector<oatpp::collection::FastQueue<AbstractCoroutine>> m_ioPopQueues;
   std::vector<oatpp::collection::FastQueue<AbstractCoroutine>> m_timerPopQueues;
 
-  v_word32 m_ioBalancer = 0;
   v_word32 m_timerBalancer = 0;
 
 private:
 
-  oatpp::concurrency::SpinLock m_taskLock;
-  std::condition_variable_any m_taskCondition;
-  std::list<std::shared_ptr<TaskSubmission>> m_taskList;
-  oatpp::collection::FastQueue<AbstractCoroutine> m_pushList;
+  oatpp::collection::MPSCQueue<TaskSubmission> m_taskQueue;
+  oatpp::collection::MPSCQueue<AbstractCoroutine> m_pushQueue;
 
 private:
 
+  /*
+   * Parking of idle processor.
+   * Producers take m_sleepMutex only if processor announced that it is going to sleep.
+   */
+  std::atomic<bool> m_sleeping;
+  std::mutex m_sleepMutex;
+  std::condition_variable m_sleepCondition;
+
+private:
+
+  CoroutineArena* m_arena;
   oatpp::collection::FastQueue<AbstractCoroutine> m_queue;
 
 private:
 
-  bool m_running = true;
+  /*
+   * Ready coroutines donated by this processor to idle peers.
+   */
+  oatpp::collection::MPSCQueue<AbstractCoroutine> m_stealQueue;
+  std::atomic<bool> m_stealRequested;
+
+private:
+
+  std::atomic<bool> m_running;
   std::atomic<v_int32> m_tasksCounter;
 
+  /*
+   * Runnable tasks - not yet consumed submissions and ready coroutines (as of the last iteration).
+   * Tasks parked on I/O and timers are not counted.
+   */
+  std::atomic<v_int32> m_submissionsCounter;
+  std::atomic<v_int32> m_readyCounter;
+
 private:
 
   void popIOTask(AbstractCoroutine* coroutine);
@@ -120,13 +153,22 @@ private:
   void addCoroutine(AbstractCoroutine* coroutine);
   void popTasks();
   void pushQueues();
+  void donateTasks();
+
+  bool hasIncomingTasks() const;
+  void wakeUp();
 
 public:
 
-  Processor()
-    : m_running(true)
-    , m_tasksCounter(0)
-  {}
+  /**
+   * Constructor.
+   */
+  Processor();
+
+  /**
+   * Non-virtual destructor.
+   */
+  ~Processor();
 
   /**
    * Add dedicated co-worker to processor.
@@ -154,11 +196,11 @@ public:
    */
   template<typename CoroutineType, typename ... Args>
   void execute(Args... params) {
-    auto submission = std::make_shared<SubmissionTemplate<CoroutineType, Args...>>(params...);
+    auto submission = new SubmissionTemplate<CoroutineType, Args...>(params...);
     ++ m_tasksCounter;
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_taskLock);
-    m_taskList.push_back(submission);
-    m_taskCondition.notify_one();
+    ++ m_submissionsCounter;
+    m_taskQueue.push(submission);
+    wakeUp();
   }
 
   /**
@@ -166,6 +208,23 @@ public:
    */
   void waitForTasks();
 
+  /**
+   * Sleep and wait for tasks not longer than timeout.
+   * @param timeout - maximum time to wait.
+   * @return - `true` if there are tasks to process. `false` on timeout.
+   */
+  bool waitForTasks(const std::chrono::duration<v_int64, std::micro>& timeout);
+
+  /**
+   * Steal tasks from other processor. <br>
+   * Takes all of victim's pending submissions and returned coroutines, and all coroutines donated by victim,
+   * keeping their order. Stolen coroutines are re-assigned to this processor, so I/O and timer workers push them back here.
+   * If there is nothing to steal, victim is asked to donate the newer half of its ready coroutines on its next iteration.
+   * @param victim - processor to steal tasks from.
+   * @return - number of stolen tasks.
+   */
+  v_int32 stealTasks(Processor& victim);
+
   /**
    * Iterate Coroutines.
    * @param numIterations - number of iterations.
@@ -184,6 +243,13 @@ public:
    */
   v_int32 getTasksCount();
 
+  /**
+   * Get number of tasks which are ready to run - pending submissions and ready coroutines. <br>
+   * Tasks waiting for I/O or timers are not counted. The value is updated on each iteration, so it is approximate.
+   * @return - number of runnable tasks.
+   */
+  v_int32 getRunnableCount();
+
   
 };
   
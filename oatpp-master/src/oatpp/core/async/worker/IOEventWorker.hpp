@@ -30,6 +30,7 @@
 
 #include <thread>
 #include <mutex>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -71,9 +72,20 @@ class IOEventWorkerForeman; // FWD
 class IOEventWorker : public Worker {
 private:
   static constexpr const v_int32 MAX_EVENTS = 10000;
+private:
+
+  /**
+   * State of the I/O handle registered in persistent mode.
+   */
+  struct HandleState {
+    AbstractCoroutine* waiter = nullptr;
+    bool ready = false;
+  };
+
 private:
   IOEventWorkerForeman* m_foreman;
   Action::IOEventType m_specialization;
+  bool m_persistent;
   bool m_running;
   oatpp::collection::FastQueue<AbstractCoroutine> m_backlog;
   oatpp::concurrency::SpinLock m_backlogLock;
@@ -84,6 +96,10 @@ private:
   v_int32 m_inEventsCount;
   v_int32 m_inEventsCapacity;
   std::unique_ptr<v_char8[]> m_outEvents;
+private:
+  std::vector<HandleState> m_handleStates;
+  std::vector<oatpp::data::v_io_handle> m_releasedHandles;
+  oatpp::collection::FastQueue<AbstractCoroutine> m_readyQueue;
 private:
   std::thread m_thread;
 private:
@@ -94,12 +110,27 @@ private:
   void triggerWakeup();
   void setTriggerEvent(p_char8 eventPtr);
   void setCoroutineEvent(AbstractCoroutine* coroutine, int operation, p_char8 eventPtr);
+#if defined(OATPP_IO_EVENT_INTERFACE_EPOLL)
+private:
+  HandleState& registerHandle(oatpp::data::v_io_handle handle);
+  void parkCoroutine(AbstractCoroutine* coroutine, HandleState& state);
+  void unregisterPersistent();
+  void wakeReleasedHandles();
+  void consumeBacklogPersistent();
+  void waitEventsPersistent();
+#endif
 public:
 
   /**
    * Constructor.
+   * @param foreman - &l:IOEventWorkerForeman;.
+   * @param specialization - &id:oatpp::async::Action::IOEventType; this worker is responsible for.
+   * @param persistent - keep I/O handles registered in the event queue (edge-triggered) instead of re-arming
+   * them on every wait. Only supported by the `epoll` implementation, ignored otherwise. <br>
+   * In this mode coroutine must return `IO_WAIT` only after the I/O operation reported `WAIT_RETRY`
+   * (which is the contract of `suggestInputStreamAction()` / `suggestOutputStreamAction()`).
    */
-  IOEventWorker(IOEventWorkerForeman* foreman, Action::IOEventType specialization);
+  IOEventWorker(IOEventWorkerForeman* foreman, Action::IOEventType specialization, bool persistent = false);
 
   /**
    * Virtual destructor.
@@ -123,6 +154,16 @@ public:
    */
   void run();
 
+  /**
+   * Remove I/O handle from the event queues of all persistent workers and wake up coroutines waiting on it. <br>
+   * Must be called before the handle is closed - kernel drops closed handles from the event queue silently,
+   * so a coroutine waiting on the handle would never be resumed. <br>
+   * Woken coroutines repeat their I/O operation, so the owner of the handle has to report an error for it from now on.
+   * Does nothing if persistent mode is not supported.
+   * @param handle - I/O handle which is about to be closed.
+   */
+  static void releaseHandle(oatpp::data::v_io_handle handle);
+
   /**
    * Break run loop.
    */
@@ -152,8 +193,9 @@ public:
 
   /**
    * Constructor.
+   * @param persistent - keep I/O handles registered in the event queue. See See &l:IOEventWorker::IOEventWorker ();.l:IOEventWorker;.
    */
-  IOEventWorkerForeman();
+  IOEventWorkerForeman(bool persistent = false);
 
   /**
    * Virtual destructor.
@@ -35,10 +35,11 @@ namespace oatpp { namespace async { namespace worker {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // IOEventWorker
 
-IOEventWorker::IOEventWorker(IOEventWorkerForeman* foreman, Action::IOEventType specialization)
+IOEventWorker::IOEventWorker(IOEventWorkerForeman* foreman, Action::IOEventType specialization, bool persistent)
   : Worker(Type::IO)
   , m_foreman(foreman)
   , m_specialization(specialization)
+  , m_persistent(persistent)
   , m_running(true)
   , m_eventQueueHandle(-1)
   , m_wakeupTrigger(-1)
@@ -52,6 +53,9 @@ IOEventWorker::IOEventWorker(IOEventWorkerForeman* foreman, Action::IOEventType
 
 
 IOEventWorker::~IOEventWorker() {
+#if defined(OATPP_IO_EVENT_INTERFACE_EPOLL)
+  unregisterPersistent();
+#endif
 #if !defined(WIN32) && !defined(_WIN32)
   if(m_eventQueueHandle >=0) {
     ::close(m_eventQueueHandle);
@@ -112,10 +116,10 @@ void IOEventWorker::detach() {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // IOEventWorkerForeman
 
-IOEventWorkerForeman::IOEventWorkerForeman()
+IOEventWorkerForeman::IOEventWorkerForeman(bool persistent)
   : Worker(Type::IO)
-  , m_reader(this, Action::IOEventType::IO_EVENT_READ)
-  , m_writer(this, Action::IOEventType::IO_EVENT_WRITE)
+  , m_reader(this, Action::IOEventType::IO_EVENT_READ, persistent)
+  , m_writer(this, Action::IOEventType::IO_EVENT_WRITE, persistent)
 {}
 
 IOEventWorkerForeman::~IOEventWorkerForeman() {
@@ -31,12 +31,33 @@
 
 #include "oatpp/core/async/Processor.hpp"
 
+#include <atomic>
+#include <algorithm>
 #include <unistd.h>
 #include <sys/epoll.h>
 #include <sys/eventfd.h>
 
 namespace oatpp { namespace async { namespace worker {
 
+namespace {
+
+/*
+ * Workers running in persistent mode - handles have to be removed from their event queues before close.
+ */
+struct PersistentWorkers {
+  std::mutex mutex;
+  std::vector<IOEventWorker*> workers;
+  std::atomic<v_int32> count{0};
+};
+
+PersistentWorkers& getPersistentWorkers() {
+  // Never destroyed - connections may be closed during static destruction.
+  static PersistentWorkers* workers = new PersistentWorkers();
+  return *workers;
+}
+
+}
+
 void IOEventWorker::initEventQueue() {
 
   m_eventQueueHandle = ::epoll_create1(0);
@@ -64,7 +85,11 @@ void IOEventWorker::initEventQueue() {
   struct epoll_event event;
   std::memset(&event, 0, sizeof(struct epoll_event));
 
-  event.data.ptr = this;
+  if(m_persistent) {
+    event.data.fd = m_wakeupTrigger;
+  } else {
+    event.data.ptr = this;
+  }
 
 #ifdef EPOLLEXCLUSIVE
   event.events = EPOLLIN | EPOLLET | EPOLLEXCLUSIVE;
@@ -78,6 +103,45 @@ void IOEventWorker::initEventQueue() {
     throw std::runtime_error("[oatpp::async::worker::IOEventWorker::initEventQueue()]: Error. Call to ::epoll_ctl() failed.");
   }
 
+  if(m_persistent) {
+    auto& registry = getPersistentWorkers();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.workers.push_back(this);
+    ++ registry.count;
+  }
+
+}
+
+void IOEventWorker::unregisterPersistent() {
+  auto& registry = getPersistentWorkers();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto it = std::find(registry.workers.begin(), registry.workers.end(), this);
+  if(it != registry.workers.end()) {
+    registry.workers.erase(it);
+    -- registry.count;
+  }
+}
+
+void IOEventWorker::releaseHandle(oatpp::data::v_io_handle handle) {
+
+  auto& registry = getPersistentWorkers();
+  if(registry.count == 0) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  for(auto worker : registry.workers) {
+    // ENOENT - handle is not registered with this worker
+    if(epoll_ctl(worker->m_eventQueueHandle, EPOLL_CTL_DEL, handle, nullptr) == 0) {
+      {
+        std::lock_guard<oatpp::concurrency::SpinLock> backlogLock(worker->m_backlogLock);
+        worker->m_releasedHandles.push_back(handle);
+      }
+      worker->triggerWakeup();
+    }
+  }
+
 }
 
 void IOEventWorker::triggerWakeup() {
@@ -133,6 +197,11 @@ void IOEventWorker::setCoroutineEvent(AbstractCoroutine* coroutine, int operatio
 
 void IOEventWorker::consumeBacklog() {
 
+  if(m_persistent) {
+    consumeBacklogPersistent();
+    return;
+  }
+
   std::lock_guard<oatpp::concurrency::SpinLock> lock(m_backlogLock);
 
   auto curr = m_backlog.first;
@@ -149,6 +218,11 @@ void IOEventWorker::consumeBacklog() {
 
 void IOEventWorker::waitEvents() {
 
+  if(m_persistent) {
+    waitEventsPersistent();
+    return;
+  }
+
   struct epoll_event* outEvents = (struct epoll_event*)m_outEvents.get();
   auto eventsCount = epoll_wait(m_eventQueueHandle, outEvents, MAX_EVENTS, -1);
 
@@ -262,6 +336,214 @@ void IOEventWorker::waitEvents() {
 
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Persistent mode.
+// Handle is registered once (edge-triggered, no EPOLLONESHOT) and is never re-armed by the worker.
+// Owner of the handle removes it with IOEventWorker::releaseHandle() before close - this wakes up the parked waiter.
+// Events for handles which have no waiting coroutine are remembered in the HandleState::ready flag.
+
+IOEventWorker::HandleState& IOEventWorker::registerHandle(oatpp::data::v_io_handle handle) {
+
+  if(handle < 0) {
+    throw std::runtime_error("[oatpp::async::worker::IOEventWorker::registerHandle()]: Error. Invalid I/O handle.");
+  }
+
+  if((size_t) handle >= m_handleStates.size()) {
+    m_handleStates.resize(handle + 1);
+  }
+
+  auto& state = m_handleStates[handle];
+
+  struct epoll_event event;
+  std::memset(&event, 0, sizeof(struct epoll_event));
+
+  event.data.fd = handle;
+
+  if(m_specialization == Action::IOEventType::IO_EVENT_READ) {
+    event.events = EPOLLIN | EPOLLET;
+  } else {
+    event.events = EPOLLOUT | EPOLLET;
+  }
+
+  auto res = epoll_ctl(m_eventQueueHandle, EPOLL_CTL_ADD, handle, &event);
+
+  if(res == 0) {
+    // Fresh registration. Handle could be reused after close - drop the stale state.
+    // Current readiness is reported by epoll on EPOLL_CTL_ADD.
+    state.ready = false;
+  } else if(errno == EBADF) {
+    // Handle was closed before the coroutine got here. Let it repeat I/O and get the error.
+    state.ready = true;
+  } else if(errno != EEXIST) {
+    OATPP_LOGE("[oatpp::async::worker::IOEventWorker::registerHandle()]", "Error. Call to epoll_ctl failed. operation=%d, errno=%d", EPOLL_CTL_ADD, errno);
+    throw std::runtime_error("[oatpp::async::worker::IOEventWorker::registerHandle()]: Error. Call to epoll_ctl failed.");
+  }
+
+  return state;
+
+}
+
+void IOEventWorker::parkCoroutine(AbstractCoroutine* coroutine, HandleState& state) {
+
+  if(state.waiter != nullptr && state.waiter != coroutine) {
+    // Handle already has a waiter - it is a stale one (handle was closed and reused),
+    // or it came to this worker from another processor. Let it retry its I/O instead of failing the worker.
+    m_readyQueue.pushBack(state.waiter);
+    state.waiter = nullptr;
+  }
+
+  auto& action = getCoroutineScheduledAction(coroutine);
+
+  if(state.ready || action.getType() == Action::TYPE_IO_REPEAT) {
+    state.ready = false;
+    m_readyQueue.pushBack(coroutine);
+  } else {
+    state.waiter = coroutine;
+  }
+
+}
+
+void IOEventWorker::consumeBacklogPersistent() {
+
+  oatpp::collection::FastQueue<AbstractCoroutine> backlog;
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_backlogLock);
+    oatpp::collection::FastQueue<AbstractCoroutine>::moveAll(m_backlog, backlog);
+  }
+
+  while(backlog.first != nullptr) {
+
+    auto coroutine = backlog.popFront();
+    auto& action = getCoroutineScheduledAction(coroutine);
+
+    switch(action.getType()) {
+
+      case Action::TYPE_IO_WAIT: break;
+      case Action::TYPE_IO_REPEAT: break;
+
+      default:
+        OATPP_LOGE("[oatpp::async::worker::IOEventWorker::consumeBacklogPersistent()]", "Error. Unknown Action. action.getType()==%d", action.getType());
+        throw std::runtime_error("[oatpp::async::worker::IOEventWorker::consumeBacklogPersistent()]: Error. Unknown Action.");
+
+    }
+
+    parkCoroutine(coroutine, registerHandle(action.getIOHandle()));
+
+  }
+
+  wakeReleasedHandles();
+
+}
+
+void IOEventWorker::wakeReleasedHandles() {
+
+  std::vector<oatpp::data::v_io_handle> released;
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_backlogLock);
+    if(m_releasedHandles.empty()) {
+      return;
+    }
+    std::swap(released, m_releasedHandles);
+  }
+
+  for(auto handle : released) {
+    if((size_t) handle < m_handleStates.size()) {
+      auto& state = m_handleStates[handle];
+      if(state.waiter != nullptr) {
+        m_readyQueue.pushBack(state.waiter);
+        state.waiter = nullptr;
+      }
+      state.ready = false;
+    }
+  }
+
+}
+
+void IOEventWorker::waitEventsPersistent() {
+
+  struct epoll_event* outEvents = (struct epoll_event*)m_outEvents.get();
+
+  // do not block if there are coroutines ready to be iterated
+  int timeout = m_readyQueue.first == nullptr ? -1 : 0;
+
+  auto eventsCount = epoll_wait(m_eventQueueHandle, outEvents, MAX_EVENTS, timeout);
+
+  if(eventsCount < 0) {
+    OATPP_LOGE("[oatpp::async::worker::IOEventWorker::waitEventsPersistent()]", "Error. errno=%d", errno);
+    throw std::runtime_error("[oatpp::async::worker::IOEventWorker::waitEventsPersistent()]: Error. Event loop failed.");
+  }
+
+  for(v_int32 i = 0; i < eventsCount; i ++) {
+
+    auto handle = outEvents[i].data.fd;
+
+    if(handle == m_wakeupTrigger) {
+      eventfd_t value;
+      eventfd_read(m_wakeupTrigger, &value);
+    } else {
+      auto& state = m_handleStates[handle];
+      if(state.waiter != nullptr) {
+        m_readyQueue.pushBack(state.waiter);
+        state.waiter = nullptr;
+      } else {
+        state.ready = true;
+      }
+    }
+
+  }
+
+  oatpp::collection::FastQueue<AbstractCoroutine> readyQueue;
+  oatpp::collection::FastQueue<AbstractCoroutine>::moveAll(m_readyQueue, readyQueue);
+
+  oatpp::collection::FastQueue<AbstractCoroutine> popQueue;
+
+  while(readyQueue.first != nullptr) {
+
+    auto coroutine = readyQueue.popFront();
+    auto prevHandle = getCoroutineScheduledAction(coroutine).getIOHandle();
+
+    Action action = coroutine->iterate();
+
+    switch(action.getIOEventCode() | m_specialization) {
+
+      case Action::CODE_IO_WAIT_READ:
+      case Action::CODE_IO_WAIT_WRITE:
+      case Action::CODE_IO_REPEAT_READ:
+      case Action::CODE_IO_REPEAT_WRITE: {
+
+        auto handle = action.getIOHandle();
+        setCoroutineScheduledAction(coroutine, std::move(action));
+
+        if(handle == prevHandle) {
+          parkCoroutine(coroutine, m_handleStates[handle]);
+        } else {
+          parkCoroutine(coroutine, registerHandle(handle));
+        }
+
+        break;
+
+      }
+
+      case Action::CODE_IO_WAIT_RESCHEDULE:
+      case Action::CODE_IO_REPEAT_RESCHEDULE:
+        setCoroutineScheduledAction(coroutine, std::move(action));
+        popQueue.pushBack(coroutine);
+        break;
+
+      default:
+        setCoroutineScheduledAction(coroutine, std::move(action));
+        getCoroutineProcessor(coroutine)->pushOneTask(coroutine);
+
+    }
+
+  }
+
+  if(popQueue.count > 0) {
+    m_foreman->pushTasks(popQueue);
+  }
+
+}
+
 }}}
 
 #endif // #ifdef OATPP_IO_EVENT_INTERFACE_EPOLL
\ No newline at end of file
@@ -234,6 +234,11 @@ void IOEventWorker::waitEvents() {
 
 }
 
+void IOEventWorker::releaseHandle(oatpp::data::v_io_handle handle) {
+  (void) handle;
+  // Handles are re-armed on every wait (EV_ONESHOT) - nothing is kept registered.
+}
+
 }}}
 
 #endif // #ifdef OATPP_IO_EVENT_INTERFACE_KQUEUE
@@ -57,6 +57,11 @@ void IOEventWorker::waitEvents() {
   throw std::runtime_error("[IOEventWorker for Windows OS is NOT IMPLEMENTED! Use IOWorker instead.]");
 }
 
+void IOEventWorker::releaseHandle(oatpp::data::v_io_handle handle) {
+  (void) handle;
+  // DO NOTHING
+}
+
 }}}
 
 #endif // #ifdef OATPP_IO_EVENT_INTERFACE_KQUEUE
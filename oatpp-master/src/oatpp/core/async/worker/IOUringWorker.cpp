@@ -0,0 +1,474 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "IOUringWorker.hpp"
+
+#include "oatpp/core/async/Processor.hpp"
+
+#if defined(OATPP_IO_URING_SUPPORTED)
+
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cstring>
+
+#endif
+
+namespace oatpp { namespace async { namespace worker {
+
+#if defined(OATPP_IO_URING_SUPPORTED)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// IOUringWorker::Ring
+
+namespace {
+
+  /*
+   * user_data of the wakeup-trigger poll request. Coroutine pointers are never null.
+   */
+  constexpr v_word64 WAKEUP_USER_DATA = 0;
+
+  int sys_io_uring_setup(unsigned entries, struct io_uring_params* params) {
+    return (int) ::syscall(__NR_io_uring_setup, entries, params);
+  }
+
+  int sys_io_uring_enter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+    return (int) ::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0);
+  }
+
+}
+
+/*
+ * Raw mapping of the io_uring submission/completion rings.
+ * Only the worker thread touches the ring - the only concurrent party is the kernel.
+ */
+struct IOUringWorker::Ring {
+
+  int fd = -1;
+
+  void* sqRingPtr = MAP_FAILED;
+  size_t sqRingSize = 0;
+  void* cqRingPtr = MAP_FAILED;
+  size_t cqRingSize = 0;
+  struct io_uring_sqe* sqes = (struct io_uring_sqe*) MAP_FAILED;
+  size_t sqesSize = 0;
+
+  unsigned* sqHead = nullptr;
+  unsigned* sqTail = nullptr;
+  unsigned* sqArray = nullptr;
+  unsigned sqMask = 0;
+  unsigned sqEntries = 0;
+
+  unsigned* cqHead = nullptr;
+  unsigned* cqTail = nullptr;
+  struct io_uring_cqe* cqes = nullptr;
+  unsigned cqMask = 0;
+
+  /*
+   * Number of prepared SQEs not yet passed to the kernel.
+   */
+  unsigned toSubmit = 0;
+
+  ~Ring() {
+    if(sqes != MAP_FAILED) {
+      ::munmap(sqes, sqesSize);
+    }
+    if(cqRingPtr != MAP_FAILED && cqRingPtr != sqRingPtr) {
+      ::munmap(cqRingPtr, cqRingSize);
+    }
+    if(sqRingPtr != MAP_FAILED) {
+      ::munmap(sqRingPtr, sqRingSize);
+    }
+    if(fd >= 0) {
+      ::close(fd);
+    }
+  }
+
+};
+
+bool IOUringWorker::isSupported() {
+  static bool supported = [] {
+    struct io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    int fd = sys_io_uring_setup(2, &params);
+    if(fd < 0) {
+      return false;
+    }
+    ::close(fd);
+    // Number of in-flight polls is not limited by the ring size, so completions must never be dropped.
+    return (params.features & IORING_FEAT_NODROP) != 0;
+  }();
+  return supported;
+}
+
+void IOUringWorker::initRing() {
+
+  m_ring = std::unique_ptr<Ring>(new Ring());
+
+  struct io_uring_params params;
+  std::memset(&params, 0, sizeof(params));
+
+  m_ring->fd = sys_io_uring_setup(RING_ENTRIES, &params);
+  if(m_ring->fd < 0) {
+    OATPP_LOGE("[oatpp::async::worker::IOUringWorker::initRing()]", "Error. Call to io_uring_setup() failed. errno=%d", errno);
+    throw std::runtime_error("[oatpp::async::worker::IOUringWorker::initRing()]: Error. Call to io_uring_setup() failed.");
+  }
+
+  m_ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  m_ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+
+  bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if(singleMmap && m_ring->cqRingSize > m_ring->sqRingSize) {
+    m_ring->sqRingSize = m_ring->cqRingSize;
+  }
+
+  m_ring->sqRingPtr = ::mmap(nullptr, m_ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                             m_ring->fd, IORING_OFF_SQ_RING);
+
+  if(m_ring->sqRingPtr == MAP_FAILED) {
+    throw std::runtime_error("[oatpp::async::worker::IOUringWorker::initRing()]: Error. Can't map submission ring.");
+  }
+
+  if(singleMmap) {
+    m_ring->cqRingPtr = m_ring->sqRingPtr;
+  } else {
+    m_ring->cqRingPtr = ::mmap(nullptr, m_ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                               m_ring->fd, IORING_OFF_CQ_RING);
+    if(m_ring->cqRingPtr == MAP_FAILED) {
+      throw std::runtime_error("[oatpp::async::worker::IOUringWorker::initRing()]: Error. Can't map completion ring.");
+    }
+  }
+
+  m_ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+  m_ring->sqes = (struct io_uring_sqe*) ::mmap(nullptr, m_ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                               m_ring->fd, IORING_OFF_SQES);
+
+  if(m_ring->sqes == MAP_FAILED) {
+    throw std::runtime_error("[oatpp::async::worker::IOUringWorker::initRing()]: Error. Can't map submission queue entries.");
+  }
+
+  p_char8 sq = (p_char8) m_ring->sqRingPtr;
+  m_ring->sqHead = (unsigned*) (sq + params.sq_off.head);
+  m_ring->sqTail = (unsigned*) (sq + params.sq_off.tail);
+  m_ring->sqArray = (unsigned*) (sq + params.sq_off.array);
+  m_ring->sqMask = *(unsigned*) (sq + params.sq_off.ring_mask);
+  m_ring->sqEntries = *(unsigned*) (sq + params.sq_off.ring_entries);
+
+  p_char8 cq = (p_char8) m_ring->cqRingPtr;
+  m_ring->cqHead = (unsigned*) (cq + params.cq_off.head);
+  m_ring->cqTail = (unsigned*) (cq + params.cq_off.tail);
+  m_ring->cqes = (struct io_uring_cqe*) (cq + params.cq_off.cqes);
+  m_ring->cqMask = *(unsigned*) (cq + params.cq_off.ring_mask);
+
+  m_wakeupTrigger = ::eventfd(0, EFD_NONBLOCK);
+
+  if(m_wakeupTrigger == -1) {
+    OATPP_LOGE("[oatpp::async::worker::IOUringWorker::initRing()]", "Error. Call to ::eventfd() failed. errno=%d", errno);
+    throw std::runtime_error("[oatpp::async::worker::IOUringWorker::initRing()]: Error. Call to ::eventfd() failed.");
+  }
+
+  submitWakeupRead();
+
+}
+
+void IOUringWorker::triggerWakeup() {
+  eventfd_write(m_wakeupTrigger, 1);
+}
+
+void IOUringWorker::enter(v_word32 minComplete) {
+
+  if(m_ring->toSubmit == 0 && minComplete == 0) {
+    return;
+  }
+
+  unsigned flags = minComplete > 0 ? IORING_ENTER_GETEVENTS : 0;
+
+  auto res = sys_io_uring_enter(m_ring->fd, m_ring->toSubmit, minComplete, flags);
+
+  if(res < 0) {
+    if(errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+      // Kernel is short on resources or completion queue is overflown. Drain completions and retry.
+      return;
+    }
+    OATPP_LOGE("[oatpp::async::worker::IOUringWorker::enter()]", "Error. Call to io_uring_enter() failed. errno=%d", errno);
+    throw std::runtime_error("[oatpp::async::worker::IOUringWorker::enter()]: Error. Call to io_uring_enter() failed.");
+  }
+
+  m_ring->toSubmit -= (unsigned) res;
+
+}
+
+void IOUringWorker::submitPoll(AbstractCoroutine* coroutine) {
+
+  oatpp::data::v_io_handle handle;
+  v_word32 events;
+  v_word64 userData;
+
+  if(coroutine == nullptr) {
+    handle = m_wakeupTrigger;
+    events = POLLIN;
+    userData = WAKEUP_USER_DATA;
+  } else {
+
+    auto& action = getCoroutineScheduledAction(coroutine);
+    handle = action.getIOHandle();
+    userData = (v_word64) coroutine;
+
+    switch(action.getIOEventType()) {
+      case Action::IOEventType::IO_EVENT_READ:
+        events = POLLIN;
+        break;
+      case Action::IOEventType::IO_EVENT_WRITE:
+        events = POLLOUT;
+        break;
+      default:
+        throw std::runtime_error("[oatpp::async::worker::IOUringWorker::submitPoll()]: Error. Unknown Action Event Type.");
+    }
+
+  }
+
+  unsigned tail = *m_ring->sqTail;
+  if(tail - __atomic_load_n(m_ring->sqHead, __ATOMIC_ACQUIRE) >= m_ring->sqEntries) {
+    // submission ring is full - pass prepared entries to the kernel.
+    enter(0);
+    tail = *m_ring->sqTail;
+    if(tail - __atomic_load_n(m_ring->sqHead, __ATOMIC_ACQUIRE) >= m_ring->sqEntries) {
+      throw std::runtime_error("[oatpp::async::worker::IOUringWorker::submitPoll()]: Error. Submission ring is full.");
+    }
+  }
+
+  unsigned index = tail & m_ring->sqMask;
+  struct io_uring_sqe* sqe = &m_ring->sqes[index];
+  std::memset(sqe, 0, sizeof(struct io_uring_sqe));
+
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = handle;
+#if defined(IORING_FEAT_POLL_32BITS)
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  events = (events << 16) | (events >> 16);
+#endif
+  sqe->poll32_events = events;
+#else
+  sqe->poll_events = (__u16) events;
+#endif
+  sqe->user_data = userData;
+
+  m_ring->sqArray[index] = index;
+  __atomic_store_n(m_ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+  ++ m_ring->toSubmit;
+
+}
+
+void IOUringWorker::submitWakeupRead() {
+  submitPoll(nullptr);
+}
+
+void IOUringWorker::processCompletions() {
+
+  unsigned head = *m_ring->cqHead;
+  unsigned tail = __atomic_load_n(m_ring->cqTail, __ATOMIC_ACQUIRE);
+
+  bool wakeup = false;
+
+  while(head != tail) {
+    struct io_uring_cqe* cqe = &m_ring->cqes[head & m_ring->cqMask];
+    if(cqe->user_data == WAKEUP_USER_DATA) {
+      wakeup = true;
+    } else {
+      // Result is not checked - coroutine will get the error (if any) from the I/O call itself.
+      m_readyQueue.pushBack((AbstractCoroutine*) cqe->user_data);
+    }
+    head ++;
+  }
+
+  __atomic_store_n(m_ring->cqHead, head, __ATOMIC_RELEASE);
+
+  if(wakeup) {
+    eventfd_t value;
+    eventfd_read(m_wakeupTrigger, &value);
+    submitWakeupRead();
+  }
+
+}
+
+#else
+
+struct IOUringWorker::Ring {};
+
+bool IOUringWorker::isSupported() {
+  return false;
+}
+
+void IOUringWorker::initRing() {
+  throw std::runtime_error("[oatpp::async::worker::IOUringWorker::initRing()]: Error. io_uring is not supported on this platform.");
+}
+
+void IOUringWorker::triggerWakeup() {}
+
+void IOUringWorker::enter(v_word32 minComplete) {
+  (void) minComplete;
+}
+
+void IOUringWorker::submitPoll(AbstractCoroutine* coroutine) {
+  (void) coroutine;
+}
+
+void IOUringWorker::submitWakeupRead() {}
+void IOUringWorker::processCompletions() {}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// IOUringWorker
+
+IOUringWorker::IOUringWorker()
+  : Worker(Type::IO)
+  , m_running(true)
+  , m_wakeupTrigger(-1)
+{
+  initRing();
+  m_thread = std::thread(&IOUringWorker::run, this);
+}
+
+IOUringWorker::~IOUringWorker() {
+#if defined(OATPP_IO_URING_SUPPORTED)
+  if(m_wakeupTrigger >= 0) {
+    ::close(m_wakeupTrigger);
+  }
+#endif
+}
+
+void IOUringWorker::pushTasks(oatpp::collection::FastQueue<AbstractCoroutine>& tasks) {
+  if (tasks.first != nullptr) {
+    {
+      std::lock_guard<oatpp::concurrency::SpinLock> guard(m_backlogLock);
+      oatpp::collection::FastQueue<AbstractCoroutine>::moveAll(tasks, m_backlog);
+    }
+    triggerWakeup();
+  }
+}
+
+void IOUringWorker::pushOneTask(AbstractCoroutine* task) {
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> guard(m_backlogLock);
+    m_backlog.pushBack(task);
+  }
+  triggerWakeup();
+}
+
+void IOUringWorker::consumeBacklog() {
+
+  oatpp::collection::FastQueue<AbstractCoroutine> backlog;
+  {
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_backlogLock);
+    oatpp::collection::FastQueue<AbstractCoroutine>::moveAll(m_backlog, backlog);
+  }
+
+  while(backlog.first != nullptr) {
+
+    auto coroutine = backlog.popFront();
+    auto& action = getCoroutineScheduledAction(coroutine);
+
+    switch(action.getType()) {
+
+      case Action::TYPE_IO_WAIT:
+        submitPoll(coroutine);
+        break;
+
+      case Action::TYPE_IO_REPEAT:
+        m_readyQueue.pushBack(coroutine);
+        break;
+
+      default:
+        OATPP_LOGE("[oatpp::async::worker::IOUringWorker::consumeBacklog()]", "Error. Unknown Action. action.getType()==%d", action.getType());
+        throw std::runtime_error("[oatpp::async::worker::IOUringWorker::consumeBacklog()]: Error. Unknown Action.");
+
+    }
+
+  }
+
+}
+
+void IOUringWorker::iterateReady() {
+
+  oatpp::collection::FastQueue<AbstractCoroutine> readyQueue;
+  oatpp::collection::FastQueue<AbstractCoroutine>::moveAll(m_readyQueue, readyQueue);
+
+  while(readyQueue.first != nullptr) {
+
+    auto coroutine = readyQueue.popFront();
+    Action action = coroutine->iterate();
+
+    switch(action.getType()) {
+
+      case Action::TYPE_IO_WAIT:
+        setCoroutineScheduledAction(coroutine, std::move(action));
+        submitPoll(coroutine);
+        break;
+
+      case Action::TYPE_IO_REPEAT:
+        setCoroutineScheduledAction(coroutine, std::move(action));
+        m_readyQueue.pushBack(coroutine);
+        break;
+
+      default:
+        setCoroutineScheduledAction(coroutine, std::move(action));
+        getCoroutineProcessor(coroutine)->pushOneTask(coroutine);
+
+    }
+
+  }
+
+}
+
+void IOUringWorker::run() {
+
+  while(m_running) {
+    consumeBacklog();
+    iterateReady();
+    // Submit all polls prepared during this loop and wait for completions with one call.
+    // Do not block if there are coroutines ready to be iterated.
+    enter(m_readyQueue.first == nullptr ? 1 : 0);
+    processCompletions();
+  }
+
+}
+
+void IOUringWorker::stop() {
+  m_running = false;
+  triggerWakeup();
+}
+
+void IOUringWorker::join() {
+  m_thread.join();
+}
+
+void IOUringWorker::detach() {
+  m_thread.detach();
+}
+
+}}}
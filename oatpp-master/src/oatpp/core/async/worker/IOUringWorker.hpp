@@ -0,0 +1,132 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_async_worker_IOUringWorker_hpp
+#define oatpp_async_worker_IOUringWorker_hpp
+
+#include "./Worker.hpp"
+#include "oatpp/core/concurrency/SpinLock.hpp"
+
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+#if !defined(OATPP_IO_URING_DISABLED) && (defined(__linux__) || defined(linux) || defined(__linux))
+  #if defined(__has_include)
+    #if __has_include(<linux/io_uring.h>)
+      #define OATPP_IO_URING_SUPPORTED
+    #endif
+  #endif
+#endif
+
+namespace oatpp { namespace async { namespace worker {
+
+/**
+ * `io_uring` based implementation of I/O worker. Linux only. <br>
+ * Coroutines waiting for I/O are submitted to the submission ring as poll requests and are iterated on completion.
+ * All submissions accumulated during one loop are passed to the kernel with the same `io_uring_enter` call
+ * which also waits for completions. <br>
+ * One worker serves both read and write events - there is no reader/writer split as in &id:oatpp::async::worker::IOEventWorker;. <br>
+ * Check &l:IOUringWorker::isSupported (); before use - kernel may lack `io_uring` support or it may be disabled.
+ */
+class IOUringWorker : public Worker {
+private:
+  static constexpr const v_word32 RING_ENTRIES = 4096;
+private:
+  struct Ring; // FWD
+private:
+  std::atomic<bool> m_running;
+  oatpp::collection::FastQueue<AbstractCoroutine> m_backlog;
+  oatpp::concurrency::SpinLock m_backlogLock;
+  oatpp::collection::FastQueue<AbstractCoroutine> m_readyQueue;
+  std::unique_ptr<Ring> m_ring;
+  oatpp::data::v_io_handle m_wakeupTrigger;
+private:
+  std::thread m_thread;
+private:
+  void initRing();
+  void triggerWakeup();
+  void submitWakeupRead();
+  void submitPoll(AbstractCoroutine* coroutine);
+  void enter(v_word32 minComplete);
+  void consumeBacklog();
+  void processCompletions();
+  void iterateReady();
+public:
+
+  /**
+   * Check if `io_uring` is available on this system.
+   * @return - `true` if available.
+   */
+  static bool isSupported();
+
+public:
+
+  /**
+   * Constructor.
+   */
+  IOUringWorker();
+
+  /**
+   * Virtual destructor.
+   */
+  ~IOUringWorker();
+
+  /**
+   * Push list of tasks to worker.
+   * @param tasks - &id:oatpp::collection::FastQueue; of &id:oatpp::async::AbstractCoroutine;.
+   */
+  void pushTasks(oatpp::collection::FastQueue<AbstractCoroutine>& tasks) override;
+
+  /**
+   * Push one task to worker.
+   * @param task - &id:AbstractCoroutine;.
+   */
+  void pushOneTask(AbstractCoroutine* task) override;
+
+  /**
+   * Run worker.
+   */
+  void run();
+
+  /**
+   * Break run loop.
+   */
+  void stop() override;
+
+  /**
+   * Join all worker-threads.
+   */
+  void join() override;
+
+  /**
+   * Detach all worker-threads.
+   */
+  void detach() override;
+
+};
+
+}}}
+
+#endif //oatpp_async_worker_IOUringWorker_hpp
@@ -26,18 +26,29 @@
 
 #include "oatpp/core/async/Processor.hpp"
 
+#include <algorithm>
 #include <chrono>
 
 namespace oatpp { namespace async { namespace worker {
 
-TimerWorker::TimerWorker(const std::chrono::duration<v_int64, std::micro>& granularity)
+TimerWorker::TimerWorker(const std::chrono::duration<v_int64, std::micro>& granularity, Backend backend)
   : Worker(Type::TIMER)
   , m_running(true)
   , m_granularity(granularity)
+  , m_backend(backend)
 {
   m_thread = std::thread(&TimerWorker::run, this);
 }
 
+TimerWorker::~TimerWorker() {
+  for(auto& entry : m_heap) {
+    delete entry.coroutine;
+  }
+  m_heap.clear();
+  m_queue.clear();
+  m_backlog.clear();
+}
+
 void TimerWorker::pushTasks(oatpp::collection::FastQueue<AbstractCoroutine>& tasks) {
   {
     std::lock_guard<oatpp::concurrency::SpinLock> guard(m_backlogLock);
@@ -56,6 +67,31 @@ void TimerWorker::consumeBacklog() {
 
 }
 
+void TimerWorker::consumeBacklogToHeap() {
+
+  std::unique_lock<oatpp::concurrency::SpinLock> lock(m_backlogLock);
+  while (m_backlog.first == nullptr && m_running) {
+    if(m_heap.empty()) {
+      m_backlogCondition.wait(lock);
+    } else {
+      std::chrono::system_clock::time_point deadline(std::chrono::microseconds(m_heap.front().timePointMicroseconds));
+      if(m_backlogCondition.wait_until(lock, deadline) == std::cv_status::timeout) {
+        break;
+      }
+    }
+  }
+
+  while(m_backlog.first != nullptr) {
+    pushToHeap(m_backlog.popFront());
+  }
+
+}
+
+void TimerWorker::pushToHeap(AbstractCoroutine* coroutine) {
+  m_heap.push_back({getCoroutineScheduledAction(coroutine).getTimePointMicroseconds(), coroutine});
+  std::push_heap(m_heap.begin(), m_heap.end(), HeapEntryCompare());
+}
+
 void TimerWorker::pushOneTask(AbstractCoroutine* task) {
   {
     std::lock_guard<oatpp::concurrency::SpinLock> guard(m_backlogLock);
@@ -65,6 +101,60 @@ void TimerWorker::pushOneTask(AbstractCoroutine* task) {
 }
 
 void TimerWorker::run() {
+  switch(m_backend) {
+    case Backend::MIN_HEAP:
+      runMinHeap();
+      break;
+    default:
+      runLinearScan();
+  }
+}
+
+void TimerWorker::runMinHeap() {
+
+  while(m_running) {
+
+    consumeBacklogToHeap();
+
+    std::chrono::microseconds ms = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch());
+    v_int64 tick = ms.count();
+
+    while(!m_heap.empty() && m_heap.front().timePointMicroseconds <= tick) {
+
+      std::pop_heap(m_heap.begin(), m_heap.end(), HeapEntryCompare());
+      auto curr = m_heap.back().coroutine;
+      m_heap.pop_back();
+
+      Action action = curr->iterate();
+
+      switch(action.getType()) {
+
+        case Action::TYPE_WAIT_REPEAT:
+          setCoroutineScheduledAction(curr, std::move(action));
+          pushToHeap(curr);
+          break;
+
+        case Action::TYPE_IO_WAIT:
+          setCoroutineScheduledAction(curr, oatpp::async::Action::createWaitRepeatAction(tick + m_granularity.count()));
+          pushToHeap(curr);
+          break;
+
+        default:
+          setCoroutineScheduledAction(curr, std::move(action));
+          getCoroutineProcessor(curr)->pushOneTask(curr);
+          break;
+
+      }
+
+      dismissAction(action);
+
+    }
+
+  }
+
+}
+
+void TimerWorker::runLinearScan() {
 
   while(m_running) {
 
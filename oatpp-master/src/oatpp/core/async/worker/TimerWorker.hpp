@@ -32,6 +32,7 @@
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <vector>
 
 namespace oatpp { namespace async { namespace worker {
 
@@ -40,25 +41,72 @@ namespace oatpp { namespace async { namespace worker {
  * Used to wait for timer-scheduled coroutines.
  */
 class TimerWorker : public Worker {
+public:
+
+  /**
+   * Timer queue implementation.
+   */
+  enum Backend : v_int32 {
+
+    /**
+     * Scan all scheduled coroutines every `granularity` period.
+     */
+    LINEAR_SCAN = 0,
+
+    /**
+     * Keep scheduled coroutines in a min-heap ordered by deadline.
+     * Only expired coroutines are touched and worker sleeps until the nearest deadline.
+     * `granularity` is only used as a retry period for coroutines waiting for I/O.
+     */
+    MIN_HEAP = 1
+
+  };
+
+private:
+
+  struct HeapEntry {
+    v_int64 timePointMicroseconds;
+    AbstractCoroutine* coroutine;
+  };
+
+  struct HeapEntryCompare {
+    bool operator()(const HeapEntry& a, const HeapEntry& b) const {
+      return a.timePointMicroseconds > b.timePointMicroseconds;
+    }
+  };
+
 private:
   bool m_running;
   oatpp::collection::FastQueue<AbstractCoroutine> m_backlog;
   oatpp::collection::FastQueue<AbstractCoroutine> m_queue;
+  std::vector<HeapEntry> m_heap;
   oatpp::concurrency::SpinLock m_backlogLock;
   std::condition_variable_any m_backlogCondition;
 private:
   std::chrono::duration<v_int64, std::micro> m_granularity;
+  Backend m_backend;
 private:
   std::thread m_thread;
 private:
   void consumeBacklog();
+  void consumeBacklogToHeap();
+  void pushToHeap(AbstractCoroutine* coroutine);
+  void runLinearScan();
+  void runMinHeap();
 public:
 
   /**
    * Constructor.
    * @param granularity - minimum possible time to wait.
+   * @param backend - timer queue implementation. &l:TimerWorker::Backend;.
+   */
+  TimerWorker(const std::chrono::duration<v_int64, std::micro>& granularity = std::chrono::milliseconds(100),
+              Backend backend = Backend::LINEAR_SCAN);
+
+  /**
+   * Virtual destructor.
    */
-  TimerWorker(const std::chrono::duration<v_int64, std::micro>& granularity = std::chrono::milliseconds(100));
+  ~TimerWorker();
 
   /**
    * Push list of tasks to worker.
@@ -56,6 +56,14 @@
   #define OATPP_THREAD_DISTRIBUTED_MEM_POOL_SHARDS_COUNT 10
 #endif
 
+/**
+ * Max number of free entries of each ThreadDistributedMemoryPool shard cached per thread.
+ * Entries are moved between thread cache and shard in batches of half of this size. Set to 0 to disable thread caches.
+ */
+#ifndef OATPP_THREAD_DISTRIBUTED_MEM_POOL_CACHE_SIZE
+  #define OATPP_THREAD_DISTRIBUTED_MEM_POOL_CACHE_SIZE 32
+#endif
+
 /**
  * oatpp::async::Executor default number of threads
  */
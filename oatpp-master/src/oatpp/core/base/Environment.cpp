@@ -24,6 +24,8 @@
 
 #include "Environment.hpp"
 
+#include "oatpp/core/base/memory/MemoryPool.hpp"
+
 #include <iomanip>
 #include <chrono>
 #include <iostream>
@@ -229,6 +231,19 @@ v_counter Environment::getThreadLocalObjectsCreated(){
 #endif
 }
 
+Environment::MemoryPoolsStatistics Environment::getMemoryPoolsStatistics() {
+  MemoryPoolsStatistics stats = {0, 0, 0, 0};
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(memory::MemoryPool::POOLS_SPIN_LOCK);
+  for(auto& pair : memory::MemoryPool::POOLS) {
+    auto pool = pair.second;
+    stats.cacheHits += pool->getCacheHits();
+    stats.cacheMisses += pool->getCacheMisses();
+    stats.objectsCount += pool->getObjectsCount();
+    stats.bytesHeld += pool->getMemorySize();
+  }
+  return stats;
+}
+
 void Environment::setLogger(const std::shared_ptr<Logger>& logger){
   m_logger = logger;
 }
@@ -254,6 +269,7 @@ void Environment::printCompilationConfig() {
 #endif
 
   OATPP_LOGD("oatpp/Config", "OATPP_THREAD_DISTRIBUTED_MEM_POOL_SHARDS_COUNT=%d", OATPP_THREAD_DISTRIBUTED_MEM_POOL_SHARDS_COUNT);
+  OATPP_LOGD("oatpp/Config", "OATPP_THREAD_DISTRIBUTED_MEM_POOL_CACHE_SIZE=%d", OATPP_THREAD_DISTRIBUTED_MEM_POOL_CACHE_SIZE);
   OATPP_LOGD("oatpp/Config", "OATPP_ASYNC_EXECUTOR_THREAD_NUM_DEFAULT=%d\n", OATPP_ASYNC_EXECUTOR_THREAD_NUM_DEFAULT);
 
 }
@@ -174,6 +174,35 @@ public:
  * Manage object counters, manage components, and do system health-checks.
  */
 class Environment{
+public:
+
+  /**
+   * Summary statistics of all memory pools - &id:oatpp::base::memory::MemoryPool;.
+   */
+  struct MemoryPoolsStatistics {
+
+    /**
+     * Number of entries obtained from thread caches without locking a pool.
+     */
+    v_int64 cacheHits;
+
+    /**
+     * Number of times thread cache had to be refilled from a pool.
+     */
+    v_int64 cacheMisses;
+
+    /**
+     * Number of entries in use. Entries cached by threads are counted as used.
+     */
+    v_int64 objectsCount;
+
+    /**
+     * Size of the memory held by all pools in bytes.
+     */
+    v_int64 bytesHeld;
+
+  };
+
 private:
 
   static v_atomicCounter m_objectsCount;
@@ -299,6 +328,12 @@ public:
    */
   static v_counter getThreadLocalObjectsCreated();
 
+  /**
+   * Get summary statistics of all memory pools.
+   * @return - &l:Environment::MemoryPoolsStatistics;.
+   */
+  static MemoryPoolsStatistics getMemoryPoolsStatistics();
+
   /**
    * Set environment logger.
    * @param logger - system-wide logger.
@@ -32,12 +32,16 @@ void StrBuffer::set(const void* data, v_int32 size, bool hasOwnData) {
   m_data = (p_char8) data;
   m_size = size;
   m_hasOwnData = hasOwnData;
+  m_hash = 0;
+  m_hashCI = 0;
 }
   
 void StrBuffer::setAndCopy(const void* data, const void* originData, v_int32 size){
   m_data = (p_char8) data;
   m_size = size;
   //m_hasOwnData = false;
+  m_hash = 0;
+  m_hashCI = 0;
   if(originData != nullptr) {
     std::memcpy(m_data, originData, size);
   }
@@ -48,15 +52,21 @@ std::shared_ptr<StrBuffer> StrBuffer::allocShared(const void* data, v_int32 size
   if(copyAsOwnData) {
     memory::AllocationExtras extras(size + 1);
     std::shared_ptr<StrBuffer> ptr;
-    if(size + 1 > getSmStringSize()) {
-      ptr = memory::allocateSharedWithExtras<StrBuffer>(extras);
-    } else {
+    if(size + 1 <= TINY_STRING_DATA_SIZE) {
+      ptr = memory::customPoolAllocateSharedWithExtras<StrBuffer>(extras, getTinyStringPool());
+    } else if(size + 1 <= getSmStringSize()) {
       ptr = memory::customPoolAllocateSharedWithExtras<StrBuffer>(extras, getSmallStringPool());
+    } else {
+      ptr = memory::allocateSharedWithExtras<StrBuffer>(extras);
     }
     ptr->setAndCopy(extras.extraPtr, data, size);
     return ptr;
   }
-  return std::make_shared<StrBuffer>(data, size, copyAsOwnData);
+  /* buffer doesn't own data - only control block and StrBuffer are allocated */
+  memory::AllocationExtras extras(0);
+  auto ptr = memory::customPoolAllocateSharedWithExtras<StrBuffer>(extras, getTinyStringPool());
+  ptr->set(data, size, false);
+  return ptr;
 }
   
 p_char8 StrBuffer::allocStrBuffer(const void* originData, v_int32 size, bool copyAsOwnData) {
@@ -75,12 +85,16 @@ StrBuffer::StrBuffer()
   : m_data((p_char8)"[<nullptr>]")
   , m_size(11)
   , m_hasOwnData(false)
+  , m_hash(0)
+  , m_hashCI(0)
 {}
 
 StrBuffer::StrBuffer(const void* data, v_int32 size, bool copyAsOwnData)
   : m_data(allocStrBuffer(data, size, copyAsOwnData))
   , m_size(size)
   , m_hasOwnData(copyAsOwnData)
+  , m_hash(0)
+  , m_hashCI(0)
 {}
 
 StrBuffer::~StrBuffer() {
@@ -148,6 +162,26 @@ std::string StrBuffer::std_str() const {
   return std::string((const char*) m_data, m_size);
 }
   
+v_word32 StrBuffer::getHash() const {
+  v_word64 cached = m_hash.load(std::memory_order_relaxed);
+  if(cached & HASH_COMPUTED) {
+    return (v_word32) cached;
+  }
+  v_word32 result = hash(m_data, m_size);
+  m_hash.store(HASH_COMPUTED | result, std::memory_order_relaxed);
+  return result;
+}
+
+v_word32 StrBuffer::getHashCI() const {
+  v_word64 cached = m_hashCI.load(std::memory_order_relaxed);
+  if(cached & HASH_COMPUTED) {
+    return (v_word32) cached;
+  }
+  v_word32 result = hashCI(m_data, m_size);
+  m_hashCI.store(HASH_COMPUTED | result, std::memory_order_relaxed);
+  return result;
+}
+
 bool StrBuffer::hasOwnData() const {
   return m_hasOwnData;
 }
@@ -294,6 +328,50 @@ bool StrBuffer::equalsCI_FAST(StrBuffer* str1, const char* str2) {
   return (str1->getSize() == len && equalsCI_FAST(str1->m_data, str2, str1->m_size));
 }
 
+v_word32 StrBuffer::hash(const void* data, v_int32 size) {
+
+  p_char8 curr = (p_char8) data;
+  v_int32 size4 = size >> 2;
+
+  v_word32 result = 0;
+
+  for(v_int32 i = 0; i < size4; i++) {
+    v_word32 word;
+    std::memcpy(&word, curr, 4);
+    result ^= word;
+    curr += 4;
+  }
+
+  for(v_int32 i = 0; i < size - (size4 << 2); i++ ) {
+    ((p_char8) &result)[i] ^= curr[i];
+  }
+
+  return result;
+
+}
+
+v_word32 StrBuffer::hashCI(const void* data, v_int32 size) {
+
+  p_char8 curr = (p_char8) data;
+  v_int32 size4 = size >> 2;
+
+  v_word32 result = 0;
+
+  for(v_int32 i = 0; i < size4; i++) {
+    v_word32 word;
+    std::memcpy(&word, curr, 4);
+    result ^= (word | 538976288); // 538976288 = 32 | (32 << 8) | (32 << 16) | (32 << 24);
+    curr += 4;
+  }
+
+  for(v_int32 i = 0; i < size - (size4 << 2); i++ ) {
+    ((p_char8) &result)[i] ^= (curr[i] | 32);
+  }
+
+  return result;
+
+}
+
 void StrBuffer::lowerCase(const void* data, v_int32 size) {
   for(v_int32 i = 0; i < size; i++) {
     v_char8 a = ((p_char8) data)[i];
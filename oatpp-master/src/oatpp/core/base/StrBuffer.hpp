@@ -28,22 +28,34 @@
 #include "memory/ObjectPool.hpp"
 #include "./Countable.hpp"
 
+#include <atomic>
 #include <cstring> // c
 
 namespace oatpp { namespace base {
 
 /**
- * String buffer class.
+ * String buffer class.<br>
+ * Buffer data is allocated together with the control block and the StrBuffer object - with one allocation.
+ * Short strings (most of header values, path variables, and DTO fields) are allocated from the compact "tiny" pool,
+ * strings up to &l:StrBuffer::SM_STRING_POOL_ENTRY_SIZE; - from the "small" pool.<br>
+ * Hash of the buffer data is computed on first use and is cached - data must not be modified after the hash was taken.
  */
 class StrBuffer : public oatpp::base::Countable {  
 private:
 
   static constexpr v_int32 SM_STRING_POOL_ENTRY_SIZE = 256;
+  static constexpr v_int32 TINY_STRING_DATA_SIZE = 32;
+  static constexpr v_word64 HASH_COMPUTED = ((v_word64) 1) << 32;
   
   static oatpp::base::memory::ThreadDistributedMemoryPool& getSmallStringPool() {
     static oatpp::base::memory::ThreadDistributedMemoryPool pool("Small_String_Pool", SM_STRING_POOL_ENTRY_SIZE, 16);
     return pool;
   }
+
+  static oatpp::base::memory::ThreadDistributedMemoryPool& getTinyStringPool() {
+    static oatpp::base::memory::ThreadDistributedMemoryPool pool("Tiny_String_Pool", getSmStringBaseSize() + TINY_STRING_DATA_SIZE, 64);
+    return pool;
+  }
   
   static v_int32 getSmStringBaseSize() {
     memory::AllocationExtras extras(0);
@@ -60,6 +72,8 @@ private:
   p_char8 m_data;
   v_int32 m_size;
   bool m_hasOwnData;
+  mutable std::atomic<v_word64> m_hash;
+  mutable std::atomic<v_word64> m_hashCI;
 private:
   
   void set(const void* data, v_int32 size, bool hasOwnData);
@@ -184,6 +198,18 @@ public:
    */
   std::string std_str() const;
 
+  /**
+   * Get hash of the buffer data. Hash is computed on first call and cached.
+   * @return - same as &l:StrBuffer::hash (); of the buffer data.
+   */
+  v_word32 getHash() const;
+
+  /**
+   * Get case-insensitive hash of the buffer data. Hash is computed on first call and cached.
+   * @return - same as &l:StrBuffer::hashCI (); of the buffer data.
+   */
+  v_word32 getHashCI() const;
+
   /**
    * Is this object is responsible for freeing buffer data.
    * @return - true if this object is responsible for freeing buffer data.
@@ -354,6 +380,22 @@ public:
    */
   static bool equalsCI_FAST(StrBuffer* str1, const char* str2);
 
+  /**
+   * Compute hash of data.
+   * @param data - pointer to data.
+   * @param size - size of the data.
+   * @return - hash.
+   */
+  static v_word32 hash(const void* data, v_int32 size);
+
+  /**
+   * Compute case-insensitive hash of data. (ASCII only)
+   * @param data - pointer to data.
+   * @param size - size of the data.
+   * @return - hash.
+   */
+  static v_word32 hashCI(const void* data, v_int32 size);
+
   /**
    * Change characters in data to lowercase.
    * @param data - pointer to data.
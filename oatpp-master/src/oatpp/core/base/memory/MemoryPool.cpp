@@ -27,31 +27,205 @@
 #include "oatpp/core/concurrency/Thread.hpp"
 
 #include <mutex>
+#include <vector>
 
 namespace oatpp { namespace base { namespace  memory {
 
-MemoryPool::MemoryPool(const std::string& name, v_int32 entrySize, v_int32 chunkSize)
+#if !defined(OATPP_DISABLE_POOL_ALLOCATIONS) && !defined(OATPP_COMPAT_BUILD_NO_THREAD_LOCAL)
+
+namespace {
+  thread_local bool t_threadCacheDestroyed = false;
+}
+
+/*
+ * Per-thread cache of free entries. One magazine per pool, indexed by pool cache slot.
+ * Slots of destroyed pools are reused, so magazine remembers id of the pool it was filled from.
+ * Entries in magazine are linked through EntryHeader::next - same as in pool free-list.
+ */
+class MemoryPool::ThreadCache {
+private:
+
+  struct Magazine {
+    v_int64 poolId;
+    EntryHeader* top;
+    v_int32 count;
+    v_int64 hits;
+  };
+
+private:
+  std::vector<Magazine> m_magazines;
+private:
+
+  Magazine& getMagazine(MemoryPool* pool) {
+    if(pool->m_cacheSlot >= (v_int32) m_magazines.size()) {
+      m_magazines.resize(pool->m_cacheSlot + 1, {0, nullptr, 0, 0});
+    }
+    Magazine& magazine = m_magazines[pool->m_cacheSlot];
+    if(magazine.poolId != pool->m_id) {
+      /* slot was used by a destroyed pool - its entries are already deallocated */
+      magazine = {pool->m_id, nullptr, 0, 0};
+    }
+    return magazine;
+  }
+
+  /*
+   * Move `batchSize` entries from the pool to magazine. Called when magazine is empty.
+   */
+  static void refill(MemoryPool* pool, Magazine& magazine) {
+
+    v_int32 batchSize = pool->m_cacheSize / 2;
+    if(batchSize < 1) {
+      batchSize = 1;
+    }
+
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(pool->m_lock);
+
+    for(v_int32 i = 0; i < batchSize; i ++) {
+      if(pool->m_rootEntry == nullptr) {
+        pool->allocChunk();
+        if(pool->m_rootEntry == nullptr) {
+          throw std::runtime_error("[oatpp::base::memory::MemoryPool:obtain()]: Unable to allocate entry");
+        }
+      }
+      auto entry = pool->m_rootEntry;
+      pool->m_rootEntry = entry->next;
+      entry->next = magazine.top;
+      magazine.top = entry;
+      ++ magazine.count;
+      ++ pool->m_objectsCount;
+    }
+
+    pool->m_cacheMisses ++;
+    pool->m_cacheHits += magazine.hits;
+    magazine.hits = 0;
+
+  }
+
+  /*
+   * Move `count` entries from magazine back to the pool.
+   * Batch is unlinked from magazine without lock, then put to pool free-list with one lock.
+   */
+  static void drain(MemoryPool* pool, Magazine& magazine, v_int32 count) {
+
+    if(count <= 0) {
+      return;
+    }
+
+    EntryHeader* first = magazine.top;
+    EntryHeader* last = first;
+    for(v_int32 i = 1; i < count; i ++) {
+      last = last->next;
+    }
+    magazine.top = last->next;
+    magazine.count -= count;
+
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(pool->m_lock);
+    last->next = pool->m_rootEntry;
+    pool->m_rootEntry = first;
+    pool->m_objectsCount -= count;
+    pool->m_cacheHits += magazine.hits;
+    magazine.hits = 0;
+
+  }
+
+public:
+
+  ~ThreadCache() {
+    t_threadCacheDestroyed = true;
+    /* return cached entries to pools which are still alive */
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(POOLS_SPIN_LOCK);
+    for(Magazine& magazine : m_magazines) {
+      if(magazine.count > 0) {
+        auto it = POOLS.find(magazine.poolId);
+        if(it != POOLS.end()) {
+          drain(it->second, magazine, magazine.count);
+        }
+      }
+    }
+  }
+
+  /*
+   * Get cache of the current thread.
+   * Returns `nullptr` if called after cache was destroyed (thread is exiting).
+   */
+  static ThreadCache* getInstance() {
+    if(t_threadCacheDestroyed) {
+      return nullptr;
+    }
+    static thread_local ThreadCache cache;
+    return &cache;
+  }
+
+  void* obtain(MemoryPool* pool) {
+    Magazine& magazine = getMagazine(pool);
+    if(magazine.top == nullptr) {
+      refill(pool, magazine);
+    } else {
+      ++ magazine.hits;
+    }
+    auto entry = magazine.top;
+    magazine.top = entry->next;
+    -- magazine.count;
+    return ((p_char8) entry) + sizeof(EntryHeader);
+  }
+
+  void free(MemoryPool* pool, EntryHeader* entry) {
+    Magazine& magazine = getMagazine(pool);
+    if(magazine.count >= pool->m_cacheSize) {
+      drain(pool, magazine, magazine.count / 2 > 0 ? magazine.count / 2 : magazine.count);
+    }
+    entry->next = magazine.top;
+    magazine.top = entry;
+    ++ magazine.count;
+  }
+
+};
+
+#endif
+
+MemoryPool::MemoryPool(const std::string& name, v_int32 entrySize, v_int32 chunkSize, v_int32 cacheSize)
   : m_name(name)
   , m_entrySize(entrySize)
   , m_chunkSize(chunkSize)
   , m_id(++poolIdCounter)
   , m_rootEntry(nullptr)
   , m_objectsCount(0)
+  , m_cacheSize(cacheSize)
+  , m_cacheSlot(-1)
+  , m_cacheHits(0)
+  , m_cacheMisses(0)
 {
+#if defined(OATPP_DISABLE_POOL_ALLOCATIONS) || defined(OATPP_COMPAT_BUILD_NO_THREAD_LOCAL)
+  m_cacheSize = 0;
+#endif
   allocChunk();
   std::lock_guard<oatpp::concurrency::SpinLock> lock(POOLS_SPIN_LOCK);
   POOLS[m_id] = this;
+  if(m_cacheSize > 0) {
+    if(freeCacheSlots.empty()) {
+      m_cacheSlot = cacheSlotsCount ++;
+    } else {
+      m_cacheSlot = freeCacheSlots.back();
+      freeCacheSlots.pop_back();
+    }
+  }
 }
 
 MemoryPool::~MemoryPool() {
+  {
+    /* unregister first - exiting threads return their cached entries only to registered pools */
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(POOLS_SPIN_LOCK);
+    POOLS.erase(m_id);
+    if(m_cacheSlot >= 0) {
+      freeCacheSlots.push_back(m_cacheSlot);
+    }
+  }
   auto it = m_chunks.begin();
   while (it != m_chunks.end()) {
     p_char8 chunk = *it;
     delete [] chunk;
     it++;
   }
-  std::lock_guard<oatpp::concurrency::SpinLock> lock(POOLS_SPIN_LOCK);
-  POOLS.erase(m_id);
 }
 
 void MemoryPool::allocChunk() {
@@ -69,10 +243,7 @@ void MemoryPool::allocChunk() {
 #endif
 }
   
-void* MemoryPool::obtain() {
-#ifdef OATPP_DISABLE_POOL_ALLOCATIONS
-  return new v_char8[m_entrySize];
-#else
+void* MemoryPool::obtainLocked() {
   std::lock_guard<oatpp::concurrency::SpinLock> lock(m_lock);
   if(m_rootEntry != nullptr) {
     auto entry = m_rootEntry;
@@ -89,15 +260,43 @@ void* MemoryPool::obtain() {
     ++ m_objectsCount;
     return ((p_char8) entry) + sizeof(EntryHeader);
   }
+}
+  
+void* MemoryPool::obtain() {
+#ifdef OATPP_DISABLE_POOL_ALLOCATIONS
+  return new v_char8[m_entrySize];
+#else
+#ifndef OATPP_COMPAT_BUILD_NO_THREAD_LOCAL
+  if(m_cacheSize > 0) {
+    auto cache = ThreadCache::getInstance();
+    if(cache != nullptr) {
+      return cache->obtain(this);
+    }
+  }
 #endif
+  return obtainLocked();
+#endif
+}
+
+void MemoryPool::freeLocked(EntryHeader* entry) {
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(m_lock);
+  entry->next = m_rootEntry;
+  m_rootEntry = entry;
+  -- m_objectsCount;
 }
 
 void MemoryPool::freeByEntryHeader(EntryHeader* entry) {
   if(entry->poolId == m_id) {
-    std::lock_guard<oatpp::concurrency::SpinLock> lock(m_lock);
-    entry->next = m_rootEntry;
-    m_rootEntry = entry;
-    -- m_objectsCount;
+#if !defined(OATPP_DISABLE_POOL_ALLOCATIONS) && !defined(OATPP_COMPAT_BUILD_NO_THREAD_LOCAL)
+    if(m_cacheSize > 0) {
+      auto cache = ThreadCache::getInstance();
+      if(cache != nullptr) {
+        cache->free(this, entry);
+        return;
+      }
+    }
+#endif
+    freeLocked(entry);
   } else {
     OATPP_LOGD("[oatpp::base::memory::MemoryPool::freeByEntryHeader()]",
       "Error. Invalid EntryHeader. Expected poolId=%d, entry poolId=%d", m_id, entry->poolId);
@@ -126,34 +325,58 @@ v_int64 MemoryPool::getSize(){
   return m_chunks.size() * m_chunkSize;
 }
 
+v_int64 MemoryPool::getMemorySize(){
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(m_lock);
+  return (v_int64) m_chunks.size() * m_chunkSize * (sizeof(EntryHeader) + m_entrySize);
+}
+
 v_int32 MemoryPool::getObjectsCount(){
   return m_objectsCount;
 }
 
+v_int32 MemoryPool::getCacheSize(){
+  return m_cacheSize;
+}
+
+v_int64 MemoryPool::getCacheHits(){
+  return m_cacheHits;
+}
+
+v_int64 MemoryPool::getCacheMisses(){
+  return m_cacheMisses;
+}
+
 oatpp::concurrency::SpinLock MemoryPool::POOLS_SPIN_LOCK;
 std::unordered_map<v_int64, MemoryPool*> MemoryPool::POOLS;
 std::atomic<v_int64> MemoryPool::poolIdCounter(0);
+std::vector<v_int32> MemoryPool::freeCacheSlots;
+v_int32 MemoryPool::cacheSlotsCount = 0;
 
 const v_int32 ThreadDistributedMemoryPool::SHARDS_COUNT_DEFAULT = OATPP_THREAD_DISTRIBUTED_MEM_POOL_SHARDS_COUNT;
+const v_int32 ThreadDistributedMemoryPool::CACHE_SIZE_DEFAULT = OATPP_THREAD_DISTRIBUTED_MEM_POOL_CACHE_SIZE;
 
 #if defined(OATPP_DISABLE_POOL_ALLOCATIONS) || defined(OATPP_COMPAT_BUILD_NO_THREAD_LOCAL)
-ThreadDistributedMemoryPool::ThreadDistributedMemoryPool(const std::string& name, v_int32 entrySize, v_int32 chunkSize, v_int32 shardsCount)
+ThreadDistributedMemoryPool::ThreadDistributedMemoryPool(const std::string& name, v_int32 entrySize, v_int32 chunkSize,
+                                                         v_int32 shardsCount, v_int32 cacheSize)
   : m_shardsCount(1)
   , m_shards(new MemoryPool*[1])
   , m_deleted(false)
 {
+  (void) shardsCount;
+  (void) cacheSize;
   for(v_int32 i = 0; i < m_shardsCount; i++){
     m_shards[i] = new MemoryPool(name + "_" + oatpp::utils::conversion::int32ToStdStr(i), entrySize, chunkSize);
   }
 }
 #else
-ThreadDistributedMemoryPool::ThreadDistributedMemoryPool(const std::string& name, v_int32 entrySize, v_int32 chunkSize, v_int32 shardsCount)
+ThreadDistributedMemoryPool::ThreadDistributedMemoryPool(const std::string& name, v_int32 entrySize, v_int32 chunkSize,
+                                                         v_int32 shardsCount, v_int32 cacheSize)
   : m_shardsCount(shardsCount)
   , m_shards(new MemoryPool*[m_shardsCount])
   , m_deleted(false)
 {
   for(v_int32 i = 0; i < m_shardsCount; i++){
-    m_shards[i] = new MemoryPool(name + "_" + oatpp::utils::conversion::int32ToStdStr(i), entrySize, chunkSize);
+    m_shards[i] = new MemoryPool(name + "_" + oatpp::utils::conversion::int32ToStdStr(i), entrySize, chunkSize, cacheSize);
   }
 }
 #endif
@@ -28,15 +28,20 @@
 #include "oatpp/core/concurrency/SpinLock.hpp"
 #include "oatpp/core/base/Environment.hpp"
 
+#include <atomic>
 #include <list>
 #include <unordered_map>
+#include <vector>
 #include <cstring>
 
 namespace oatpp { namespace base { namespace  memory {
 
 /**
  * Memory Pool allocates memory chunks. Each chunk consists of specified number of fixed-size entries.
- * Entries can be obtained and freed by user. When memory pool runs out of free entries, new chunk is allocated.
+ * Entries can be obtained and freed by user. When memory pool runs out of free entries, new chunk is allocated.<br>
+ * If pool is created with non-zero `cacheSize`, each thread keeps a cache ("magazine") of up to `cacheSize` free entries
+ * of the pool. Entries are obtained from and freed to the thread cache without locking, and are moved
+ * between the thread cache and the pool in batches of `cacheSize / 2` entries.
  */
 class MemoryPool {
 public:
@@ -44,6 +49,11 @@ public:
   static std::unordered_map<v_int64, MemoryPool*> POOLS;
 private:
   static std::atomic<v_int64> poolIdCounter;
+  /*
+   * Indexes of thread caches of pools which are no longer alive. Guarded by POOLS_SPIN_LOCK.
+   */
+  static std::vector<v_int32> freeCacheSlots;
+  static v_int32 cacheSlotsCount;
 private:
   
   class EntryHeader {
@@ -60,10 +70,14 @@ private:
     EntryHeader* next;
     
   };
+
+  class ThreadCache;
   
 private:
   void allocChunk();
   void freeByEntryHeader(EntryHeader* entry);
+  void* obtainLocked();
+  void freeLocked(EntryHeader* entry);
 private:
   std::string m_name;
   v_int32 m_entrySize;
@@ -72,6 +86,10 @@ private:
   std::list<p_char8> m_chunks;
   EntryHeader* m_rootEntry;
   v_int32 m_objectsCount;
+  v_int32 m_cacheSize;
+  v_int32 m_cacheSlot;
+  std::atomic<v_int64> m_cacheHits;
+  std::atomic<v_int64> m_cacheMisses;
   oatpp::concurrency::SpinLock m_lock;
 public:
 
@@ -80,8 +98,9 @@ public:
    * @param name - name of the pool.
    * @param entrySize - size of the entry in bytes returned in call to &l:MemoryPool::obtain ();.
    * @param chunkSize - number of entries in one chunk.
+   * @param cacheSize - max number of free entries cached per thread. `0` - no thread cache.
    */
-  MemoryPool(const std::string& name, v_int32 entrySize, v_int32 chunkSize);
+  MemoryPool(const std::string& name, v_int32 entrySize, v_int32 chunkSize, v_int32 cacheSize = 0);
 
   /**
    * Deleted copy-constructor.
@@ -126,10 +145,35 @@ public:
   v_int64 getSize();
 
   /**
-   * Get number of entries currently in use.
+   * Get size of the memory held by memory pool in bytes. Including entry headers.
+   * @return - size of the memory held by memory pool in bytes.
+   */
+  v_int64 getMemorySize();
+
+  /**
+   * Get number of entries currently in use. Entries cached by threads are counted as used.
    * @return - number of entries currently in use.
    */
   v_int32 getObjectsCount();
+
+  /**
+   * Get max number of free entries cached per thread.
+   * @return - max number of free entries cached per thread. `0` - if pool has no thread cache.
+   */
+  v_int32 getCacheSize();
+
+  /**
+   * Get number of calls to &l:MemoryPool::obtain (); served by thread cache without locking the pool.
+   * Thread caches report their hits to the pool in batches, so this value may lag behind.
+   * @return - number of thread cache hits.
+   */
+  v_int64 getCacheHits();
+
+  /**
+   * Get number of calls to &l:MemoryPool::obtain (); which had to refill thread cache from the pool.
+   * @return - number of thread cache misses.
+   */
+  v_int64 getCacheMisses();
   
 };
 
@@ -147,6 +191,11 @@ public:
    * Default number of MemoryPools (&l:MemoryPool;) "shards" to create.
    */
   static const v_int32 SHARDS_COUNT_DEFAULT;
+
+  /**
+   * Default max number of free entries of each shard cached per thread.
+   */
+  static const v_int32 CACHE_SIZE_DEFAULT;
 public:
 
   /**
@@ -155,9 +204,11 @@ public:
    * @param entrySize - size of memory pool entry.
    * @param chunkSize - number of entries in chunk.
    * @param shardsCount - number of MemoryPools (&l:MemoryPool;) "shards" to create.
+   * @param cacheSize - max number of free entries of each shard cached per thread. `0` - no thread cache.
    */
   ThreadDistributedMemoryPool(const std::string& name, v_int32 entrySize, v_int32 chunkSize,
-                              v_int32 shardsCount = SHARDS_COUNT_DEFAULT);
+                              v_int32 shardsCount = SHARDS_COUNT_DEFAULT,
+                              v_int32 cacheSize = CACHE_SIZE_DEFAULT);
 
   /**
    * Deleted copy-constructor.
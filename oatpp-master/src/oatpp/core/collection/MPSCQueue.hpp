@@ -0,0 +1,150 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_collection_MPSCQueue_hpp
+#define oatpp_collection_MPSCQueue_hpp
+
+#include "./FastQueue.hpp"
+
+#include <atomic>
+
+namespace oatpp { namespace collection {
+
+/**
+ * Intrusive lock-free multi-producer single-consumer queue. <br>
+ * Entries are linked through their `_ref` field, the same way as in &id:oatpp::collection::FastQueue;.
+ * Producers push entries with a CAS on the head, consumer takes all entries at once.
+ * Since there is no single-entry pop, it is also safe to have several threads taking entries.
+ * @tparam T - entry type. Must have `T* _ref` field accessible.
+ */
+template<typename T>
+class MPSCQueue {
+private:
+  std::atomic<T*> m_head;
+private:
+
+  /*
+   * Push chain of entries (first->...->last) which is already in LIFO order.
+   */
+  void pushChain(T* first, T* last) {
+    T* head = m_head.load(std::memory_order_relaxed);
+    do {
+      last->_ref = head;
+    } while(!m_head.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+public:
+
+  MPSCQueue()
+    : m_head(nullptr)
+  {}
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+  ~MPSCQueue() {
+    FastQueue<T> queue;
+    popAll(queue);
+  }
+
+  /**
+   * Push entry. Can be called from any thread.
+   * @param entry
+   */
+  void push(T* entry) {
+    pushChain(entry, entry);
+  }
+
+  /**
+   * Move all entries of the &id:oatpp::collection::FastQueue; to this queue. Can be called from any thread.
+   * Order of entries is preserved.
+   * @param queue
+   */
+  void pushAll(FastQueue<T>& queue) {
+
+    if(queue.first == nullptr) {
+      return;
+    }
+
+    T* first = nullptr;
+    T* last = queue.first;
+
+    T* curr = queue.first;
+    while(curr != nullptr) {
+      T* next = curr->_ref;
+      curr->_ref = first;
+      first = curr;
+      curr = next;
+    }
+
+    queue.first = nullptr;
+    queue.last = nullptr;
+    queue.count = 0;
+
+    pushChain(first, last);
+
+  }
+
+  /**
+   * Take all entries and append them to the &id:oatpp::collection::FastQueue; in the order they were pushed.
+   * @param toQueue
+   * @return - number of entries taken.
+   */
+  v_int32 popAll(FastQueue<T>& toQueue) {
+
+    if(m_head.load(std::memory_order_relaxed) == nullptr) {
+      return 0;
+    }
+
+    T* curr = m_head.exchange(nullptr, std::memory_order_acquire);
+    if(curr == nullptr) {
+      return 0;
+    }
+
+    FastQueue<T> queue;
+    while(curr != nullptr) {
+      T* next = curr->_ref;
+      queue.pushFront(curr);
+      curr = next;
+    }
+
+    v_int32 count = queue.count;
+    FastQueue<T>::moveAll(queue, toQueue);
+    return count;
+
+  }
+
+  /**
+   * Check if queue is empty.
+   * @return
+   */
+  bool empty() const {
+    return m_head.load(std::memory_order_acquire) == nullptr;
+  }
+
+};
+
+}}
+
+#endif // oatpp_collection_MPSCQueue_hpp
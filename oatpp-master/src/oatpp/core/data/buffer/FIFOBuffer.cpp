@@ -24,6 +24,7 @@
 
 #include "FIFOBuffer.hpp"
 #include <mutex>
+#include <algorithm>
 
 namespace oatpp { namespace data{ namespace buffer {
 
@@ -67,6 +68,29 @@ data::v_io_size FIFOBuffer::getBufferSize() const {
   return m_bufferSize;
 }
 
+data::v_io_size FIFOBuffer::compact() {
+
+  auto size = availableToRead();
+
+  if(size == 0) {
+    setBufferPosition(0, 0, false);
+    return 0;
+  }
+
+  if(m_readPosition > 0) {
+    if(m_readPosition < m_writePosition) {
+      std::memmove(m_buffer, &m_buffer[m_readPosition], (size_t) size);
+    } else {
+      /* data wraps around the end of the buffer */
+      std::rotate(m_buffer, &m_buffer[m_readPosition], &m_buffer[m_bufferSize]);
+    }
+  }
+
+  setBufferPosition(0, size == m_bufferSize ? 0 : size, true);
+  return size;
+
+}
+
 data::v_io_size FIFOBuffer::read(void *data, data::v_io_size count) {
   
   if(!m_canRead) {
@@ -85,6 +85,13 @@ public:
    */
   data::v_io_size getBufferSize() const;
 
+  /**
+   * Move bytes available to read to the beginning of the buffer. <br>
+   * After this call read position is `0` and all available bytes are contiguous.
+   * @return - amount of bytes available to read.
+   */
+  data::v_io_size compact();
+
   /**
    * read up to count bytes from the buffer to data
    * @param data
@@ -26,6 +26,95 @@
 
 namespace oatpp { namespace data { namespace mapping {
 
+namespace {
+
+class WholeObjectWriter : public ObjectMapper::Writer {
+private:
+  const ObjectMapper* m_mapper;
+  type::AbstractObjectWrapper m_object;
+public:
+
+  WholeObjectWriter(const ObjectMapper* mapper, const type::AbstractObjectWrapper& object)
+    : m_mapper(mapper)
+    , m_object(object)
+  {}
+
+  bool writeNext(const std::shared_ptr<oatpp::data::stream::ConsistentOutputStream>& stream) override {
+    m_mapper->write(stream, m_object);
+    return false;
+  }
+
+};
+
+class BufferingReader : public ObjectMapper::Reader {
+private:
+  const ObjectMapper* m_mapper;
+  const type::Type* m_type;
+  stream::ChunkedBuffer m_buffer;
+public:
+
+  BufferingReader(const ObjectMapper* mapper, const type::Type* const type)
+    : m_mapper(mapper)
+    , m_type(type)
+  {}
+
+  bool feed(const void* data, data::v_io_size size) override {
+    m_buffer.write(data, size);
+    return true;
+  }
+
+  type::AbstractObjectWrapper finish() override {
+    auto str = m_buffer.toString();
+    m_buffer.clear();
+    oatpp::parser::Caret caret(str);
+    auto result = m_mapper->read(caret, m_type);
+    if(caret.hasError()) {
+      setError(caret.getErrorMessage(), caret.getErrorCode(), caret.getPosition());
+      return type::AbstractObjectWrapper::empty();
+    }
+    return result;
+  }
+
+};
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ObjectMapper::Reader
+
+ObjectMapper::Reader::Reader()
+  : m_errorMessage(nullptr)
+  , m_errorCode(0)
+  , m_errorPosition(0)
+{}
+
+void ObjectMapper::Reader::setError(const char* message, v_int32 code, v_int64 position) {
+  if(m_errorMessage == nullptr) {
+    m_errorMessage = message;
+    m_errorCode = code;
+    m_errorPosition = position;
+  }
+}
+
+bool ObjectMapper::Reader::hasError() const {
+  return m_errorMessage != nullptr;
+}
+
+const char* ObjectMapper::Reader::getErrorMessage() const {
+  return m_errorMessage;
+}
+
+v_int32 ObjectMapper::Reader::getErrorCode() const {
+  return m_errorCode;
+}
+
+v_int64 ObjectMapper::Reader::getErrorPosition() const {
+  return m_errorPosition;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// ObjectMapper
+
 ObjectMapper::ObjectMapper(const Info& info)
   : m_info(info)
 {}
@@ -34,6 +123,14 @@ const ObjectMapper::Info& ObjectMapper::getInfo() const {
   return m_info;
 }
 
+std::shared_ptr<ObjectMapper::Writer> ObjectMapper::createWriter(const type::AbstractObjectWrapper& variant) const {
+  return std::make_shared<WholeObjectWriter>(this, variant);
+}
+
+std::shared_ptr<ObjectMapper::Reader> ObjectMapper::createReader(const type::Type* const type) const {
+  return std::make_shared<BufferingReader>(this, type);
+}
+
 oatpp::String ObjectMapper::writeToString(const type::AbstractObjectWrapper& variant) const {
   auto stream = stream::ChunkedBuffer::createShared();
   write(stream, variant);
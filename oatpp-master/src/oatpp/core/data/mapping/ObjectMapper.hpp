@@ -62,6 +62,101 @@ public:
      */
     const char* const http_content_type;
 
+  };
+public:
+
+  /**
+   * Incremental object writer. <br>
+   * Serializes object in portions so that the caller may flush output between the portions
+   * and keep memory usage bounded regardless of the object size.
+   */
+  class Writer {
+  public:
+
+    /**
+     * Virtual destructor.
+     */
+    virtual ~Writer() = default;
+
+    /**
+     * Write next portion of the serialized object to stream.
+     * @param stream - &id:oatpp::data::stream::ConsistentOutputStream; to write to.
+     * @return - `true` if there is more data to write. `false` if object is fully written.
+     */
+    virtual bool writeNext(const std::shared_ptr<oatpp::data::stream::ConsistentOutputStream>& stream) = 0;
+
+  };
+
+  /**
+   * Incremental object reader. <br>
+   * Accepts serialized data in portions as they arrive and builds the object as it goes,
+   * so that the caller doesn't have to accumulate the whole serialized data before parsing.
+   */
+  class Reader {
+  private:
+    const char* m_errorMessage;
+    v_int32 m_errorCode;
+    v_int64 m_errorPosition;
+  protected:
+
+    /**
+     * Set error. Only the first error is kept.
+     * @param message - error message. Should be a static string.
+     * @param code - error code.
+     * @param position - position in the serialized data where error occurred.
+     */
+    void setError(const char* message, v_int32 code, v_int64 position);
+
+  public:
+
+    /**
+     * Constructor.
+     */
+    Reader();
+
+    /**
+     * Virtual destructor.
+     */
+    virtual ~Reader() = default;
+
+    /**
+     * Feed next portion of the serialized data.
+     * @param data - pointer to data.
+     * @param size - size of the data.
+     * @return - `true` if data was accepted. `false` on error. See &l:ObjectMapper::Reader::getErrorMessage ();.
+     */
+    virtual bool feed(const void* data, data::v_io_size size) = 0;
+
+    /**
+     * Signal end of the serialized data and get the resultant object.
+     * @return - deserialized object. Empty wrapper on error.
+     */
+    virtual type::AbstractObjectWrapper finish() = 0;
+
+    /**
+     * Check if reader has error.
+     * @return - `true` if error occurred.
+     */
+    bool hasError() const;
+
+    /**
+     * Get error message.
+     * @return - error message or `nullptr`.
+     */
+    const char* getErrorMessage() const;
+
+    /**
+     * Get error code.
+     * @return - error code.
+     */
+    v_int32 getErrorCode() const;
+
+    /**
+     * Get position in the serialized data where error occurred.
+     * @return - error position.
+     */
+    v_int64 getErrorPosition() const;
+
   };
 private:
   Info m_info;
@@ -96,6 +191,24 @@ public:
   virtual mapping::type::AbstractObjectWrapper read(oatpp::parser::Caret& caret,
                                                     const mapping::type::Type* const type) const = 0;
 
+  /**
+   * Create incremental writer for the object. <br>
+   * Default implementation returns writer which writes the whole object in one portion. <br>
+   * Override this method if the mapper is able to serialize object in parts.
+   * @param variant - Object to serialize.
+   * @return - `std::shared_ptr` to &l:ObjectMapper::Writer;.
+   */
+  virtual std::shared_ptr<Writer> createWriter(const type::AbstractObjectWrapper& variant) const;
+
+  /**
+   * Create incremental reader for the object of the specified type. <br>
+   * Default implementation returns reader which accumulates all data and calls &l:ObjectMapper::read (); once finished. <br>
+   * Override this method if the mapper is able to deserialize object from partial data.
+   * @param type - pointer to object type. See &id:oatpp::data::mapping::type::Type;.
+   * @return - `std::shared_ptr` to &l:ObjectMapper::Reader;.
+   */
+  virtual std::shared_ptr<Reader> createReader(const type::Type* const type) const;
+
   /**
    * Serialize object to String.
    * @param variant - Object to serialize.
@@ -418,22 +418,7 @@ namespace std {
     typedef v_word32 result_type;
     
     result_type operator()(oatpp::data::mapping::type::String const& s) const noexcept {
-      
-      p_char8 data = s->getData();
-      v_int32 size4 = s->getSize() >> 2;
-      
-      result_type result = 0;
-      
-      for(v_int32 i = 0; i < size4; i++) {
-        result ^= *((p_word32) data);
-        data += 4;
-      }
-      
-      for(v_int32 i = 0; i < s->getSize() - (size4 << 2); i++ ) {
-        ((p_char8) &result)[i] ^= data[i];
-      }
-      
-      return result;
+      return s->getHash();
     }
     
   };
@@ -24,6 +24,13 @@
 
 #include "./Type.hpp"
 
+#include "./Primitive.hpp"
+#include "./List.hpp"
+#include "./ListMap.hpp"
+#include "./Object.hpp"
+
+#include <cstring>
+
 
 namespace oatpp { namespace data { namespace mapping { namespace type {
   
@@ -41,14 +48,83 @@ namespace __class {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Type::Properties
 
+Type::Properties::Properties()
+  : m_index(1, IndexEntry{nullptr, 0})
+  , m_indexSeed(0)
+  , m_indexMask(0)
+{}
+
+v_word32 Type::Properties::hash(const char* data, v_int32 size, v_word32 seed) {
+  v_word32 result = 2166136261U ^ seed;
+  for(v_int32 i = 0; i < size; i ++) {
+    result ^= (v_char8) data[i];
+    result *= 16777619U;
+  }
+  return result ^ (result >> 15);
+}
+
+void Type::Properties::buildIndex() {
+
+  /* Names in m_map are unique - look for a seed which gives no collisions. Grow table if none found */
+
+  v_word32 tableSize = 4;
+  while(tableSize < m_map.size() * 2) {
+    tableSize <<= 1;
+  }
+
+  std::vector<IndexEntry> index;
+
+  while(true) {
+
+    for(v_word32 seed = 0; seed < 256; seed ++) {
+
+      index.assign(tableSize, IndexEntry{nullptr, 0});
+      bool collision = false;
+
+      for(auto& pair : m_map) {
+        v_int32 nameSize = (v_int32) pair.first.size();
+        IndexEntry& entry = index[hash(pair.first.data(), nameSize, seed) & (tableSize - 1)];
+        if(entry.property != nullptr) {
+          collision = true;
+          break;
+        }
+        entry.property = pair.second;
+        entry.nameSize = nameSize;
+      }
+
+      if(!collision) {
+        m_index.swap(index);
+        m_indexSeed = seed;
+        m_indexMask = tableSize - 1;
+        return;
+      }
+
+    }
+
+    tableSize <<= 1;
+
+  }
+
+}
+
 void Type::Properties::pushBack(Property* property) {
   m_map.insert({property->name, property});
   m_list.push_back(property);
+  buildIndex();
 }
   
 void Type::Properties::pushFrontAll(Properties* properties) {
   m_map.insert(properties->m_map.begin(), properties->m_map.end());
   m_list.insert(m_list.begin(), properties->m_list.begin(), properties->m_list.end());
+  buildIndex();
+}
+
+Type::Property* Type::Properties::find(const char* name, v_int32 size) const {
+  const IndexEntry& entry = m_index[hash(name, size, m_indexSeed) & m_indexMask];
+  if(entry.property != nullptr && entry.nameSize == size && std::memcmp(entry.property->name, name, size) == 0) {
+    return entry.property;
+  }
+  return nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -80,11 +156,44 @@ AbstractObjectWrapper& Type::Property::getAsRef(void* object) {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Type
 
+v_int32 Type::getClassId(const char* name) {
+
+  /* Types are compared by name pointer - same as mappers did before class ids */
+
+  if(name == __class::String::CLASS_NAME) {
+    return CLASS_ID_STRING;
+  } else if(name == __class::Int8::CLASS_NAME) {
+    return CLASS_ID_INT8;
+  } else if(name == __class::Int16::CLASS_NAME) {
+    return CLASS_ID_INT16;
+  } else if(name == __class::Int32::CLASS_NAME) {
+    return CLASS_ID_INT32;
+  } else if(name == __class::Int64::CLASS_NAME) {
+    return CLASS_ID_INT64;
+  } else if(name == __class::Float32::CLASS_NAME) {
+    return CLASS_ID_FLOAT32;
+  } else if(name == __class::Float64::CLASS_NAME) {
+    return CLASS_ID_FLOAT64;
+  } else if(name == __class::Boolean::CLASS_NAME) {
+    return CLASS_ID_BOOLEAN;
+  } else if(name == __class::AbstractList::CLASS_NAME) {
+    return CLASS_ID_LIST;
+  } else if(name == __class::AbstractListMap::CLASS_NAME) {
+    return CLASS_ID_LIST_MAP;
+  } else if(name == __class::AbstractObject::CLASS_NAME) {
+    return CLASS_ID_OBJECT;
+  }
+
+  return CLASS_ID_UNKNOWN;
+
+}
+
 Type::Type(const char* pName, const char* pNameQualifier)
   : name(pName)
   , nameQualifier(pNameQualifier)
   , creator(nullptr)
   , properties(nullptr)
+  , classId(getClassId(pName))
 {}
 
 Type::Type(const char* pName, const char* pNameQualifier, Creator pCreator)
@@ -92,6 +201,7 @@ Type::Type(const char* pName, const char* pNameQualifier, Creator pCreator)
   , nameQualifier(pNameQualifier)
   , creator(pCreator)
   , properties(nullptr)
+  , classId(getClassId(pName))
 {}
 
 Type::Type(const char* pName, const char* pNameQualifier, Creator pCreator, Properties* pProperties)
@@ -99,6 +209,7 @@ Type::Type(const char* pName, const char* pNameQualifier, Creator pCreator, Prop
   , nameQualifier(pNameQualifier)
   , creator(pCreator)
   , properties(pProperties)
+  , classId(getClassId(pName))
 {}
   
 }}}}
@@ -30,6 +30,7 @@
 #include <list>
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 namespace oatpp { namespace data { namespace mapping { namespace type {
   
@@ -119,7 +120,7 @@ public:
     return *this;
   }
   
-  PolymorphicWrapper& operator=(const PolymorphicWrapper<T>&& other){
+  PolymorphicWrapper& operator=(PolymorphicWrapper<T>&& other){
     m_ptr = std::move(other.m_ptr);
     return *this;
   }
@@ -229,7 +230,7 @@ public:
     return *this;
   }
   
-  ObjectWrapper& operator=(const PolymorphicWrapper<T>&& other){
+  ObjectWrapper& operator=(PolymorphicWrapper<T>&& other){
     if(this->valueType != other.valueType){
       OATPP_LOGE("ObjectWrapper", "Invalid class cast");
       throw std::runtime_error("[oatpp::data::mapping::type::ObjectWrapper]: Invalid class cast");
@@ -255,15 +256,58 @@ public:
   class Property; // FWD
 public:
 
+  /**
+   * Dense ids of built-in types. <br>
+   * Mappers dispatch on &l:Type::classId; instead of comparing type names one by one.
+   */
+  enum ClassId : v_int32 {
+    CLASS_ID_UNKNOWN = 0,
+    CLASS_ID_STRING,
+    CLASS_ID_INT8,
+    CLASS_ID_INT16,
+    CLASS_ID_INT32,
+    CLASS_ID_INT64,
+    CLASS_ID_FLOAT32,
+    CLASS_ID_FLOAT64,
+    CLASS_ID_BOOLEAN,
+    CLASS_ID_LIST,
+    CLASS_ID_LIST_MAP,
+    CLASS_ID_OBJECT
+  };
+
+private:
+  static v_int32 getClassId(const char* name);
+public:
+
   /**
    * Object type properties table.
    */
   class Properties {
+  private:
+
+    struct IndexEntry {
+      Property* property;
+      v_int32 nameSize;
+    };
+
+  private:
+    static v_word32 hash(const char* data, v_int32 size, v_word32 seed);
   private:
     std::unordered_map<std::string, Property*> m_map;
     std::list<Property*> m_list;
+    /* Perfect hash table of properties. Rebuilt when properties are added */
+    std::vector<IndexEntry> m_index;
+    v_word32 m_indexSeed;
+    v_word32 m_indexMask;
+  private:
+    void buildIndex();
   public:
 
+    /**
+     * Constructor.
+     */
+    Properties();
+
     /**
      * Add property to the end of the list.
      * @param property
@@ -291,6 +335,16 @@ public:
     const std::list<Property*>& getList() const {
       return m_list;
     }
+
+    /**
+     * Find property by name. <br>
+     * Lookup is done in a perfect hash table built when properties are registered -
+     * one hash and one comparison, no allocations.
+     * @param name - pointer to property name. Doesn't have to be null-terminated.
+     * @param size - size of the name.
+     * @return - &id:oatpp::data::mapping::type::Type::Property;* or `nullptr` if not found.
+     */
+    Property* find(const char* name, v_int32 size) const;
     
   };
 
@@ -396,6 +450,11 @@ public:
    * Pointer to type properties.
    */
   const Properties* const properties;
+
+  /**
+   * Type class id - &l:Type::ClassId;. Resolved from type name on type creation.
+   */
+  const v_int32 classId;
   
 };
   
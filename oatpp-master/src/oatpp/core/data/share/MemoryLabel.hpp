@@ -83,6 +83,28 @@ public:
     return m_memoryHandle;
   }
 
+  /**
+   * Get hash of labeled data. If label covers the whole memory handle - hash cached by the handle is used.
+   * @return - hash. See &id:oatpp::base::StrBuffer::hash;.
+   */
+  v_word32 getHash() const {
+    if(m_memoryHandle && m_memoryHandle->getData() == m_data && m_memoryHandle->getSize() == m_size) {
+      return m_memoryHandle->getHash();
+    }
+    return base::StrBuffer::hash(m_data, m_size);
+  }
+
+  /**
+   * Get case-insensitive hash of labeled data. If label covers the whole memory handle - hash cached by the handle is used.
+   * @return - hash. See &id:oatpp::base::StrBuffer::hashCI;.
+   */
+  v_word32 getHashCI() const {
+    if(m_memoryHandle && m_memoryHandle->getData() == m_data && m_memoryHandle->getSize() == m_size) {
+      return m_memoryHandle->getHashCI();
+    }
+    return base::StrBuffer::hashCI(m_data, m_size);
+  }
+
   /**
    * Check if labeled data equals to data specified.
    * Data is compared using &id:oatpp::base::StrBuffer::equals;.
@@ -136,11 +158,11 @@ public:
   StringKeyLabel(const oatpp::String& str);
   
   bool operator==(const StringKeyLabel &other) const {
-    return m_size == other.m_size && base::StrBuffer::equals(m_data, other.m_data, m_size);
+    return m_size == other.m_size && (m_data == other.m_data || base::StrBuffer::equals(m_data, other.m_data, m_size));
   }
   
   bool operator!=(const StringKeyLabel &other) const {
-    return !(m_size == other.m_size && base::StrBuffer::equals(m_data, other.m_data, m_size));
+    return !(m_size == other.m_size && (m_data == other.m_data || base::StrBuffer::equals(m_data, other.m_data, m_size)));
   }
   
 };
@@ -158,11 +180,11 @@ public:
   StringKeyLabelCI(const oatpp::String& str);
   
   bool operator==(const StringKeyLabelCI &other) const {
-    return m_size == other.m_size && base::StrBuffer::equalsCI(m_data, other.m_data, m_size);
+    return m_size == other.m_size && (m_data == other.m_data || base::StrBuffer::equalsCI(m_data, other.m_data, m_size));
   }
   
   bool operator!=(const StringKeyLabelCI &other) const {
-    return !(m_size == other.m_size && base::StrBuffer::equalsCI(m_data, other.m_data, m_size));
+    return !(m_size == other.m_size && (m_data == other.m_data || base::StrBuffer::equalsCI(m_data, other.m_data, m_size)));
   }
   
 };
@@ -174,17 +196,19 @@ public:
  */
 class StringKeyLabelCI_FAST : public MemoryLabel {
 public:
+
+  StringKeyLabelCI_FAST() : MemoryLabel() {};
   
   StringKeyLabelCI_FAST(const std::shared_ptr<base::StrBuffer>& memHandle, p_char8 data, v_int32 size);
   StringKeyLabelCI_FAST(const char* constText);
   StringKeyLabelCI_FAST(const oatpp::String& str);
   
   bool operator==(const StringKeyLabelCI_FAST &other) const {
-    return m_size == other.m_size && base::StrBuffer::equalsCI_FAST(m_data, other.m_data, m_size);
+    return m_size == other.m_size && (m_data == other.m_data || base::StrBuffer::equalsCI_FAST(m_data, other.m_data, m_size));
   }
   
   bool operator!=(const StringKeyLabelCI_FAST &other) const {
-    return !(m_size == other.m_size && base::StrBuffer::equalsCI_FAST(m_data, other.m_data, m_size));
+    return !(m_size == other.m_size && (m_data == other.m_data || base::StrBuffer::equalsCI_FAST(m_data, other.m_data, m_size)));
   }
   
 };
@@ -200,22 +224,7 @@ namespace std {
     typedef v_word32 result_type;
     
     result_type operator()(oatpp::data::share::StringKeyLabel const& s) const noexcept {
-      
-      p_char8 data = s.getData();
-      v_int32 size4 = s.getSize() >> 2;
-      
-      result_type result = 0;
-      
-      for(v_int32 i = 0; i < size4; i++) {
-        result ^= *((p_word32) data);
-        data += 4;
-      }
-      
-      for(v_int32 i = 0; i < s.getSize() - (size4 << 2); i++ ) {
-        ((p_char8) &result)[i] ^= data[i];
-      }
-      
-      return result;
+      return s.getHash();
     }
   };
   
@@ -226,22 +235,7 @@ namespace std {
     typedef v_word32 result_type;
     
     result_type operator()(oatpp::data::share::StringKeyLabelCI const& s) const noexcept {
-      
-      p_char8 data = s.getData();
-      v_int32 size4 = s.getSize() >> 2;
-      
-      result_type result = 0;
-      
-      for(v_int32 i = 0; i < size4; i++) {
-        result ^= (*((p_word32) data) | 538976288); // 538976288 = 32 | (32 << 8) | (32 << 16) | (32 << 24);
-        data += 4;
-      }
-      
-      for(v_int32 i = 0; i < s.getSize() - (size4 << 2); i++ ) {
-        ((p_char8) &result)[i] ^= (data[i] | 32);
-      }
-      
-      return result;
+      return s.getHashCI();
     }
   };
   
@@ -252,22 +246,7 @@ namespace std {
     typedef v_word32 result_type;
     
     result_type operator()(oatpp::data::share::StringKeyLabelCI_FAST const& s) const noexcept {
-      
-      p_char8 data = s.getData();
-      v_int32 size4 = s.getSize() >> 2;
-      
-      result_type result = 0;
-      
-      for(v_int32 i = 0; i < size4; i++) {
-        result ^= (*((p_word32) data) | 538976288); // 538976288 = 32 | (32 << 8) | (32 << 16) | (32 << 24);
-        data += 4;
-      }
-      
-      for(v_int32 i = 0; i < s.getSize() - (size4 << 2); i++ ) {
-        ((p_char8) &result)[i] ^= (data[i] | 32);
-      }
-      
-      return result;
+      return s.getHashCI();
     }
   };
   
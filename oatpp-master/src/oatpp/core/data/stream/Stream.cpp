@@ -27,6 +27,35 @@
 
 namespace oatpp { namespace data{ namespace stream {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// OutputStream
+
+data::v_io_size OutputStream::writeVectored(const IOVector* vectors, v_int32 count) {
+
+  data::v_io_size progress = 0;
+
+  for(v_int32 i = 0; i < count; i ++) {
+
+    if(vectors[i].size == 0) {
+      continue;
+    }
+
+    auto res = write(vectors[i].data, vectors[i].size);
+    if(res <= 0) {
+      return progress > 0 ? progress : res;
+    }
+
+    progress += res;
+    if(res < vectors[i].size) {
+      break;
+    }
+
+  }
+
+  return progress;
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // ConsistentOutputStream
 
@@ -118,6 +147,39 @@ void AsyncInlineWriteData::setEof() {
   bytesLeft = 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// AsyncInlineWriteVectoredData
+
+AsyncInlineWriteVectoredData::AsyncInlineWriteVectoredData()
+  : vectors(nullptr)
+  , count(0)
+{}
+
+AsyncInlineWriteVectoredData::AsyncInlineWriteVectoredData(IOVector* pVectors, v_int32 pCount)
+  : vectors(pVectors)
+  , count(pCount)
+{
+  inc(0);
+}
+
+void AsyncInlineWriteVectoredData::set(IOVector* pVectors, v_int32 pCount) {
+  vectors = pVectors;
+  count = pCount;
+  inc(0);
+}
+
+void AsyncInlineWriteVectoredData::inc(data::v_io_size amount) {
+  while(count > 0 && amount >= vectors->size) {
+    amount -= vectors->size;
+    vectors ++;
+    count --;
+  }
+  if(count > 0) {
+    vectors->data = &((p_char8) vectors->data)[amount];
+    vectors->size -= amount;
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // AsyncInlineReadData
 
@@ -479,6 +541,25 @@ oatpp::async::Action writeExactSizeDataAsyncInline(oatpp::async::AbstractCorouti
 
 }
 
+oatpp::async::Action writeExactSizeVectoredAsyncInline(oatpp::async::AbstractCoroutine* coroutine,
+                                                       oatpp::data::stream::OutputStream* stream,
+                                                       AsyncInlineWriteVectoredData& inlineData,
+                                                       oatpp::async::Action&& nextAction) {
+  if(inlineData.count > 0) {
+    auto res = stream->writeVectored(inlineData.vectors, inlineData.count);
+    if(res > 0) {
+      inlineData.inc(res);
+      if (inlineData.count > 0) {
+        return stream->suggestOutputStreamAction(res);
+      }
+    } else {
+      return asyncOutputStreamActionOnIOError(coroutine, stream, res);
+    }
+  }
+  return std::forward<oatpp::async::Action>(nextAction);
+
+}
+
 oatpp::async::CoroutineStarter writeExactSizeDataAsync(const std::shared_ptr<oatpp::data::stream::OutputStream>& stream,
                                                        const void* data, data::v_io_size size)
 {
@@ -590,4 +671,29 @@ oatpp::data::v_io_size writeExactSizeData(oatpp::data::stream::OutputStream* str
   return progress;
 }
   
+oatpp::data::v_io_size writeExactSizeVectored(oatpp::data::stream::OutputStream* stream, IOVector* vectors, v_int32 count) {
+
+  AsyncInlineWriteVectoredData inlineData(vectors, count);
+  oatpp::data::v_io_size progress = 0;
+
+  while (inlineData.count > 0) {
+
+    auto res = stream->writeVectored(inlineData.vectors, inlineData.count);
+
+    if(res > 0) {
+      inlineData.inc(res);
+      progress += res;
+    } else { // if res == 0 then probably stream handles write() error incorrectly. return.
+      if(res == data::IOError::RETRY || res == data::IOError::WAIT_RETRY) {
+        continue;
+      }
+      return progress;
+    }
+
+  }
+
+  return progress;
+
+}
+
 }}}
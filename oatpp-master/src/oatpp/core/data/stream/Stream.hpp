@@ -48,6 +48,23 @@ enum IOMode : v_int32 {
   NON_BLOCKING = 1
 };
 
+/**
+ * Data buffer descriptor for vectored (scatter/gather) write - &l:OutputStream::writeVectored ();.
+ */
+struct IOVector {
+
+  /**
+   * Pointer to data.
+   */
+  const void* data;
+
+  /**
+   * Size of data in bytes.
+   */
+  data::v_io_size size;
+
+};
+
 /**
  * Output Stream.
  */
@@ -68,6 +85,16 @@ public:
    */
   virtual data::v_io_size write(const void *data, data::v_io_size count) = 0;
 
+  /**
+   * Write data from several buffers in one operation (scatter/gather write) and return number of bytes actually written. <br>
+   * Buffers are written in order. It is a legal case if return result is less than the total size of the buffers. Caller should handle this! <br>
+   * Default implementation calls &l:OutputStream::write (); for each buffer and stops on the first incomplete write.
+   * @param vectors - array of &id:oatpp::data::stream::IOVector;.
+   * @param count - number of elements in `vectors` array.
+   * @return - actual number of bytes written. &id:oatpp::data::v_io_size;.
+   */
+  virtual data::v_io_size writeVectored(const IOVector* vectors, v_int32 count);
+
   /**
    * Implementation of OutputStream must suggest async actions for I/O results. <br>
    * Suggested Action is used for scheduling coroutines in async::Executor. <br>
@@ -338,6 +365,48 @@ struct AsyncInlineWriteData {
 
 };
 
+/**
+ * Convenience structure for stream Async-Inline vectored write operations.
+ */
+struct AsyncInlineWriteVectoredData {
+
+  /**
+   * Pointer to the first buffer which is not fully written yet.
+   */
+  IOVector* vectors;
+
+  /**
+   * Number of buffers left to write.
+   */
+  v_int32 count;
+
+  /**
+   * Default constructor.
+   */
+  AsyncInlineWriteVectoredData();
+
+  /**
+   * Constructor.
+   * @param pVectors - array of &l:IOVector;. Array is modified as data is written.
+   * @param pCount - number of elements in `pVectors` array.
+   */
+  AsyncInlineWriteVectoredData(IOVector* pVectors, v_int32 pCount);
+
+  /**
+   * Set `vectors` and `count` values.
+   * @param pVectors - array of &l:IOVector;. Array is modified as data is written.
+   * @param pCount - number of elements in `pVectors` array.
+   */
+  void set(IOVector* pVectors, v_int32 pCount);
+
+  /**
+   * Skip `amount` written bytes. Fully written buffers are dropped, partially written buffer is shifted.
+   * @param amount
+   */
+  void inc(data::v_io_size amount);
+
+};
+
 /**
  * Convenience structure for stream Async-Inline read operations.
  */
@@ -604,6 +673,11 @@ oatpp::async::Action writeExactSizeDataAsyncInline(oatpp::async::AbstractCorouti
 oatpp::async::CoroutineStarter writeExactSizeDataAsync(const std::shared_ptr<oatpp::data::stream::OutputStream>& stream,
                                                        const void* data, data::v_io_size size);
 
+oatpp::async::Action writeExactSizeVectoredAsyncInline(oatpp::async::AbstractCoroutine* coroutine,
+                                                       oatpp::data::stream::OutputStream* stream,
+                                                       AsyncInlineWriteVectoredData& inlineData,
+                                                       oatpp::async::Action&& nextAction);
+
 oatpp::async::Action readSomeDataAsyncInline(oatpp::async::AbstractCoroutine* coroutine,
                                              oatpp::data::stream::InputStream* stream,
                                              AsyncInlineReadData& inlineData,
@@ -628,6 +702,14 @@ oatpp::data::v_io_size readExactSizeData(oatpp::data::stream::InputStream* strea
  * return result can be < size only in case of some disaster like broken pipe
  */
 oatpp::data::v_io_size writeExactSizeData(oatpp::data::stream::OutputStream* stream, const void* data, data::v_io_size size);
+
+/**
+ * Write all buffers to stream using &l:OutputStream::writeVectored ();. <br>
+ * `vectors` array is modified as data is written.
+ * returns exact amount of bytes was written.
+ * return result can be < total size only in case of some disaster like broken pipe
+ */
+oatpp::data::v_io_size writeExactSizeVectored(oatpp::data::stream::OutputStream* stream, IOVector* vectors, v_int32 count);
   
 }}}
 
@@ -38,6 +38,40 @@ data::v_io_size OutputStreamBufferedProxy::write(const void *data, data::v_io_si
   }
 }
 
+data::v_io_size OutputStreamBufferedProxy::writeVectored(const IOVector* vectors, v_int32 count) {
+
+  data::v_io_size pending = m_buffer->availableToRead();
+
+  if(pending > 0) {
+
+    data::v_io_size total = 0;
+    for(v_int32 i = 0; i < count; i ++) {
+      total += vectors[i].size;
+    }
+
+    if(total <= m_buffer->availableToWrite()) {
+      for(v_int32 i = 0; i < count; i ++) {
+        if(vectors[i].size > 0) {
+          m_buffer->write(vectors[i].data, vectors[i].size);
+        }
+      }
+      return total;
+    }
+
+    auto res = m_buffer->readAndWriteToStream(m_outputStream.get(), pending);
+    if(res <= 0) {
+      return res;
+    }
+    if(m_buffer->availableToRead() > 0) {
+      return data::IOError::RETRY;
+    }
+
+  }
+
+  return m_outputStream->writeVectored(vectors, count);
+
+}
+
 oatpp::async::Action OutputStreamBufferedProxy::suggestOutputStreamAction(data::v_io_size ioResult) {
   return m_outputStream->suggestOutputStreamAction(ioResult);
 }
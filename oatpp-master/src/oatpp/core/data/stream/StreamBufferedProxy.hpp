@@ -74,6 +74,18 @@ public:
   
   data::v_io_size write(const void *data, data::v_io_size count) override;
 
+  /**
+   * Vectored write. <br>
+   * If buffer already contains data and there is enough space, data is copied to buffer.
+   * Otherwise buffered data is flushed and vectors are passed to the underlying stream's
+   * &id:oatpp::data::stream::OutputStream::writeVectored; as is. <br>
+   * Use it for complete messages only - parts of a message written this way are not coalesced and go out as separate segments.
+   * @param vectors - array of &id:oatpp::data::stream::IOVector;.
+   * @param count - number of elements in `vectors` array.
+   * @return - actual number of bytes written. &id:oatpp::data::v_io_size;.
+   */
+  data::v_io_size writeVectored(const IOVector* vectors, v_int32 count) override;
+
   oatpp::async::Action suggestOutputStreamAction(data::v_io_size ioResult) override;
 
   /**
@@ -91,6 +103,14 @@ public:
   data::v_io_size flush();
   oatpp::async::CoroutineStarter flushAsync();
 
+  /**
+   * Get underlying stream.
+   * @return - `std::shared_ptr` to &id:oatpp::data::stream::OutputStream;.
+   */
+  const std::shared_ptr<OutputStream>& getOutputStream() const {
+    return m_outputStream;
+  }
+
   void setBufferPosition(data::v_io_size readPosition, data::v_io_size writePosition, bool canRead) {
     m_buffer->setBufferPosition(readPosition, writePosition, canRead);
   }
@@ -192,6 +212,15 @@ public:
   void setBufferPosition(data::v_io_size readPosition, data::v_io_size writePosition, bool canRead) {
     m_buffer.setBufferPosition(readPosition, writePosition, canRead);
   }
+
+  /**
+   * Move buffered bytes which were not read yet to the beginning of the buffer.
+   * See &id:oatpp::data::buffer::FIFOBuffer::compact;.
+   * @return - amount of buffered bytes.
+   */
+  data::v_io_size compactBuffer() {
+    return m_buffer.compact();
+  }
   
 };
   
@@ -24,6 +24,8 @@
 
 #include "Caret.hpp"
 
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
 #include <stdlib.h>
 #include <cstdlib>
 #include <algorithm>
@@ -342,46 +344,42 @@ v_int32 Caret::StateSaveGuard::getSavedErrorCode() {
   }
 
   long int Caret::parseInt(int base) {
-    char* end;
-    char* start = (char*)&m_data[m_pos];
-    long int result = std::strtol(start, &end, base);
-    if(start == end){
+    v_int64 result = 0;
+    v_int32 size = utils::conversion::charSequenceToInt64((const char*)&m_data[m_pos], m_size - m_pos, result, base);
+    if(size == 0){
       m_errorMessage = ERROR_INVALID_INTEGER;
     }
-    m_pos = (v_int32)((v_int64) end - (v_int64) m_data);
-    return result;
+    m_pos += size;
+    return (long int) result;
   }
 
   unsigned long int Caret::parseUnsignedInt(int base) {
-    char* end;
-    char* start = (char*)&m_data[m_pos];
-    long int result = std::strtoul(start, &end, base);
-    if(start == end){
+    v_word64 result = 0;
+    v_int32 size = utils::conversion::charSequenceToUInt64((const char*)&m_data[m_pos], m_size - m_pos, result, base);
+    if(size == 0){
       m_errorMessage = ERROR_INVALID_INTEGER;
     }
-    m_pos = (v_int32)((v_int64) end - (v_int64) m_data);
-    return result;
+    m_pos += size;
+    return (unsigned long int) result;
   }
   
   v_float32 Caret::parseFloat32(){
-    char* end;
-    char* start = (char*)&m_data[m_pos];
-    v_float32 result = std::strtof(start , &end);
-    if(start == end){
+    v_float32 result = 0;
+    v_int32 size = utils::conversion::charSequenceToFloat32((const char*)&m_data[m_pos], m_size - m_pos, result);
+    if(size == 0){
       m_errorMessage = ERROR_INVALID_FLOAT;
     }
-    m_pos = (v_int32)((v_int64) end - (v_int64) m_data);
+    m_pos += size;
     return result;
   }
   
   v_float64 Caret::parseFloat64(){
-    char* end;
-    char* start = (char*)&m_data[m_pos];
-    v_float64 result = std::strtod(start , &end);
-    if(start == end){
+    v_float64 result = 0;
+    v_int32 size = utils::conversion::charSequenceToFloat64((const char*)&m_data[m_pos], m_size - m_pos, result);
+    if(size == 0){
       m_errorMessage = ERROR_INVALID_FLOAT;
     }
-    m_pos = (v_int32)((v_int64) end - (v_int64) m_data);
+    m_pos += size;
     return result;
   }
   
@@ -334,42 +334,34 @@ public:
 
   /**
    * parse integer value starting from the current position.
-   * Using function std::strtol()
-   *
-   * Warning: position may go out of @Caret::getSize() bound.
-   *
-   * @param base - base is passed to std::strtol function
+   * Using function &id:oatpp::utils::conversion::charSequenceToInt64;.
+   * Sets error &l:Caret::ERROR_INVALID_INTEGER; if there is no integer at the current position or it's out of range.
+   * @param base - numeric base in range [2..36].
    * @return parsed value
    */
   long int parseInt(int base = 10);
 
   /**
-   * parse integer value starting from the current position.
-   * Using function std::strtoul()
-   *
-   * Warning: position may go out of @Caret::getSize() bound.
-   *
-   * @param base - base is passed to std::strtoul function
+   * parse unsigned integer value starting from the current position.
+   * Using function &id:oatpp::utils::conversion::charSequenceToUInt64;.
+   * Sets error &l:Caret::ERROR_INVALID_INTEGER; if there is no integer at the current position or it's out of range.
+   * @param base - numeric base in range [2..36].
    * @return parsed value
    */
   unsigned long int parseUnsignedInt(int base = 10);
 
   /**
    * parse float value starting from the current position.
-   * Using function std::strtof()
-   *
-   * Warning: position may go out of @Caret::getSize() bound.
-   *
+   * Using function &id:oatpp::utils::conversion::charSequenceToFloat32;.
+   * Sets error &l:Caret::ERROR_INVALID_FLOAT; if there is no number at the current position.
    * @return parsed value
    */
   v_float32 parseFloat32();
 
   /**
    * parse float value starting from the current position.
-   * Using function std::strtod()
-   *
-   * Warning: position may go out of @Caret::getSize() bound.
-   *
+   * Using function &id:oatpp::utils::conversion::charSequenceToFloat64;.
+   * Sets error &l:Caret::ERROR_INVALID_FLOAT; if there is no number at the current position.
    * @return parsed value
    */
   v_float64 parseFloat64();
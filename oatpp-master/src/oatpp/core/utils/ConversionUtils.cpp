@@ -22,42 +22,899 @@
  *
  ***************************************************************************/
 
+
 #include "ConversionUtils.hpp"
 
+#include <clocale>
 #include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <type_traits>
 
 namespace oatpp { namespace utils { namespace conversion {
+
+namespace {
+
+  const char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+  const v_float64 EXACT_POWERS_OF_TEN[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+
+  const v_float32 EXACT_POWERS_OF_TEN_32[] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+  };
+
+  /*
+   * Sufficient for any of the number formats produced below: sign, 17 significant digits,
+   * decimal point, up to 5 leading zeros or up to 21 integer digits, exponent.
+   */
+  constexpr v_int32 FORMAT_BUFFER_SIZE = 32;
+
+  /*
+   * Writes decimal digits of value so that the last digit is right before `end`.
+   * Returns number of digits written.
+   */
+  template<typename T>
+  v_int32 writeDigitsBackwards(T value, char* end) {
+    char* p = end;
+    while(value >= 100) {
+      v_word32 i = (v_word32)(value % 100) * 2;
+      value /= 100;
+      p -= 2;
+      p[0] = DIGIT_PAIRS[i];
+      p[1] = DIGIT_PAIRS[i + 1];
+    }
+    if(value >= 10) {
+      v_word32 i = (v_word32) value * 2;
+      p -= 2;
+      p[0] = DIGIT_PAIRS[i];
+      p[1] = DIGIT_PAIRS[i + 1];
+    } else {
+      *--p = (char)('0' + value);
+    }
+    return (v_int32)(end - p);
+  }
+
+  /*
+   * Copy formatted result to the user's buffer.
+   * Same as `snprintf` the result is NUL-terminated, but here nothing is written if result doesn't fit.
+   */
+  v_int32 copyResult(const char* result, v_int32 size, p_char8 data, v_int32 n) {
+    if(size >= n) {
+      return 0;
+    }
+    std::memcpy(data, result, size);
+    data[size] = 0;
+    return size;
+  }
+
+  template<typename T>
+  v_int32 signedToCharSequence(T value, p_char8 data, v_int32 n) {
+    typedef typename std::make_unsigned<T>::type U;
+    char buffer[FORMAT_BUFFER_SIZE];
+    char* end = buffer + FORMAT_BUFFER_SIZE;
+    if(value < 0) {
+      v_int32 size = writeDigitsBackwards<U>((U)0 - (U)value, end);
+      *(end - size - 1) = '-';
+      return copyResult(end - size - 1, size + 1, data, n);
+    }
+    v_int32 size = writeDigitsBackwards<U>((U)value, end);
+    return copyResult(end - size, size, data, n);
+  }
+
+  v_word32 digitValue(char c) {
+    v_word32 d = (v_word32)(c - '0');
+    if(d < 10) {
+      return d;
+    }
+    d = (v_word32)((c | 0x20) - 'a');
+    if(d < 26) {
+      return d + 10;
+    }
+    return 36;
+  }
+
+  /*
+   * Parse digits in the given base starting at `pos`.
+   * Returns position after the last digit, or `0` if there are no digits or value exceeds `limit`.
+   */
+  v_int32 parseDigits(const char* data, v_int32 size, v_int32 pos, v_int32 base, v_word64 limit, v_word64& value) {
+
+    if(base < 2 || base > 36) {
+      return 0;
+    }
+
+    const v_int32 start = pos;
+    const v_word64 maxBeforeMul = limit / (v_word64) base;
+    v_word64 acc = 0;
+
+    while(pos < size) {
+      v_word32 d = digitValue(data[pos]);
+      if(d >= (v_word32) base) {
+        break;
+      }
+      if(acc > maxBeforeMul) {
+        return 0;
+      }
+      acc *= (v_word64) base;
+      if(acc > limit - d) {
+        return 0;
+      }
+      acc += d;
+      pos ++;
+    }
+
+    if(pos == start) {
+      return 0;
+    }
+
+    value = acc;
+    return pos;
+
+  }
+
+  template<typename T>
+  v_int32 parseSigned(const char* data, v_int32 size, T& value, v_int32 base) {
+
+    typedef typename std::make_unsigned<T>::type U;
+
+    v_int32 pos = 0;
+    bool negative = false;
+    if(pos < size && (data[pos] == '-' || data[pos] == '+')) {
+      negative = data[pos] == '-';
+      pos ++;
+    }
+
+    const v_word64 max = (v_word64) std::numeric_limits<T>::max();
+    v_word64 result;
+    pos = parseDigits(data, size, pos, base, negative ? max + 1 : max, result);
+    if(pos == 0) {
+      return 0;
+    }
+
+    value = negative ? (T)((U)0 - (U)result) : (T) result;
+    return pos;
+
+  }
+
+  bool matchIgnoreCase(const char* data, v_int32 size, v_int32 pos, const char* text, v_int32 textSize) {
+    if(size - pos < textSize) {
+      return false;
+    }
+    for(v_int32 i = 0; i < textSize; i ++) {
+      if((data[pos + i] | 0x20) != text[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /*
+   * Decomposed decimal literal: `mantissa * 10^exponent`.
+   */
+  struct DecimalLiteral {
+    v_word64 mantissa;
+    v_int32 exponent;
+    v_int32 significantDigits;
+    bool negative;
+    bool special; // inf or nan, value is stored in `specialValue`.
+    v_float64 specialValue;
+  };
+
+  /*
+   * Scan decimal floating point literal - `[+-]digits[.digits][(e|E)[+-]digits]`, `inf`, `infinity`, `nan`.
+   * Returns number of characters of the literal or `0` if data doesn't start with a number.
+   */
+  v_int32 scanDecimal(const char* data, v_int32 size, DecimalLiteral& literal) {
+
+    literal.mantissa = 0;
+    literal.exponent = 0;
+    literal.significantDigits = 0;
+    literal.negative = false;
+    literal.special = false;
+
+    v_int32 pos = 0;
+    if(pos < size && (data[pos] == '-' || data[pos] == '+')) {
+      literal.negative = data[pos] == '-';
+      pos ++;
+    }
+
+    if(pos < size && (data[pos] | 0x20) == 'i') {
+      if(matchIgnoreCase(data, size, pos, "infinity", 8)) {
+        pos += 8;
+      } else if(matchIgnoreCase(data, size, pos, "inf", 3)) {
+        pos += 3;
+      } else {
+        return 0;
+      }
+      literal.special = true;
+      literal.specialValue = std::numeric_limits<v_float64>::infinity();
+      return pos;
+    }
+
+    if(pos < size && (data[pos] | 0x20) == 'n') {
+      if(!matchIgnoreCase(data, size, pos, "nan", 3)) {
+        return 0;
+      }
+      literal.special = true;
+      literal.specialValue = std::numeric_limits<v_float64>::quiet_NaN();
+      return pos + 3;
+    }
+
+    v_int32 digits = 0;
+
+    while(pos < size) {
+      v_word32 d = (v_word32)(data[pos] - '0');
+      if(d > 9) break;
+      if(literal.significantDigits < 19) {
+        literal.mantissa = literal.mantissa * 10 + d;
+        if(literal.mantissa > 0) literal.significantDigits ++;
+      } else {
+        literal.significantDigits ++;
+        literal.exponent ++;
+      }
+      digits ++;
+      pos ++;
+    }
+
+    if(pos < size && data[pos] == '.') {
+      pos ++;
+      while(pos < size) {
+        v_word32 d = (v_word32)(data[pos] - '0');
+        if(d > 9) break;
+        if(literal.significantDigits < 19) {
+          literal.mantissa = literal.mantissa * 10 + d;
+          if(literal.mantissa > 0) literal.significantDigits ++;
+          literal.exponent --;
+        } else {
+          literal.significantDigits ++;
+        }
+        digits ++;
+        pos ++;
+      }
+    }
+
+    if(digits == 0) {
+      return 0;
+    }
+
+    if(pos < size && (data[pos] | 0x20) == 'e') {
+      v_int32 expPos = pos + 1;
+      bool expNegative = false;
+      if(expPos < size && (data[expPos] == '-' || data[expPos] == '+')) {
+        expNegative = data[expPos] == '-';
+        expPos ++;
+      }
+      v_int32 expStart = expPos;
+      v_int32 exp = 0;
+      while(expPos < size) {
+        v_word32 d = (v_word32)(data[expPos] - '0');
+        if(d > 9) break;
+        if(exp < 100000) exp = exp * 10 + (v_int32) d;
+        expPos ++;
+      }
+      if(expPos > expStart) {
+        literal.exponent += expNegative ? -exp : exp;
+        pos = expPos;
+      }
+    }
+
+    return pos;
+
+  }
+
+  /*
+   * Slow path - hand the literal over to `strtod`/`strtof`.
+   * The literal is copied so that it's NUL-terminated, and the decimal point is replaced with the one of the current locale.
+   */
+  template<typename T>
+  T parseWithStrto(const char* data, v_int32 size, T (*strto)(const char*, char**)) {
+    char localBuffer[64];
+    std::string heapBuffer;
+    char* buffer = localBuffer;
+    if(size >= (v_int32) sizeof(localBuffer)) {
+      heapBuffer.resize(size + 1);
+      buffer = &heapBuffer[0];
+    }
+    std::memcpy(buffer, data, size);
+    buffer[size] = 0;
+    const char localePoint = std::localeconv()->decimal_point[0];
+    if(localePoint != '.') {
+      for(v_int32 i = 0; i < size; i ++) {
+        if(buffer[i] == '.') {
+          buffer[i] = localePoint;
+        }
+      }
+    }
+    char* end;
+    return strto(buffer, &end);
+  }
+
+  /*
+   * Clinger's fast path - if both mantissa and power of ten are exactly representable,
+   * a single IEEE multiplication/division yields the correctly rounded result.
+   */
+  bool fastPathFloat64(v_word64 mantissa, v_int32 exponent, v_float64& value) {
+
+    const v_word64 maxExactMantissa = (v_word64) 1 << 53;
+
+    if(mantissa > maxExactMantissa) {
+      return false;
+    }
+
+    v_float64 result = (v_float64) mantissa;
+
+    if(exponent < 0) {
+      if(exponent < -22) {
+        return false;
+      }
+      value = result / EXACT_POWERS_OF_TEN[-exponent];
+      return true;
+    }
+
+    if(exponent > 22) {
+      // 123e30 == 123000000000e22 - move extra zeros into the mantissa while it stays exact.
+      if(exponent > 22 + 15) {
+        return false;
+      }
+      v_float64 shifted = result * EXACT_POWERS_OF_TEN[exponent - 22];
+      if(shifted > (v_float64) maxExactMantissa) {
+        return false;
+      }
+      value = shifted * EXACT_POWERS_OF_TEN[22];
+      return true;
+    }
+
+    value = result * EXACT_POWERS_OF_TEN[exponent];
+    return true;
+
+  }
+
+  bool fastPathFloat32(v_word64 mantissa, v_int32 exponent, v_float32& value) {
+
+    if(mantissa <= ((v_word64) 1 << 24) && exponent >= -10 && exponent <= 10) {
+      v_float32 result = (v_float32) mantissa;
+      value = exponent < 0 ? result / EXACT_POWERS_OF_TEN_32[-exponent] : result * EXACT_POWERS_OF_TEN_32[exponent];
+      return true;
+    }
+
+    if(exponent < -22 || exponent > 22) {
+      return false;
+    }
+
+    // Correctly rounded double is then rounded to float.
+    // This double rounding is exact unless the double lands exactly in the middle between two floats.
+    v_float64 result;
+    if(!fastPathFloat64(mantissa, exponent, result)) {
+      return false;
+    }
+
+    v_word64 bits;
+    std::memcpy(&bits, &result, sizeof(bits));
+    if((bits & 0x1FFFFFFF) == 0x10000000) {
+      return false;
+    }
+
+    value = (v_float32) result;
+    return true;
+
+  }
+
+  /*
+   * Shortest round-trip formatting of floating point values.
+   * Grisu2 algorithm by Florian Loitsch - "Printing Floating-Point Numbers Quickly and Accurately with Integers".
+   * Produces the shortest digit sequence which parses back to the same value in the vast majority of cases,
+   * and a correct (round-trip) but slightly longer sequence otherwise.
+   */
+  namespace grisu {
+
+    struct DiyFp {
+
+      v_word64 f;
+      v_int32 e;
+
+      DiyFp(v_word64 pF, v_int32 pE)
+        : f(pF)
+        , e(pE)
+      {}
+
+      static DiyFp sub(const DiyFp& x, const DiyFp& y) {
+        return DiyFp(x.f - y.f, x.e);
+      }
+
+      /*
+       * Upper 64 bits of 128-bit product, rounded.
+       */
+      static DiyFp mul(const DiyFp& x, const DiyFp& y) {
+
+        const v_word64 xLo = x.f & 0xFFFFFFFF;
+        const v_word64 xHi = x.f >> 32;
+        const v_word64 yLo = y.f & 0xFFFFFFFF;
+        const v_word64 yHi = y.f >> 32;
+
+        const v_word64 p0 = xLo * yLo;
+        const v_word64 p1 = xLo * yHi;
+        const v_word64 p2 = xHi * yLo;
+        const v_word64 p3 = xHi * yHi;
+
+        v_word64 q = (p0 >> 32) + (p1 & 0xFFFFFFFF) + (p2 & 0xFFFFFFFF);
+        q += (v_word64) 1 << 31;
+
+        return DiyFp(p3 + (p2 >> 32) + (p1 >> 32) + (q >> 32), x.e + y.e + 64);
+
+      }
+
+      static DiyFp normalize(DiyFp x) {
+        while((x.f >> 63) == 0) {
+          x.f <<= 1;
+          x.e --;
+        }
+        return x;
+      }
+
+      static DiyFp normalizeTo(const DiyFp& x, v_int32 e) {
+        return DiyFp(x.f << (x.e - e), e);
+      }
+
+    };
+
+    struct Boundaries {
+      DiyFp w;
+      DiyFp minus;
+      DiyFp plus;
+    };
+
+    /*
+     * Value and it's rounding boundaries (the midpoints to the neighbouring values) for positive finite value
+     * given by IEEE bits of type with `precision` significand bits (including the hidden bit).
+     */
+    Boundaries computeBoundaries(v_word64 bits, v_int32 precision, v_int32 maxExponent) {
+
+      const v_int32 bias = maxExponent - 1 + (precision - 1);
+      const v_int32 minExponent = 1 - bias;
+      const v_word64 hiddenBit = (v_word64) 1 << (precision - 1);
+
+      const v_word64 E = bits >> (precision - 1);
+      const v_word64 F = bits & (hiddenBit - 1);
+
+      const DiyFp v = (E == 0) ? DiyFp(F, minExponent) : DiyFp(F + hiddenBit, (v_int32) E - bias);
+
+      // the lower neighbour is closer if value is a power of two (except for the smallest normal number)
+      const bool lowerBoundaryIsCloser = (F == 0 && E > 1);
+      const DiyFp mPlus(2 * v.f + 1, v.e - 1);
+      const DiyFp mMinus = lowerBoundaryIsCloser ? DiyFp(4 * v.f - 1, v.e - 2) : DiyFp(2 * v.f - 1, v.e - 1);
+
+      const DiyFp wPlus = DiyFp::normalize(mPlus);
+      const DiyFp wMinus = DiyFp::normalizeTo(mMinus, wPlus.e);
+
+      return {DiyFp::normalize(v), wMinus, wPlus};
+
+    }
+
+    struct CachedPower {
+      v_word64 f;
+      v_int32 e;
+      v_int32 k;
+    };
+
+    constexpr v_int32 ALPHA = -60;
+    constexpr v_int32 CACHED_POWERS_MIN_DEC_EXP = -300;
+    constexpr v_int32 CACHED_POWERS_DEC_STEP = 8;
+
+    /*
+     * Normalized 64-bit approximations (rounded to nearest) of 10^k for k = -300, -292, ..., 332.
+     */
+    const CachedPower CACHED_POWERS[] = {
+    {0xAB70FE17C79AC6CA, -1060, -300},
+    {0xFF77B1FCBEBCDC4F, -1034, -292},
+    {0xBE5691EF416BD60C, -1007, -284},
+    {0x8DD01FAD907FFC3C,  -980, -276},
+    {0xD3515C2831559A83,  -954, -268},
+    {0x9D71AC8FADA6C9B5,  -927, -260},
+    {0xEA9C227723EE8BCB,  -901, -252},
+    {0xAECC49914078536D,  -874, -244},
+    {0x823C12795DB6CE57,  -847, -236},
+    {0xC21094364DFB5637,  -821, -228},
+    {0x9096EA6F3848984F,  -794, -220},
+    {0xD77485CB25823AC7,  -768, -212},
+    {0xA086CFCD97BF97F4,  -741, -204},
+    {0xEF340A98172AACE5,  -715, -196},
+    {0xB23867FB2A35B28E,  -688, -188},
+    {0x84C8D4DFD2C63F3B,  -661, -180},
+    {0xC5DD44271AD3CDBA,  -635, -172},
+    {0x936B9FCEBB25C996,  -608, -164},
+    {0xDBAC6C247D62A584,  -582, -156},
+    {0xA3AB66580D5FDAF6,  -555, -148},
+    {0xF3E2F893DEC3F126,  -529, -140},
+    {0xB5B5ADA8AAFF80B8,  -502, -132},
+    {0x87625F056C7C4A8B,  -475, -124},
+    {0xC9BCFF6034C13053,  -449, -116},
+    {0x964E858C91BA2655,  -422, -108},
+    {0xDFF9772470297EBD,  -396, -100},
+    {0xA6DFBD9FB8E5B88F,  -369,  -92},
+    {0xF8A95FCF88747D94,  -343,  -84},
+    {0xB94470938FA89BCF,  -316,  -76},
+    {0x8A08F0F8BF0F156B,  -289,  -68},
+    {0xCDB02555653131B6,  -263,  -60},
+    {0x993FE2C6D07B7FAC,  -236,  -52},
+    {0xE45C10C42A2B3B06,  -210,  -44},
+    {0xAA242499697392D3,  -183,  -36},
+    {0xFD87B5F28300CA0E,  -157,  -28},
+    {0xBCE5086492111AEB,  -130,  -20},
+    {0x8CBCCC096F5088CC,  -103,  -12},
+    {0xD1B71758E219652C,   -77,   -4},
+    {0x9C40000000000000,   -50,    4},
+    {0xE8D4A51000000000,   -24,   12},
+    {0xAD78EBC5AC620000,     3,   20},
+    {0x813F3978F8940984,    30,   28},
+    {0xC097CE7BC90715B3,    56,   36},
+    {0x8F7E32CE7BEA5C70,    83,   44},
+    {0xD5D238A4ABE98068,   109,   52},
+    {0x9F4F2726179A2245,   136,   60},
+    {0xED63A231D4C4FB27,   162,   68},
+    {0xB0DE65388CC8ADA8,   189,   76},
+    {0x83C7088E1AAB65DB,   216,   84},
+    {0xC45D1DF942711D9A,   242,   92},
+    {0x924D692CA61BE758,   269,  100},
+    {0xDA01EE641A708DEA,   295,  108},
+    {0xA26DA3999AEF774A,   322,  116},
+    {0xF209787BB47D6B85,   348,  124},
+    {0xB454E4A179DD1877,   375,  132},
+    {0x865B86925B9BC5C2,   402,  140},
+    {0xC83553C5C8965D3D,   428,  148},
+    {0x952AB45CFA97A0B3,   455,  156},
+    {0xDE469FBD99A05FE3,   481,  164},
+    {0xA59BC234DB398C25,   508,  172},
+    {0xF6C69A72A3989F5C,   534,  180},
+    {0xB7DCBF5354E9BECE,   561,  188},
+    {0x88FCF317F22241E2,   588,  196},
+    {0xCC20CE9BD35C78A5,   614,  204},
+    {0x98165AF37B2153DF,   641,  212},
+    {0xE2A0B5DC971F303A,   667,  220},
+    {0xA8D9D1535CE3B396,   694,  228},
+    {0xFB9B7CD9A4A7443C,   720,  236},
+    {0xBB764C4CA7A44410,   747,  244},
+    {0x8BAB8EEFB6409C1A,   774,  252},
+    {0xD01FEF10A657842C,   800,  260},
+    {0x9B10A4E5E9913129,   827,  268},
+    {0xE7109BFBA19C0C9D,   853,  276},
+    {0xAC2820D9623BF429,   880,  284},
+    {0x80444B5E7AA7CF85,   907,  292},
+    {0xBF21E44003ACDD2D,   933,  300},
+    {0x8E679C2F5E44FF8F,   960,  308},
+    {0xD433179D9C8CB841,   986,  316},
+    {0x9E19DB92B4E31BA9,  1013,  324},
+    {0xEB96BF6EBADF77D9,  1039,  332},
+    };
+
+    /*
+     * Find cached power c = 10^k such that binary exponent of (c * 2^e) is in range [ALPHA, GAMMA] = [-60, -32].
+     */
+    const CachedPower& getCachedPowerForBinaryExponent(v_int32 e) {
+      const v_int32 f = ALPHA - e - 1;
+      const v_int32 k = (f * 78913) / (1 << 18) + (f > 0 ? 1 : 0); // ceil(f * log10(2))
+      const v_int32 index = (-CACHED_POWERS_MIN_DEC_EXP + k + (CACHED_POWERS_DEC_STEP - 1)) / CACHED_POWERS_DEC_STEP;
+      return CACHED_POWERS[index];
+    }
+
+    v_int32 findLargestPow10(v_word32 n, v_word32& pow10) {
+      if(n >= 1000000000) { pow10 = 1000000000; return 10; }
+      if(n >= 100000000)  { pow10 = 100000000;  return 9; }
+      if(n >= 10000000)   { pow10 = 10000000;   return 8; }
+      if(n >= 1000000)    { pow10 = 1000000;    return 7; }
+      if(n >= 100000)     { pow10 = 100000;     return 6; }
+      if(n >= 10000)      { pow10 = 10000;      return 5; }
+      if(n >= 1000)       { pow10 = 1000;       return 4; }
+      if(n >= 100)        { pow10 = 100;        return 3; }
+      if(n >= 10)         { pow10 = 10;         return 2; }
+      pow10 = 1;
+      return 1;
+    }
+
+    /*
+     * Move the last digit closer to the exact value while staying within the rounding boundaries.
+     */
+    void round(char* buffer, v_int32 length, v_word64 dist, v_word64 delta, v_word64 rest, v_word64 tenK) {
+      while(rest < dist && delta - rest >= tenK && (rest + tenK < dist || dist - rest > rest + tenK - dist)) {
+        buffer[length - 1] --;
+        rest += tenK;
+      }
+    }
+
+    void generateDigits(char* buffer, v_int32& length, v_int32& decimalExponent, DiyFp mMinus, DiyFp w, DiyFp mPlus) {
+
+      v_word64 delta = DiyFp::sub(mPlus, mMinus).f;
+      v_word64 dist = DiyFp::sub(mPlus, w).f;
+
+      const DiyFp one((v_word64) 1 << -mPlus.e, mPlus.e);
+
+      v_word32 p1 = (v_word32)(mPlus.f >> -one.e); // integral part
+      v_word64 p2 = mPlus.f & (one.f - 1);         // fractional part
+
+      v_word32 pow10;
+      v_int32 n = findLargestPow10(p1, pow10);
+
+      while(n > 0) {
+
+        const v_word32 d = p1 / pow10;
+        p1 = p1 % pow10;
+        buffer[length ++] = (char)('0' + d);
+        n --;
+
+        const v_word64 rest = ((v_word64) p1 << -one.e) + p2;
+        if(rest <= delta) {
+          decimalExponent += n;
+          round(buffer, length, dist, delta, rest, (v_word64) pow10 << -one.e);
+          return;
+        }
+
+        pow10 /= 10;
+
+      }
+
+      v_int32 m = 0;
+      for(;;) {
+        p2 *= 10;
+        const v_word64 d = p2 >> -one.e;
+        p2 &= one.f - 1;
+        buffer[length ++] = (char)('0' + d);
+        m ++;
+        delta *= 10;
+        dist *= 10;
+        if(p2 <= delta) {
+          break;
+        }
+      }
+
+      decimalExponent -= m;
+      round(buffer, length, dist, delta, p2, one.f);
+
+    }
+
+    /*
+     * Generate shortest digits of the value. Value == digits * 10^decimalExponent.
+     */
+    void generate(char* buffer, v_int32& length, v_int32& decimalExponent, const Boundaries& b) {
+
+      const CachedPower& cached = getCachedPowerForBinaryExponent(b.plus.e);
+      const DiyFp c(cached.f, cached.e);
+
+      const DiyFp w = DiyFp::mul(b.w, c);
+      const DiyFp wMinus = DiyFp::mul(b.minus, c);
+      const DiyFp wPlus = DiyFp::mul(b.plus, c);
+
+      // shrink the interval to compensate for the error of multiplication
+      const DiyFp mMinus(wMinus.f + 1, wMinus.e);
+      const DiyFp mPlus(wPlus.f - 1, wPlus.e);
+
+      length = 0;
+      decimalExponent = -cached.k;
+      generateDigits(buffer, length, decimalExponent, mMinus, w, mPlus);
+
+    }
+
+  }
+
+  /*
+   * Lay out `length` digits at the beginning of buffer - value == digits * 10^decimalExponent.
+   * Plain notation is used for values in range [1e-6, 1e21) (same as JavaScript), exponential notation otherwise.
+   * Integral values keep the `.0` suffix so that they are still read as floating point numbers.
+   */
+  v_int32 layoutDigits(char* buffer, v_int32 length, v_int32 decimalExponent) {
+
+    const v_int32 k = length;
+    const v_int32 n = length + decimalExponent; // position of the decimal point
+
+    if(k <= n && n <= 21) {
+      // digits[000].0
+      std::memset(buffer + k, '0', n - k);
+      buffer[n] = '.';
+      buffer[n + 1] = '0';
+      return n + 2;
+    }
+
+    if(0 < n && n <= 21) {
+      // dig.its
+      std::memmove(buffer + n + 1, buffer + n, k - n);
+      buffer[n] = '.';
+      return k + 1;
+    }
+
+    if(-6 < n && n <= 0) {
+      // 0.[000]digits
+      std::memmove(buffer + 2 - n, buffer, k);
+      buffer[0] = '0';
+      buffer[1] = '.';
+      std::memset(buffer + 2, '0', -n);
+      return 2 - n + k;
+    }
+
+    // d[.igits]e(+|-)exp
+    v_int32 pos = 1;
+    if(k > 1) {
+      std::memmove(buffer + 2, buffer + 1, k - 1);
+      buffer[1] = '.';
+      pos = k + 1;
+    }
+
+    v_int32 exp = n - 1;
+    buffer[pos ++] = 'e';
+    if(exp < 0) {
+      buffer[pos ++] = '-';
+      exp = -exp;
+    } else {
+      buffer[pos ++] = '+';
+    }
+
+    return pos + writeDigitsBackwards<v_word32>((v_word32) exp, buffer + pos + (exp >= 100 ? 3 : (exp >= 10 ? 2 : 1)));
+
+  }
+
+  /*
+   * Returns `true` if value is not finite. In this case it's representation is written to the buffer.
+   */
+  bool formatSpecial(v_float64 value, char* buffer, v_int32& size) {
+    if(std::isnan(value)) {
+      std::memcpy(buffer, "nan", 3);
+      size = 3;
+      return true;
+    }
+    if(std::isinf(value)) {
+      if(value < 0) {
+        std::memcpy(buffer, "-inf", 4);
+        size = 4;
+      } else {
+        std::memcpy(buffer, "inf", 3);
+        size = 3;
+      }
+      return true;
+    }
+    return false;
+  }
+
+  template<typename Float, typename Bits>
+  v_int32 formatFloat(Float value, char* buffer) {
+
+    v_int32 size;
+    if(formatSpecial(value, buffer, size)) {
+      return size;
+    }
+
+    v_int32 pos = 0;
+    if(std::signbit(value)) {
+      buffer[pos ++] = '-';
+      value = -value;
+    }
+
+    if(value == 0) {
+      buffer[pos ++] = '0';
+      buffer[pos ++] = '.';
+      buffer[pos ++] = '0';
+      return pos;
+    }
+
+    Bits bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const grisu::Boundaries b = grisu::computeBoundaries(bits, std::numeric_limits<Float>::digits, std::numeric_limits<Float>::max_exponent);
+
+    v_int32 length;
+    v_int32 decimalExponent;
+    grisu::generate(buffer + pos, length, decimalExponent, b);
+
+    return pos + layoutDigits(buffer + pos, length, decimalExponent);
+
+  }
+
+}
+
+  v_int32 charSequenceToInt32(const char* data, v_int32 size, v_int32& value, v_int32 base) {
+    return parseSigned<v_int32>(data, size, value, base);
+  }
+
+  v_int32 charSequenceToInt64(const char* data, v_int32 size, v_int64& value, v_int32 base) {
+    return parseSigned<v_int64>(data, size, value, base);
+  }
+
+  v_int32 charSequenceToUInt64(const char* data, v_int32 size, v_word64& value, v_int32 base) {
+    v_int32 pos = 0;
+    if(pos < size && data[pos] == '+') {
+      pos ++;
+    }
+    return parseDigits(data, size, pos, base, std::numeric_limits<v_word64>::max(), value);
+  }
+
+  v_int32 charSequenceToFloat32(const char* data, v_int32 size, v_float32& value) {
+
+    DecimalLiteral literal;
+    v_int32 length = scanDecimal(data, size, literal);
+    if(length == 0) {
+      return 0;
+    }
+
+    v_float32 result;
+    if(literal.special) {
+      result = (v_float32) literal.specialValue;
+    } else if(literal.mantissa == 0) {
+      result = 0;
+    } else if(literal.significantDigits > 19 || !fastPathFloat32(literal.mantissa, literal.exponent, result)) {
+      value = parseWithStrto<v_float32>(data, length, std::strtof);
+      return length;
+    }
+
+    value = literal.negative ? -result : result;
+    return length;
+
+  }
+
+  v_int32 charSequenceToFloat64(const char* data, v_int32 size, v_float64& value) {
+
+    DecimalLiteral literal;
+    v_int32 length = scanDecimal(data, size, literal);
+    if(length == 0) {
+      return 0;
+    }
+
+    v_float64 result;
+    if(literal.special) {
+      result = literal.specialValue;
+    } else if(literal.mantissa == 0) {
+      result = 0;
+    } else if(literal.significantDigits > 19 || !fastPathFloat64(literal.mantissa, literal.exponent, result)) {
+      value = parseWithStrto<v_float64>(data, length, std::strtod);
+      return length;
+    }
+
+    value = literal.negative ? -result : result;
+    return length;
+
+  }
   
   v_int32 strToInt32(const char* str){
-    char* end;
-    return (v_int32) std::strtol(str, &end, 10);
+    v_int32 result = 0;
+    charSequenceToInt32(str, (v_int32) std::strlen(str), result);
+    return result;
   }
   
   v_int32 strToInt32(const oatpp::String& str, bool& success){
-    char* end;
-    v_int32 result = (v_int32) std::strtol((const char*)str->getData(), &end, 10);
-    success = (((v_int64)end - (v_int64)str->getData()) == str->getSize());
+    v_int32 result = 0;
+    v_int32 size = charSequenceToInt32((const char*)str->getData(), str->getSize(), result);
+    success = (size > 0 && size == str->getSize());
     return result;
   }
   
   v_int64 strToInt64(const char* str){
-    char* end;
-    return std::strtoll(str, &end, 10);
+    v_int64 result = 0;
+    charSequenceToInt64(str, (v_int32) std::strlen(str), result);
+    return result;
   }
   
   v_int64 strToInt64(const oatpp::String& str, bool& success){
-    char* end;
-    v_int64 result = std::strtoll((const char*)str->getData(), &end, 10);
-    success = (((v_int64)end - (v_int64)str->getData()) == str->getSize());
+    v_int64 result = 0;
+    v_int32 size = charSequenceToInt64((const char*)str->getData(), str->getSize(), result);
+    success = (size > 0 && size == str->getSize());
     return result;
   }
   
   v_int32 int32ToCharSequence(v_int32 value, p_char8 data, v_int32 n) {
-    return snprintf((char*)data, n, "%d", value);
+    return signedToCharSequence<v_int32>(value, data, n);
   }
   
   v_int32 int64ToCharSequence(v_int64 value, p_char8 data, v_int32 n) {
-    return snprintf((char*)data, n, "%lld", value);
+    return signedToCharSequence<v_int64>(value, data, n);
   }
   
   oatpp::String int32ToStr(v_int32 value){
@@ -97,40 +954,46 @@ namespace oatpp { namespace utils { namespace conversion {
   }
   
   v_float32 strToFloat32(const char* str){
-    char* end;
-    return std::strtof(str, &end);
+    v_float32 result = 0;
+    charSequenceToFloat32(str, (v_int32) std::strlen(str), result);
+    return result;
   }
   
   v_float32 strToFloat32(const oatpp::String& str, bool& success) {
-    char* end;
-    v_float32 result = std::strtof((const char*)str->getData(), &end);
-    success = (((v_int64)end - (v_int64)str->getData()) == str->getSize());
+    v_float32 result = 0;
+    v_int32 size = charSequenceToFloat32((const char*)str->getData(), str->getSize(), result);
+    success = (size > 0 && size == str->getSize());
     return result;
   }
   
   v_float64 strToFloat64(const char* str){
-    char* end;
-    return std::strtod(str, &end);
+    v_float64 result = 0;
+    charSequenceToFloat64(str, (v_int32) std::strlen(str), result);
+    return result;
   }
   
   v_float64 strToFloat64(const oatpp::String& str, bool& success) {
-    char* end;
-    v_float64 result = std::strtod((const char*)str->getData(), &end);
-    success = (((v_int64)end - (v_int64)str->getData()) == str->getSize());
+    v_float64 result = 0;
+    v_int32 size = charSequenceToFloat64((const char*)str->getData(), str->getSize(), result);
+    success = (size > 0 && size == str->getSize());
     return result;
   }
   
   v_int32 float32ToCharSequence(v_float32 value, p_char8 data, v_int32 n) {
-    return snprintf((char*)data, n, "%f", value);
+    char buffer[FORMAT_BUFFER_SIZE];
+    v_int32 size = formatFloat<v_float32, v_word32>(value, buffer);
+    return copyResult(buffer, size, data, n);
   }
   
   v_int32 float64ToCharSequence(v_float64 value, p_char8 data, v_int32 n) {
-    return snprintf((char*)data, n, "%f", value);
+    char buffer[FORMAT_BUFFER_SIZE];
+    v_int32 size = formatFloat<v_float64, v_word64>(value, buffer);
+    return copyResult(buffer, size, data, n);
   }
   
   oatpp::String float32ToStr(v_float32 value){
-    v_char8 buff [100];
-    v_int32 size = float32ToCharSequence(value, &buff[0], 100);
+    v_char8 buff [32];
+    v_int32 size = float32ToCharSequence(value, &buff[0], 32);
     if(size > 0){
       return oatpp::String((const char*)&buff[0], size, true);
     }
@@ -138,8 +1001,8 @@ namespace oatpp { namespace utils { namespace conversion {
   }
   
   oatpp::String float64ToStr(v_float64 value){
-    v_char8 buff [100];
-    v_int32 size = float64ToCharSequence(value, &buff[0], 100);
+    v_char8 buff [32];
+    v_int32 size = float64ToCharSequence(value, &buff[0], 32);
     if(size > 0){
       return oatpp::String((const char*)&buff[0], size, true);
     }
@@ -66,12 +66,45 @@ namespace oatpp { namespace utils { namespace conversion {
    */
   v_int64 strToInt64(const oatpp::String& str, bool& success);
 
+  /**
+   * Parse 32-bit integer from the beginning of the char sequence. <br>
+   * Doesn't depend on locale and doesn't require the sequence to be NUL-terminated - no more than `size` chars are read.
+   * @param data - pointer to data.
+   * @param size - data size.
+   * @param value - out parameter. Parsed value. Not modified if parsing failed.
+   * @param base - numeric base in range [2..36].
+   * @return - number of characters parsed. `0` if data doesn't start with integer or value is out of range.
+   */
+  v_int32 charSequenceToInt32(const char* data, v_int32 size, v_int32& value, v_int32 base = 10);
+
+  /**
+   * Parse 64-bit integer from the beginning of the char sequence. <br>
+   * Doesn't depend on locale and doesn't require the sequence to be NUL-terminated - no more than `size` chars are read.
+   * @param data - pointer to data.
+   * @param size - data size.
+   * @param value - out parameter. Parsed value. Not modified if parsing failed.
+   * @param base - numeric base in range [2..36].
+   * @return - number of characters parsed. `0` if data doesn't start with integer or value is out of range.
+   */
+  v_int32 charSequenceToInt64(const char* data, v_int32 size, v_int64& value, v_int32 base = 10);
+
+  /**
+   * Parse unsigned 64-bit integer from the beginning of the char sequence. <br>
+   * Doesn't depend on locale and doesn't require the sequence to be NUL-terminated - no more than `size` chars are read.
+   * @param data - pointer to data.
+   * @param size - data size.
+   * @param value - out parameter. Parsed value. Not modified if parsing failed.
+   * @param base - numeric base in range [2..36].
+   * @return - number of characters parsed. `0` if data doesn't start with integer or value is out of range.
+   */
+  v_int32 charSequenceToUInt64(const char* data, v_int32 size, v_word64& value, v_int32 base = 10);
+
   /**
    * Convert 32-bit integer to it's string representation.
    * @param value - 32-bit integer value.
    * @param data - buffer to write data to.
    * @param n - buffer size.
-   * @return - length of the resultant string.
+   * @return - length of the resultant string. `0` if buffer is too small.
    */
   v_int32 int32ToCharSequence(v_int32 value, p_char8 data, v_int32 n);
 
@@ -80,7 +113,7 @@ namespace oatpp { namespace utils { namespace conversion {
   * @param value - 64-bit integer value.
   * @param data - buffer to write data to.
   * @param n - buffer size.
-  * @return - length of the resultant string.
+  * @return - length of the resultant string. `0` if buffer is too small.
   */
  v_int32 int64ToCharSequence(v_int64 value, p_char8 data, v_int32 n);
 
@@ -174,20 +207,48 @@ namespace oatpp { namespace utils { namespace conversion {
   v_float64 strToFloat64(const oatpp::String& str, bool& success);
 
   /**
-   * Convert 32-bit float to it's string representation.
+   * Parse 32-bit float from the beginning of the char sequence. <br>
+   * Accepts `[+-]digits[.digits][(e|E)[+-]digits]`, `inf`, `infinity` and `nan`.
+   * Doesn't depend on locale and doesn't require the sequence to be NUL-terminated - no more than `size` chars are read.
+   * Result is correctly rounded.
+   * @param data - pointer to data.
+   * @param size - data size.
+   * @param value - out parameter. Parsed value. Not modified if parsing failed.
+   * @return - number of characters parsed. `0` if data doesn't start with a number.
+   */
+  v_int32 charSequenceToFloat32(const char* data, v_int32 size, v_float32& value);
+
+  /**
+   * Parse 64-bit float from the beginning of the char sequence. <br>
+   * Accepts `[+-]digits[.digits][(e|E)[+-]digits]`, `inf`, `infinity` and `nan`.
+   * Doesn't depend on locale and doesn't require the sequence to be NUL-terminated - no more than `size` chars are read.
+   * Result is correctly rounded.
+   * @param data - pointer to data.
+   * @param size - data size.
+   * @param value - out parameter. Parsed value. Not modified if parsing failed.
+   * @return - number of characters parsed. `0` if data doesn't start with a number.
+   */
+  v_int32 charSequenceToFloat64(const char* data, v_int32 size, v_float64& value);
+
+  /**
+   * Convert 32-bit float to it's shortest string representation which parses back to the same value. <br>
+   * Plain notation is used for absolute values in range [1e-6, 1e21), exponential notation otherwise.
+   * Integral values are written with `.0` suffix.
    * @param value - 32-bit float value.
    * @param data - buffer to write data to.
    * @param n - buffer size.
-   * @return - length of the resultant string.
+   * @return - length of the resultant string. `0` if buffer is too small (32 bytes is always enough).
    */
   v_int32 float32ToCharSequence(v_float32 value, p_char8 data, v_int32 n);
 
   /**
-   * Convert 64-bit float to it's string representation.
+   * Convert 64-bit float to it's shortest string representation which parses back to the same value. <br>
+   * Plain notation is used for absolute values in range [1e-6, 1e21), exponential notation otherwise.
+   * Integral values are written with `.0` suffix.
    * @param value - 64-bit float value.
    * @param data - buffer to write data to.
    * @param n - buffer size.
-   * @return - length of the resultant string.
+   * @return - length of the resultant string. `0` if buffer is too small (32 bytes is always enough).
    */
   v_int32 float64ToCharSequence(v_float64 value, p_char8 data, v_int32 n);
 
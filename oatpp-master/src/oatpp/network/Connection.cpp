@@ -24,21 +24,27 @@
 
 #include "./Connection.hpp"
 
+#include "oatpp/core/async/worker/IOEventWorker.hpp"
+
 #if defined(WIN32) || defined(_WIN32)
 #include <io.h>
 #include <WinSock2.h>
 #else
 #include <unistd.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #endif
 #include <thread>
 #include <chrono>
+#include <cstring>
 #include <fcntl.h>
 
 namespace oatpp { namespace network {
 
 Connection::Connection(data::v_io_handle handle)
   : m_handle(handle)
+  , m_blocking(false)
+  , m_closed(false)
 {
 #if defined(WIN32) || defined(_WIN32)
     // in Windows, there is no reliable method to get if a socket is blocking or not.
@@ -53,6 +59,10 @@ Connection::~Connection(){
 
 data::v_io_size Connection::write(const void *buff, data::v_io_size count){
 
+  if(m_closed) {
+    return data::IOError::BROKEN_PIPE;
+  }
+
 #if defined(WIN32) || defined(_WIN32)
 
   auto result = ::send(m_handle, (const char*) buff, (size_t)count, 0);
@@ -87,6 +97,9 @@ data::v_io_size Connection::write(const void *buff, data::v_io_size count){
   if(result <= 0) {
     auto e = errno;
     if(e == EAGAIN || e == EWOULDBLOCK){
+      if(m_blocking) {
+        return data::IOError::BROKEN_PIPE; // socket timeout expired
+      }
       return data::IOError::WAIT_RETRY; // For async io. In case socket is non_blocking
     } else if(e == EINTR) {
       return data::IOError::RETRY;
@@ -102,8 +115,67 @@ data::v_io_size Connection::write(const void *buff, data::v_io_size count){
 
 }
 
+data::v_io_size Connection::writeVectored(const data::stream::IOVector* vectors, v_int32 count) {
+
+  if(m_closed) {
+    return data::IOError::BROKEN_PIPE;
+  }
+
+#if defined(WIN32) || defined(_WIN32)
+
+  return OutputStream::writeVectored(vectors, count);
+
+#else
+
+  if(count > MAX_IO_VECTORS) {
+    count = MAX_IO_VECTORS;
+  }
+
+  struct iovec iov[MAX_IO_VECTORS];
+  for(v_int32 i = 0; i < count; i ++) {
+    iov[i].iov_base = (void*) vectors[i].data;
+    iov[i].iov_len = (size_t) vectors[i].size;
+  }
+
+  struct msghdr message;
+  std::memset(&message, 0, sizeof(message));
+  message.msg_iov = iov;
+  message.msg_iovlen = count;
+
+  errno = 0;
+  v_int32 flags = 0;
+
+#ifdef MSG_NOSIGNAL
+  flags |= MSG_NOSIGNAL;
+#endif
+
+  auto result = ::sendmsg(m_handle, &message, flags);
+
+  if(result <= 0) {
+    auto e = errno;
+    if(e == EAGAIN || e == EWOULDBLOCK){
+      if(m_blocking) {
+        return data::IOError::BROKEN_PIPE; // socket timeout expired
+      }
+      return data::IOError::WAIT_RETRY; // For async io. In case socket is non_blocking
+    } else if(e == EINTR) {
+      return data::IOError::RETRY;
+    } else if(e == EPIPE) {
+      return data::IOError::BROKEN_PIPE;
+    }
+  }
+  return result;
+
+#endif
+
+}
+
 data::v_io_size Connection::read(void *buff, data::v_io_size count){
 
+  if(m_closed) {
+    return data::IOError::BROKEN_PIPE;
+  }
+
 #if defined(WIN32) || defined(_WIN32)
 
   auto result = ::recv(m_handle, (char*)buff, (size_t)count, 0);
@@ -134,6 +206,9 @@ data::v_io_size Connection::read(void *buff, data::v_io_size count){
   if(result <= 0) {
     auto e = errno;
     if(e == EAGAIN || e == EWOULDBLOCK){
+      if(m_blocking) {
+        return data::IOError::BROKEN_PIPE; // socket timeout expired
+      }
       return data::IOError::WAIT_RETRY; // For async io. In case socket is non_blocking
     } else if(e == EINTR) {
       return data::IOError::RETRY;
@@ -186,6 +261,7 @@ void Connection::setStreamIOMode(oatpp::data::stream::IOMode ioMode) {
       if (fcntl(m_handle, F_SETFL, flags) < 0) {
         throw std::runtime_error("[oatpp::network::Connection::setStreamIOMode()]: Error. Can't set stream I/O mode to IOMode::BLOCKING.");
       }
+      m_blocking = true;
       break;
 
     case oatpp::data::stream::IOMode::NON_BLOCKING:
@@ -193,6 +269,7 @@ void Connection::setStreamIOMode(oatpp::data::stream::IOMode ioMode) {
       if (fcntl(m_handle, F_SETFL, flags) < 0) {
         throw std::runtime_error("[oatpp::network::Connection::setStreamIOMode()]: Error. Can't set stream I/O mode to IOMode::NON_BLOCKING.");
       }
+      m_blocking = false;
       break;
 
   }
@@ -272,6 +349,11 @@ oatpp::data::stream::IOMode Connection::getInputStreamIOMode() {
 }
 
 void Connection::close(){
+  if(m_closed.exchange(true)) {
+    return;
+  }
+  // handle must leave event queues before it's closed - otherwise waiting coroutines are never resumed
+  oatpp::async::worker::IOEventWorker::releaseHandle(m_handle);
 #if defined(WIN32) || defined(_WIN32)
 	::closesocket(m_handle);
 #else
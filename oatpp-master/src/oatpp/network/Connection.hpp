@@ -28,6 +28,8 @@
 #include "oatpp/core/base/memory/ObjectPool.hpp"
 #include "oatpp/core/data/stream/Stream.hpp"
 
+#include <atomic>
+
 namespace oatpp { namespace network {
 
 /**
@@ -37,8 +39,16 @@ class Connection : public oatpp::base::Countable, public oatpp::data::stream::IO
 public:
   OBJECT_POOL(Connection_Pool, Connection, 32);
   SHARED_OBJECT_POOL(Shared_Connection_Pool, Connection, 32);
+public:
+  /**
+   * Maximum number of buffers passed to one `sendmsg` call in &l:Connection::writeVectored ();.
+   */
+  static constexpr v_int32 MAX_IO_VECTORS = 16;
 private:
   data::v_io_handle m_handle;
+  /* set to BLOCKING by setStreamIOMode() - EAGAIN on a blocking socket means SO_RCVTIMEO/SO_SNDTIMEO expired */
+  bool m_blocking;
+  std::atomic<bool> m_closed;
 #if defined(WIN32) || defined(_WIN32)
   oatpp::data::stream::IOMode m_mode;
 #endif
@@ -69,13 +79,26 @@ public:
   ~Connection();
 
   /**
-   * Implementation of &id:oatpp::data::stream::IOStream::write;.
+   * Implementation of &id:oatpp::data::stream::IOStream::write;. <br>
+   * If the stream was set to `IOMode::BLOCKING` a write which failed on `SO_SNDTIMEO` expiration returns
+   * &id:oatpp::data::IOError::BROKEN_PIPE; instead of &id:oatpp::data::IOError::WAIT_RETRY; so that blocking
+   * writers don't retry it forever. Same for reads and `SO_RCVTIMEO`.
    * @param buff - buffer containing data to write.
    * @param count - bytes count you want to write.
    * @return - actual amount of bytes written. See &id:oatpp::data::v_io_size;.
    */
   data::v_io_size write(const void *buff, data::v_io_size count) override;
 
+  /**
+   * Implementation of &id:oatpp::data::stream::OutputStream::writeVectored;. <br>
+   * Uses `sendmsg` to write up to &l:Connection::MAX_IO_VECTORS; buffers in one system call.
+   * On Windows falls back to the default implementation.
+   * @param vectors - array of &id:oatpp::data::stream::IOVector;.
+   * @param count - number of elements in `vectors` array.
+   * @return - actual amount of bytes written. See &id:oatpp::data::v_io_size;.
+   */
+  data::v_io_size writeVectored(const data::stream::IOVector* vectors, v_int32 count) override;
+
   /**
    * Implementation of &id:oatpp::data::stream::IOStream::read;.
    * @param buff - buffer to read data to.
@@ -125,7 +148,9 @@ public:
   oatpp::data::stream::IOMode getInputStreamIOMode() override;
 
   /**
-   * Close socket handle.
+   * Close socket handle. <br>
+   * Coroutines waiting for I/O on this connection are woken up, all further I/O operations return
+   * &id:oatpp::data::IOError::BROKEN_PIPE;. Calling it more than once has no effect.
    */
   void close();
 
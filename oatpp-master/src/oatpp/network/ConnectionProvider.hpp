@@ -108,9 +108,31 @@ public:
 };
   
 /**
- * No properties here. It is just a logical division
+ * Provider of incoming connections.
  */
 class ServerConnectionProvider : public ConnectionProvider {
+public:
+
+  /**
+   * Get number of independent listeners (accept queues) of this provider. <br>
+   * &id:oatpp::network::server::Server; runs one accepting thread per listener.
+   * @return - number of listeners. Default - `1`.
+   */
+  virtual v_int32 getListenersCount() {
+    return 1;
+  }
+
+  /**
+   * Get incoming connection from the specific listener. <br>
+   * Called concurrently - one thread per listener.
+   * @param listenerIndex - index of the listener in range `[0, getListenersCount())`.
+   * @return - &id:oatpp::data::stream::IOStream;. Default - &l:ConnectionProvider::getConnection ();.
+   */
+  virtual std::shared_ptr<IOStream> getListenerConnection(v_int32 listenerIndex) {
+    (void) listenerIndex;
+    return getConnection();
+  }
+
 };
 
 /**
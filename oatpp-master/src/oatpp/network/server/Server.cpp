@@ -26,6 +26,7 @@
 
 #include <thread>
 #include <chrono>
+#include <vector>
 
 namespace oatpp { namespace network { namespace server {
   
@@ -41,16 +42,19 @@ Server::Server(const std::shared_ptr<ServerConnectionProvider>& connectionProvid
   , m_connectionHandler(connectionHandler)
 {}
 
-void Server::mainLoop(){
-  
-  setStatus(STATUS_CREATED, STATUS_RUNNING);
+void Server::acceptLoop(v_int32 listenerIndex, v_int32 listenersCount) {
 
   std::shared_ptr<const std::unordered_map<oatpp::String, oatpp::String>> params;
 
   while(getStatus() == STATUS_RUNNING) {
-    
-    auto connection = m_connectionProvider->getConnection();
-    
+
+    std::shared_ptr<oatpp::data::stream::IOStream> connection;
+    if(listenersCount > 1) {
+      connection = m_connectionProvider->getListenerConnection(listenerIndex);
+    } else {
+      connection = m_connectionProvider->getConnection();
+    }
+
     if (connection) {
       if(getStatus() == STATUS_RUNNING){
         m_connectionHandler->handleConnection(connection, params /* null params */);
@@ -58,7 +62,26 @@ void Server::mainLoop(){
         OATPP_LOGD("Server", "Already stopped. Closing connection...");
       }
     }
-    
+
+  }
+
+}
+
+void Server::mainLoop(){
+  
+  setStatus(STATUS_CREATED, STATUS_RUNNING);
+
+  v_int32 listenersCount = m_connectionProvider->getListenersCount();
+
+  std::vector<std::thread> acceptors;
+  for(v_int32 i = 1; i < listenersCount; i ++) {
+    acceptors.push_back(std::thread(&Server::acceptLoop, this, i, listenersCount));
+  }
+
+  acceptLoop(0, listenersCount);
+
+  for(auto& acceptor : acceptors) {
+    acceptor.join();
   }
   
   setStatus(STATUS_DONE);
@@ -40,12 +40,16 @@ namespace oatpp { namespace network { namespace server {
 
 /**
  * Server calls &id:oatpp::network::ConnectionProvider::getConnection; in the loop and passes obtained Connection
- * to &id:oatpp::network::server::ConnectionHandler;.
+ * to &id:oatpp::network::server::ConnectionHandler;. <br>
+ * If connection provider has multiple listeners (&id:oatpp::network::ServerConnectionProvider::getListenersCount;)
+ * server accepts connections in one thread per listener. In this case
+ * &id:oatpp::network::server::ConnectionHandler::handleConnection; is called concurrently.
  */
 class Server : public base::Countable {
 private:
 
   void mainLoop();
+  void acceptLoop(v_int32 listenerIndex, v_int32 listenersCount);
   
   bool setStatus(v_int32 expectedStatus, v_int32 newStatus);
   void setStatus(v_int32 status);
@@ -104,7 +108,8 @@ public:
 
   /**
    * Call &id:oatpp::network::ConnectionProvider::getConnection; in the loop and passes obtained Connection
-   * to &id:oatpp::network::server::ConnectionHandler;.
+   * to &id:oatpp::network::server::ConnectionHandler;. <br>
+   * Blocks until all accepting threads are done.
    */
   void run();
 
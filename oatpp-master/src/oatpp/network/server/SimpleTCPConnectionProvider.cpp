@@ -43,11 +43,40 @@
 
 namespace oatpp { namespace network { namespace server {
 
-SimpleTCPConnectionProvider::SimpleTCPConnectionProvider(v_word16 port)
+SimpleTCPConnectionProvider::SimpleTCPConnectionProvider(v_word16 port, v_int32 listenersCount)
   : m_port(port)
   , m_closed(false)
+  , m_activeAcceptors(0)
 {
-  m_serverHandle = instantiateServer();
+
+#if defined(WIN32) || defined(_WIN32) || !defined(SO_REUSEPORT)
+  if(listenersCount > 1) {
+    OATPP_LOGW("[oatpp::network::server::SimpleTCPConnectionProvider::SimpleTCPConnectionProvider()]",
+               "Warning. SO_REUSEPORT is not supported. Using single listener.");
+    listenersCount = 1;
+  }
+#endif
+
+  if(listenersCount < 1) {
+    listenersCount = 1;
+  }
+
+  try {
+    for(v_int32 i = 0; i < listenersCount; i ++) {
+      m_listenerHandles.push_back(instantiateServer(listenersCount > 1));
+    }
+  } catch (...) {
+    for(auto handle : m_listenerHandles) {
+#if defined(WIN32) || defined(_WIN32)
+      ::closesocket(handle);
+#else
+      ::close(handle);
+#endif
+    }
+    throw;
+  }
+
+  m_serverHandle = m_listenerHandles[0];
   setProperty(PROPERTY_HOST, "localhost");
   setProperty(PROPERTY_PORT, oatpp::utils::conversion::int32ToStr(port));
 }
@@ -57,19 +86,45 @@ SimpleTCPConnectionProvider::~SimpleTCPConnectionProvider() {
 }
 
 void SimpleTCPConnectionProvider::close() {
-  if(!m_closed) {
-    m_closed = true;
+
+  std::unique_lock<std::mutex> lock(m_acceptorsMutex);
+
+  bool expected = false;
+  if(!m_closed.compare_exchange_strong(expected, true)) {
+    return;
+  }
+
+  // shutdown() wakes up threads blocked in accept() on these sockets
+  for(auto handle : m_listenerHandles) {
+#if defined(WIN32) || defined(_WIN32)
+    ::shutdown(handle, SD_BOTH);
+#else
+    ::shutdown(handle, SHUT_RDWR);
+#endif
+  }
+
+  // handles may be reused by the system as soon as they are closed - wait for acceptors to leave accept() first
+  m_acceptorsCondition.wait(lock, [this]{ return m_activeAcceptors == 0; });
+
+  for(auto handle : m_listenerHandles) {
 #if defined(WIN32) || defined(_WIN32)
-	  ::closesocket(m_serverHandle);
+    ::closesocket(handle);
 #else
-	  ::close(m_serverHandle);
+    ::close(handle);
 #endif
   }
+
+}
+
+v_int32 SimpleTCPConnectionProvider::getListenersCount() {
+  return (v_int32) m_listenerHandles.size();
 }
 
 #if defined(WIN32) || defined(_WIN32)
 
-oatpp::data::v_io_handle SimpleTCPConnectionProvider::instantiateServer(){
+oatpp::data::v_io_handle SimpleTCPConnectionProvider::instantiateServer(bool reusePort){
+
+  (void) reusePort;
 
   int iResult;
 
@@ -123,7 +178,7 @@ oatpp::data::v_io_handle SimpleTCPConnectionProvider::instantiateServer(){
 
 #else
 
-oatpp::data::v_io_handle SimpleTCPConnectionProvider::instantiateServer(){
+oatpp::data::v_io_handle SimpleTCPConnectionProvider::instantiateServer(bool reusePort){
 
   oatpp::data::v_io_handle serverHandle;
   v_int32 ret;
@@ -146,6 +201,18 @@ oatpp::data::v_io_handle SimpleTCPConnectionProvider::instantiateServer(){
     OATPP_LOGD("[oatpp::network::server::SimpleTCPConnectionProvider::instantiateServer()]", "Warning. Failed to set %s for accepting socket", "SO_REUSEADDR");
   }
 
+#ifdef SO_REUSEPORT
+  if(reusePort) {
+    ret = setsockopt(serverHandle, SOL_SOCKET, SO_REUSEPORT, &yes, sizeof(int));
+    if(ret < 0) {
+      ::close(serverHandle);
+      throw std::runtime_error("[oatpp::network::server::SimpleTCPConnectionProvider::instantiateServer()]: Error. Failed to set SO_REUSEPORT for accepting socket.");
+    }
+  }
+#else
+  (void) reusePort;
+#endif
+
   ret = bind(serverHandle, (struct sockaddr *)&addr, sizeof(addr));
 
   if(ret != 0) {
@@ -168,11 +235,38 @@ oatpp::data::v_io_handle SimpleTCPConnectionProvider::instantiateServer(){
 #endif
 
 std::shared_ptr<oatpp::data::stream::IOStream> SimpleTCPConnectionProvider::getConnection(){
+  return acceptConnection(m_serverHandle);
+}
 
-  oatpp::data::v_io_handle handle = accept(m_serverHandle, nullptr, nullptr);
+std::shared_ptr<oatpp::data::stream::IOStream> SimpleTCPConnectionProvider::getListenerConnection(v_int32 listenerIndex){
+  return acceptConnection(m_listenerHandles[listenerIndex]);
+}
+
+std::shared_ptr<oatpp::data::stream::IOStream> SimpleTCPConnectionProvider::acceptConnection(oatpp::data::v_io_handle serverHandle){
+
+  {
+    std::lock_guard<std::mutex> lock(m_acceptorsMutex);
+    if(m_closed) {
+      return nullptr;
+    }
+    ++ m_activeAcceptors;
+  }
+
+#if defined(__linux__) || defined(linux) || defined(__linux)
+  // Do not leak connection handles to child processes.
+  oatpp::data::v_io_handle handle = accept4(serverHandle, nullptr, nullptr, SOCK_CLOEXEC);
+#else
+  oatpp::data::v_io_handle handle = accept(serverHandle, nullptr, nullptr);
+#endif
+  v_int32 error = errno;
+
+  {
+    std::lock_guard<std::mutex> lock(m_acceptorsMutex);
+    -- m_activeAcceptors;
+  }
+  m_acceptorsCondition.notify_all();
 
   if (handle < 0) {
-    v_int32 error = errno;
     if(error == EAGAIN || error == EWOULDBLOCK){
       return nullptr;
     } else {
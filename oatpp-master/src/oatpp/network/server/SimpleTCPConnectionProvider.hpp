@@ -30,36 +30,50 @@
 #include "oatpp/core/data/stream/Stream.hpp"
 #include "oatpp/core/Types.hpp"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
 namespace oatpp { namespace network { namespace server {
 
 /**
- * Simple provider of TCP connections.
+ * Simple provider of TCP connections. <br>
+ * May have multiple listening sockets bound to the same port with `SO_REUSEPORT` - kernel distributes incoming
+ * connections between them. &id:oatpp::network::server::Server; accepts on each listener in a separate thread.
  */
 class SimpleTCPConnectionProvider : public base::Countable, public ServerConnectionProvider {
 private:
   v_word16 m_port;
-  bool m_closed;
+  std::atomic<bool> m_closed;
   oatpp::data::v_io_handle m_serverHandle;
+  std::vector<oatpp::data::v_io_handle> m_listenerHandles;
+  std::mutex m_acceptorsMutex;
+  std::condition_variable m_acceptorsCondition;
+  v_int32 m_activeAcceptors;
 private:
-  oatpp::data::v_io_handle instantiateServer();
+  oatpp::data::v_io_handle instantiateServer(bool reusePort);
+  std::shared_ptr<IOStream> acceptConnection(oatpp::data::v_io_handle serverHandle);
 public:
 
   /**
    * Constructor.
    * @param port - port to listen for incoming connections.
-   * @param port
+   * @param listenersCount - number of listening sockets. Values `> 1` require `SO_REUSEPORT` support,
+   * otherwise single listener is created.
    */
-  SimpleTCPConnectionProvider(v_word16 port);
+  SimpleTCPConnectionProvider(v_word16 port, v_int32 listenersCount = 1);
 public:
 
   /**
    * Create shared SimpleTCPConnectionProvider.
    * @param port - port to listen for incoming connections.
-   * @param port
+   * @param listenersCount - number of listening sockets. Values `> 1` require `SO_REUSEPORT` support,
+   * otherwise single listener is created.
    * @return - `std::shared_ptr` to SimpleTCPConnectionProvider.
    */
-  static std::shared_ptr<SimpleTCPConnectionProvider> createShared(v_word16 port){
-    return std::make_shared<SimpleTCPConnectionProvider>(port);
+  static std::shared_ptr<SimpleTCPConnectionProvider> createShared(v_word16 port, v_int32 listenersCount = 1){
+    return std::make_shared<SimpleTCPConnectionProvider>(port, listenersCount);
   }
 
   /**
@@ -68,7 +82,10 @@ public:
   ~SimpleTCPConnectionProvider();
 
   /**
-   * Close accept-socket.
+   * Close accept-sockets. <br>
+   * Listening sockets are shut down first, which wakes up all threads blocked in `accept()`.
+   * Handles are closed only after every acceptor has left `accept()`, so that no acceptor
+   * may end up accepting on an unrelated socket which reused the same handle number.
    */
   void close() override;
 
@@ -78,6 +95,19 @@ public:
    */
   std::shared_ptr<IOStream> getConnection() override;
 
+  /**
+   * Get number of listening sockets.
+   * @return - number of listening sockets.
+   */
+  v_int32 getListenersCount() override;
+
+  /**
+   * Get incoming connection from the specific listening socket.
+   * @param listenerIndex - index of the listening socket.
+   * @return &id:oatpp::data::stream::IOStream;.
+   */
+  std::shared_ptr<IOStream> getListenerConnection(v_int32 listenerIndex) override;
+
   /**
    * No need to implement this.<br>
    * For Asynchronous IO in oatpp it is considered to be a good practice
@@ -27,13 +27,131 @@
 #include "oatpp/encoding/Unicode.hpp"
 #include "oatpp/encoding/Hex.hpp"
 
+#include <cstring>
+
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#elif defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
+
 namespace oatpp { namespace parser { namespace json{
 
+v_int32 Utils::findCharToEscape(p_char8 data, v_int32 size) {
+
+  v_int32 i = 0;
+
+  /* Signed compare with 32 catches both control chars and non-ASCII bytes (negative as signed) */
+
+#if defined(__AVX2__)
+
+  const __m256i space = _mm256_set1_epi8(32);
+  const __m256i quote = _mm256_set1_epi8('"');
+  const __m256i backslash = _mm256_set1_epi8('\\');
+  const __m256i slash = _mm256_set1_epi8('/');
+
+  for(; i + 32 <= size; i += 32) {
+    __m256i chunk = _mm256_loadu_si256((const __m256i*) &data[i]);
+    __m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi8(space, chunk), _mm256_cmpeq_epi8(chunk, quote)),
+                                _mm256_or_si256(_mm256_cmpeq_epi8(chunk, backslash), _mm256_cmpeq_epi8(chunk, slash)));
+    v_word32 mask = (v_word32) _mm256_movemask_epi8(m);
+    if(mask != 0) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+
+#elif defined(__SSE2__)
+
+  const __m128i space = _mm_set1_epi8(32);
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i slash = _mm_set1_epi8('/');
+
+  for(; i + 16 <= size; i += 16) {
+    __m128i chunk = _mm_loadu_si128((const __m128i*) &data[i]);
+    __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmplt_epi8(chunk, space), _mm_cmpeq_epi8(chunk, quote)),
+                             _mm_or_si128(_mm_cmpeq_epi8(chunk, backslash), _mm_cmpeq_epi8(chunk, slash)));
+    v_word32 mask = (v_word32) _mm_movemask_epi8(m);
+    if(mask != 0) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+
+#endif
+
+  for(; i < size; i ++) {
+    v_char8 a = data[i];
+    if(a < 32 || a >= 128 || a == '"' || a == '\\' || a == '/') {
+      return i;
+    }
+  }
+
+  return size;
+
+}
+
+v_int32 Utils::findQuoteOrBackslash(p_char8 data, v_int32 size) {
+
+  v_int32 i = 0;
+
+#if defined(__AVX2__)
+
+  const __m256i quote = _mm256_set1_epi8('"');
+  const __m256i backslash = _mm256_set1_epi8('\\');
+
+  for(; i + 32 <= size; i += 32) {
+    __m256i chunk = _mm256_loadu_si256((const __m256i*) &data[i]);
+    v_word32 mask = (v_word32) _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash)));
+    if(mask != 0) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+
+#elif defined(__SSE2__)
+
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+
+  for(; i + 16 <= size; i += 16) {
+    __m128i chunk = _mm_loadu_si128((const __m128i*) &data[i]);
+    v_word32 mask = (v_word32) _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)));
+    if(mask != 0) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+
+#endif
+
+  for(; i < size; i ++) {
+    if(data[i] == '"' || data[i] == '\\') {
+      return i;
+    }
+  }
+
+  return size;
+
+}
+
+v_int32 Utils::findBackslash(p_char8 data, v_int32 size) {
+  /* memchr is vectorized by the standard library */
+  p_char8 found = (p_char8) std::memchr(data, '\\', size);
+  if(found == nullptr) {
+    return size;
+  }
+  return (v_int32) (found - data);
+}
+
 v_int32 Utils::calcEscapedStringSize(p_char8 data, v_int32 size, v_int32& safeSize) {
   v_int32 result = 0;
   v_int32 i = 0;
   safeSize = size;
   while (i < size) {
+    v_int32 safeRun = findCharToEscape(&data[i], size - i);
+    i += safeRun;
+    result += safeRun;
+    if(i == size) {
+      break;
+    }
     v_char8 a = data[i];
     if(a < 32) {
       i ++;
@@ -44,11 +162,7 @@ v_int32 Utils::calcEscapedStringSize(p_char8 data, v_int32 size, v_int32& safeSi
       }
     } else if(a < 128){
       i ++;
-      if(a == '\"' || a == '\\' || a == '/'){
-        result += 2; // '\/'
-      } else {
-        result ++;
-      }
+      result += 2; // '\"', '\\', '\/'
     } else {
       v_int32 charSize = oatpp::encoding::Unicode::getUtf8CharSequenceLength(a);
       if(charSize != 0) {
@@ -79,6 +193,14 @@ v_int32 Utils::calcUnescapedStringSize(p_char8 data, v_int32 size, v_int32& erro
   v_int32 i = 0;
   
   while (i < size) {
+
+    v_int32 plainRun = findBackslash(&data[i], size - i);
+    i += plainRun;
+    result += plainRun;
+    if(i == size) {
+      break;
+    }
+
     v_char8 a = data[i];
     if(a == '\\'){
       
@@ -196,6 +318,50 @@ v_int32 Utils::escapeUtf8Char(p_char8 sequence, p_char8 buffer){
   }
 }
   
+v_int32 Utils::escapeChar(p_char8 data, v_int32 size, p_char8 buffer, v_int32& charSize) {
+
+  v_char8 a = data[0];
+  charSize = 1;
+
+  if(a < 32) {
+    buffer[0] = '\\';
+    switch(a) {
+      case '\b': buffer[1] = 'b'; return 2;
+      case '\f': buffer[1] = 'f'; return 2;
+      case '\n': buffer[1] = 'n'; return 2;
+      case '\r': buffer[1] = 'r'; return 2;
+      case '\t': buffer[1] = 't'; return 2;
+      default:
+        buffer[1] = 'u';
+        oatpp::encoding::Hex::writeWord16(a, &buffer[2]);
+        return 6;
+    }
+  } else if(a < 128) {
+    buffer[0] = '\\';
+    buffer[1] = a;
+    return 2;
+  }
+
+  v_int32 sequenceSize = oatpp::encoding::Unicode::getUtf8CharSequenceLength(a);
+  if(sequenceSize == 0) {
+    // invalid char
+    buffer[0] = a;
+    return 1;
+  }
+
+  if(sequenceSize > size) {
+    // truncated sequence - fill escaped size with '?'
+    v_int32 escapedSize = sequenceSize < 4 ? 6 : (sequenceSize == 4 ? 12 : 11);
+    std::memset(buffer, '?', escapedSize);
+    charSize = size;
+    return escapedSize;
+  }
+
+  charSize = sequenceSize;
+  return escapeUtf8Char(data, buffer);
+
+}
+
 oatpp::String Utils::escapeString(p_char8 data, v_int32 size, bool copyAsOwnData) {
   v_int32 safeSize;
   v_int32 escapedSize = calcEscapedStringSize(data, size, safeSize);
@@ -203,63 +369,44 @@ oatpp::String Utils::escapeString(p_char8 data, v_int32 size, bool copyAsOwnData
     return String((const char*)data, size, copyAsOwnData);
   }
   auto result = String(escapedSize);
-  v_int32 i = 0;
   p_char8 resultData = result->getData();
+  v_int32 i = 0;
   v_int32 pos = 0;
-  
-  while (i < safeSize) {
-    v_char8 a = data[i];
-    if(a < 32) {
-      if(a == '\b'){
-        resultData[pos] = '\\'; resultData[pos + 1] = 'b'; pos += 2;
-      } else if(a == '\f'){
-        resultData[pos] = '\\'; resultData[pos + 1] = 'f'; pos += 2;
-      } else if(a == '\n'){
-        resultData[pos] = '\\'; resultData[pos + 1] = 'n'; pos += 2;
-      } else if(a == '\r'){
-        resultData[pos] = '\\'; resultData[pos + 1] = 'r'; pos += 2;
-      } else if(a == '\t'){
-        resultData[pos] = '\\'; resultData[pos + 1] = 't'; pos += 2;
-      } else {
-        resultData[pos] = '\\';
-        resultData[pos + 1] = 'u';
-        oatpp::encoding::Hex::writeWord16(a, &resultData[pos + 2]);
-        pos += 6;
-      }
-      i ++;
-    } else if(a < 128){
-      if(a == '\"'){
-        resultData[pos] = '\\'; resultData[pos + 1] = '"'; pos += 2;
-      } else if(a == '\\'){
-        resultData[pos] = '\\'; resultData[pos + 1] = '\\'; pos += 2;
-      } else if(a == '/'){
-        resultData[pos] = '\\'; resultData[pos + 1] = '/'; pos += 2;
-      } else {
-        resultData[pos] = data[i];
-        pos ++;
-      }
-      i ++;
-    } else {
-      v_int32 charSize = oatpp::encoding::Unicode::getUtf8CharSequenceLength(a);
-      if(charSize != 0) {
-        pos += escapeUtf8Char(&data[i], &resultData[pos]);
-        i += charSize;
-      } else {
-        // invalid char
-        resultData[pos] = data[i];
-        i ++;
-        pos ++;
-      }
+
+  while (i < size) {
+    v_int32 safeRun = findCharToEscape(&data[i], size - i);
+    std::memcpy(&resultData[pos], &data[i], safeRun);
+    i += safeRun;
+    pos += safeRun;
+    if(i < size) {
+      v_int32 charSize;
+      pos += escapeChar(&data[i], size - i, &resultData[pos], charSize);
+      i += charSize;
     }
   }
-  
-  if(size > safeSize){
-    for(v_int32 i = pos; i < result->getSize(); i ++){
-      resultData[i] = '?';
+
+  return result;
+}
+
+void Utils::escapeStringToStream(data::stream::ConsistentOutputStream* stream, p_char8 data, v_int32 size) {
+
+  v_char8 buffer[12];
+  v_int32 i = 0;
+
+  while (i < size) {
+    v_int32 safeRun = findCharToEscape(&data[i], size - i);
+    if(safeRun > 0) {
+      stream->write(&data[i], safeRun);
+      i += safeRun;
+    }
+    if(i < size) {
+      v_int32 charSize;
+      v_int32 escapedSize = escapeChar(&data[i], size - i, buffer, charSize);
+      stream->write(buffer, escapedSize);
+      i += charSize;
     }
   }
-  
-  return result;
+
 }
 
 void Utils::unescapeStringToBuffer(p_char8 data, v_int32 size, p_char8 resultData){
@@ -268,6 +415,15 @@ void Utils::unescapeStringToBuffer(p_char8 data, v_int32 size, p_char8 resultDat
   v_int32 pos = 0;
   
   while (i < size) {
+
+    v_int32 plainRun = findBackslash(&data[i], size - i);
+    std::memcpy(&resultData[pos], &data[i], plainRun);
+    i += plainRun;
+    pos += plainRun;
+    if(i == size) {
+      break;
+    }
+
     v_char8 a = data[i];
     
     if(a == '\\'){
@@ -361,15 +517,15 @@ p_char8 Utils::preparseString(ParsingCaret& caret, v_int32& size){
     v_int32 length = caret.getDataSize();
     
     while (pos < length) {
-      v_char8 a = data[pos];
-      if(a == '"'){
+      pos += findQuoteOrBackslash(&data[pos], length - pos);
+      if(pos >= length) {
+        break;
+      }
+      if(data[pos] == '"'){
         size = pos - pos0;
         return &data[pos0];
-      } else if(a == '\\') {
-        pos += 2;
-      } else {
-        pos ++;
       }
+      pos += 2;
     }
     caret.setPosition(caret.getDataSize());
     caret.setError("[oatpp::parser::json::Utils::preparseString()]: Error. '\"' - expected", ERROR_CODE_PARSER_QUOTE_EXPECTED);
@@ -408,6 +564,37 @@ oatpp::String Utils::parseString(ParsingCaret& caret) {
   
 }
   
+p_char8 Utils::parseStringInPlace(ParsingCaret& caret, v_int32& size) {
+
+  v_int32 start = caret.getPosition();
+
+  if(caret.canContinueAtChar('"', 1)){
+
+    const p_char8 data = caret.getData();
+    v_int32 pos = caret.getPosition();
+    v_int32 pos0 = pos;
+    v_int32 length = caret.getDataSize();
+
+    pos += findQuoteOrBackslash(&data[pos], length - pos);
+    if(pos < length) {
+      if(data[pos] == '"'){
+        size = pos - pos0;
+        caret.setPosition(pos + 1);
+        return &data[pos0];
+      }
+      caret.setPosition(start);
+      return nullptr;
+    }
+    caret.setPosition(caret.getDataSize());
+    caret.setError("[oatpp::parser::json::Utils::parseStringInPlace()]: Error. '\"' - expected", ERROR_CODE_PARSER_QUOTE_EXPECTED);
+  } else {
+    caret.setError("[oatpp::parser::json::Utils::parseStringInPlace()]: Error. '\"' - expected", ERROR_CODE_PARSER_QUOTE_EXPECTED);
+  }
+
+  return nullptr;
+
+}
+
 std::string Utils::parseStringToStdString(ParsingCaret& caret){
   
   v_int32 size;
@@ -25,6 +25,7 @@
 #ifndef oatpp_parser_json_Utils_hpp
 #define oatpp_parser_json_Utils_hpp
 
+#include "oatpp/core/data/stream/Stream.hpp"
 #include "oatpp/core/parser/Caret.hpp"
 #include "oatpp/core/Types.hpp"
 
@@ -59,7 +60,17 @@ public:
   typedef oatpp::String String;
   typedef oatpp::parser::Caret ParsingCaret;
 private:
+
+  /*
+   * Scanners below use AVX2 or SSE2 instructions if available at compile time.
+   * Return position of the first matching char or `size` if not found.
+   */
+  static v_int32 findCharToEscape(p_char8 data, v_int32 size);
+  static v_int32 findQuoteOrBackslash(p_char8 data, v_int32 size);
+  static v_int32 findBackslash(p_char8 data, v_int32 size);
+
   static v_int32 escapeUtf8Char(p_char8 sequence, p_char8 buffer);
+  static v_int32 escapeChar(p_char8 data, v_int32 size, p_char8 buffer, v_int32& charSize);
   static v_int32 calcEscapedStringSize(p_char8 data, v_int32 size, v_int32& safeSize);
   static v_int32 calcUnescapedStringSize(p_char8 data, v_int32 size, v_int32& errorCode, v_int32& errorPosition);
   static void unescapeStringToBuffer(p_char8 data, v_int32 size, p_char8 resultData);
@@ -76,6 +87,15 @@ public:
    */
   static String escapeString(p_char8 data, v_int32 size, bool copyAsOwnData = true);
 
+  /**
+   * Escape string as for json standard and write it directly to stream. <br>
+   * Single pass - no intermediate buffer is allocated. Quotes are not written.
+   * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+   * @param data - pointer to string to escape.
+   * @param size - data size.
+   */
+  static void escapeStringToStream(data::stream::ConsistentOutputStream* stream, p_char8 data, v_int32 size);
+
   /**
    * Unescape string as for json standard.
    * @param data - pointer to string to unescape.
@@ -121,6 +141,16 @@ public:
    * @return - `std::string`.
    */
   static std::string parseStringToStdString(ParsingCaret& caret);
+
+  /**
+   * Parse string enclosed in `"<string>"` without copying it. <br>
+   * Works for strings with no escaped chars only. If string has escaped chars - caret stays at the opening quote
+   * and `nullptr` is returned. Use &l:Utils::parseStringToStdString (); in this case.
+   * @param caret - &id:oatpp::parser::Caret;.
+   * @param size - out parameter. Size of the string.
+   * @return - pointer to string data in the caret buffer or `nullptr`.
+   */
+  static p_char8 parseStringInPlace(ParsingCaret& caret, v_int32& size);
   
 };
   
@@ -199,27 +199,18 @@ Deserializer::AbstractObjectWrapper Deserializer::readValue(const Type* const ty
                                                   oatpp::parser::Caret& caret,
                                                   const std::shared_ptr<Config>& config){
   
-  auto typeName = type->name;
-  if(typeName == oatpp::data::mapping::type::__class::String::CLASS_NAME){
-    return readStringValue(caret);
-  } else if(typeName == oatpp::data::mapping::type::__class::Int32::CLASS_NAME){
-    return readInt32Value(caret);
-  } else if(typeName == oatpp::data::mapping::type::__class::Int64::CLASS_NAME){
-    return readInt64Value(caret);
-  } else if(typeName == oatpp::data::mapping::type::__class::Float32::CLASS_NAME){
-    return readFloat32Value(caret);
-  } else if(typeName == oatpp::data::mapping::type::__class::Float64::CLASS_NAME){
-    return readFloat64Value(caret);
-  } else if(typeName == oatpp::data::mapping::type::__class::Boolean::CLASS_NAME){
-    return readBooleanValue(caret);
-  } else if(typeName == oatpp::data::mapping::type::__class::AbstractObject::CLASS_NAME){
-    return readObjectValue(type, caret, config);
-  } else if(typeName == oatpp::data::mapping::type::__class::AbstractList::CLASS_NAME){
-    return readListValue(type, caret, config);
-  } else if(typeName == oatpp::data::mapping::type::__class::AbstractListMap::CLASS_NAME){
-    return readListMapValue(type, caret, config);
-  } else {
-    skipValue(caret);
+  switch(type->classId) {
+    case Type::CLASS_ID_STRING: return readStringValue(caret);
+    case Type::CLASS_ID_INT32: return readInt32Value(caret);
+    case Type::CLASS_ID_INT64: return readInt64Value(caret);
+    case Type::CLASS_ID_FLOAT32: return readFloat32Value(caret);
+    case Type::CLASS_ID_FLOAT64: return readFloat64Value(caret);
+    case Type::CLASS_ID_BOOLEAN: return readBooleanValue(caret);
+    case Type::CLASS_ID_OBJECT: return readObjectValue(type, caret, config);
+    case Type::CLASS_ID_LIST: return readListValue(type, caret, config);
+    case Type::CLASS_ID_LIST_MAP: return readListMapValue(type, caret, config);
+    default:
+      skipValue(caret);
   }
   
   return AbstractObjectWrapper::empty();
@@ -282,7 +273,7 @@ Deserializer::AbstractObjectWrapper Deserializer::readListMap(const Type* type,
     
     auto it = type->params.begin();
     Type* keyType = *it ++;
-    if(keyType->name != oatpp::data::mapping::type::__class::String::CLASS_NAME){
+    if(keyType->classId != Type::CLASS_ID_STRING){
       throw std::runtime_error("[oatpp::parser::json::mapping::Deserializer::readListMap()]: Invalid json map key. Key should be String");
     }
     Type* valueType = *it;
@@ -336,20 +327,32 @@ Deserializer::AbstractObjectWrapper Deserializer::readObject(const Type* type,
   if(caret.canContinueAtChar('{', 1)) {
     
     auto object = type->creator();
-    const auto& fieldsMap = type->properties->getMap();
+    const auto properties = type->properties;
 
     caret.skipBlankChars();
     
     while (!caret.isAtChar('}') && caret.canContinue()) {
       
       caret.skipBlankChars();
-      auto key = Utils::parseStringToStdString(caret);
-      if(caret.hasError()){
-        return AbstractObjectWrapper::empty();
+
+      /* Keys are matched right in the input buffer. Only keys with escaped chars are copied */
+      Property* field;
+      v_int32 keySize;
+      p_char8 keyData = Utils::parseStringInPlace(caret, keySize);
+      if(keyData != nullptr) {
+        field = properties->find((const char*) keyData, keySize);
+      } else {
+        if(caret.hasError()){
+          return AbstractObjectWrapper::empty();
+        }
+        auto key = Utils::parseStringToStdString(caret);
+        if(caret.hasError()){
+          return AbstractObjectWrapper::empty();
+        }
+        field = properties->find(key.data(), (v_int32) key.size());
       }
       
-      auto fieldIterator = fieldsMap.find(key);
-      if(fieldIterator != fieldsMap.end()){
+      if(field != nullptr){
         
         caret.skipBlankChars();
         if(!caret.canContinueAtChar(':', 1)){
@@ -359,8 +362,7 @@ Deserializer::AbstractObjectWrapper Deserializer::readObject(const Type* type,
         
         caret.skipBlankChars();
         
-        auto field = fieldIterator->second;
-        field->set(object.get(), readValue(field->type, caret, config));
+        field->getAsRef(object.get()) = readValue(field->type, caret, config);
         
       } else if (config->allowUnknownFields) {
         caret.skipBlankChars();
@@ -397,4 +399,505 @@ Deserializer::AbstractObjectWrapper Deserializer::readObject(const Type* type,
   
 }
   
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Deserializer::Reader
+
+namespace {
+
+bool isBlankChar(v_char8 a) {
+  return a == ' ' || a == '\t' || a == '\n' || a == '\r' || a == '\f';
+}
+
+bool isLiteralChar(v_char8 a) {
+  return (a >= '0' && a <= '9') || (a >= 'a' && a <= 'z') || (a >= 'A' && a <= 'Z') || a == '-' || a == '+' || a == '.';
+}
+
+}
+
+Deserializer::Reader::Reader(const Type* const type, const std::shared_ptr<Config>& config)
+  : m_config(config)
+  , m_valueType(type)
+  , m_state(STATE_VALUE)
+  , m_stringIsKey(false)
+  , m_storeToken(false)
+  , m_escaped(false)
+  , m_hasEscapes(false)
+  , m_position(0)
+  , m_resultType(nullptr)
+{}
+
+bool Deserializer::Reader::isReadableType(const Type* type) {
+  if(type == nullptr) {
+    return false;
+  }
+  switch(type->classId) {
+    case Type::CLASS_ID_STRING:
+    case Type::CLASS_ID_INT32:
+    case Type::CLASS_ID_INT64:
+    case Type::CLASS_ID_FLOAT32:
+    case Type::CLASS_ID_FLOAT64:
+    case Type::CLASS_ID_BOOLEAN:
+    case Type::CLASS_ID_OBJECT:
+    case Type::CLASS_ID_LIST:
+    case Type::CLASS_ID_LIST_MAP:
+      return true;
+    default:
+      return false; // same as Deserializer::readValue() - values of other types are skipped
+  }
+}
+
+Deserializer::AbstractObjectWrapper Deserializer::Reader::emptyValue(const Type* type) {
+  if(type == nullptr) {
+    return AbstractObjectWrapper::empty();
+  }
+  return AbstractObjectWrapper(type);
+}
+
+void Deserializer::Reader::error(const char* message, v_int32 code) {
+  setError(message, code, m_position);
+  m_stack.clear();
+  m_token.clear();
+}
+
+bool Deserializer::Reader::startValue(v_char8 a) {
+
+  if(a == '{' || a == '[') {
+    return openScope(a);
+  }
+
+  /* same as Deserializer::deserialize() - root object, list or map can't be null or a plain value */
+  if(m_stack.empty() && isReadableType(m_valueType)) {
+    switch(m_valueType->classId) {
+      case Type::CLASS_ID_OBJECT:
+      case Type::CLASS_ID_LIST_MAP:
+        error("[oatpp::parser::json::mapping::Deserializer::Reader::startValue()]: Error. '{' - expected", ERROR_CODE_OBJECT_SCOPE_OPEN);
+        return false;
+      case Type::CLASS_ID_LIST:
+        error("[oatpp::parser::json::mapping::Deserializer::Reader::startValue()]: Error. '[' - expected", ERROR_CODE_ARRAY_SCOPE_OPEN);
+        return false;
+      default:
+        break;
+    }
+  }
+
+  if(a == '"') {
+    bool readable = isReadableType(m_valueType);
+    if(readable && m_valueType->classId != Type::CLASS_ID_STRING) {
+      error("[oatpp::parser::json::mapping::Deserializer::Reader::startValue()]: Error. Unexpected string value", ERROR_CODE_VALUE_INVALID);
+      return false;
+    }
+    m_state = STATE_STRING;
+    m_stringIsKey = false;
+    m_storeToken = readable;
+    m_hasEscapes = false;
+    m_token.clear();
+    return true;
+  }
+
+  if(isLiteralChar(a)) {
+    m_state = STATE_LITERAL;
+    m_token.clear();
+    m_token.push_back((char) a);
+    return true;
+  }
+
+  error("[oatpp::parser::json::mapping::Deserializer::Reader::startValue()]: Error. Value expected", ERROR_CODE_UNEXPECTED_CHAR);
+  return false;
+
+}
+
+bool Deserializer::Reader::openScope(v_char8 a) {
+
+  const Type* type = isReadableType(m_valueType) ? m_valueType : nullptr;
+
+  if(type != nullptr) {
+    if(a == '{') {
+      if(type->classId == Type::CLASS_ID_LIST_MAP) {
+        if((*type->params.begin())->classId != Type::CLASS_ID_STRING) {
+          error("[oatpp::parser::json::mapping::Deserializer::Reader::openScope()]: Error. Invalid json map key. Key should be String", ERROR_CODE_VALUE_INVALID);
+          return false;
+        }
+      } else if(type->classId == Type::CLASS_ID_LIST) {
+        error("[oatpp::parser::json::mapping::Deserializer::Reader::openScope()]: Error. '[' - expected", ERROR_CODE_ARRAY_SCOPE_OPEN);
+        return false;
+      } else if(type->classId != Type::CLASS_ID_OBJECT) {
+        error("[oatpp::parser::json::mapping::Deserializer::Reader::openScope()]: Error. Unexpected object value", ERROR_CODE_VALUE_INVALID);
+        return false;
+      }
+    } else if(type->classId != Type::CLASS_ID_LIST) {
+      if(type->classId == Type::CLASS_ID_OBJECT || type->classId == Type::CLASS_ID_LIST_MAP) {
+        error("[oatpp::parser::json::mapping::Deserializer::Reader::openScope()]: Error. '{' - expected", ERROR_CODE_OBJECT_SCOPE_OPEN);
+      } else {
+        error("[oatpp::parser::json::mapping::Deserializer::Reader::openScope()]: Error. Unexpected array value", ERROR_CODE_VALUE_INVALID);
+      }
+      return false;
+    }
+  }
+
+  if(m_stack.size() >= (size_t) m_config->maxDepth) {
+    error("[oatpp::parser::json::mapping::Deserializer::Reader::openScope()]: Error. Max depth exceeded", ERROR_CODE_MAX_DEPTH_EXCEEDED);
+    return false;
+  }
+
+  if(a == '{') {
+    m_stack.push_back(Frame(type, m_valueType, '}'));
+    m_state = STATE_KEY_OR_OBJECT_END;
+  } else {
+    m_stack.push_back(Frame(type, m_valueType, ']'));
+    m_state = STATE_VALUE_OR_LIST_END;
+    m_valueType = (type == nullptr) ? nullptr : *type->params.begin();
+  }
+
+  return true;
+
+}
+
+bool Deserializer::Reader::closeScope() {
+  Frame& frame = m_stack.back();
+  auto value = frame.type == nullptr ? emptyValue(frame.declaredType) : frame.container;
+  m_stack.pop_back();
+  return onValue(value);
+}
+
+bool Deserializer::Reader::makeString(String& result) {
+  if(!m_hasEscapes) {
+    result = String(m_token.data(), (v_int32) m_token.size(), true);
+    return true;
+  }
+  v_int32 errorCode;
+  v_int32 errorPosition;
+  result = Utils::unescapeString((p_char8) m_token.data(), (v_int32) m_token.size(), errorCode, errorPosition);
+  if(errorCode != 0) {
+    error("[oatpp::parser::json::mapping::Deserializer::Reader::makeString()]: Error. Call to unescapeString() failed", errorCode);
+    return false;
+  }
+  return true;
+}
+
+bool Deserializer::Reader::onString() {
+
+  if(m_stringIsKey) {
+    return onKey();
+  }
+
+  if(!m_storeToken) {
+    return onValue(emptyValue(m_valueType));
+  }
+
+  String value;
+  if(!makeString(value)) {
+    return false;
+  }
+  m_token.clear();
+  return onValue(AbstractObjectWrapper(value.getPtr(), String::Class::getType()));
+
+}
+
+bool Deserializer::Reader::onKey() {
+
+  Frame& frame = m_stack.back();
+  m_state = STATE_COLON;
+
+  if(frame.type == nullptr) {
+    m_valueType = nullptr;
+    return true;
+  }
+
+  if(frame.type->classId == Type::CLASS_ID_LIST_MAP) {
+    if(!makeString(frame.key)) {
+      return false;
+    }
+    auto it = frame.type->params.begin();
+    m_valueType = *(++ it);
+    return true;
+  }
+
+  if(m_hasEscapes) {
+    v_int32 errorCode;
+    v_int32 errorPosition;
+    auto key = Utils::unescapeStringToStdString((p_char8) m_token.data(), (v_int32) m_token.size(), errorCode, errorPosition);
+    if(errorCode != 0) {
+      error("[oatpp::parser::json::mapping::Deserializer::Reader::onKey()]: Error. Call to unescapeString() failed", errorCode);
+      return false;
+    }
+    frame.field = frame.type->properties->find(key.data(), (v_int32) key.size());
+  } else {
+    frame.field = frame.type->properties->find(m_token.data(), (v_int32) m_token.size());
+  }
+
+  if(frame.field != nullptr) {
+    m_valueType = frame.field->type;
+  } else if(m_config->allowUnknownFields) {
+    m_valueType = nullptr;
+  } else {
+    error("[oatpp::parser::json::mapping::Deserializer::Reader::onKey()]: Error. Unknown field", ERROR_CODE_OBJECT_SCOPE_UNKNOWN_FIELD);
+    return false;
+  }
+
+  return true;
+
+}
+
+bool Deserializer::Reader::onLiteral() {
+
+  if(m_token == "null" || !isReadableType(m_valueType)) {
+    return onValue(emptyValue(m_valueType));
+  }
+
+  const char* data = m_token.data();
+  const v_int32 size = (v_int32) m_token.size();
+
+  switch(m_valueType->classId) {
+
+    case Type::CLASS_ID_BOOLEAN:
+      if(m_token == "true") {
+        return onValue(AbstractObjectWrapper(Boolean::ObjectType::createAbstract(true), Boolean::ObjectWrapper::Class::getType()));
+      } else if(m_token == "false") {
+        return onValue(AbstractObjectWrapper(Boolean::ObjectType::createAbstract(false), Boolean::ObjectWrapper::Class::getType()));
+      }
+      error("[oatpp::parser::json::mapping::Deserializer::Reader::onLiteral()]: Error. 'true' or 'false' - expected.", ERROR_CODE_VALUE_BOOLEAN);
+      return false;
+
+    case Type::CLASS_ID_INT32: {
+      v_int32 value;
+      if(size > 0 && utils::conversion::charSequenceToInt32(data, size, value) == size) {
+        return onValue(AbstractObjectWrapper(Int32::ObjectType::createAbstract(value), Int32::ObjectWrapper::Class::getType()));
+      }
+      break;
+    }
+
+    case Type::CLASS_ID_INT64: {
+      v_int64 value;
+      if(size > 0 && utils::conversion::charSequenceToInt64(data, size, value) == size) {
+        return onValue(AbstractObjectWrapper(Int64::ObjectType::createAbstract(value), Int64::ObjectWrapper::Class::getType()));
+      }
+      break;
+    }
+
+    case Type::CLASS_ID_FLOAT32: {
+      v_float32 value;
+      if(size > 0 && utils::conversion::charSequenceToFloat32(data, size, value) == size) {
+        return onValue(AbstractObjectWrapper(Float32::ObjectType::createAbstract(value), Float32::ObjectWrapper::Class::getType()));
+      }
+      break;
+    }
+
+    case Type::CLASS_ID_FLOAT64: {
+      v_float64 value;
+      if(size > 0 && utils::conversion::charSequenceToFloat64(data, size, value) == size) {
+        return onValue(AbstractObjectWrapper(Float64::ObjectType::createAbstract(value), Float64::ObjectWrapper::Class::getType()));
+      }
+      break;
+    }
+
+    default:
+      break;
+
+  }
+
+  error("[oatpp::parser::json::mapping::Deserializer::Reader::onLiteral()]: Error. Invalid value", ERROR_CODE_VALUE_INVALID);
+  return false;
+
+}
+
+bool Deserializer::Reader::onValue(const AbstractObjectWrapper& value) {
+
+  if(m_stack.empty()) {
+    m_resultPtr = value.getPtr();
+    m_resultType = value.valueType;
+    m_state = STATE_DONE;
+    return true;
+  }
+
+  Frame& frame = m_stack.back();
+  m_state = STATE_COMMA_OR_END;
+
+  if(frame.type == nullptr) {
+    return true;
+  }
+
+  switch(frame.type->classId) {
+    case Type::CLASS_ID_LIST:
+      static_cast<AbstractList*>(frame.container.get())->addPolymorphicItem(value);
+      break;
+    case Type::CLASS_ID_LIST_MAP:
+      static_cast<AbstractListMap*>(frame.container.get())->putPolymorphicItem(frame.key, value);
+      break;
+    default:
+      if(frame.field != nullptr) {
+        frame.field->getAsRef(frame.container.get()) = value;
+      }
+  }
+
+  return true;
+
+}
+
+bool Deserializer::Reader::feed(const void* data, oatpp::data::v_io_size size) {
+
+  if(hasError()) {
+    return false;
+  }
+
+  if(m_config->maxSize > 0 && m_position + size > m_config->maxSize) {
+    error("[oatpp::parser::json::mapping::Deserializer::Reader::feed()]: Error. Max size exceeded", ERROR_CODE_MAX_SIZE_EXCEEDED);
+    return false;
+  }
+
+  p_char8 bytes = (p_char8) data;
+  v_int64 base = m_position;
+  oatpp::data::v_io_size i = 0;
+
+  while(i < size) {
+
+    v_char8 a = bytes[i];
+    m_position = base + i;
+
+    switch(m_state) {
+
+      case STATE_STRING: {
+        if(m_escaped) {
+          if(m_storeToken) m_token.push_back((char) a);
+          m_escaped = false;
+          i ++;
+          break;
+        }
+        oatpp::data::v_io_size start = i;
+        while(i < size && bytes[i] != '"' && bytes[i] != '\\') {
+          i ++;
+        }
+        if(m_storeToken) {
+          m_token.append((const char*) &bytes[start], i - start);
+        }
+        if(i < size) {
+          if(bytes[i] == '\\') {
+            if(m_storeToken) m_token.push_back('\\');
+            m_escaped = true;
+            m_hasEscapes = true;
+            i ++;
+          } else {
+            i ++;
+            m_position = base + i;
+            if(!onString()) return false;
+          }
+        }
+        break;
+      }
+
+      case STATE_LITERAL: {
+        oatpp::data::v_io_size start = i;
+        while(i < size && isLiteralChar(bytes[i])) {
+          i ++;
+        }
+        m_token.append((const char*) &bytes[start], i - start);
+        if(i < size) {
+          m_position = base + i;
+          if(!onLiteral()) return false;
+        }
+        break;
+      }
+
+      case STATE_VALUE:
+      case STATE_VALUE_OR_LIST_END: {
+        i ++;
+        if(isBlankChar(a)) break;
+        if(a == ']' && m_state == STATE_VALUE_OR_LIST_END) {
+          if(!closeScope()) return false;
+        } else if(!startValue(a)) {
+          return false;
+        }
+        break;
+      }
+
+      case STATE_KEY:
+      case STATE_KEY_OR_OBJECT_END: {
+        i ++;
+        if(isBlankChar(a)) break;
+        if(a == '"') {
+          m_state = STATE_STRING;
+          m_stringIsKey = true;
+          m_storeToken = (m_stack.back().type != nullptr);
+          m_hasEscapes = false;
+          m_token.clear();
+        } else if(a == '}' && m_state == STATE_KEY_OR_OBJECT_END) {
+          if(!closeScope()) return false;
+        } else {
+          error("[oatpp::parser::json::mapping::Deserializer::Reader::feed()]: Error. '\"' - expected", Utils::ERROR_CODE_PARSER_QUOTE_EXPECTED);
+          return false;
+        }
+        break;
+      }
+
+      case STATE_COLON: {
+        i ++;
+        if(isBlankChar(a)) break;
+        if(a == ':') {
+          m_state = STATE_VALUE;
+        } else {
+          error("[oatpp::parser::json::mapping::Deserializer::Reader::feed()]: Error. ':' - expected", ERROR_CODE_OBJECT_SCOPE_COLON_MISSING);
+          return false;
+        }
+        break;
+      }
+
+      case STATE_COMMA_OR_END: {
+        i ++;
+        if(isBlankChar(a)) break;
+        Frame& frame = m_stack.back();
+        if(a == ',') {
+          if(frame.closeChar == '}') {
+            m_state = STATE_KEY;
+          } else {
+            m_state = STATE_VALUE;
+            m_valueType = (frame.type == nullptr) ? nullptr : *frame.type->params.begin();
+          }
+        } else if(a == frame.closeChar) {
+          if(!closeScope()) return false;
+        } else if(frame.closeChar == '}') {
+          error("[oatpp::parser::json::mapping::Deserializer::Reader::feed()]: Error. '}' - expected", ERROR_CODE_OBJECT_SCOPE_CLOSE);
+          return false;
+        } else {
+          error("[oatpp::parser::json::mapping::Deserializer::Reader::feed()]: Error. ']' - expected", ERROR_CODE_ARRAY_SCOPE_CLOSE);
+          return false;
+        }
+        break;
+      }
+
+      default: {
+        i ++;
+        if(!isBlankChar(a)) {
+          error("[oatpp::parser::json::mapping::Deserializer::Reader::feed()]: Error. Unexpected data after the end of json", ERROR_CODE_UNEXPECTED_CHAR);
+          return false;
+        }
+      }
+
+    }
+
+  }
+
+  m_position = base + size;
+  return true;
+
+}
+
+Deserializer::AbstractObjectWrapper Deserializer::Reader::finish() {
+
+  if(!hasError()) {
+    if(m_state == STATE_LITERAL) {
+      onLiteral();
+    }
+    if(!hasError() && m_state != STATE_DONE) {
+      error("[oatpp::parser::json::mapping::Deserializer::Reader::finish()]: Error. Unexpected end of data", ERROR_CODE_UNEXPECTED_END);
+    }
+  }
+
+  if(hasError()) {
+    return AbstractObjectWrapper::empty();
+  }
+
+  m_token.clear();
+  return AbstractObjectWrapper(m_resultPtr, m_resultType);
+
+}
+
 }}}}
@@ -25,6 +25,8 @@
 #ifndef oatpp_parser_json_mapping_Deserializer_hpp
 #define oatpp_parser_json_mapping_Deserializer_hpp
 
+#include "oatpp/core/data/mapping/ObjectMapper.hpp"
+#include "oatpp/core/data/mapping/type/ListMap.hpp"
 #include "oatpp/core/data/mapping/type/List.hpp"
 #include "oatpp/core/data/mapping/type/Object.hpp"
 #include "oatpp/core/data/mapping/type/Primitive.hpp"
@@ -35,6 +37,9 @@
 #include "oatpp/core/collection/LinkedList.hpp"
 #include "oatpp/core/Types.hpp"
 
+#include <string>
+#include <vector>
+
 namespace oatpp { namespace parser { namespace json { namespace mapping {
 
 /**
@@ -88,7 +93,18 @@ public:
      * "unknown field" is the one which is not present in DTO object class.
      */
     bool allowUnknownFields = true;
-    
+
+    /**
+     * Max nesting depth of json objects and arrays accepted by &l:Deserializer::Reader;.
+     */
+    v_int32 maxDepth = 256;
+
+    /**
+     * Max size of json data in bytes accepted by &l:Deserializer::Reader;. `0` - no limit. <br>
+     * Default is 10MB so that a streamed request body can't grow the result without bound.
+     */
+    v_int64 maxSize = 10 * 1024 * 1024;
+
   };
 
 public:
@@ -128,6 +144,31 @@ public:
    */
   static constexpr v_int32 ERROR_CODE_VALUE_BOOLEAN = 7;
 
+  /**
+   * "Invalid value"
+   */
+  static constexpr v_int32 ERROR_CODE_VALUE_INVALID = 8;
+
+  /**
+   * "Unexpected character"
+   */
+  static constexpr v_int32 ERROR_CODE_UNEXPECTED_CHAR = 9;
+
+  /**
+   * "Unexpected end of data"
+   */
+  static constexpr v_int32 ERROR_CODE_UNEXPECTED_END = 10;
+
+  /**
+   * "Max depth exceeded"
+   */
+  static constexpr v_int32 ERROR_CODE_MAX_DEPTH_EXCEEDED = 11;
+
+  /**
+   * "Max size exceeded"
+   */
+  static constexpr v_int32 ERROR_CODE_MAX_SIZE_EXCEEDED = 12;
+
 private:
   
   static void skipScope(oatpp::parser::Caret& caret, v_char8 charOpen, v_char8 charClose);
@@ -168,6 +209,101 @@ private:
                                           oatpp::parser::Caret& caret,
                                           const std::shared_ptr<Config>& config);
   
+public:
+
+  /**
+   * Incremental (push) json reader. <br>
+   * Accepts json in portions of arbitrary size and builds the object as the data arrives. <br>
+   * Parsing state is kept between portions so tokens and escape sequences may be split at any byte. <br>
+   * Input is limited by &l:Deserializer::Config::maxDepth; and &l:Deserializer::Config::maxSize;.
+   */
+  class Reader : public oatpp::data::mapping::ObjectMapper::Reader {
+  private:
+
+    enum State : v_int32 {
+      STATE_VALUE = 0,
+      STATE_VALUE_OR_LIST_END = 1,
+      STATE_STRING = 2,
+      STATE_LITERAL = 3,
+      STATE_KEY = 4,
+      STATE_KEY_OR_OBJECT_END = 5,
+      STATE_COLON = 6,
+      STATE_COMMA_OR_END = 7,
+      STATE_DONE = 8
+    };
+
+    /*
+     * Open json object or array. type == nullptr - the scope is skipped.
+     */
+    struct Frame {
+
+      Frame(const Type* pType, const Type* pDeclaredType, v_char8 pCloseChar)
+        : type(pType)
+        , declaredType(pDeclaredType)
+        , container(pType == nullptr ? AbstractObjectWrapper::empty() : pType->creator())
+        , closeChar(pCloseChar)
+        , field(nullptr)
+      {}
+
+      const Type* type;
+      const Type* declaredType;
+      AbstractObjectWrapper container;
+      v_char8 closeChar;
+      Property* field;
+      String key;
+    };
+
+  private:
+    static bool isReadableType(const Type* type);
+    static AbstractObjectWrapper emptyValue(const Type* type);
+  private:
+    void error(const char* message, v_int32 code);
+    bool startValue(v_char8 a);
+    bool openScope(v_char8 a);
+    bool closeScope();
+    bool onString();
+    bool onKey();
+    bool onLiteral();
+    bool onValue(const AbstractObjectWrapper& value);
+    bool makeString(String& result);
+  private:
+    std::shared_ptr<Config> m_config;
+    std::vector<Frame> m_stack;
+    const Type* m_valueType;
+    v_int32 m_state;
+    bool m_stringIsKey;
+    bool m_storeToken;
+    bool m_escaped;
+    bool m_hasEscapes;
+    std::string m_token;
+    v_int64 m_position;
+    std::shared_ptr<oatpp::base::Countable> m_resultPtr;
+    const Type* m_resultType;
+  public:
+
+    /**
+     * Constructor.
+     * @param type - type of the resultant object &id:oatpp::data::mapping::type::Type;.
+     * @param config - &l:Deserializer::Config;.
+     */
+    Reader(const Type* const type, const std::shared_ptr<Config>& config);
+
+    /**
+     * Feed next portion of json.
+     * @param data - pointer to data.
+     * @param size - size of the data.
+     * @return - `true` if data was accepted. `false` on error.
+     */
+    bool feed(const void* data, oatpp::data::v_io_size size) override;
+
+    /**
+     * Signal end of json and get the resultant object.
+     * @return - &id:oatpp::data::mapping::type::AbstractObjectWrapper; containing deserialized object. Empty wrapper on error.
+     */
+    AbstractObjectWrapper finish() override;
+
+  };
+
 public:
 
   /**
@@ -180,14 +316,13 @@ public:
   static AbstractObjectWrapper deserialize(oatpp::parser::Caret& caret,
                                            const std::shared_ptr<Config>& config,
                                            const Type* const type) {
-    if(type->name == oatpp::data::mapping::type::__class::AbstractObject::CLASS_NAME){
-      return readObject(type, caret, config);
-    } else if(type->name == oatpp::data::mapping::type::__class::AbstractList::CLASS_NAME){
-      return readList(type, caret, config);
-    } else if(type->name == oatpp::data::mapping::type::__class::AbstractListMap::CLASS_NAME){
-      return readListMap(type, caret, config);
+    switch(type->classId) {
+      case Type::CLASS_ID_OBJECT: return readObject(type, caret, config);
+      case Type::CLASS_ID_LIST: return readList(type, caret, config);
+      case Type::CLASS_ID_LIST_MAP: return readListMap(type, caret, config);
+      default:
+        return AbstractObjectWrapper::empty();
     }
-    return AbstractObjectWrapper::empty();
   }
   
 };
@@ -43,9 +43,17 @@ void ObjectMapper::write(const std::shared_ptr<oatpp::data::stream::ConsistentOu
   Serializer::serialize(stream, variant, serializerConfig);
 }
 
+std::shared_ptr<ObjectMapper::Writer> ObjectMapper::createWriter(const oatpp::data::mapping::type::AbstractObjectWrapper& variant) const {
+  return std::make_shared<Serializer::Writer>(variant, serializerConfig);
+}
+
 oatpp::data::mapping::type::AbstractObjectWrapper ObjectMapper::read(oatpp::parser::Caret& caret,
                                                                      const oatpp::data::mapping::type::Type* const type) const {
   return Deserializer::deserialize(caret, deserializerConfig, type);
 }
 
+std::shared_ptr<ObjectMapper::Reader> ObjectMapper::createReader(const oatpp::data::mapping::type::Type* const type) const {
+  return std::make_shared<Deserializer::Reader>(type, deserializerConfig);
+}
+
 }}}}
\ No newline at end of file
@@ -71,6 +71,13 @@ public:
   void write(const std::shared_ptr<oatpp::data::stream::ConsistentOutputStream>& stream,
              const oatpp::data::mapping::type::AbstractObjectWrapper& variant) const override;
 
+  /**
+   * Implementation of &id:oatpp::data::mapping::ObjectMapper::createWriter;.
+   * @param variant - object to serialize &id:oatpp::data::mapping::type::AbstractObjectWrapper;.
+   * @return - &id:oatpp::parser::json::mapping::Serializer::Writer;.
+   */
+  std::shared_ptr<Writer> createWriter(const oatpp::data::mapping::type::AbstractObjectWrapper& variant) const override;
+
   /**
    * Implementation of &id:oatpp::data::mapping::ObjectMapper::read;.
    * @param caret - &id:oatpp::parser::Caret;.
@@ -80,6 +87,13 @@ public:
   oatpp::data::mapping::type::AbstractObjectWrapper read(oatpp::parser::Caret& caret,
                                                          const oatpp::data::mapping::type::Type* const type) const override;
 
+  /**
+   * Implementation of &id:oatpp::data::mapping::ObjectMapper::createReader;.
+   * @param type - type of resultant object &id:oatpp::data::mapping::type::Type;.
+   * @return - &id:oatpp::parser::json::mapping::Deserializer::Reader;.
+   */
+  std::shared_ptr<Reader> createReader(const oatpp::data::mapping::type::Type* const type) const override;
+
   /**
    * Serializer config.
    */
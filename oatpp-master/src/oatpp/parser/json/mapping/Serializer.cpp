@@ -29,9 +29,8 @@
 namespace oatpp { namespace parser { namespace json { namespace mapping {
   
 void Serializer::writeString(oatpp::data::stream::ConsistentOutputStream* stream, p_char8 data, v_int32 size) {
-  auto encodedValue = Utils::escapeString(data, size, false);
   stream->writeChar('\"');
-  stream->write(encodedValue);
+  Utils::escapeStringToStream(stream, data, size);
   stream->writeChar('\"');
 }
 
@@ -45,10 +44,10 @@ void Serializer::writeList(oatpp::data::stream::ConsistentOutputStream* stream,
   auto curr = list->getFirstNode();
   
   while(curr != nullptr){
-    auto value = curr->getData();
+    const auto& value = curr->getData();
     if(value || config->includeNullFields) {
       (first) ? first = false : stream->write(", ", 2);
-      writeValue(stream, curr->getData(), config);
+      writeValue(stream, value, config);
     }
     curr = curr->getNext();
   }
@@ -62,13 +61,13 @@ void Serializer::writeFieldsMap(oatpp::data::stream::ConsistentOutputStream* str
   auto curr = map->getFirstEntry();
   
   while(curr != nullptr){
-    auto value = curr->getValue();
+    const auto& value = curr->getValue();
     if(value || config->includeNullFields) {
       (first) ? first = false : stream->write(", ", 2);
-      auto key = curr->getKey();
+      const auto& key = curr->getKey();
       writeString(stream, key->getData(), key->getSize());
       stream->write(": ", 2);
-      writeValue(stream, curr->getValue(), config);
+      writeValue(stream, value, config);
     }
     curr = curr->getNext();
   }
@@ -81,12 +80,12 @@ void Serializer::writeObject(oatpp::data::stream::ConsistentOutputStream* stream
   stream->writeChar('{');
   
   bool first = true;
-  auto fields = polymorph.valueType->properties->getList();
+  const auto& fields = polymorph.valueType->properties->getList();
   Object* object = polymorph.get();
   
   for (auto const& field : fields) {
     
-    auto value = field->get(object);
+    const auto& value = field->getAsRef(object);
     if(value || config->includeNullFields) {
       (first) ? first = false : stream->write(", ", 2);
       writeString(stream, field->name);
@@ -107,40 +106,154 @@ void Serializer::writeValue(oatpp::data::stream::ConsistentOutputStream* stream,
     return;
   }
   
-  const char* typeName = polymorph.valueType->name;
-  
-  if(typeName == oatpp::data::mapping::type::__class::String::CLASS_NAME) {
-    auto str = oatpp::data::mapping::type::static_wrapper_cast<oatpp::base::StrBuffer>(polymorph);
-    writeString(stream, str->getData(), str->getSize());
-  } else if(typeName == oatpp::data::mapping::type::__class::Int8::CLASS_NAME) {
-    writeSimpleData(stream, oatpp::data::mapping::type::static_wrapper_cast<Int8::ObjectType>(polymorph));
-  } else if(typeName == oatpp::data::mapping::type::__class::Int16::CLASS_NAME) {
-    writeSimpleData(stream, oatpp::data::mapping::type::static_wrapper_cast<Int16::ObjectType>(polymorph));
-  } else if(typeName == oatpp::data::mapping::type::__class::Int32::CLASS_NAME) {
-    writeSimpleData(stream, oatpp::data::mapping::type::static_wrapper_cast<Int32::ObjectType>(polymorph));
-  } else if(typeName == oatpp::data::mapping::type::__class::Int64::CLASS_NAME) {
-    writeSimpleData(stream, oatpp::data::mapping::type::static_wrapper_cast<Int64::ObjectType>(polymorph));
-  } else if(typeName == oatpp::data::mapping::type::__class::Float32::CLASS_NAME) {
-    writeSimpleData(stream, oatpp::data::mapping::type::static_wrapper_cast<Float32::ObjectType>(polymorph));
-  } else if(typeName == oatpp::data::mapping::type::__class::Float64::CLASS_NAME) {
-    writeSimpleData(stream, oatpp::data::mapping::type::static_wrapper_cast<Float64::ObjectType>(polymorph));
-  } else if(typeName == oatpp::data::mapping::type::__class::Boolean::CLASS_NAME) {
-    writeSimpleData(stream, oatpp::data::mapping::type::static_wrapper_cast<Boolean::ObjectType>(polymorph));
-  } else if(typeName == oatpp::data::mapping::type::__class::AbstractList::CLASS_NAME) {
-    writeList(stream, oatpp::data::mapping::type::static_wrapper_cast<AbstractList>(polymorph), config);
-  } else if(typeName == oatpp::data::mapping::type::__class::AbstractListMap::CLASS_NAME) {
-    // TODO Assert that key is String
-    writeFieldsMap(stream, oatpp::data::mapping::type::static_wrapper_cast<AbstractFieldsMap>(polymorph), config);
-  } else if(typeName == oatpp::data::mapping::type::__class::AbstractObject::CLASS_NAME) {
-    writeObject(stream, oatpp::data::mapping::type::static_wrapper_cast<Object>(polymorph), config);
-  } else {
-    if(config->throwOnUnknownTypes) {
-      throw std::runtime_error("[oatpp::kafka::protocol::mapping::Serializer::writeField]: Unknown data type");
-    } else {
-      writeString(stream, "<unknown-type>");
+  switch(polymorph.valueType->classId) {
+
+    case Type::CLASS_ID_STRING: {
+      auto str = static_cast<oatpp::base::StrBuffer*>(polymorph.get());
+      writeString(stream, str->getData(), str->getSize());
+      return;
     }
+
+    case Type::CLASS_ID_INT8: writeSimpleData<Int8::ObjectType>(stream, polymorph); return;
+    case Type::CLASS_ID_INT16: writeSimpleData<Int16::ObjectType>(stream, polymorph); return;
+    case Type::CLASS_ID_INT32: writeSimpleData<Int32::ObjectType>(stream, polymorph); return;
+    case Type::CLASS_ID_INT64: writeSimpleData<Int64::ObjectType>(stream, polymorph); return;
+    case Type::CLASS_ID_FLOAT32: writeSimpleData<Float32::ObjectType>(stream, polymorph); return;
+    case Type::CLASS_ID_FLOAT64: writeSimpleData<Float64::ObjectType>(stream, polymorph); return;
+    case Type::CLASS_ID_BOOLEAN: writeSimpleData<Boolean::ObjectType>(stream, polymorph); return;
+
+    case Type::CLASS_ID_LIST:
+      writeList(stream, oatpp::data::mapping::type::static_wrapper_cast<AbstractList>(polymorph), config);
+      return;
+
+    case Type::CLASS_ID_LIST_MAP:
+      // TODO Assert that key is String
+      writeFieldsMap(stream, oatpp::data::mapping::type::static_wrapper_cast<AbstractFieldsMap>(polymorph), config);
+      return;
+
+    case Type::CLASS_ID_OBJECT:
+      writeObject(stream, oatpp::data::mapping::type::static_wrapper_cast<Object>(polymorph), config);
+      return;
+
+    default:
+      break;
+
+  }
+
+  if(config->throwOnUnknownTypes) {
+    throw std::runtime_error("[oatpp::parser::json::mapping::Serializer::writeValue()]: Unknown data type");
+  } else {
+    writeString(stream, "<unknown-type>");
   }
   
 }
+
+Serializer::Writer::Writer(const AbstractObjectWrapper& polymorph, const std::shared_ptr<Config>& config)
+  : m_root(polymorph)
+  , m_config(config)
+  , m_classId(polymorph ? polymorph.valueType->classId : (v_int32) Type::CLASS_ID_UNKNOWN)
+  , m_state(STATE_BEGIN)
+  , m_first(true)
+  , m_currNode(nullptr)
+  , m_currEntry(nullptr)
+{
+  switch(m_classId) {
+    case Type::CLASS_ID_OBJECT:
+      m_currField = m_root.valueType->properties->getList().begin();
+      break;
+    case Type::CLASS_ID_LIST:
+      m_currNode = static_cast<AbstractList*>(m_root.get())->getFirstNode();
+      break;
+    case Type::CLASS_ID_LIST_MAP:
+      m_currEntry = static_cast<AbstractFieldsMap*>(m_root.get())->getFirstEntry();
+      break;
+    default:
+      throw std::runtime_error("[oatpp::parser::json::mapping::Serializer::Writer::Writer()]: Unknown parameter type");
+  }
+}
+
+bool Serializer::Writer::writeElement(oatpp::data::stream::ConsistentOutputStream* stream) {
+
+  switch(m_classId) {
+
+    case Type::CLASS_ID_OBJECT: {
+      if(m_currField == m_root.valueType->properties->getList().end()) {
+        return false;
+      }
+      Property* field = *m_currField;
+      const auto& value = field->getAsRef(m_root.get());
+      if(value || m_config->includeNullFields) {
+        (m_first) ? m_first = false : stream->write(", ", 2);
+        writeString(stream, field->name);
+        stream->write(": ", 2);
+        writeValue(stream, value, m_config);
+      }
+      m_currField ++;
+      return true;
+    }
+
+    case Type::CLASS_ID_LIST: {
+      if(m_currNode == nullptr) {
+        return false;
+      }
+      const auto& value = m_currNode->getData();
+      if(value || m_config->includeNullFields) {
+        (m_first) ? m_first = false : stream->write(", ", 2);
+        writeValue(stream, value, m_config);
+      }
+      m_currNode = m_currNode->getNext();
+      return true;
+    }
+
+    case Type::CLASS_ID_LIST_MAP: {
+      if(m_currEntry == nullptr) {
+        return false;
+      }
+      const auto& value = m_currEntry->getValue();
+      if(value || m_config->includeNullFields) {
+        (m_first) ? m_first = false : stream->write(", ", 2);
+        const auto& key = m_currEntry->getKey();
+        writeString(stream, key->getData(), key->getSize());
+        stream->write(": ", 2);
+        writeValue(stream, value, m_config);
+      }
+      m_currEntry = m_currEntry->getNext();
+      return true;
+    }
+
+    default:
+      return false;
+
+  }
+
+}
+
+bool Serializer::Writer::writeNext(const std::shared_ptr<oatpp::data::stream::ConsistentOutputStream>& stream) {
+
+  switch(m_state) {
+
+    case STATE_BEGIN:
+      stream->writeChar(m_classId == Type::CLASS_ID_LIST ? '[' : '{');
+      m_state = STATE_ELEMENTS;
+      return true;
+
+    case STATE_ELEMENTS:
+      if(writeElement(stream.get())) {
+        return true;
+      }
+      m_state = STATE_END;
+      // fallthrough - no more elements
+
+    case STATE_END:
+      stream->writeChar(m_classId == Type::CLASS_ID_LIST ? ']' : '}');
+      m_state = STATE_DONE;
+      return false;
+
+    default:
+      return false;
+
+  }
+
+}
   
 }}}}
@@ -25,6 +25,7 @@
 #ifndef oatpp_parser_json_mapping_Serializer_hpp
 #define oatpp_parser_json_mapping_Serializer_hpp
 
+#include "oatpp/core/data/mapping/ObjectMapper.hpp"
 #include "oatpp/core/data/mapping/type/ListMap.hpp"
 #include "oatpp/core/data/mapping/type/List.hpp"
 #include "oatpp/core/data/mapping/type/Object.hpp"
@@ -100,13 +101,12 @@ private:
   static void writeString(oatpp::data::stream::ConsistentOutputStream* stream, p_char8 data, v_int32 size);
   static void writeString(oatpp::data::stream::ConsistentOutputStream* stream, const char* data);
   
+  /*
+   * Write primitive value. Caller must guarantee that polymorph is not null and its type matches T.
+   */
   template<class T>
-  static void writeSimpleData(oatpp::data::stream::ConsistentOutputStream* stream, const PolymorphicWrapper<T>& value){
-    if(value){
-      stream->writeAsString(value.get()->getValue());
-    } else {
-      stream->write("null", 4);
-    }
+  static void writeSimpleData(oatpp::data::stream::ConsistentOutputStream* stream, const AbstractObjectWrapper& polymorph){
+    stream->writeAsString(static_cast<T*>(polymorph.get())->getValue());
   }
   
   static void writeList(oatpp::data::stream::ConsistentOutputStream* stream, const AbstractList::ObjectWrapper& list, const std::shared_ptr<Config>& config);
@@ -115,6 +115,53 @@ private:
   
   static void writeValue(oatpp::data::stream::ConsistentOutputStream* stream, const AbstractObjectWrapper& polymorph, const std::shared_ptr<Config>& config);
   
+public:
+
+  /**
+   * Incremental json writer. <br>
+   * Writes top-level DTO, List or Fields element by element - one element per &l:Serializer::Writer::writeNext (); call.
+   * Elements themselves are serialized as a whole.
+   */
+  class Writer : public oatpp::data::mapping::ObjectMapper::Writer {
+  private:
+
+    enum State : v_int32 {
+      STATE_BEGIN = 0,
+      STATE_ELEMENTS = 1,
+      STATE_END = 2,
+      STATE_DONE = 3
+    };
+
+  private:
+    bool writeElement(oatpp::data::stream::ConsistentOutputStream* stream);
+  private:
+    AbstractObjectWrapper m_root;
+    std::shared_ptr<Config> m_config;
+    v_int32 m_classId;
+    v_int32 m_state;
+    bool m_first;
+    AbstractList::LinkedListNode* m_currNode;
+    AbstractFieldsMap::Entry* m_currEntry;
+    std::list<Property*>::const_iterator m_currField;
+  public:
+
+    /**
+     * Constructor.
+     * @param polymorph - DTO object to serialize. Must be DTO, List or Fields.
+     * @param config - &l:Serializer::Config;.
+     * @throws - `std::runtime_error` if object is of an unsupported type.
+     */
+    Writer(const AbstractObjectWrapper& polymorph, const std::shared_ptr<Config>& config);
+
+    /**
+     * Write next element of the object.
+     * @param stream - &id:oatpp::data::stream::ConsistentOutputStream;.
+     * @return - `true` if there are more elements to write.
+     */
+    bool writeNext(const std::shared_ptr<oatpp::data::stream::ConsistentOutputStream>& stream) override;
+
+  };
+
 public:
 
   /**
@@ -126,15 +173,18 @@ public:
   static void serialize(const std::shared_ptr<oatpp::data::stream::ConsistentOutputStream>& stream,
                         const oatpp::data::mapping::type::AbstractObjectWrapper& polymorph,
                         const std::shared_ptr<Config>& config){
-    auto type = polymorph.valueType;
-    if(type->name == oatpp::data::mapping::type::__class::AbstractObject::CLASS_NAME) {
-      writeObject(stream.get(), oatpp::data::mapping::type::static_wrapper_cast<Object>(polymorph), config);
-    } else if(type->name == oatpp::data::mapping::type::__class::AbstractList::CLASS_NAME) {
-      writeList(stream.get(), oatpp::data::mapping::type::static_wrapper_cast<AbstractList>(polymorph), config);
-    } else if(type->name == oatpp::data::mapping::type::__class::AbstractListMap::CLASS_NAME) {
-      writeFieldsMap(stream.get(), oatpp::data::mapping::type::static_wrapper_cast<AbstractFieldsMap>(polymorph), config);
-    } else {
-      throw std::runtime_error("[oatpp::parser::json::mapping::Serializer::serialize()]: Unknown parameter type");
+    switch(polymorph.valueType->classId) {
+      case Type::CLASS_ID_OBJECT:
+        writeObject(stream.get(), oatpp::data::mapping::type::static_wrapper_cast<Object>(polymorph), config);
+        break;
+      case Type::CLASS_ID_LIST:
+        writeList(stream.get(), oatpp::data::mapping::type::static_wrapper_cast<AbstractList>(polymorph), config);
+        break;
+      case Type::CLASS_ID_LIST_MAP:
+        writeFieldsMap(stream.get(), oatpp::data::mapping::type::static_wrapper_cast<AbstractFieldsMap>(polymorph), config);
+        break;
+      default:
+        throw std::runtime_error("[oatpp::parser::json::mapping::Serializer::serialize()]: Unknown parameter type");
     }
   }
   
@@ -0,0 +1,168 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "ConnectionPool.hpp"
+
+#include "oatpp/network/Connection.hpp"
+
+#include <cerrno>
+
+#if !defined(WIN32) && !defined(_WIN32)
+#include <sys/socket.h>
+#endif
+
+namespace oatpp { namespace web { namespace client {
+
+ConnectionPool::ConnectionPool(v_int32 maxIdlePerHost,
+                               const std::chrono::duration<v_int64, std::micro>& maxIdleTime,
+                               const std::chrono::duration<v_int64, std::micro>& maxAge)
+  : m_maxIdlePerHost(maxIdlePerHost)
+  , m_maxIdleTime(maxIdleTime.count())
+  , m_maxAge(maxAge.count())
+  , m_hits(0)
+  , m_misses(0)
+  , m_stale(0)
+  , m_returned(0)
+{}
+
+std::shared_ptr<ConnectionPool> ConnectionPool::createShared(v_int32 maxIdlePerHost,
+                                                             const std::chrono::duration<v_int64, std::micro>& maxIdleTime,
+                                                             const std::chrono::duration<v_int64, std::micro>& maxAge)
+{
+  return std::make_shared<ConnectionPool>(maxIdlePerHost, maxIdleTime, maxAge);
+}
+
+bool ConnectionPool::isAlive(IOStream* connection) {
+
+  /* Idle keep-alive connection has nothing to read. Data or EOF means server has closed it or it's out of sync */
+
+#if !defined(WIN32) && !defined(_WIN32)
+  auto networkConnection = dynamic_cast<oatpp::network::Connection*>(connection);
+  if(networkConnection != nullptr) {
+    v_char8 byte;
+    auto res = ::recv(networkConnection->getHandle(), &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+    return res < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+  }
+#endif
+
+  auto ioMode = connection->getInputStreamIOMode();
+  connection->setInputStreamIOMode(oatpp::data::stream::IOMode::NON_BLOCKING);
+  v_char8 byte;
+  auto res = connection->read(&byte, 1);
+  connection->setInputStreamIOMode(ioMode);
+  return res == data::IOError::WAIT_RETRY;
+
+}
+
+bool ConnectionPool::take(const oatpp::String& host, PooledConnection& result) {
+
+  v_int64 now = oatpp::base::Environment::getMicroTickCount();
+
+  while(true) {
+
+    IdleConnection idle;
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto it = m_idle.find(host);
+      if(it == m_idle.end() || it->second.empty()) {
+        break;
+      }
+      idle = it->second.back();
+      it->second.pop_back();
+    }
+
+    if(now - idle.idleSince > m_maxIdleTime || now - idle.createdAt > m_maxAge || !isAlive(idle.connection.get())) {
+      ++ m_stale;
+      continue;
+    }
+
+    ++ m_hits;
+    result.connection = idle.connection;
+    result.createdAt = idle.createdAt;
+    result.reused = true;
+    return true;
+
+  }
+
+  ++ m_misses;
+  result.connection = nullptr;
+  result.createdAt = now;
+  result.reused = false;
+  return false;
+
+}
+
+void ConnectionPool::put(const oatpp::String& host, const PooledConnection& connection) {
+
+  v_int64 now = oatpp::base::Environment::getMicroTickCount();
+  if(!connection.connection || now - connection.createdAt > m_maxAge || m_maxIdlePerHost <= 0) {
+    return;
+  }
+
+  ++ m_returned;
+
+  /* dropped connection is destroyed outside of the lock */
+  std::shared_ptr<IOStream> dropped;
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& list = m_idle[host];
+    if(list.size() >= (size_t) m_maxIdlePerHost) {
+      dropped = list.front().connection;
+      list.pop_front();
+    }
+    list.push_back({connection.connection, connection.createdAt, now});
+  }
+
+}
+
+void ConnectionPool::clear() {
+  std::unordered_map<oatpp::String, std::list<IdleConnection>> idle;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    idle.swap(m_idle);
+  }
+}
+
+v_int32 ConnectionPool::getIdleCount() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  v_int32 result = 0;
+  for(auto& pair : m_idle) {
+    result += (v_int32) pair.second.size();
+  }
+  return result;
+}
+
+ConnectionPool::Statistics ConnectionPool::getStatistics() const {
+  Statistics result;
+  result.hits = m_hits;
+  result.misses = m_misses;
+  result.stale = m_stale;
+  result.returned = m_returned;
+  return result;
+}
+
+}}}
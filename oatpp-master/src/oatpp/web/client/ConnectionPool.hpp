@@ -0,0 +1,196 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_web_client_ConnectionPool_hpp
+#define oatpp_web_client_ConnectionPool_hpp
+
+#include "oatpp/core/data/stream/Stream.hpp"
+#include "oatpp/core/Types.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace oatpp { namespace web { namespace client {
+
+/**
+ * Pool of idle keep-alive client connections grouped by host. <br>
+ * Used by &id:oatpp::web::client::HttpRequestExecutor; to reuse connections between requests.
+ * Connections are validated before reuse - connection closed by the server or connection with unexpected data
+ * is dropped. <br>
+ * Do not share the same pool between sync and async executors since connections keep their I/O mode.
+ */
+class ConnectionPool : public oatpp::base::Countable {
+public:
+
+  /**
+   * Convenience typedef for &id:oatpp::data::stream::IOStream;.
+   */
+  typedef oatpp::data::stream::IOStream IOStream;
+
+  /**
+   * Connection taken from the pool or created by executor.
+   */
+  struct PooledConnection {
+
+    /**
+     * Connection stream.
+     */
+    std::shared_ptr<IOStream> connection;
+
+    /**
+     * Time when connection was created. In microseconds. See &id:oatpp::base::Environment::getMicroTickCount;.
+     */
+    v_int64 createdAt;
+
+    /**
+     * `true` if connection was taken from the pool.
+     */
+    bool reused;
+
+  };
+
+  /**
+   * Pool statistics.
+   */
+  struct Statistics {
+
+    /**
+     * Number of times idle connection was reused.
+     */
+    v_int64 hits;
+
+    /**
+     * Number of times there was no idle connection to reuse.
+     */
+    v_int64 misses;
+
+    /**
+     * Number of connections dropped because server closed them or because they were idle for too long.
+     */
+    v_int64 stale;
+
+    /**
+     * Number of connections returned to the pool.
+     */
+    v_int64 returned;
+
+    /**
+     * Hit rate - hits / (hits + misses).
+     * @return - hit rate in range [0..1].
+     */
+    double getHitRate() const {
+      if(hits + misses == 0) {
+        return 0;
+      }
+      return (double) hits / (hits + misses);
+    }
+
+  };
+
+private:
+
+  struct IdleConnection {
+    std::shared_ptr<IOStream> connection;
+    v_int64 createdAt;
+    v_int64 idleSince;
+  };
+
+private:
+  static bool isAlive(IOStream* connection);
+private:
+  v_int32 m_maxIdlePerHost;
+  v_int64 m_maxIdleTime;
+  v_int64 m_maxAge;
+  std::mutex m_mutex;
+  std::unordered_map<oatpp::String, std::list<IdleConnection>> m_idle;
+  std::atomic<v_int64> m_hits;
+  std::atomic<v_int64> m_misses;
+  std::atomic<v_int64> m_stale;
+  std::atomic<v_int64> m_returned;
+public:
+
+  /**
+   * Constructor.
+   * @param maxIdlePerHost - max number of idle connections kept per host.
+   * @param maxIdleTime - idle connections are dropped after this time.
+   * @param maxAge - connections are not reused after this time since they were created.
+   */
+  ConnectionPool(v_int32 maxIdlePerHost = 16,
+                 const std::chrono::duration<v_int64, std::micro>& maxIdleTime = std::chrono::seconds(5),
+                 const std::chrono::duration<v_int64, std::micro>& maxAge = std::chrono::minutes(5));
+
+  /**
+   * Create shared ConnectionPool.
+   * @param maxIdlePerHost - max number of idle connections kept per host.
+   * @param maxIdleTime - idle connections are dropped after this time.
+   * @param maxAge - connections are not reused after this time since they were created.
+   * @return - `std::shared_ptr` to ConnectionPool.
+   */
+  static std::shared_ptr<ConnectionPool> createShared(v_int32 maxIdlePerHost = 16,
+                                                      const std::chrono::duration<v_int64, std::micro>& maxIdleTime = std::chrono::seconds(5),
+                                                      const std::chrono::duration<v_int64, std::micro>& maxAge = std::chrono::minutes(5));
+
+  /**
+   * Take idle connection to the host. Most recently used connection is taken first.
+   * Connections which are closed by the server, idle for too long or too old are dropped.
+   * @param host - host key. Ex.: "localhost:8000".
+   * @param result - &l:ConnectionPool::PooledConnection;. `connection` is set if idle connection was found.
+   * @return - `true` if idle connection was found.
+   */
+  bool take(const oatpp::String& host, PooledConnection& result);
+
+  /**
+   * Return connection to the pool. Connection must have no pending data to read.
+   * If there are too many idle connections or connection is too old - connection is dropped.
+   * @param host - host key. Ex.: "localhost:8000".
+   * @param connection - &l:ConnectionPool::PooledConnection;.
+   */
+  void put(const oatpp::String& host, const PooledConnection& connection);
+
+  /**
+   * Drop all idle connections.
+   */
+  void clear();
+
+  /**
+   * Get number of idle connections in the pool.
+   * @return - number of idle connections.
+   */
+  v_int32 getIdleCount();
+
+  /**
+   * Get pool statistics.
+   * @return - &l:ConnectionPool::Statistics;.
+   */
+  Statistics getStatistics() const;
+
+};
+
+}}}
+
+#endif // oatpp_web_client_ConnectionPool_hpp
@@ -31,7 +31,9 @@
 #include "oatpp/network/Connection.hpp"
 #include "oatpp/core/data/stream/ChunkedBuffer.hpp"
 #include "oatpp/core/data/stream/StreamBufferedProxy.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
 
+#include <cstring>
 #include <stdlib.h>
 #include <sys/types.h>
 #if defined(WIN32) || defined(_WIN32)
@@ -45,21 +47,239 @@
 
 namespace oatpp { namespace web { namespace client {
 
+/**
+ * Response body stream which returns connection to the pool once the whole body is read.
+ */
+class HttpRequestExecutor::PooledBodyStream : public oatpp::base::Countable, public oatpp::data::stream::InputStream {
+private:
+  std::shared_ptr<oatpp::data::stream::InputStream> m_bodyStream;
+  std::shared_ptr<ConnectionPool> m_connectionPool;
+  oatpp::String m_host;
+  ConnectionPool::PooledConnection m_connection;
+  v_int64 m_bytesLeft;
+  oatpp::data::stream::IOMode m_ioMode;
+private:
+
+  void release() {
+    m_ioMode = m_bodyStream->getInputStreamIOMode();
+    m_bodyStream = nullptr;
+    m_connectionPool->put(m_host, m_connection);
+    m_connection.connection = nullptr;
+  }
+
+public:
+
+  PooledBodyStream(const std::shared_ptr<oatpp::data::stream::InputStream>& bodyStream,
+                   const std::shared_ptr<ConnectionPool>& connectionPool,
+                   const oatpp::String& host,
+                   const ConnectionPool::PooledConnection& connection,
+                   v_int64 bodySize)
+    : m_bodyStream(bodyStream)
+    , m_connectionPool(connectionPool)
+    , m_host(host)
+    , m_connection(connection)
+    , m_bytesLeft(bodySize)
+  {
+    if(m_bytesLeft == 0) {
+      release();
+    }
+  }
+
+  data::v_io_size read(void *data, data::v_io_size count) override {
+    if(m_bytesLeft == 0) {
+      return data::IOError::ZERO_VALUE;
+    }
+    if(count > m_bytesLeft) {
+      count = m_bytesLeft;
+    }
+    auto res = m_bodyStream->read(data, count);
+    if(res > 0) {
+      m_bytesLeft -= res;
+      if(m_bytesLeft == 0) {
+        release();
+      }
+    }
+    return res;
+  }
+
+  oatpp::async::Action suggestInputStreamAction(data::v_io_size ioResult) override {
+    if(m_bodyStream) {
+      return m_bodyStream->suggestInputStreamAction(ioResult);
+    }
+    return oatpp::async::Action::createActionByType(oatpp::async::Action::TYPE_REPEAT);
+  }
+
+  void setInputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    if(m_bodyStream) {
+      m_bodyStream->setInputStreamIOMode(ioMode);
+    } else {
+      m_ioMode = ioMode;
+    }
+  }
+
+  oatpp::data::stream::IOMode getInputStreamIOMode() override {
+    if(m_bodyStream) {
+      return m_bodyStream->getInputStreamIOMode();
+    }
+    return m_ioMode;
+  }
+
+};
+
+/**
+ * Connection wrapper counting bytes sent and received. <br>
+ * Used to decide whether a request failed on a reused connection can be safely retried.
+ */
+class HttpRequestExecutor::TrackedConnection : public oatpp::base::Countable, public oatpp::data::stream::IOStream {
+private:
+  std::shared_ptr<oatpp::data::stream::IOStream> m_connection;
+  v_int64 m_bytesWritten;
+  v_int64 m_bytesRead;
+public:
+
+  TrackedConnection(const std::shared_ptr<oatpp::data::stream::IOStream>& connection)
+    : m_connection(connection)
+    , m_bytesWritten(0)
+    , m_bytesRead(0)
+  {}
+
+  data::v_io_size write(const void *data, data::v_io_size count) override {
+    auto res = m_connection->write(data, count);
+    if(res > 0) {
+      m_bytesWritten += res;
+    }
+    return res;
+  }
+
+  data::v_io_size writeVectored(const oatpp::data::stream::IOVector* vectors, v_int32 count) override {
+    auto res = m_connection->writeVectored(vectors, count);
+    if(res > 0) {
+      m_bytesWritten += res;
+    }
+    return res;
+  }
+
+  data::v_io_size read(void *data, data::v_io_size count) override {
+    auto res = m_connection->read(data, count);
+    if(res > 0) {
+      m_bytesRead += res;
+    }
+    return res;
+  }
+
+  oatpp::async::Action suggestOutputStreamAction(data::v_io_size ioResult) override {
+    return m_connection->suggestOutputStreamAction(ioResult);
+  }
+
+  oatpp::async::Action suggestInputStreamAction(data::v_io_size ioResult) override {
+    return m_connection->suggestInputStreamAction(ioResult);
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    m_connection->setOutputStreamIOMode(ioMode);
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return m_connection->getOutputStreamIOMode();
+  }
+
+  void setInputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    m_connection->setInputStreamIOMode(ioMode);
+  }
+
+  oatpp::data::stream::IOMode getInputStreamIOMode() override {
+    return m_connection->getInputStreamIOMode();
+  }
+
+  v_int64 getBytesWritten() const {
+    return m_bytesWritten;
+  }
+
+  v_int64 getBytesRead() const {
+    return m_bytesRead;
+  }
+
+};
+
 HttpRequestExecutor::HttpRequestExecutor(const std::shared_ptr<oatpp::network::ClientConnectionProvider>& connectionProvider,
-                                         const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder)
+                                         const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder,
+                                         const std::shared_ptr<ConnectionPool>& connectionPool)
   : m_connectionProvider(connectionProvider)
   , m_bodyDecoder(bodyDecoder)
+  , m_connectionPool(connectionPool)
+  , m_host(connectionProvider->getProperty("host").toString() + ":" + connectionProvider->getProperty("port").toString())
 {}
 
 std::shared_ptr<HttpRequestExecutor>
 HttpRequestExecutor::createShared(const std::shared_ptr<oatpp::network::ClientConnectionProvider>& connectionProvider,
-                                  const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder)
+                                  const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder,
+                                  const std::shared_ptr<ConnectionPool>& connectionPool)
 {
-  return std::make_shared<HttpRequestExecutor>(connectionProvider, bodyDecoder);
+  return std::make_shared<HttpRequestExecutor>(connectionProvider, bodyDecoder, connectionPool);
+}
+
+v_int64 HttpRequestExecutor::getPoolableBodySize(const String& method, v_int32 statusCode, const Headers& headers) {
+
+  auto connectionIt = headers.find(Header::CONNECTION);
+  if(connectionIt != headers.end()) {
+    v_int32 size = (v_int32) std::strlen(Header::Value::CONNECTION_KEEP_ALIVE);
+    if(connectionIt->second.getSize() != size ||
+       !oatpp::base::StrBuffer::equalsCI_FAST(connectionIt->second.getData(), Header::Value::CONNECTION_KEEP_ALIVE, size)) {
+      return -1;
+    }
+  }
+
+  if(statusCode < 200 || statusCode == 204 || statusCode == 304 || method == "HEAD") {
+    return 0;
+  }
+
+  /* Chunked body end is not tracked - such connections are not reused */
+  if(headers.find(Header::TRANSFER_ENCODING) != headers.end()) {
+    return -1;
+  }
+
+  auto contentLengthIt = headers.find(Header::CONTENT_LENGTH);
+  if(contentLengthIt == headers.end()) {
+    return -1; // body ends when server closes connection
+  }
+
+  bool success;
+  v_int64 contentLength = oatpp::utils::conversion::strToInt64(contentLengthIt->second.toString(), success);
+  if(!success || contentLength < 0) {
+    return -1;
+  }
+
+  return contentLength;
+
+}
+
+bool HttpRequestExecutor::isRetryAllowed(const String& method, const std::shared_ptr<Body>& body, const TrackedConnection& connection) {
+
+  if(connection.getBytesRead() > 0) {
+    return false; // server has started to respond
+  }
+
+  if(connection.getBytesWritten() == 0) {
+    return true; // request wasn't sent
+  }
+
+  /* Request may have reached the server - send it again only if it's safe to repeat and the body can be replayed */
+  bool idempotent = method == "GET" || method == "HEAD" || method == "OPTIONS" || method == "TRACE" ||
+                    method == "PUT" || method == "DELETE";
+  bool replayable = !body || body->getKnownData() != nullptr;
+
+  return idempotent && replayable;
+
 }
 
 std::shared_ptr<HttpRequestExecutor::ConnectionHandle> HttpRequestExecutor::getConnection() {
-  auto connection = m_connectionProvider->getConnection();
+  ConnectionPool::PooledConnection pooled;
+  std::shared_ptr<oatpp::data::stream::IOStream> connection;
+  if(m_connectionPool && m_connectionPool->take(m_host, pooled)) {
+    connection = pooled.connection;
+  } else {
+    connection = m_connectionProvider->getConnection();
+  }
   if(!connection){
     throw RequestExecutionError(RequestExecutionError::ERROR_CODE_CANT_CONNECT,
                                 "[oatpp::web::client::HttpRequestExecutor::getConnection()]: ConnectionProvider failed to provide Connection");
@@ -73,13 +293,23 @@ HttpRequestExecutor::getConnectionAsync() {
   class GetConnectionCoroutine : public oatpp::async::CoroutineWithResult<GetConnectionCoroutine, const std::shared_ptr<ConnectionHandle>&> {
   private:
     std::shared_ptr<oatpp::network::ClientConnectionProvider> m_connectionProvider;
+    std::shared_ptr<ConnectionPool> m_connectionPool;
+    oatpp::String m_host;
   public:
     
-    GetConnectionCoroutine(const std::shared_ptr<oatpp::network::ClientConnectionProvider>& connectionProvider)
+    GetConnectionCoroutine(const std::shared_ptr<oatpp::network::ClientConnectionProvider>& connectionProvider,
+                           const std::shared_ptr<ConnectionPool>& connectionPool,
+                           const oatpp::String& host)
       : m_connectionProvider(connectionProvider)
+      , m_connectionPool(connectionPool)
+      , m_host(host)
     {}
     
     Action act() override {
+      ConnectionPool::PooledConnection pooled;
+      if(m_connectionPool && m_connectionPool->take(m_host, pooled)) {
+        return onConnectionReady(pooled.connection);
+      }
       return m_connectionProvider->getConnectionAsync().callbackTo(&GetConnectionCoroutine::onConnectionReady);
     }
     
@@ -89,7 +319,7 @@ HttpRequestExecutor::getConnectionAsync() {
     
   };
   
-  return GetConnectionCoroutine::startForResult(m_connectionProvider);
+  return GetConnectionCoroutine::startForResult(m_connectionProvider, m_connectionPool, m_host);
   
 }
   
@@ -100,16 +330,14 @@ HttpRequestExecutor::execute(const String& method,
                              const std::shared_ptr<Body>& body,
                              const std::shared_ptr<ConnectionHandle>& connectionHandle) {
   
-  std::shared_ptr<oatpp::network::ConnectionProvider::IOStream> connection;
+  ConnectionPool::PooledConnection pooled;
+  pooled.reused = false;
+  bool usePool = m_connectionPool && !connectionHandle;
+
   if(connectionHandle) {
-    connection = static_cast<HttpConnectionHandle*>(connectionHandle.get())->connection;
-  } else {
-    connection = m_connectionProvider->getConnection();
-  }
-  
-  if(!connection){
-    throw RequestExecutionError(RequestExecutionError::ERROR_CODE_CANT_CONNECT,
-                                "[oatpp::web::client::HttpRequestExecutor::execute()]: ConnectionProvider failed to provide Connection");
+    pooled.connection = static_cast<HttpConnectionHandle*>(connectionHandle.get())->connection;
+  } else if(!usePool || !m_connectionPool->take(m_host, pooled)) {
+    pooled.connection = m_connectionProvider->getConnection();
   }
   
   auto request = oatpp::web::protocol::http::outgoing::Request::createShared(method, path, headers, body);
@@ -118,29 +346,61 @@ HttpRequestExecutor::execute(const String& method,
   
   auto ioBuffer = oatpp::data::buffer::IOBuffer::createShared();
 
-  oatpp::data::stream::OutputStreamBufferedProxy upStream(connection, ioBuffer, (p_char8)ioBuffer->getData(), ioBuffer->getSize());
-  request->send(&upStream);
-  upStream.flush();
-  
-  oatpp::web::protocol::http::incoming::ResponseHeadersReader headerReader(ioBuffer->getData(), ioBuffer->getSize(), 4096);
+  oatpp::web::protocol::http::incoming::ResponseHeadersReader::Result result;
   oatpp::web::protocol::http::HttpError::Info error;
-  const auto& result = headerReader.readHeaders(connection, error);
+
+  while(true) {
+
+    if(!pooled.connection){
+      throw RequestExecutionError(RequestExecutionError::ERROR_CODE_CANT_CONNECT,
+                                  "[oatpp::web::client::HttpRequestExecutor::execute()]: ConnectionProvider failed to provide Connection");
+    }
+
+    auto connection = std::make_shared<TrackedConnection>(pooled.connection);
+
+    oatpp::data::stream::OutputStreamBufferedProxy upStream(connection, ioBuffer, (p_char8)ioBuffer->getData(), ioBuffer->getSize());
+    request->send(&upStream);
+    upStream.flush();
+
+    oatpp::web::protocol::http::incoming::ResponseHeadersReader headerReader(ioBuffer->getData(), ioBuffer->getSize(), 4096);
+    error = oatpp::web::protocol::http::HttpError::Info();
+    result = headerReader.readHeaders(connection, error);
+
+    if(pooled.reused && error.ioStatus <= 0 && isRetryAllowed(method, body, *connection)) {
+      /* Server closed idle connection before it got the request. Retry on a new connection */
+      pooled.connection = m_connectionProvider->getConnection();
+      pooled.createdAt = oatpp::base::Environment::getMicroTickCount();
+      pooled.reused = false;
+      continue;
+    }
+
+    break;
+
+  }
   
   if(error.status.code != 0) {
     throw RequestExecutionError(RequestExecutionError::ERROR_CODE_CANT_PARSE_STARTING_LINE,
                                 "[oatpp::web::client::HttpRequestExecutor::execute()]: Failed to parse response. Invalid response headers");
   }
   
-  if(error.ioStatus < 0) {
+  if(error.ioStatus <= 0) {
     throw RequestExecutionError(RequestExecutionError::ERROR_CODE_CANT_PARSE_STARTING_LINE,
                                 "[oatpp::web::client::HttpRequestExecutor::execute()]: Failed to read response.");
   }
   
-  auto bodyStream = oatpp::data::stream::InputStreamBufferedProxy::createShared(connection,
-                                                                                ioBuffer,
-                                                                                result.bufferPosStart,
-                                                                                result.bufferPosEnd,
-                                                                                result.bufferPosStart != result.bufferPosEnd);
+  std::shared_ptr<oatpp::data::stream::InputStream> bodyStream =
+    oatpp::data::stream::InputStreamBufferedProxy::createShared(pooled.connection,
+                                                                ioBuffer,
+                                                                result.bufferPosStart,
+                                                                result.bufferPosEnd,
+                                                                result.bufferPosStart != result.bufferPosEnd);
+
+  if(usePool) {
+    v_int64 bodySize = getPoolableBodySize(method, result.startingLine.statusCode, result.headers);
+    if(bodySize >= 0 && result.bufferPosEnd - result.bufferPosStart <= bodySize) {
+      bodyStream = std::make_shared<PooledBodyStream>(bodyStream, m_connectionPool, m_host, pooled, bodySize);
+    }
+  }
   
   return Response::createShared(result.startingLine.statusCode,
                                 result.startingLine.description.toString(),
@@ -166,10 +426,14 @@ HttpRequestExecutor::executeAsync(const String& method,
     std::shared_ptr<Body> m_body;
     std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder> m_bodyDecoder;
     std::shared_ptr<ConnectionHandle> m_connectionHandle;
+    std::shared_ptr<ConnectionPool> m_connectionPool;
+    oatpp::String m_host;
     std::shared_ptr<oatpp::data::stream::OutputStreamBufferedProxy> m_upstream;
   private:
     std::shared_ptr<oatpp::data::stream::IOStream> m_connection;
+    std::shared_ptr<TrackedConnection> m_trackedConnection;
     std::shared_ptr<oatpp::data::buffer::IOBuffer> m_ioBuffer;
+    ConnectionPool::PooledConnection m_pooled;
   public:
     
     ExecutorCoroutine(const std::shared_ptr<oatpp::network::ClientConnectionProvider>& connectionProvider,
@@ -178,7 +442,9 @@ HttpRequestExecutor::executeAsync(const String& method,
                       const Headers& headers,
                       const std::shared_ptr<Body>& body,
                       const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder,
-                      const std::shared_ptr<ConnectionHandle>& connectionHandle)
+                      const std::shared_ptr<ConnectionHandle>& connectionHandle,
+                      const std::shared_ptr<ConnectionPool>& connectionPool,
+                      const oatpp::String& host)
       : m_connectionProvider(connectionProvider)
       , m_method(method)
       , m_path(path)
@@ -186,13 +452,20 @@ HttpRequestExecutor::executeAsync(const String& method,
       , m_body(body)
       , m_bodyDecoder(bodyDecoder)
       , m_connectionHandle(connectionHandle)
-    {}
+      , m_connectionPool(connectionHandle ? nullptr : connectionPool)
+      , m_host(host)
+    {
+      m_pooled.createdAt = oatpp::base::Environment::getMicroTickCount();
+      m_pooled.reused = false;
+    }
     
     Action act() override {
       if(m_connectionHandle) {
         /* Careful here onConnectionReady() should have only one possibe state */
         /* Because it is called here in synchronous manner */
         return onConnectionReady(static_cast<HttpConnectionHandle*>(m_connectionHandle.get())->connection);
+      } else if(m_connectionPool && m_connectionPool->take(m_host, m_pooled)) {
+        return onConnectionReady(m_pooled.connection);
       } else {
         return m_connectionProvider->getConnectionAsync().callbackTo(&ExecutorCoroutine::onConnectionReady);
       }
@@ -202,36 +475,59 @@ HttpRequestExecutor::executeAsync(const String& method,
     /* Because there is a call to it from act() in synchronous manner */
     Action onConnectionReady(const std::shared_ptr<oatpp::data::stream::IOStream>& connection) {
       m_connection = connection;
+      m_pooled.connection = connection;
       auto request = oatpp::web::protocol::http::outgoing::Request::createShared(m_method, m_path, m_headers, m_body);
       request->putHeaderIfNotExists(Header::HOST, m_connectionProvider->getProperty("host"));
       request->putHeaderIfNotExists(Header::CONNECTION, Header::Value::CONNECTION_KEEP_ALIVE);
+      m_trackedConnection = std::make_shared<TrackedConnection>(connection);
       m_ioBuffer = oatpp::data::buffer::IOBuffer::createShared();
-      m_upstream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(connection, m_ioBuffer);
+      m_upstream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(m_trackedConnection, m_ioBuffer);
       return request->sendAsync(m_upstream).next(m_upstream->flushAsync()).next(yieldTo(&ExecutorCoroutine::readResponse));
     }
     
     Action readResponse() {
       ResponseHeadersReader headersReader(m_ioBuffer->getData(), m_ioBuffer->getSize(), 4096);
-      return headersReader.readHeadersAsync(m_connection).callbackTo(&ExecutorCoroutine::onHeadersParsed);
+      return headersReader.readHeadersAsync(m_trackedConnection).callbackTo(&ExecutorCoroutine::onHeadersParsed);
     }
     
     Action onHeadersParsed(const ResponseHeadersReader::Result& result) {
+
+      m_trackedConnection = nullptr;
       
-      auto bodyStream = oatpp::data::stream::InputStreamBufferedProxy::createShared(m_connection,
-                                                                                    m_ioBuffer,
-                                                                                    result.bufferPosStart,
-                                                                                    result.bufferPosEnd,
-                                                                                    result.bufferPosStart != result.bufferPosEnd);
+      std::shared_ptr<oatpp::data::stream::InputStream> bodyStream =
+        oatpp::data::stream::InputStreamBufferedProxy::createShared(m_connection,
+                                                                    m_ioBuffer,
+                                                                    result.bufferPosStart,
+                                                                    result.bufferPosEnd,
+                                                                    result.bufferPosStart != result.bufferPosEnd);
+
+      if(m_connectionPool) {
+        v_int64 bodySize = getPoolableBodySize(m_method, result.startingLine.statusCode, result.headers);
+        if(bodySize >= 0 && result.bufferPosEnd - result.bufferPosStart <= bodySize) {
+          bodyStream = std::make_shared<PooledBodyStream>(bodyStream, m_connectionPool, m_host, m_pooled, bodySize);
+        }
+      }
       
       return _return(Response::createShared(result.startingLine.statusCode,
                                             result.startingLine.description.toString(),
                                             result.headers, bodyStream, m_bodyDecoder));
       
     }
+
+    Action handleError(const std::shared_ptr<const Error>& error) override {
+      if(m_pooled.reused && m_trackedConnection && isRetryAllowed(m_method, m_body, *m_trackedConnection)) {
+        /* Server closed idle connection before it got the request. Retry on a new connection */
+        m_pooled.reused = false;
+        m_pooled.createdAt = oatpp::base::Environment::getMicroTickCount();
+        return m_connectionProvider->getConnectionAsync().callbackTo(&ExecutorCoroutine::onConnectionReady);
+      }
+      return oatpp::async::AbstractCoroutine::handleError(error);
+    }
     
   };
   
-  return ExecutorCoroutine::startForResult(m_connectionProvider, method, path, headers, body, m_bodyDecoder, connectionHandle);
+  return ExecutorCoroutine::startForResult(m_connectionProvider, method, path, headers, body, m_bodyDecoder, connectionHandle,
+                                          m_connectionPool, m_host);
   
 }
   
@@ -26,6 +26,7 @@
 #define oatpp_web_client_HttpRequestExecutor_hpp
 
 #include "./RequestExecutor.hpp"
+#include "./ConnectionPool.hpp"
 
 #include "oatpp/web/protocol/http/incoming/SimpleBodyDecoder.hpp"
 #include "oatpp/network/ConnectionProvider.hpp"
@@ -33,14 +34,31 @@
 namespace oatpp { namespace web { namespace client {
 
 /**
- * Default implementation of &id:oatpp::web::client::RequestExecutor; for making http request.
+ * Default implementation of &id:oatpp::web::client::RequestExecutor; for making http request. <br>
+ * If created with &id:oatpp::web::client::ConnectionPool; - keep-alive connections are returned to the pool
+ * once response body is fully read and are reused by subsequent requests to the same host.
  */
 class HttpRequestExecutor : public oatpp::base::Countable, public RequestExecutor {
 private:
   typedef oatpp::web::protocol::http::Header Header;
+private:
+  class PooledBodyStream; // FWD
+  class TrackedConnection; // FWD
+private:
+  /*
+   * Size of response body if connection can be returned to the pool after the body is read. -1 otherwise.
+   */
+  static v_int64 getPoolableBodySize(const String& method, v_int32 statusCode, const Headers& headers);
+
+  /*
+   * Check if request failed on a reused connection can be sent again on a new connection.
+   */
+  static bool isRetryAllowed(const String& method, const std::shared_ptr<Body>& body, const TrackedConnection& connection);
 protected:
   std::shared_ptr<oatpp::network::ClientConnectionProvider> m_connectionProvider;
   std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder> m_bodyDecoder;
+  std::shared_ptr<ConnectionPool> m_connectionPool;
+  oatpp::String m_host;
 public:
   /**
    * Connection handle for &l:HttpRequestExecutor; <br>
@@ -68,25 +86,31 @@ public:
    * Constructor.
    * @param connectionProvider - &id:oatpp::network::ClientConnectionProvider;.
    * @param bodyDecoder - &id:oatpp::web::protocol::http::incoming::BodyDecoder;.
+   * @param connectionPool - &id:oatpp::web::client::ConnectionPool;. `nullptr` - new connection for every request.
    */
   HttpRequestExecutor(const std::shared_ptr<oatpp::network::ClientConnectionProvider>& connectionProvider,
                       const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder =
-                      std::make_shared<oatpp::web::protocol::http::incoming::SimpleBodyDecoder>());
+                      std::make_shared<oatpp::web::protocol::http::incoming::SimpleBodyDecoder>(),
+                      const std::shared_ptr<ConnectionPool>& connectionPool = nullptr);
 public:
 
   /**
    * Create shared HttpRequestExecutor.
    * @param connectionProvider - &id:oatpp::network::ClientConnectionProvider;.
    * @param bodyDecoder - &id:oatpp::web::protocol::http::incoming::BodyDecoder;.
+   * @param connectionPool - &id:oatpp::web::client::ConnectionPool;. `nullptr` - new connection for every request.
    * @return - `std::shared_ptr` to `HttpRequestExecutor`.
    */
   static std::shared_ptr<HttpRequestExecutor>
   createShared(const std::shared_ptr<oatpp::network::ClientConnectionProvider>& connectionProvider,
                const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder =
-               std::make_shared<oatpp::web::protocol::http::incoming::SimpleBodyDecoder>());
+               std::make_shared<oatpp::web::protocol::http::incoming::SimpleBodyDecoder>(),
+               const std::shared_ptr<ConnectionPool>& connectionPool = nullptr);
 
   /**
-   * Get &id:oatpp::web::client::RequestExecutor::ConnectionHandle;
+   * Get &id:oatpp::web::client::RequestExecutor::ConnectionHandle; <br>
+   * If executor has connection pool - idle connection is taken from the pool.
+   * Connections obtained this way are managed by the caller and are not returned to the pool.
    * @return - ConnectionHandle which is &l:HttpRequestExecutor::HttpConnectionHandle;.
    */
   std::shared_ptr<ConnectionHandle> getConnection() override;
@@ -33,9 +33,9 @@ namespace oatpp { namespace web { namespace mime { namespace multipart {
 
 /**
  * Typedef for headers map. Headers map key is case-insensitive.
- * `std::unordered_map` of &id:oatpp::data::share::StringKeyLabelCI_FAST; and &id:oatpp::data::share::StringKeyLabel;.
+ * &id:oatpp::web::protocol::http::HeaderMap; of &id:oatpp::data::share::StringKeyLabelCI_FAST; and &id:oatpp::data::share::StringKeyLabel;.
  */
-typedef std::unordered_map<oatpp::data::share::StringKeyLabelCI_FAST, oatpp::data::share::StringKeyLabel> Headers;
+typedef oatpp::web::protocol::http::HeaderMap Headers;
 
 /**
  * Structure that holds parts of Multipart.
@@ -25,6 +25,7 @@
 #ifndef oatpp_web_mime_multipart_Part_hpp
 #define oatpp_web_mime_multipart_Part_hpp
 
+#include "oatpp/web/protocol/http/HeaderMap.hpp"
 #include "oatpp/core/data/share/MemoryLabel.hpp"
 #include "oatpp/core/data/stream/Stream.hpp"
 
@@ -39,9 +40,9 @@ class Part {
 public:
   /**
    * Typedef for headers map. Headers map key is case-insensitive.
-   * `std::unordered_map` of &id:oatpp::data::share::StringKeyLabelCI_FAST; and &id:oatpp::data::share::StringKeyLabel;.
+   * &id:oatpp::web::protocol::http::HeaderMap; of &id:oatpp::data::share::StringKeyLabelCI_FAST; and &id:oatpp::data::share::StringKeyLabel;.
    */
-  typedef std::unordered_map<oatpp::data::share::StringKeyLabelCI_FAST, oatpp::data::share::StringKeyLabel> Headers;
+  typedef oatpp::web::protocol::http::HeaderMap Headers;
 private:
   oatpp::String m_name;
   oatpp::String m_filename;
@@ -26,6 +26,7 @@
 #define oatpp_web_mime_multipart_StatefulParser_hpp
 
 #include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+#include "oatpp/web/protocol/http/HeaderMap.hpp"
 #include "oatpp/core/data/share/MemoryLabel.hpp"
 #include "oatpp/core/Types.hpp"
 
@@ -49,9 +50,9 @@ private:
 private:
   /**
    * Typedef for headers map. Headers map key is case-insensitive.
-   * `std::unordered_map` of &id:oatpp::data::share::StringKeyLabelCI_FAST; and &id:oatpp::data::share::StringKeyLabel;.
+   * &id:oatpp::web::protocol::http::HeaderMap; of &id:oatpp::data::share::StringKeyLabelCI_FAST; and &id:oatpp::data::share::StringKeyLabel;.
    */
-  typedef std::unordered_map<oatpp::data::share::StringKeyLabelCI_FAST, oatpp::data::share::StringKeyLabel> Headers;
+  typedef oatpp::web::protocol::http::HeaderMap Headers;
 public:
 
   /**
@@ -61,9 +62,9 @@ public:
   public:
     /**
      * Convenience typedef for headers map. Headers map key is case-insensitive.
-     * `std::unordered_map` of &id:oatpp::data::share::StringKeyLabelCI_FAST; and &id:oatpp::data::share::StringKeyLabel;.
+     * &id:oatpp::web::protocol::http::HeaderMap; of &id:oatpp::data::share::StringKeyLabelCI_FAST; and &id:oatpp::data::share::StringKeyLabel;.
      */
-    typedef std::unordered_map<oatpp::data::share::StringKeyLabelCI_FAST, oatpp::data::share::StringKeyLabel> Headers;
+    typedef oatpp::web::protocol::http::HeaderMap Headers;
   public:
 
     /**
@@ -98,9 +99,9 @@ public:
   public:
     /**
      * Convenience typedef for headers map. Headers map key is case-insensitive.
-     * `std::unordered_map` of &id:oatpp::data::share::StringKeyLabelCI_FAST; and &id:oatpp::data::share::StringKeyLabel;.
+     * &id:oatpp::web::protocol::http::HeaderMap; of &id:oatpp::data::share::StringKeyLabelCI_FAST; and &id:oatpp::data::share::StringKeyLabel;.
      */
-    typedef std::unordered_map<oatpp::data::share::StringKeyLabelCI_FAST, oatpp::data::share::StringKeyLabel> Headers;
+    typedef oatpp::web::protocol::http::HeaderMap Headers;
   public:
 
     /**
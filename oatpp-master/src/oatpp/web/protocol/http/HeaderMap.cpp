@@ -0,0 +1,431 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "HeaderMap.hpp"
+
+#include "Http.hpp"
+
+#include <cstring>
+#include <cstdint>
+#include <vector>
+
+namespace oatpp { namespace web { namespace protocol { namespace http {
+
+namespace {
+
+/*
+ * Header names interned by HeaderMap.
+ * Lookup by a pointer to one of the Header:: constants resolves to id without hashing the name.
+ */
+class WellKnownHeaders {
+public:
+  static constexpr v_int32 TABLE_SIZE = 64;
+  static constexpr v_word32 TABLE_MASK = TABLE_SIZE - 1;
+public:
+
+  struct Info {
+    HeaderMap::Key key;
+    v_word32 hash;
+  };
+
+private:
+  std::vector<Info> m_headers;
+  const char* m_names[TABLE_SIZE];
+  v_int16 m_byName[TABLE_SIZE];
+  v_int16 m_byPointer[TABLE_SIZE];
+private:
+
+  static v_word32 pointerSlot(const char* name) {
+    v_word32 h = (v_word32) (((std::uintptr_t) name) >> 3);
+    h *= 0x9E3779B1;
+    return (h ^ (h >> 15)) & TABLE_MASK;
+  }
+
+  static v_word32 hashSlot(v_word32 hash) {
+    hash *= 0x9E3779B1;
+    return (hash ^ (hash >> 15)) & TABLE_MASK;
+  }
+
+public:
+
+  WellKnownHeaders() {
+
+    const char* const names[] = {
+      Header::ACCEPT,
+      Header::ACCEPT_ENCODING,
+      Header::AUTHORIZATION,
+      Header::CONNECTION,
+      Header::TRANSFER_ENCODING,
+      Header::CONTENT_ENCODING,
+      Header::CONTENT_LENGTH,
+      Header::CONTENT_TYPE,
+      Header::CONTENT_RANGE,
+      Header::RANGE,
+      Header::HOST,
+      Header::USER_AGENT,
+      Header::SERVER,
+      Header::UPGRADE,
+      Header::ACCEPT_RANGES,
+      Header::ETAG,
+      Header::IF_NONE_MATCH,
+      Header::LAST_MODIFIED,
+      Header::IF_MODIFIED_SINCE,
+      Header::VARY
+    };
+
+    std::memset(m_names, 0, sizeof(m_names));
+    std::memset(m_byName, 0, sizeof(m_byName));
+    std::memset(m_byPointer, 0, sizeof(m_byPointer));
+
+    for(const char* name : names) {
+
+      HeaderMap::Key key(name);
+      v_word32 hash = std::hash<HeaderMap::Key>()(key);
+      m_headers.push_back({key, hash});
+      v_int16 id = (v_int16) m_headers.size();
+
+      v_word32 slot = hashSlot(hash);
+      while(m_byName[slot] != 0) {
+        slot = (slot + 1) & TABLE_MASK;
+      }
+      m_byName[slot] = id;
+
+      slot = pointerSlot(name);
+      while(m_byPointer[slot] != 0) {
+        slot = (slot + 1) & TABLE_MASK;
+      }
+      m_byPointer[slot] = id;
+      m_names[slot] = name;
+
+    }
+
+  }
+
+  v_int32 findByName(const HeaderMap::Key& key, v_word32 hash) const {
+    v_word32 slot = hashSlot(hash);
+    while(m_byName[slot] != 0) {
+      const Info& info = m_headers[m_byName[slot] - 1];
+      if(info.hash == hash && info.key == key) {
+        return m_byName[slot] - 1;
+      }
+      slot = (slot + 1) & TABLE_MASK;
+    }
+    return -1;
+  }
+
+  v_int32 findByPointer(const char* name) const {
+    v_word32 slot = pointerSlot(name);
+    while(m_byPointer[slot] != 0) {
+      if(m_names[slot] == name) {
+        return m_byPointer[slot] - 1;
+      }
+      slot = (slot + 1) & TABLE_MASK;
+    }
+    return -1;
+  }
+
+  const Info& get(v_int32 id) const {
+    return m_headers[id];
+  }
+
+};
+
+const WellKnownHeaders& getWellKnownHeaders() {
+  static WellKnownHeaders headers;
+  return headers;
+}
+
+v_word32 mixHash(v_word32 hash) {
+  hash *= 0x9E3779B1;
+  return hash ^ (hash >> 15);
+}
+
+}
+
+HeaderMap::HeaderMap()
+  : m_entries(m_inlineEntries)
+  , m_index(m_inlineIndex)
+  , m_capacity(INLINE_CAPACITY)
+  , m_count(0)
+{
+  std::memset(m_inlineIndex, 0, sizeof(m_inlineIndex));
+}
+
+HeaderMap::HeaderMap(const HeaderMap& other)
+  : HeaderMap()
+{
+  copyFrom(other);
+}
+
+HeaderMap::HeaderMap(HeaderMap&& other)
+  : HeaderMap()
+{
+  moveFrom(other);
+}
+
+HeaderMap& HeaderMap::operator=(const HeaderMap& other) {
+  if(this != &other) {
+    copyFrom(other);
+  }
+  return *this;
+}
+
+HeaderMap& HeaderMap::operator=(HeaderMap&& other) {
+  if(this != &other) {
+    moveFrom(other);
+  }
+  return *this;
+}
+
+void HeaderMap::resetStorage() {
+  clear();
+  m_heapEntries.reset();
+  m_heapIndex.reset();
+  m_entries = m_inlineEntries;
+  m_index = m_inlineIndex;
+  m_capacity = INLINE_CAPACITY;
+}
+
+void HeaderMap::copyFrom(const HeaderMap& other) {
+
+  resetStorage();
+
+  while(m_capacity < other.m_count) {
+    grow();
+  }
+
+  for(v_int32 i = 0; i < other.m_count; i ++) {
+    m_entries[i] = other.m_entries[i];
+  }
+  m_count = other.m_count;
+
+  if(m_capacity == other.m_capacity) {
+    std::memcpy(m_index, other.m_index, m_capacity * 2 * sizeof(v_word16));
+  } else {
+    rebuildIndex();
+  }
+
+}
+
+void HeaderMap::moveFrom(HeaderMap& other) {
+
+  if(!other.m_heapEntries) {
+    copyFrom(other);
+    other.clear();
+    return;
+  }
+
+  resetStorage();
+
+  m_heapEntries = std::move(other.m_heapEntries);
+  m_heapIndex = std::move(other.m_heapIndex);
+  m_entries = m_heapEntries.get();
+  m_index = m_heapIndex.get();
+  m_capacity = other.m_capacity;
+  m_count = other.m_count;
+
+  other.m_entries = other.m_inlineEntries;
+  other.m_index = other.m_inlineIndex;
+  other.m_capacity = INLINE_CAPACITY;
+  other.m_count = 0;
+  std::memset(other.m_inlineIndex, 0, sizeof(other.m_inlineIndex));
+
+}
+
+v_word32 HeaderMap::hashKey(const Key& key) {
+  return std::hash<Key>()(key);
+}
+
+v_int32 HeaderMap::internKey(const Key& key, v_word32 hash) {
+  return getWellKnownHeaders().findByName(key, hash);
+}
+
+v_int32 HeaderMap::getInternedId(const char* name) {
+  return getWellKnownHeaders().findByPointer(name);
+}
+
+v_int32 HeaderMap::getWellKnownId(const Key& key) {
+  return internKey(key, hashKey(key));
+}
+
+v_int32 HeaderMap::findEntry(const Key& key, v_word32 hash, v_int32 id) const {
+  v_word32 mask = (v_word32) m_capacity * 2 - 1;
+  v_word32 slot = mixHash(hash) & mask;
+  while(m_index[slot] != 0) {
+    const Entry& entry = m_entries[m_index[slot] - 1];
+    if(entry.hash == hash) {
+      if(id >= 0 ? entry.id == id : entry.pair.first == key) {
+        return m_index[slot] - 1;
+      }
+    }
+    slot = (slot + 1) & mask;
+  }
+  return -1;
+}
+
+v_int32 HeaderMap::findEntry(const char* name) const {
+  v_int32 id = getInternedId(name);
+  if(id >= 0) {
+    const auto& info = getWellKnownHeaders().get(id);
+    return findEntry(info.key, info.hash, id);
+  }
+  Key key(name);
+  return findEntry(key, hashKey(key), -1);
+}
+
+v_int32 HeaderMap::addEntry(const Key& key, v_word32 hash, v_int32 id, const Value& value) {
+  if(m_count == m_capacity) {
+    grow();
+  }
+  Entry& entry = m_entries[m_count];
+  entry.pair.first = key;
+  entry.pair.second = value;
+  entry.hash = hash;
+  entry.id = id;
+  indexEntry(m_count);
+  return m_count ++;
+}
+
+void HeaderMap::indexEntry(v_int32 entryIndex) {
+  v_word32 mask = (v_word32) m_capacity * 2 - 1;
+  v_word32 slot = mixHash(m_entries[entryIndex].hash) & mask;
+  while(m_index[slot] != 0) {
+    slot = (slot + 1) & mask;
+  }
+  m_index[slot] = (v_word16) (entryIndex + 1);
+}
+
+void HeaderMap::rebuildIndex() {
+  std::memset(m_index, 0, m_capacity * 2 * sizeof(v_word16));
+  for(v_int32 i = 0; i < m_count; i ++) {
+    indexEntry(i);
+  }
+}
+
+void HeaderMap::grow() {
+
+  v_int32 capacity = m_capacity * 2;
+  if(capacity > MAX_CAPACITY) {
+    throw std::runtime_error("[oatpp::web::protocol::http::HeaderMap::grow()]: Error. Too many headers.");
+  }
+
+  std::unique_ptr<Entry[]> entries(new Entry[capacity]);
+  for(v_int32 i = 0; i < m_count; i ++) {
+    entries[i] = std::move(m_entries[i]);
+  }
+
+  m_heapIndex.reset(new v_word16[capacity * 2]);
+  m_heapEntries = std::move(entries);
+  m_entries = m_heapEntries.get();
+  m_index = m_heapIndex.get();
+  m_capacity = capacity;
+
+  rebuildIndex();
+
+}
+
+HeaderMap::iterator HeaderMap::find(const Key& key) {
+  v_int32 index = findEntry(key, hashKey(key), -1);
+  return iterator(index < 0 ? m_entries + m_count : m_entries + index);
+}
+
+HeaderMap::const_iterator HeaderMap::find(const Key& key) const {
+  v_int32 index = findEntry(key, hashKey(key), -1);
+  return const_iterator(index < 0 ? m_entries + m_count : m_entries + index);
+}
+
+HeaderMap::iterator HeaderMap::find(const char* name) {
+  v_int32 index = findEntry(name);
+  return iterator(index < 0 ? m_entries + m_count : m_entries + index);
+}
+
+HeaderMap::const_iterator HeaderMap::find(const char* name) const {
+  v_int32 index = findEntry(name);
+  return const_iterator(index < 0 ? m_entries + m_count : m_entries + index);
+}
+
+v_int32 HeaderMap::count(const Key& key) const {
+  return findEntry(key, hashKey(key), -1) < 0 ? 0 : 1;
+}
+
+HeaderMap::Value& HeaderMap::operator[](const Key& key) {
+  v_word32 hash = hashKey(key);
+  v_int32 index = findEntry(key, hash, -1);
+  if(index < 0) {
+    index = addEntry(key, hash, internKey(key, hash), Value());
+  }
+  return m_entries[index].pair.second;
+}
+
+HeaderMap::Value& HeaderMap::operator[](const char* name) {
+  v_int32 id = getInternedId(name);
+  if(id >= 0) {
+    const auto& info = getWellKnownHeaders().get(id);
+    v_int32 index = findEntry(info.key, info.hash, id);
+    if(index < 0) {
+      index = addEntry(info.key, info.hash, id, Value());
+    }
+    return m_entries[index].pair.second;
+  }
+  return operator[](Key(name));
+}
+
+std::pair<HeaderMap::iterator, bool> HeaderMap::insert(const value_type& pair) {
+  v_word32 hash = hashKey(pair.first);
+  v_int32 index = findEntry(pair.first, hash, -1);
+  if(index >= 0) {
+    return {iterator(m_entries + index), false};
+  }
+  index = addEntry(pair.first, hash, internKey(pair.first, hash), pair.second);
+  return {iterator(m_entries + index), true};
+}
+
+v_int32 HeaderMap::erase(const Key& key) {
+
+  v_int32 index = findEntry(key, hashKey(key), -1);
+  if(index < 0) {
+    return 0;
+  }
+
+  for(v_int32 i = index; i < m_count - 1; i ++) {
+    m_entries[i] = std::move(m_entries[i + 1]);
+  }
+  m_count --;
+  m_entries[m_count].pair = value_type();
+
+  rebuildIndex();
+  return 1;
+
+}
+
+void HeaderMap::clear() {
+  for(v_int32 i = 0; i < m_count; i ++) {
+    m_entries[i].pair = value_type();
+  }
+  m_count = 0;
+  std::memset(m_index, 0, m_capacity * 2 * sizeof(v_word16));
+}
+
+}}}}
@@ -0,0 +1,300 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_web_protocol_http_HeaderMap_hpp
+#define oatpp_web_protocol_http_HeaderMap_hpp
+
+#include "oatpp/core/data/share/MemoryLabel.hpp"
+
+#include <iterator>
+#include <utility>
+#include <memory>
+#include <cstddef>
+
+namespace oatpp { namespace web { namespace protocol { namespace http {
+
+/**
+ * Flat case-insensitive map of http headers. <br>
+ * Entries are kept in insertion order in a contiguous array with inline storage for
+ * &l:HeaderMap::INLINE_CAPACITY; headers, and are indexed by an open-addressing (linear probe) hash table.
+ * No memory is allocated until the number of headers exceeds &l:HeaderMap::INLINE_CAPACITY;. <br>
+ * Header names from &id:oatpp::web::protocol::http::Header; are interned - they have precomputed hashes and ids,
+ * so lookups like `headers.find(Header::CONTENT_LENGTH)` don't hash or compare the name. <br>
+ * Interface is a subset of `std::unordered_map` of &id:oatpp::data::share::StringKeyLabelCI_FAST; and
+ * &id:oatpp::data::share::StringKeyLabel;. Keys must not be modified through iterators.
+ */
+class HeaderMap {
+public:
+
+  /**
+   * Key type.
+   */
+  typedef oatpp::data::share::StringKeyLabelCI_FAST Key;
+
+  /**
+   * Value type.
+   */
+  typedef oatpp::data::share::StringKeyLabel Value;
+
+  /**
+   * Type of map entry.
+   */
+  typedef std::pair<Key, Value> value_type;
+
+public:
+
+  /**
+   * Number of headers stored without heap allocations. <br>
+   * Kept small since every request and response carries its own map inline (about 650 bytes on 64-bit platforms):
+   * responses rarely have more than a few headers, and a request exceeding this limit allocates only once.
+   */
+  static constexpr v_int32 INLINE_CAPACITY = 8;
+
+  /**
+   * Max number of headers.
+   */
+  static constexpr v_int32 MAX_CAPACITY = 16384;
+
+private:
+
+  struct Entry {
+    value_type pair;
+    v_word32 hash;
+    v_int32 id;
+  };
+
+public:
+
+  /**
+   * Iterator over map entries. Entries are iterated in insertion order.
+   * @tparam E - entry type.
+   * @tparam V - value type.
+   */
+  template<class E, class V>
+  class Iterator {
+    friend HeaderMap;
+  private:
+    E* m_entry;
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef V value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef V* pointer;
+    typedef V& reference;
+  public:
+
+    Iterator(E* entry)
+      : m_entry(entry)
+    {}
+
+    template<class E2, class V2>
+    Iterator(const Iterator<E2, V2>& other)
+      : m_entry(other.m_entry)
+    {}
+
+    V& operator*() const {
+      return m_entry->pair;
+    }
+
+    V* operator->() const {
+      return &m_entry->pair;
+    }
+
+    Iterator& operator++() {
+      ++ m_entry;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      Iterator result(m_entry);
+      ++ m_entry;
+      return result;
+    }
+
+    template<class E2, class V2>
+    bool operator==(const Iterator<E2, V2>& other) const {
+      return m_entry == other.m_entry;
+    }
+
+    template<class E2, class V2>
+    bool operator!=(const Iterator<E2, V2>& other) const {
+      return m_entry != other.m_entry;
+    }
+
+    template<class E2, class V2>
+    friend class Iterator;
+
+  };
+
+  typedef Iterator<Entry, value_type> iterator;
+  typedef Iterator<const Entry, const value_type> const_iterator;
+
+private:
+  Entry m_inlineEntries[INLINE_CAPACITY];
+  v_word16 m_inlineIndex[INLINE_CAPACITY * 2];
+  std::unique_ptr<Entry[]> m_heapEntries;
+  std::unique_ptr<v_word16[]> m_heapIndex;
+  Entry* m_entries;
+  v_word16* m_index;
+  v_int32 m_capacity;
+  v_int32 m_count;
+private:
+  static v_word32 hashKey(const Key& key);
+  static v_int32 internKey(const Key& key, v_word32 hash);
+  static v_int32 getInternedId(const char* name);
+  v_int32 findEntry(const Key& key, v_word32 hash, v_int32 id) const;
+  v_int32 findEntry(const char* name) const;
+  v_int32 addEntry(const Key& key, v_word32 hash, v_int32 id, const Value& value);
+  void indexEntry(v_int32 entryIndex);
+  void rebuildIndex();
+  void grow();
+  void resetStorage();
+  void copyFrom(const HeaderMap& other);
+  void moveFrom(HeaderMap& other);
+public:
+
+  /**
+   * Constructor.
+   */
+  HeaderMap();
+
+  /**
+   * Copy constructor.
+   * @param other
+   */
+  HeaderMap(const HeaderMap& other);
+
+  /**
+   * Move constructor.
+   * @param other
+   */
+  HeaderMap(HeaderMap&& other);
+
+  HeaderMap& operator=(const HeaderMap& other);
+  HeaderMap& operator=(HeaderMap&& other);
+
+  /**
+   * Get id of the header name interned by the map. Ids are assigned to all &id:oatpp::web::protocol::http::Header; names.
+   * @param key - header name.
+   * @return - id of the header name or `-1` if name is not interned.
+   */
+  static v_int32 getWellKnownId(const Key& key);
+
+  iterator begin() {
+    return iterator(m_entries);
+  }
+
+  iterator end() {
+    return iterator(m_entries + m_count);
+  }
+
+  const_iterator begin() const {
+    return const_iterator(m_entries);
+  }
+
+  const_iterator end() const {
+    return const_iterator(m_entries + m_count);
+  }
+
+  /**
+   * Find header.
+   * @param key - header name.
+   * @return - iterator pointing to the header or &l:HeaderMap::end ();.
+   */
+  iterator find(const Key& key);
+  const_iterator find(const Key& key) const;
+
+  /**
+   * Find header. Fast path for interned names of &id:oatpp::web::protocol::http::Header;.
+   * @param name - header name.
+   * @return - iterator pointing to the header or &l:HeaderMap::end ();.
+   */
+  iterator find(const char* name);
+  const_iterator find(const char* name) const;
+
+  /**
+   * Count headers with the name.
+   * @param key - header name.
+   * @return - `1` if header is present, `0` otherwise.
+   */
+  v_int32 count(const Key& key) const;
+
+  /**
+   * Get value of the header. Insert empty value if header is not present.
+   * @param key - header name.
+   * @return - reference to the value.
+   */
+  Value& operator[](const Key& key);
+  Value& operator[](const char* name);
+
+  /**
+   * Insert header if it's not present.
+   * @param pair - header name and value.
+   * @return - iterator pointing to the header and `true` if the header was inserted.
+   */
+  std::pair<iterator, bool> insert(const value_type& pair);
+
+  /**
+   * Erase header. Order of the remaining headers is preserved.
+   * @param key - header name.
+   * @return - number of erased headers.
+   */
+  v_int32 erase(const Key& key);
+
+  /**
+   * Remove all headers.
+   */
+  void clear();
+
+  /**
+   * Get number of headers.
+   * @return
+   */
+  v_int32 size() const {
+    return m_count;
+  }
+
+  /**
+   * Check if map is empty.
+   * @return
+   */
+  bool empty() const {
+    return m_count == 0;
+  }
+
+  /**
+   * Get number of headers the map can hold without further allocations.
+   * Equals &l:HeaderMap::INLINE_CAPACITY; while no memory is allocated.
+   * @return
+   */
+  v_int32 capacity() const {
+    return m_capacity;
+  }
+
+};
+
+}}}}
+
+#endif // oatpp_web_protocol_http_HeaderMap_hpp
@@ -106,8 +106,13 @@ const char* const Header::Value::USER_AGENT = "oatpp/" OATPP_VERSION;
 const char* const Header::Value::TRANSFER_ENCODING_CHUNKED = "chunked";
   
 const char* const Header::Value::CONTENT_TYPE_APPLICATION_JSON = "application/json";
+
+const char* const Header::Value::CONTENT_ENCODING_GZIP = "gzip";
+const char* const Header::Value::CONTENT_ENCODING_DEFLATE = "deflate";
+const char* const Header::Value::CONTENT_ENCODING_IDENTITY = "identity";
   
 const char* const Header::ACCEPT = "Accept";
+const char* const Header::ACCEPT_ENCODING = "Accept-Encoding";
 const char* const Header::AUTHORIZATION = "Authorization";
 const char* const Header::CONNECTION = "Connection";
 const char* const Header::TRANSFER_ENCODING = "Transfer-Encoding";
@@ -120,6 +125,12 @@ const char* const Header::HOST = "Host";
 const char* const Header::USER_AGENT = "User-Agent";
 const char* const Header::SERVER = "Server";
 const char* const Header::UPGRADE = "Upgrade";
+const char* const Header::ACCEPT_RANGES = "Accept-Ranges";
+const char* const Header::ETAG = "ETag";
+const char* const Header::IF_NONE_MATCH = "If-None-Match";
+const char* const Header::LAST_MODIFIED = "Last-Modified";
+const char* const Header::IF_MODIFIED_SINCE = "If-Modified-Since";
+const char* const Header::VARY = "Vary";
   
 const char* const Range::UNIT_BYTES = "bytes";
 const char* const ContentRange::UNIT_BYTES = "bytes";
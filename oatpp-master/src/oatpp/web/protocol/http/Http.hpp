@@ -25,6 +25,8 @@
 #ifndef oatpp_web_protocol_http_Http_hpp
 #define oatpp_web_protocol_http_Http_hpp
 
+#include "oatpp/web/protocol/http/HeaderMap.hpp"
+
 #include "oatpp/network/Connection.hpp"
 
 #include "oatpp/web/protocol/CommunicationError.hpp"
@@ -416,7 +418,36 @@ public:
   HttpError(const Status& status, const oatpp::String& message)
     : protocol::ProtocolError<Status>(Info(0, status), message)
   {}
-  
+
+};
+
+/**
+ * Asynchronous HTTP error. <br>
+ * Extends &id:oatpp::async::Error;. Carries the &l:Status; to respond with.
+ */
+class AsyncHttpError : public oatpp::async::Error {
+private:
+  Status m_status;
+public:
+
+  /**
+   * Constructor.
+   * @param status - &l:Status;.
+   * @param what - description of error type.
+   */
+  AsyncHttpError(const Status& status, const char* what)
+    : oatpp::async::Error(what)
+    , m_status(status)
+  {}
+
+  /**
+   * Get status to respond with.
+   * @return - &l:Status;.
+   */
+  const Status& getStatus() const {
+    return m_status;
+  }
+
 };
 
 /**
@@ -448,9 +479,14 @@ public:
     
     static const char* const TRANSFER_ENCODING_CHUNKED;
     static const char* const CONTENT_TYPE_APPLICATION_JSON;
+
+    static const char* const CONTENT_ENCODING_GZIP;
+    static const char* const CONTENT_ENCODING_DEFLATE;
+    static const char* const CONTENT_ENCODING_IDENTITY;
   };
 public:
   static const char* const ACCEPT;              // "Accept"
+  static const char* const ACCEPT_ENCODING;     // "Accept-Encoding"
   static const char* const AUTHORIZATION;       // "Authorization"
   static const char* const CONNECTION;          // "Connection"
   static const char* const TRANSFER_ENCODING;   // "Transfer-Encoding"
@@ -463,6 +499,12 @@ public:
   static const char* const USER_AGENT;          // "User-Agent"
   static const char* const SERVER;              // "Server"
   static const char* const UPGRADE;             // "Upgrade"
+  static const char* const ACCEPT_RANGES;       // "Accept-Ranges"
+  static const char* const ETAG;                // "ETag"
+  static const char* const IF_NONE_MATCH;       // "If-None-Match"
+  static const char* const LAST_MODIFIED;       // "Last-Modified"
+  static const char* const IF_MODIFIED_SINCE;   // "If-Modified-Since"
+  static const char* const VARY;                // "Vary"
 };
   
 class Range {
@@ -603,9 +645,9 @@ struct HeaderValueData {
 
 /**
  * Typedef for headers map. Headers map key is case-insensitive.
- * `std::unordered_map` of &id:oatpp::data::share::StringKeyLabelCI_FAST; and &id:oatpp::data::share::StringKeyLabel;.
+ * &id:oatpp::web::protocol::http::HeaderMap; of &id:oatpp::data::share::StringKeyLabelCI_FAST; and &id:oatpp::data::share::StringKeyLabel;.
  */
-typedef std::unordered_map<oatpp::data::share::StringKeyLabelCI_FAST, oatpp::data::share::StringKeyLabel> Headers;
+typedef HeaderMap Headers;
 
 /**
  * Typedef for query parameters map.
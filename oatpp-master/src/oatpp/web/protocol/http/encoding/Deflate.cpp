@@ -0,0 +1,276 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "Deflate.hpp"
+
+#include "oatpp/web/protocol/http/Http.hpp"
+
+#ifdef OATPP_ZLIB
+  #include <zlib.h>
+#endif
+
+#include <stdexcept>
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace encoding {
+
+#ifdef OATPP_ZLIB
+
+namespace {
+
+/*
+ * zlib counts bytes in uInt - feed huge buffers in portions.
+ */
+constexpr data::v_io_size MAX_PORTION = 1 << 30;
+
+uInt portionSize(data::v_io_size size) {
+  return (uInt) (size < MAX_PORTION ? size : MAX_PORTION);
+}
+
+/*
+ * 15 - max window. +16 - gzip wrapper. +32 - auto-detect gzip/zlib wrapper on inflate.
+ */
+constexpr int WINDOW_BITS = 15;
+constexpr int MEM_LEVEL = 8;
+
+}
+
+#endif
+
+// Deflate
+
+bool Deflate::isSupported() {
+#ifdef OATPP_ZLIB
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool Deflate::isSupportedEncoding(const oatpp::data::share::StringKeyLabelCI& encoding) {
+  return isSupported() && (encoding == Header::Value::CONTENT_ENCODING_GZIP ||
+                           encoding == Header::Value::CONTENT_ENCODING_DEFLATE ||
+                           encoding == "x-gzip");
+}
+
+// DeflateEncoder
+
+DeflateEncoder::DeflateEncoder(const oatpp::data::share::StringKeyLabelCI& encoding, v_int32 level)
+  : m_stream(nullptr)
+  , m_input(nullptr)
+  , m_inputSize(0)
+  , m_finished(false)
+{
+
+  if(!Deflate::isSupportedEncoding(encoding)) {
+    throw std::runtime_error("[oatpp::web::protocol::http::encoding::DeflateEncoder::DeflateEncoder()]: Error. Encoding is not supported.");
+  }
+
+#ifdef OATPP_ZLIB
+  int windowBits = WINDOW_BITS;
+  if(encoding != Header::Value::CONTENT_ENCODING_DEFLATE) {
+    windowBits += 16;
+  }
+  z_stream* stream = new z_stream();
+  if(deflateInit2(stream, level, Z_DEFLATED, windowBits, MEM_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK) {
+    delete stream;
+    throw std::runtime_error("[oatpp::web::protocol::http::encoding::DeflateEncoder::DeflateEncoder()]: Error. Can't init zlib stream.");
+  }
+  m_stream = stream;
+#else
+  (void) level;
+#endif
+
+}
+
+DeflateEncoder::~DeflateEncoder() {
+#ifdef OATPP_ZLIB
+  z_stream* stream = (z_stream*) m_stream;
+  deflateEnd(stream);
+  delete stream;
+#endif
+}
+
+void DeflateEncoder::setInput(const void* data, data::v_io_size size) {
+  m_input = (p_char8) data;
+  m_inputSize = size;
+}
+
+data::v_io_size DeflateEncoder::getInputSize() const {
+  return m_inputSize;
+}
+
+data::v_io_size DeflateEncoder::process(void* buffer, data::v_io_size bufferSize, bool finish) {
+
+#ifdef OATPP_ZLIB
+
+  z_stream* stream = (z_stream*) m_stream;
+  p_char8 out = (p_char8) buffer;
+  data::v_io_size produced = 0;
+
+  while(!m_finished && produced < bufferSize) {
+
+    uInt inSize = portionSize(m_inputSize);
+    uInt outSize = portionSize(bufferSize - produced);
+
+    stream->next_in = m_input;
+    stream->avail_in = inSize;
+    stream->next_out = &out[produced];
+    stream->avail_out = outSize;
+
+    int flush = (finish && inSize == m_inputSize) ? Z_FINISH : Z_NO_FLUSH;
+    int res = deflate(stream, flush);
+
+    data::v_io_size consumed = inSize - stream->avail_in;
+    m_input += consumed;
+    m_inputSize -= consumed;
+    produced += outSize - stream->avail_out;
+
+    if(res == Z_STREAM_END) {
+      m_finished = true;
+    } else if(res != Z_OK) {
+      break; // Z_BUF_ERROR - no progress possible
+    } else if(stream->avail_out > 0 && m_inputSize == 0) {
+      break; // input consumed and compressor holds the rest until more input or finish
+    }
+
+  }
+
+  return produced;
+
+#else
+  (void) buffer;
+  (void) bufferSize;
+  (void) finish;
+  return 0;
+#endif
+
+}
+
+bool DeflateEncoder::isFinished() const {
+  return m_finished;
+}
+
+// DeflateDecoder
+
+DeflateDecoder::DeflateDecoder()
+  : m_stream(nullptr)
+  , m_input(nullptr)
+  , m_inputSize(0)
+  , m_finished(false)
+  , m_errorMessage(nullptr)
+{
+
+  if(!Deflate::isSupported()) {
+    throw std::runtime_error("[oatpp::web::protocol::http::encoding::DeflateDecoder::DeflateDecoder()]: Error. Deflate is not supported.");
+  }
+
+#ifdef OATPP_ZLIB
+  z_stream* stream = new z_stream();
+  if(inflateInit2(stream, WINDOW_BITS + 32) != Z_OK) {
+    delete stream;
+    throw std::runtime_error("[oatpp::web::protocol::http::encoding::DeflateDecoder::DeflateDecoder()]: Error. Can't init zlib stream.");
+  }
+  m_stream = stream;
+#endif
+
+}
+
+DeflateDecoder::~DeflateDecoder() {
+#ifdef OATPP_ZLIB
+  z_stream* stream = (z_stream*) m_stream;
+  inflateEnd(stream);
+  delete stream;
+#endif
+}
+
+void DeflateDecoder::setInput(const void* data, data::v_io_size size) {
+  if(m_finished) {
+    size = 0;
+  }
+  m_input = (p_char8) data;
+  m_inputSize = size;
+}
+
+data::v_io_size DeflateDecoder::getInputSize() const {
+  return m_inputSize;
+}
+
+data::v_io_size DeflateDecoder::process(void* buffer, data::v_io_size bufferSize) {
+
+#ifdef OATPP_ZLIB
+
+  z_stream* stream = (z_stream*) m_stream;
+  p_char8 out = (p_char8) buffer;
+  data::v_io_size produced = 0;
+
+  while(!m_finished && m_errorMessage == nullptr && produced < bufferSize) {
+
+    uInt inSize = portionSize(m_inputSize);
+    uInt outSize = portionSize(bufferSize - produced);
+
+    stream->next_in = m_input;
+    stream->avail_in = inSize;
+    stream->next_out = &out[produced];
+    stream->avail_out = outSize;
+
+    int res = inflate(stream, Z_NO_FLUSH);
+
+    data::v_io_size consumed = inSize - stream->avail_in;
+    m_input += consumed;
+    m_inputSize -= consumed;
+    produced += outSize - stream->avail_out;
+
+    if(res == Z_STREAM_END) {
+      m_finished = true;
+      m_inputSize = 0;
+    } else if(res == Z_NEED_DICT || res == Z_DATA_ERROR) {
+      m_errorMessage = "[oatpp::web::protocol::http::encoding::DeflateDecoder::process()]: Error. Invalid compressed data.";
+    } else if(res == Z_MEM_ERROR) {
+      m_errorMessage = "[oatpp::web::protocol::http::encoding::DeflateDecoder::process()]: Error. Out of memory.";
+    } else if(res != Z_OK) {
+      break; // Z_BUF_ERROR - no progress possible
+    }
+
+  }
+
+  return produced;
+
+#else
+  (void) buffer;
+  (void) bufferSize;
+  return 0;
+#endif
+
+}
+
+bool DeflateDecoder::isFinished() const {
+  return m_finished;
+}
+
+const char* DeflateDecoder::getErrorMessage() const {
+  return m_errorMessage;
+}
+
+}}}}}
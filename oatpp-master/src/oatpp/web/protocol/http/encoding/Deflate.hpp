@@ -0,0 +1,189 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_web_protocol_http_encoding_Deflate_hpp
+#define oatpp_web_protocol_http_encoding_Deflate_hpp
+
+#include "oatpp/core/data/share/MemoryLabel.hpp"
+#include "oatpp/core/data/IODefinitions.hpp"
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace encoding {
+
+/**
+ * Deflate based content-codings - `gzip` and `deflate`. <br>
+ * Codecs are backed by zlib. If oatpp is built without zlib, &l:Deflate::isSupported (); returns `false`
+ * and constructors of &l:DeflateEncoder; and &l:DeflateDecoder; throw.
+ */
+class Deflate {
+public:
+
+  /**
+   * Check if oatpp is built with zlib.
+   * @return - `true` if deflate codecs are available.
+   */
+  static bool isSupported();
+
+  /**
+   * Check if the content-coding can be processed by deflate codecs.
+   * @param encoding - content-coding token (case-insensitive). Ex.: `gzip`, `deflate`.
+   * @return - `true` if codecs are available and encoding is `gzip`, `x-gzip` or `deflate`.
+   */
+  static bool isSupportedEncoding(const oatpp::data::share::StringKeyLabelCI& encoding);
+
+};
+
+/**
+ * Streaming deflate compressor. <br>
+ * Feed input with &l:DeflateEncoder::setInput (); and drain output with &l:DeflateEncoder::process (); until input is consumed.
+ */
+class DeflateEncoder {
+public:
+  /**
+   * Fastest compression.
+   */
+  static constexpr v_int32 LEVEL_FASTEST = 1;
+
+  /**
+   * zlib default compression level - currently `6`.
+   */
+  static constexpr v_int32 LEVEL_DEFAULT = -1;
+
+  /**
+   * Best compression.
+   */
+  static constexpr v_int32 LEVEL_BEST = 9;
+private:
+  void* m_stream;
+  p_char8 m_input;
+  data::v_io_size m_inputSize;
+  bool m_finished;
+public:
+
+  /**
+   * Constructor.
+   * @param encoding - `gzip` or `deflate`.
+   * @param level - compression level `1..9` or &l:DeflateEncoder::LEVEL_DEFAULT;.
+   * @throws - `std::runtime_error` if encoding is not supported.
+   */
+  DeflateEncoder(const oatpp::data::share::StringKeyLabelCI& encoding, v_int32 level = LEVEL_DEFAULT);
+
+  /**
+   * Non-virtual destructor.
+   */
+  ~DeflateEncoder();
+
+  /**
+   * Set next portion of input data. Data must stay valid until it is consumed.
+   * @param data - pointer to data.
+   * @param size - size of the data.
+   */
+  void setInput(const void* data, data::v_io_size size);
+
+  /**
+   * Get size of input data not yet consumed by the encoder.
+   * @return - size in bytes.
+   */
+  data::v_io_size getInputSize() const;
+
+  /**
+   * Compress pending input to buffer.
+   * @param buffer - output buffer.
+   * @param bufferSize - size of output buffer.
+   * @param finish - `true` if no more input will follow. Encoder then flushes the stream trailer.
+   * @return - number of bytes written to buffer.
+   */
+  data::v_io_size process(void* buffer, data::v_io_size bufferSize, bool finish);
+
+  /**
+   * Check if the stream trailer was written.
+   * @return - `true` if encoding is finished.
+   */
+  bool isFinished() const;
+
+};
+
+/**
+ * Streaming inflater for both `gzip` and `deflate` content-codings. <br>
+ * The stream header is auto-detected.
+ */
+class DeflateDecoder {
+private:
+  void* m_stream;
+  p_char8 m_input;
+  data::v_io_size m_inputSize;
+  bool m_finished;
+  const char* m_errorMessage;
+public:
+
+  /**
+   * Constructor.
+   * @throws - `std::runtime_error` if deflate codecs are not supported.
+   */
+  DeflateDecoder();
+
+  /**
+   * Non-virtual destructor.
+   */
+  ~DeflateDecoder();
+
+  /**
+   * Set next portion of compressed data. Data must stay valid until it is consumed.
+   * @param data - pointer to data.
+   * @param size - size of the data.
+   */
+  void setInput(const void* data, data::v_io_size size);
+
+  /**
+   * Get size of input data not yet consumed by the decoder.
+   * @return - size in bytes.
+   */
+  data::v_io_size getInputSize() const;
+
+  /**
+   * Decompress pending input to buffer. <br>
+   * Input following the end of compressed stream is discarded.
+   * @param buffer - output buffer.
+   * @param bufferSize - size of output buffer.
+   * @return - number of bytes written to buffer. `0` if more input needed, stream is finished, or on error.
+   */
+  data::v_io_size process(void* buffer, data::v_io_size bufferSize);
+
+  /**
+   * Check if the end of compressed stream was reached.
+   * @return - `true` if decoding is finished.
+   */
+  bool isFinished() const;
+
+  /**
+   * Get error message.
+   * @return - error message or `nullptr` if there was no error.
+   */
+  const char* getErrorMessage() const;
+
+};
+
+}}}}}
+
+#endif // oatpp_web_protocol_http_encoding_Deflate_hpp
@@ -26,9 +26,38 @@
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace incoming {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// BodyDecoder::ToReaderWriteCallback
+
+BodyDecoder::ToReaderWriteCallback::ToReaderWriteCallback(const std::shared_ptr<data::mapping::ObjectMapper::Reader>& reader)
+  : m_reader(reader)
+{}
+
+data::v_io_size BodyDecoder::ToReaderWriteCallback::write(const void *data, data::v_io_size count) {
+  if(!m_reader->feed(data, count)) {
+    throw oatpp::parser::ParsingError(m_reader->getErrorMessage(), m_reader->getErrorCode(), (v_int32) m_reader->getErrorPosition());
+  }
+  return count;
+}
+
+oatpp::async::Action BodyDecoder::ToReaderWriteCallback::writeAsyncInline(oatpp::async::AbstractCoroutine* coroutine,
+                                                                          data::stream::AsyncInlineWriteData& inlineData,
+                                                                          oatpp::async::Action&& nextAction)
+{
+  if(!m_reader->feed(inlineData.currBufferPtr, inlineData.bytesLeft)) {
+    return coroutine->error<oatpp::async::Error>(m_reader->getErrorMessage());
+  }
+  inlineData.setEof();
+  return std::forward<oatpp::async::Action>(nextAction);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // BodyDecoder
 
+void BodyDecoder::removeDecodedHeaders(Headers& headers) const {
+  (void) headers;
+}
+
 void BodyDecoder::decodeToStream(const Headers& headers,
                                  data::stream::InputStream* bodyStream,
                                  data::stream::OutputStream* toStream) const
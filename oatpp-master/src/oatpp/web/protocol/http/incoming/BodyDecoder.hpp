@@ -39,6 +39,24 @@ namespace oatpp { namespace web { namespace protocol { namespace http { namespac
  */
 class BodyDecoder {
 private:
+
+  /*
+   * Feeds decoded body to &id:oatpp::data::mapping::ObjectMapper::Reader; as the body arrives.
+   */
+  class ToReaderWriteCallback : public data::stream::WriteCallback, public data::stream::AsyncWriteCallback {
+  private:
+    std::shared_ptr<data::mapping::ObjectMapper::Reader> m_reader;
+  public:
+
+    ToReaderWriteCallback(const std::shared_ptr<data::mapping::ObjectMapper::Reader>& reader);
+
+    data::v_io_size write(const void *data, data::v_io_size count) override;
+
+    oatpp::async::Action writeAsyncInline(oatpp::async::AbstractCoroutine* coroutine,
+                                          data::stream::AsyncInlineWriteData& inlineData,
+                                          oatpp::async::Action&& nextAction) override;
+
+  };
   
   template<class Type>
   class ToDtoDecoder : public oatpp::async::CoroutineWithResult<ToDtoDecoder<Type>, const typename Type::ObjectWrapper&> {
@@ -47,7 +65,7 @@ private:
     Headers m_headers;
     std::shared_ptr<oatpp::data::stream::InputStream> m_bodyStream;
     std::shared_ptr<oatpp::data::mapping::ObjectMapper> m_objectMapper;
-    std::shared_ptr<oatpp::data::stream::ChunkedBuffer> m_chunkedBuffer = oatpp::data::stream::ChunkedBuffer::createShared();
+    std::shared_ptr<oatpp::data::mapping::ObjectMapper::Reader> m_reader;
   public:
     
     ToDtoDecoder(const BodyDecoder* decoder,
@@ -58,20 +76,20 @@ private:
       , m_headers(headers)
       , m_bodyStream(bodyStream)
       , m_objectMapper(objectMapper)
+      , m_reader(objectMapper->createReader(Type::ObjectWrapper::Class::getType()))
     {}
     
     oatpp::async::Action act() override {
-      return m_decoder->decodeToStreamAsync(m_headers, m_bodyStream, m_chunkedBuffer).next(this->yieldTo(&ToDtoDecoder::onDecoded));
+      auto callback = std::make_shared<ToReaderWriteCallback>(m_reader);
+      return m_decoder->decodeAsync(m_headers, m_bodyStream, callback).next(this->yieldTo(&ToDtoDecoder::onDecoded));
     }
     
     oatpp::async::Action onDecoded() {
-      auto body = m_chunkedBuffer->toString();
-      oatpp::parser::Caret caret(body);
-      auto dto = m_objectMapper->readFromCaret<Type>(caret);
-      if(caret.hasError()) {
-        return this->template error<oatpp::async::Error>(caret.getErrorMessage());
+      auto dto = m_reader->finish();
+      if(m_reader->hasError()) {
+        return this->template error<oatpp::async::Error>(m_reader->getErrorMessage());
       }
-      return this->_return(dto);
+      return this->_return(oatpp::data::mapping::type::static_wrapper_cast<typename Type::ObjectWrapper::ObjectType>(dto));
     }
     
   };
@@ -110,6 +128,14 @@ public:
                                                      const std::shared_ptr<data::stream::InputStream>& bodyStream,
                                                      const std::shared_ptr<data::stream::AsyncWriteCallback>& writeCallback) const = 0;
 
+  /**
+   * Remove headers which don't describe the body anymore once it is decoded by this decoder. <br>
+   * Called by &id:oatpp::web::protocol::http::incoming::Request; and &id:oatpp::web::protocol::http::incoming::Response;
+   * right after decoding is started. Default implementation does nothing.
+   * @param headers - Headers map. &id:oatpp::web::protocol::http::Headers;.
+   */
+  virtual void removeDecodedHeaders(Headers& headers) const;
+
   /**
    * Decode in asynchronous manner using &id:oatpp::data::stream::DefaultAsyncWriteCallback;.
    * @param headers - Headers map. &id:oatpp::web::protocol::http::Headers;.
@@ -134,18 +160,27 @@ public:
   }
 
   /**
-   * Read body stream, decode, and deserialize it as DTO Object (see [Data Transfer Object (DTO)](https://oatpp.io/docs/components/dto/)).
+   * Read body stream, decode, and deserialize it as DTO Object (see [Data Transfer Object (DTO)](https://oatpp.io/docs/components/dto/)). <br>
+   * Body is fed to &id:oatpp::data::mapping::ObjectMapper::Reader; as it is decoded and is not accumulated in memory.
    * @tparam Type - DTO object type.
    * @param headers - Headers map. &id:oatpp::web::protocol::http::Headers;.
    * @param bodyStream - pointer to &id:oatpp::data::stream::InputStream;.
    * @param objectMapper - pointer to &id:oatpp::data::mapping::ObjectMapper;.
    * @return - deserialized DTO object.
+   * @throws - &id:oatpp::parser::ParsingError;
    */
   template<class Type>
   typename Type::ObjectWrapper decodeToDto(const Headers& headers,
                                            data::stream::InputStream* bodyStream,
                                            data::mapping::ObjectMapper* objectMapper) const {
-    return objectMapper->readFromString<Type>(decodeToString(headers, bodyStream));
+    auto reader = objectMapper->createReader(Type::ObjectWrapper::Class::getType());
+    ToReaderWriteCallback callback(reader);
+    decode(headers, bodyStream, &callback);
+    auto result = oatpp::data::mapping::type::static_wrapper_cast<typename Type::ObjectWrapper::ObjectType>(reader->finish());
+    if(reader->hasError()) {
+      throw oatpp::parser::ParsingError(reader->getErrorMessage(), reader->getErrorCode(), (v_int32) reader->getErrorPosition());
+    }
+    return result;
   }
 
   /**
@@ -107,26 +107,36 @@ oatpp::String Request::getPathTail() const {
 
 void Request::transferBody(data::stream::WriteCallback* writeCallback) const {
   m_bodyDecoder->decode(m_headers, m_bodyStream.get(), writeCallback);
+  m_bodyDecoder->removeDecodedHeaders(m_headers);
 }
 
 void Request::transferBodyToStream(oatpp::data::stream::OutputStream* toStream) const {
   m_bodyDecoder->decodeToStream(m_headers, m_bodyStream.get(), toStream);
+  m_bodyDecoder->removeDecodedHeaders(m_headers);
 }
 
 oatpp::String Request::readBodyToString() const {
-  return m_bodyDecoder->decodeToString(m_headers, m_bodyStream.get());
+  auto result = m_bodyDecoder->decodeToString(m_headers, m_bodyStream.get());
+  m_bodyDecoder->removeDecodedHeaders(m_headers);
+  return result;
 }
 
 async::CoroutineStarter Request::transferBodyAsync(const std::shared_ptr<data::stream::AsyncWriteCallback>& writeCallback) const {
-  return m_bodyDecoder->decodeAsync(m_headers, m_bodyStream, writeCallback);
+  auto result = m_bodyDecoder->decodeAsync(m_headers, m_bodyStream, writeCallback);
+  m_bodyDecoder->removeDecodedHeaders(m_headers);
+  return result;
 }
 
 async::CoroutineStarter Request::transferBodyToStreamAsync(const std::shared_ptr<oatpp::data::stream::OutputStream>& toStream) const {
-  return m_bodyDecoder->decodeToStreamAsync(m_headers, m_bodyStream, toStream);
+  auto result = m_bodyDecoder->decodeToStreamAsync(m_headers, m_bodyStream, toStream);
+  m_bodyDecoder->removeDecodedHeaders(m_headers);
+  return result;
 }
 
 async::CoroutineStarterForResult<const oatpp::String&> Request::readBodyToStringAsync() const {
-  return m_bodyDecoder->decodeToStringAsync(m_headers, m_bodyStream);
+  auto result = m_bodyDecoder->decodeToStringAsync(m_headers, m_bodyStream);
+  m_bodyDecoder->removeDecodedHeaders(m_headers);
+  return result;
 }
 
 }}}}}
\ No newline at end of file
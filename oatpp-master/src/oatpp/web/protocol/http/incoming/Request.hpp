@@ -43,7 +43,10 @@ private:
 
   http::RequestStartingLine m_startingLine;
   url::mapping::Pattern::MatchMap m_pathVariables;
-  http::Headers m_headers;
+  /*
+   * Headers describing encoding of the body are removed by BodyDecoder once the body is decoded.
+   */
+  mutable http::Headers m_headers;
   std::shared_ptr<oatpp::data::stream::InputStream> m_bodyStream;
   
   /*
@@ -169,18 +172,20 @@ public:
   oatpp::String readBodyToString() const;
 
   /**
-   * Transfer body to String and parse it as DTO
+   * Read body and deserialize it as DTO. Body is parsed as it arrives.
    * @tparam Type
    * @param objectMapper
    * @return DTO
    */
   template<class Type>
   typename Type::ObjectWrapper readBodyToDto(data::mapping::ObjectMapper* objectMapper) const {
-    return objectMapper->readFromString<Type>(m_bodyDecoder->decodeToString(m_headers, m_bodyStream.get()));
+    auto result = m_bodyDecoder->decodeToDto<Type>(m_headers, m_bodyStream.get(), objectMapper);
+    m_bodyDecoder->removeDecodedHeaders(m_headers);
+    return result;
   }
 
   /**
-   * Transfer body to String and parse it as DTO
+   * Read body and deserialize it as DTO. Body is parsed as it arrives.
    * (used in ApiController's codegens)
    * @tparam Type
    * @param objectMapper
@@ -189,7 +194,8 @@ public:
   template<class Type>
   void readBodyToDto(data::mapping::type::PolymorphicWrapper<Type>& objectWrapper,
                      data::mapping::ObjectMapper* objectMapper) const {
-    objectWrapper = objectMapper->readFromString<Type>(m_bodyDecoder->decodeToString(m_headers, m_bodyStream.get()));
+    objectWrapper = m_bodyDecoder->decodeToDto<Type>(m_headers, m_bodyStream.get(), objectMapper);
+    m_bodyDecoder->removeDecodedHeaders(m_headers);
   }
   
   // Async
@@ -224,7 +230,9 @@ public:
   template<class DtoType>
   oatpp::async::CoroutineStarterForResult<const typename DtoType::ObjectWrapper&>
   readBodyToDtoAsync(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper) const {
-    return m_bodyDecoder->decodeToDtoAsync<DtoType>(m_headers, m_bodyStream, objectMapper);
+    auto result = m_bodyDecoder->decodeToDtoAsync<DtoType>(m_headers, m_bodyStream, objectMapper);
+    m_bodyDecoder->removeDecodedHeaders(m_headers);
+    return result;
   }
   
 };
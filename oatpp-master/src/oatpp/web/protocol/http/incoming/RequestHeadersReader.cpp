@@ -22,41 +22,100 @@
  *
  ***************************************************************************/
 
+
 #include "RequestHeadersReader.hpp"
 
-#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#elif defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace incoming {
 
+v_int32 RequestHeadersReader::findSectionEnd(p_char8 data, v_int32 size) {
+
+  v_int32 i = 0;
+
+#if defined(__AVX2__)
+
+  const __m256i cr = _mm256_set1_epi8('\r');
+  const __m256i lf = _mm256_set1_epi8('\n');
+
+  for(; i + 35 <= size; i += 32) {
+    __m256i m0 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) &data[i]), cr);
+    __m256i m1 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) &data[i + 1]), lf);
+    __m256i m2 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) &data[i + 2]), cr);
+    __m256i m3 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) &data[i + 3]), lf);
+    v_word32 mask = (v_word32) _mm256_movemask_epi8(_mm256_and_si256(_mm256_and_si256(m0, m1), _mm256_and_si256(m2, m3)));
+    if(mask != 0) {
+      return i + __builtin_ctz(mask) + 4;
+    }
+  }
+
+#elif defined(__SSE2__)
+
+  const __m128i cr = _mm_set1_epi8('\r');
+  const __m128i lf = _mm_set1_epi8('\n');
+
+  for(; i + 19 <= size; i += 16) {
+    __m128i m0 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*) &data[i]), cr);
+    __m128i m1 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*) &data[i + 1]), lf);
+    __m128i m2 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*) &data[i + 2]), cr);
+    __m128i m3 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*) &data[i + 3]), lf);
+    v_word32 mask = (v_word32) _mm_movemask_epi8(_mm_and_si128(_mm_and_si128(m0, m1), _mm_and_si128(m2, m3)));
+    if(mask != 0) {
+      return i + __builtin_ctz(mask) + 4;
+    }
+  }
+
+#endif
+
+  for(; i + 4 <= size; i ++) {
+    if(data[i] == '\r' && data[i + 1] == '\n' && data[i + 2] == '\r' && data[i + 3] == '\n') {
+      return i + 4;
+    }
+  }
+
+  return -1;
+
+}
+
 data::v_io_size RequestHeadersReader::readHeadersSection(const std::shared_ptr<oatpp::data::stream::IOStream>& connection,
-                                                         oatpp::data::stream::OutputStream* bufferStream,
                                                          Result& result) {
 
-  v_word32 accumulator = 0;
-  v_int32 progress = 0;
+  v_int32 capacity = m_bufferSize < m_maxHeadersSize ? m_bufferSize : m_maxHeadersSize;
+  v_int32 progress = m_bufferedSize;
+
+  if(progress > 0) {
+    v_int32 sectionEnd = findSectionEnd(m_buffer, progress);
+    if(sectionEnd > 0) {
+      result.bufferPosStart = sectionEnd;
+      result.bufferPosEnd = progress;
+      return progress;
+    }
+  }
+
   data::v_io_size res;
   while (true) {
     
-    v_int32 desiredToRead = m_bufferSize;
-    if(progress + desiredToRead > m_maxHeadersSize) {
-      desiredToRead = m_maxHeadersSize - progress;
-      if(desiredToRead <= 0) {
-        return -1;
-      }
+    v_int32 desiredToRead = capacity - progress;
+    if(desiredToRead <= 0) {
+      return -1;
     }
     
-    res = connection->read(m_buffer, desiredToRead);
+    res = connection->read(&m_buffer[progress], desiredToRead);
     if(res > 0) {
-      bufferStream->write(m_buffer, res);
-      
-      for(v_int32 i = 0; i < res; i ++) {
-        accumulator <<= 8;
-        accumulator |= m_buffer[i];
-        if(accumulator == SECTION_END) {
-          result.bufferPosStart = i + 1;
-          result.bufferPosEnd = (v_int32) res;
-          return res;
-        }
+
+      /* section end may start in the previous read */
+      v_int32 scanStart = progress > 3 ? progress - 3 : 0;
+      progress += (v_int32) res;
+
+      v_int32 sectionEnd = findSectionEnd(&m_buffer[scanStart], progress - scanStart);
+      if(sectionEnd > 0) {
+        result.bufferPosStart = scanStart + sectionEnd;
+        result.bufferPosEnd = progress;
+        return res;
       }
       
     } else if(res == data::IOError::WAIT_RETRY || res == data::IOError::RETRY) {
@@ -76,11 +135,11 @@ RequestHeadersReader::Result RequestHeadersReader::readHeaders(const std::shared
   
   RequestHeadersReader::Result result;
   
-  oatpp::data::stream::ChunkedBuffer buffer;
-  error.ioStatus = readHeadersSection(connection, &buffer, result);
+  error.ioStatus = readHeadersSection(connection, result);
   
   if(error.ioStatus > 0) {
-    auto headersText = buffer.toString();
+    /* buffer is reused for body and response - parsed labels have to reference their own copy of the section */
+    oatpp::String headersText((const char*) m_buffer, result.bufferPosStart, true);
     oatpp::parser::Caret caret (headersText);
     http::Status status;
     http::Parser::parseRequestStartingLine(result.startingLine, headersText.getPtr(), caret, status);
@@ -102,47 +161,52 @@ RequestHeadersReader::readHeadersAsync(const std::shared_ptr<oatpp::data::stream
   private:
     std::shared_ptr<oatpp::data::stream::IOStream> m_connection;
     p_char8 m_buffer;
-    v_int32 m_bufferSize;
-    v_int32 m_maxHeadersSize;
-    v_word32 m_accumulator;
+    v_int32 m_capacity;
     v_int32 m_progress;
     RequestHeadersReader::Result m_result;
-    oatpp::data::stream::ChunkedBuffer m_bufferStream;
   public:
     
     ReaderCoroutine(const std::shared_ptr<oatpp::data::stream::IOStream>& connection,
-                    p_char8 buffer, v_int32 bufferSize, v_int32 maxHeadersSize)
+                    p_char8 buffer, v_int32 bufferSize, v_int32 maxHeadersSize, v_int32 bufferedSize)
       : m_connection(connection)
       , m_buffer(buffer)
-      , m_bufferSize(bufferSize)
-      , m_maxHeadersSize(maxHeadersSize)
-      , m_accumulator(0)
-      , m_progress(0)
+      , m_capacity(bufferSize < maxHeadersSize ? bufferSize : maxHeadersSize)
+      , m_progress(bufferedSize)
     {}
     
     Action act() override {
-      
-      v_int32 desiredToRead = m_bufferSize;
-      if(m_progress + desiredToRead > m_maxHeadersSize) {
-        desiredToRead = m_maxHeadersSize - m_progress;
-        if(desiredToRead <= 0) {
-          return error<Error>("[oatpp::web::protocol::http::incoming::RequestHeadersReader::readHeadersAsync()]: Error. Headers section is too large.");
+
+      if(m_progress > 0) {
+        v_int32 sectionEnd = findSectionEnd(m_buffer, m_progress);
+        if(sectionEnd > 0) {
+          m_result.bufferPosStart = sectionEnd;
+          m_result.bufferPosEnd = m_progress;
+          return yieldTo(&ReaderCoroutine::parseHeaders);
         }
       }
+
+      return yieldTo(&ReaderCoroutine::readData);
+
+    }
+
+    Action readData() {
+      
+      v_int32 desiredToRead = m_capacity - m_progress;
+      if(desiredToRead <= 0) {
+        return error<Error>("[oatpp::web::protocol::http::incoming::RequestHeadersReader::readHeadersAsync()]: Error. Headers section is too large.");
+      }
       
-      auto res = m_connection->read(m_buffer, desiredToRead);
+      auto res = m_connection->read(&m_buffer[m_progress], desiredToRead);
       if(res > 0) {
-        m_bufferStream.write(m_buffer, res);
-        m_progress += res;
-        
-        for(v_int32 i = 0; i < res; i ++) {
-          m_accumulator <<= 8;
-          m_accumulator |= m_buffer[i];
-          if(m_accumulator == SECTION_END) {
-            m_result.bufferPosStart = i + 1;
-            m_result.bufferPosEnd = (v_int32) res;
-            return yieldTo(&ReaderCoroutine::parseHeaders);
-          }
+
+        v_int32 scanStart = m_progress > 3 ? m_progress - 3 : 0;
+        m_progress += (v_int32) res;
+
+        v_int32 sectionEnd = findSectionEnd(&m_buffer[scanStart], m_progress - scanStart);
+        if(sectionEnd > 0) {
+          m_result.bufferPosStart = scanStart + sectionEnd;
+          m_result.bufferPosEnd = m_progress;
+          return yieldTo(&ReaderCoroutine::parseHeaders);
         }
         
         return m_connection->suggestInputStreamAction(res);
@@ -161,7 +225,7 @@ RequestHeadersReader::readHeadersAsync(const std::shared_ptr<oatpp::data::stream
     
     Action parseHeaders() {
       
-      auto headersText = m_bufferStream.toString();
+      oatpp::String headersText((const char*) m_buffer, m_result.bufferPosStart, true);
       oatpp::parser::Caret caret (headersText);
       http::Status status;
       http::Parser::parseRequestStartingLine(m_result.startingLine, headersText.getPtr(), caret, status);
@@ -180,7 +244,7 @@ RequestHeadersReader::readHeadersAsync(const std::shared_ptr<oatpp::data::stream
     
   };
   
-  return ReaderCoroutine::startForResult(connection, m_buffer, m_bufferSize, m_maxHeadersSize);
+  return ReaderCoroutine::startForResult(connection, m_buffer, m_bufferSize, m_maxHeadersSize, m_bufferedSize);
   
 }
 
@@ -31,7 +31,9 @@
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace incoming {
 
 /**
- * Helper class to read http headers of incoming request from stream.
+ * Helper class to read http headers of incoming request from stream. <br>
+ * Headers section is accumulated in the provided buffer and scanned for the section end in place.
+ * Size of the headers section is limited by both `bufferSize` and `maxHeadersSize`.
  */
 class RequestHeadersReader {
 public:
@@ -39,8 +41,6 @@ public:
    * Convenience typedef for &id:oatpp::async::Action;.
    */
   typedef oatpp::async::Action Action;
-private:
-  static constexpr v_int32 SECTION_END = ('\r' << 24) | ('\n' << 16) | ('\r' << 8) | ('\n');
 public:
 
   /**
@@ -58,24 +58,24 @@ public:
     http::Headers headers;
 
     /**
-     * This value represents starting position in buffer used to read data from stream for the last read operation.
+     * This value represents position in buffer right after the headers section. <br>
+     * Data between `bufferPosStart` and `bufferPosEnd` was read from stream but doesn't belong to headers.
      */
     v_int32 bufferPosStart;
 
     /**
-     * This value represents end position in buffer used to read data from stream for the last read operation.
+     * This value represents end position of data read from stream to buffer.
      */
     v_int32 bufferPosEnd;
   };
 
 private:
-  data::v_io_size readHeadersSection(const std::shared_ptr<oatpp::data::stream::IOStream>& connection,
-                                     oatpp::data::stream::OutputStream* bufferStream,
-                                     Result& result);
+  data::v_io_size readHeadersSection(const std::shared_ptr<oatpp::data::stream::IOStream>& connection, Result& result);
 private:
   p_char8 m_buffer;
   v_int32 m_bufferSize;
   v_int32 m_maxHeadersSize;
+  v_int32 m_bufferedSize;
 public:
 
   /**
@@ -83,13 +83,25 @@ public:
    * @param buffer - buffer to use to read data from stream.
    * @param bufferSize - buffer size.
    * @param maxHeadersSize - maximum allowed size in bytes of http headers section.
+   * @param bufferedSize - amount of bytes already present at the beginning of the buffer. <br>
+   * Used for pipelined requests - bytes of the next request which were read together with the previous one.
    */
-  RequestHeadersReader(void* buffer, v_int32 bufferSize, v_int32 maxHeadersSize)
+  RequestHeadersReader(void* buffer, v_int32 bufferSize, v_int32 maxHeadersSize, v_int32 bufferedSize = 0)
     : m_buffer((p_char8) buffer)
     , m_bufferSize(bufferSize)
     , m_maxHeadersSize(maxHeadersSize)
+    , m_bufferedSize(bufferedSize)
   {}
 
+  /**
+   * Find end of the headers section - `\r\n\r\n` sequence. <br>
+   * Uses AVX2 or SSE2 instructions if available at compile time.
+   * @param data - pointer to data.
+   * @param size - size of the data.
+   * @return - position right after the `\r\n\r\n` sequence or `-1` if not found.
+   */
+  static v_int32 findSectionEnd(p_char8 data, v_int32 size);
+
   /**
    * Read and parse http headers from stream.
    * @param connection - `std::shared_ptr` to &id:oatpp::data::stream::IOStream;.
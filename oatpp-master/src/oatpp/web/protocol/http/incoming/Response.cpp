@@ -68,22 +68,30 @@ std::shared_ptr<const http::incoming::BodyDecoder> Response::getBodyDecoder() co
 
 void Response::transferBody(data::stream::WriteCallback* writeCallback) const {
   m_bodyDecoder->decode(m_headers, m_bodyStream.get(), writeCallback);
+  m_bodyDecoder->removeDecodedHeaders(m_headers);
 }
 
 void Response::transferBodyToStream(oatpp::data::stream::OutputStream* toStream) const {
   m_bodyDecoder->decodeToStream(m_headers, m_bodyStream.get(), toStream);
+  m_bodyDecoder->removeDecodedHeaders(m_headers);
 }
 
 oatpp::String Response::readBodyToString() const {
-  return m_bodyDecoder->decodeToString(m_headers, m_bodyStream.get());
+  auto result = m_bodyDecoder->decodeToString(m_headers, m_bodyStream.get());
+  m_bodyDecoder->removeDecodedHeaders(m_headers);
+  return result;
 }
 
 async::CoroutineStarter Response::transferBodyAsync(const std::shared_ptr<data::stream::AsyncWriteCallback>& writeCallback) const {
-  return m_bodyDecoder->decodeAsync(m_headers, m_bodyStream, writeCallback);
+  auto result = m_bodyDecoder->decodeAsync(m_headers, m_bodyStream, writeCallback);
+  m_bodyDecoder->removeDecodedHeaders(m_headers);
+  return result;
 }
 
 oatpp::async::CoroutineStarter Response::transferBodyToStreamAsync(const std::shared_ptr<oatpp::data::stream::OutputStream>& toStream) const {
-  return m_bodyDecoder->decodeToStreamAsync(m_headers, m_bodyStream, toStream);
+  auto result = m_bodyDecoder->decodeToStreamAsync(m_headers, m_bodyStream, toStream);
+  m_bodyDecoder->removeDecodedHeaders(m_headers);
+  return result;
 }
 
 }}}}}
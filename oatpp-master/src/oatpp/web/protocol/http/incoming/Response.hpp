@@ -40,7 +40,10 @@ public:
 private:
   v_int32 m_statusCode;
   oatpp::String m_statusDescription;
-  http::Headers m_headers;
+  /*
+   * Headers describing encoding of the body are removed by BodyDecoder once the body is decoded.
+   */
+  mutable http::Headers m_headers;
   std::shared_ptr<oatpp::data::stream::InputStream> m_bodyStream;
   
   /*
@@ -141,7 +144,9 @@ public:
    */
   template<class Type>
   typename Type::ObjectWrapper readBodyToDto(oatpp::data::mapping::ObjectMapper* objectMapper) const {
-    return m_bodyDecoder->decodeToDto<Type>(m_headers, m_bodyStream.get(), objectMapper);
+    auto result = m_bodyDecoder->decodeToDto<Type>(m_headers, m_bodyStream.get(), objectMapper);
+    m_bodyDecoder->removeDecodedHeaders(m_headers);
+    return result;
   }
   
   // Async
@@ -167,7 +172,9 @@ public:
    * @return - &id:oatpp::async::CoroutineStarterForResult;.
    */
   oatpp::async::CoroutineStarterForResult<const oatpp::String&> readBodyToStringAsync() const {
-    return m_bodyDecoder->decodeToStringAsync(m_headers, m_bodyStream);
+    auto result = m_bodyDecoder->decodeToStringAsync(m_headers, m_bodyStream);
+    m_bodyDecoder->removeDecodedHeaders(m_headers);
+    return result;
   }
 
   /**
@@ -179,7 +186,9 @@ public:
   template<class DtoType>
   oatpp::async::CoroutineStarterForResult<const typename DtoType::ObjectWrapper&>
   readBodyToDtoAsync(const std::shared_ptr<oatpp::data::mapping::ObjectMapper>& objectMapper) const {
-    return m_bodyDecoder->decodeToDtoAsync<DtoType>(m_headers, m_bodyStream, objectMapper);
+    auto result = m_bodyDecoder->decodeToDtoAsync<DtoType>(m_headers, m_bodyStream, objectMapper);
+    m_bodyDecoder->removeDecodedHeaders(m_headers);
+    return result;
   }
   
 };
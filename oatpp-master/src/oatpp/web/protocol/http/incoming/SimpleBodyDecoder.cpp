@@ -24,69 +24,418 @@
 
 #include "SimpleBodyDecoder.hpp"
 
+#include "oatpp/web/protocol/http/encoding/Deflate.hpp"
+
 #include "oatpp/core/data/stream/StreamBufferedProxy.hpp"
 #include "oatpp/core/utils/ConversionUtils.hpp"
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace incoming {
   
-data::v_io_size SimpleBodyDecoder::readLine(oatpp::data::stream::InputStream* fromStream,
-                                            p_char8 buffer,
-                                            data::v_io_size maxLineSize)
-{
-  
-  v_char8 a;
-  data::v_io_size count = 0;
-  while (fromStream->read(&a, 1) > 0) {
-    if(a != '\r') {
-      if(count + 1 > maxLineSize) {
-        OATPP_LOGE("BodyDecoder", "Error - too long line");
-        return 0;
+namespace {
+
+/*
+ * Parser of chunked transfer-encoding framing. Works on portions of data of any size.
+ * Chunk extensions are skipped. Trailers are not supported.
+ */
+class ChunkedParser {
+public:
+  static constexpr v_int32 MAX_SIZE_DIGITS = 15;
+private:
+
+  enum State : v_int32 {
+    STATE_SIZE = 0,
+    STATE_EXTENSION = 1,
+    STATE_SIZE_LF = 2,
+    STATE_DATA = 3,
+    STATE_DATA_CR = 4,
+    STATE_DATA_LF = 5,
+    STATE_LAST_CR = 6,
+    STATE_LAST_LF = 7,
+    STATE_DONE = 8,
+    STATE_ERROR = 9
+  };
+
+private:
+
+  /*
+   * Min count of bytes following the chunk-size line.
+   * Either the next chunk-size line plus the rest of the body, or the final CRLF.
+   */
+  data::v_io_size getTailSize() const {
+    if(m_chunkSize > 0) {
+      return m_chunkSize + 2 + 5; // data CRLF "0" CRLF CRLF
+    }
+    return 2;
+  }
+
+  bool setError(const char* message) {
+    m_errorMessage = message;
+    m_state = STATE_ERROR;
+    return false;
+  }
+
+  bool onChar(v_char8 a) {
+
+    switch(m_state) {
+
+      case STATE_SIZE: {
+        v_int32 digit;
+        if(a >= '0' && a <= '9') {
+          digit = a - '0';
+        } else if(a >= 'a' && a <= 'f') {
+          digit = a - 'a' + 10;
+        } else if(a >= 'A' && a <= 'F') {
+          digit = a - 'A' + 10;
+        } else if(m_sizeDigits == 0) {
+          return setError("[oatpp::web::protocol::http::incoming::SimpleBodyDecoder]: Error. Invalid chunk size line");
+        } else if(a == '\r') {
+          m_state = STATE_SIZE_LF;
+          return true;
+        } else if(a == ';') {
+          m_state = STATE_EXTENSION;
+          return true;
+        } else {
+          return setError("[oatpp::web::protocol::http::incoming::SimpleBodyDecoder]: Error. Invalid chunk size line");
+        }
+        if(m_sizeDigits == MAX_SIZE_DIGITS) {
+          return setError("[oatpp::web::protocol::http::incoming::SimpleBodyDecoder]: Error. Chunk size is too long");
+        }
+        m_chunkSize = (m_chunkSize << 4) | digit;
+        m_sizeDigits ++;
+        return true;
       }
-      buffer[count++] = a;
-    } else {
-      fromStream->read(&a, 1);
-      if(a != '\n'){
-        OATPP_LOGE("BodyDecoder", "Warning - invalid line breaker");
+
+      case STATE_EXTENSION:
+        if(a == '\r') {
+          m_state = STATE_SIZE_LF;
+        }
+        return true;
+
+      case STATE_SIZE_LF:
+        if(a != '\n') {
+          return setError("[oatpp::web::protocol::http::incoming::SimpleBodyDecoder]: Error. Invalid line breaker");
+        }
+        m_state = m_chunkSize > 0 ? STATE_DATA : STATE_LAST_CR;
+        return true;
+
+      case STATE_DATA_CR:
+      case STATE_LAST_CR:
+        if(a != '\r') {
+          return setError("[oatpp::web::protocol::http::incoming::SimpleBodyDecoder]: Error. CRLF expected");
+        }
+        m_state = m_state == STATE_DATA_CR ? STATE_DATA_LF : STATE_LAST_LF;
+        return true;
+
+      case STATE_DATA_LF:
+      case STATE_LAST_LF:
+        if(a != '\n') {
+          return setError("[oatpp::web::protocol::http::incoming::SimpleBodyDecoder]: Error. Invalid line breaker");
+        }
+        if(m_state == STATE_DATA_LF) {
+          m_state = STATE_SIZE;
+          m_sizeDigits = 0;
+          m_chunkSize = 0;
+        } else {
+          m_state = STATE_DONE;
+        }
+        return true;
+
+      default:
+        return false;
+
+    }
+
+  }
+
+private:
+  v_int32 m_state;
+  v_int32 m_sizeDigits;
+  data::v_io_size m_chunkSize;
+  const char* m_errorMessage;
+public:
+
+  ChunkedParser()
+    : m_state(STATE_SIZE)
+    , m_sizeDigits(0)
+    , m_chunkSize(0)
+    , m_errorMessage(nullptr)
+  {}
+
+  /*
+   * Parse next portion of data. Parsing stops right after the chunk data found.
+   * @param data - data.
+   * @param size - size of data.
+   * @param dataSize - out. Size of chunk data at the end of consumed bytes. 0 - if no chunk data consumed.
+   * @return - count of consumed bytes.
+   */
+  data::v_io_size parse(p_char8 data, data::v_io_size size, data::v_io_size& dataSize) {
+    dataSize = 0;
+    data::v_io_size pos = 0;
+    while(pos < size && m_state != STATE_DONE) {
+      if(m_state == STATE_DATA) {
+        dataSize = size - pos;
+        if(dataSize > m_chunkSize) {
+          dataSize = m_chunkSize;
+        }
+        m_chunkSize -= dataSize;
+        if(m_chunkSize == 0) {
+          m_state = STATE_DATA_CR;
+        }
+        return pos + dataSize;
+      }
+      if(!onChar(data[pos])) {
+        return pos;
       }
-      return count; // size of line
+      pos ++;
     }
+    return pos;
   }
-  
-  return count;
-  
+
+  /*
+   * Get count of following bytes which surely belong to the body.
+   * Reading that much never consumes data beyond the end of the body.
+   */
+  data::v_io_size getReadAheadSize() const {
+    switch(m_state) {
+      case STATE_SIZE: return m_sizeDigits == 0 ? 5 : 2 + getTailSize();
+      case STATE_EXTENSION: return 2 + getTailSize();
+      case STATE_SIZE_LF: return 1 + getTailSize();
+      case STATE_DATA: return m_chunkSize + 2 + 5;
+      case STATE_DATA_CR: return 2 + 5;
+      case STATE_DATA_LF: return 1 + 5;
+      case STATE_LAST_CR: return 2;
+      case STATE_LAST_LF: return 1;
+      default: return 0;
+    }
+  }
+
+  bool isDone() const {
+    return m_state == STATE_DONE;
+  }
+
+  bool hasError() const {
+    return m_state == STATE_ERROR;
+  }
+
+  const char* getErrorMessage() const {
+    return m_errorMessage;
+  }
+
+};
+
+void writeToCallback(oatpp::data::stream::WriteCallback* writeCallback, p_char8 data, data::v_io_size size) {
+  while(size > 0) {
+    auto res = writeCallback->write(data, size);
+    if(res > 0) {
+      data = &data[res];
+      size -= res;
+    } else if(res != data::IOError::RETRY && res != data::IOError::WAIT_RETRY) {
+      throw std::runtime_error("[oatpp::web::protocol::http::incoming::SimpleBodyDecoder::doChunkedDecoding()]: Unknown Error. Can't continue transfer.");
+    }
+  }
+}
+
+bool isDeflateEncoded(const Headers& headers) {
+  auto it = headers.find(Header::CONTENT_ENCODING);
+  if(it == headers.end()) {
+    return false;
+  }
+  oatpp::data::share::StringKeyLabelCI encoding(it->second.getMemoryHandle(), it->second.getData(), it->second.getSize());
+  return encoding::Deflate::isSupportedEncoding(encoding);
+}
+
+/*
+ * Inflates data of the compressed body and passes it to the write callback.
+ */
+class InflatingWriteCallback : public oatpp::data::stream::WriteCallback {
+private:
+  encoding::DeflateDecoder m_decoder;
+  oatpp::data::stream::WriteCallback* m_writeCallback;
+  std::shared_ptr<oatpp::data::buffer::IOBuffer> m_buffer;
+  v_int64 m_inflatedSize;
+  v_int64 m_maxInflatedSize;
+  bool m_hasInput;
+public:
+
+  InflatingWriteCallback(oatpp::data::stream::WriteCallback* writeCallback, v_int64 maxInflatedSize)
+    : m_writeCallback(writeCallback)
+    , m_buffer(oatpp::data::buffer::IOBuffer::createShared())
+    , m_inflatedSize(0)
+    , m_maxInflatedSize(maxInflatedSize)
+    , m_hasInput(false)
+  {}
+
+  data::v_io_size write(const void *data, data::v_io_size count) override {
+    m_hasInput = m_hasInput || count > 0;
+    m_decoder.setInput(data, count);
+    p_char8 buffer = (p_char8) m_buffer->getData();
+    data::v_io_size size;
+    while((size = m_decoder.process(buffer, m_buffer->getSize())) > 0) {
+      m_inflatedSize += size;
+      if(m_inflatedSize > m_maxInflatedSize) {
+        throw HttpError(http::Status::CODE_413, "Inflated body is too large");
+      }
+      writeToCallback(m_writeCallback, buffer, size);
+    }
+    if(m_decoder.getErrorMessage() != nullptr) {
+      throw HttpError(http::Status::CODE_400, "Invalid compressed body");
+    }
+    return count;
+  }
+
+  void checkFinished() {
+    if(m_hasInput && !m_decoder.isFinished()) {
+      throw HttpError(http::Status::CODE_400, "Unexpected end of compressed body");
+    }
+  }
+
+};
+
+/*
+ * Same as InflatingWriteCallback but async.
+ * Inflating coroutine is started for each portion of data and shares the state with the callback.
+ */
+class AsyncInflatingWriteCallback : public oatpp::data::stream::AsyncWriteCallbackWithCoroutineStarter {
+private:
+
+  struct State {
+
+    State(v_int64 maxSize)
+      : buffer(oatpp::data::buffer::IOBuffer::createShared())
+      , inflatedSize(0)
+      , maxInflatedSize(maxSize)
+    {}
+
+    encoding::DeflateDecoder decoder;
+    std::shared_ptr<oatpp::data::buffer::IOBuffer> buffer;
+    v_int64 inflatedSize;
+    v_int64 maxInflatedSize;
+
+  };
+
+  class InflateCoroutine : public oatpp::async::Coroutine<InflateCoroutine> {
+  private:
+    std::shared_ptr<State> m_state;
+    std::shared_ptr<oatpp::data::stream::AsyncWriteCallback> m_writeCallback;
+    data::stream::AsyncInlineWriteData m_inlineData;
+  public:
+
+    InflateCoroutine(const std::shared_ptr<State>& state, const std::shared_ptr<oatpp::data::stream::AsyncWriteCallback>& writeCallback)
+      : m_state(state)
+      , m_writeCallback(writeCallback)
+    {}
+
+    Action act() override {
+      auto size = m_state->decoder.process(m_state->buffer->getData(), m_state->buffer->getSize());
+      if(size > 0) {
+        m_state->inflatedSize += size;
+        if(m_state->inflatedSize > m_state->maxInflatedSize) {
+          return error<AsyncHttpError>(http::Status::CODE_413, "Inflated body is too large");
+        }
+        m_inlineData.set(m_state->buffer->getData(), size);
+        return m_writeCallback->writeAsyncInline(this, m_inlineData, yieldTo(&InflateCoroutine::act));
+      }
+      if(m_state->decoder.getErrorMessage() != nullptr) {
+        return error<AsyncHttpError>(http::Status::CODE_400, "Invalid compressed body");
+      }
+      return finish();
+    }
+
+  };
+
+private:
+  std::shared_ptr<State> m_state;
+  std::shared_ptr<oatpp::data::stream::AsyncWriteCallback> m_writeCallback;
+  bool m_hasInput;
+public:
+
+  AsyncInflatingWriteCallback(const std::shared_ptr<oatpp::data::stream::AsyncWriteCallback>& writeCallback, v_int64 maxInflatedSize)
+    : m_state(std::make_shared<State>(maxInflatedSize))
+    , m_writeCallback(writeCallback)
+    , m_hasInput(false)
+  {}
+
+  oatpp::async::CoroutineStarter writeAsync(const void *data, data::v_io_size count) override {
+    m_hasInput = m_hasInput || count > 0;
+    m_state->decoder.setInput(data, count);
+    return InflateCoroutine::start(m_state, m_writeCallback);
+  }
+
+  bool isTruncated() const {
+    return m_hasInput && !m_state->decoder.isFinished();
+  }
+
+};
+
+/*
+ * Runs transfer decoding of the compressed body and checks that compressed stream is complete.
+ */
+class InflatingDecoder : public oatpp::async::Coroutine<InflatingDecoder> {
+private:
+  oatpp::async::CoroutineStarter m_transfer;
+  std::shared_ptr<AsyncInflatingWriteCallback> m_writeCallback;
+public:
+
+  InflatingDecoder(oatpp::async::CoroutineStarter&& transfer, const std::shared_ptr<AsyncInflatingWriteCallback>& writeCallback)
+    : m_transfer(std::move(transfer))
+    , m_writeCallback(writeCallback)
+  {}
+
+  Action act() override {
+    return m_transfer.next(yieldTo(&InflatingDecoder::onTransferred));
+  }
+
+  Action onTransferred() {
+    if(m_writeCallback->isTruncated()) {
+      return error<AsyncHttpError>(http::Status::CODE_400, "Unexpected end of compressed body");
+    }
+    return finish();
+  }
+
+};
+
 }
 
 void SimpleBodyDecoder::doChunkedDecoding(oatpp::data::stream::InputStream* fromStream,
                                           oatpp::data::stream::WriteCallback* writeCallback) {
-  
+
   auto buffer = oatpp::data::buffer::IOBuffer::createShared();
-  
-  const v_int32 maxLineSize = 8; // 0xFFFFFFFF 4Gb for chunk
-  v_char8 lineBuffer[maxLineSize + 1];
-  data::v_io_size countToRead;
-  
-  do {
-    
-    auto lineSize = readLine(fromStream, lineBuffer, maxLineSize);
-    if(lineSize == 0 || lineSize >= maxLineSize) {
-      return; // error reading stream
+  p_char8 bufferData = (p_char8) buffer->getData();
+  ChunkedParser parser;
+
+  while(!parser.isDone()) {
+
+    data::v_io_size readSize = parser.getReadAheadSize();
+    if(readSize > buffer->getSize()) {
+      readSize = buffer->getSize();
     }
-    lineBuffer[lineSize] = 0;
-    countToRead = strtol((const char*)lineBuffer, nullptr, 16);
-    
-    if(countToRead > 0) {
-      oatpp::data::stream::transfer(fromStream, writeCallback, countToRead, buffer->getData(), buffer->getSize());
+
+    auto res = fromStream->read(bufferData, readSize);
+
+    if(res > 0) {
+      data::v_io_size pos = 0;
+      while(pos < res) {
+        data::v_io_size dataSize;
+        pos += parser.parse(&bufferData[pos], res - pos, dataSize);
+        if(parser.hasError()) {
+          OATPP_LOGE("BodyDecoder", "%s", parser.getErrorMessage());
+          return;
+        }
+        if(dataSize > 0) {
+          writeToCallback(writeCallback, &bufferData[pos - dataSize], dataSize);
+        }
+      }
+    } else if(res != data::IOError::RETRY && res != data::IOError::WAIT_RETRY) {
+      return; // error reading stream
     }
-    
-    fromStream->read(lineBuffer, 2); // just skip "\r\n"
-    
-  } while (countToRead > 0);
-  
+
+  }
+
 }
 
-void SimpleBodyDecoder::decode(const Headers& headers,
-                               oatpp::data::stream::InputStream* bodyStream,
-                               oatpp::data::stream::WriteCallback* writeCallback) const {
+void SimpleBodyDecoder::doTransferDecoding(const Headers& headers,
+                                           oatpp::data::stream::InputStream* bodyStream,
+                                           oatpp::data::stream::WriteCallback* writeCallback) {
   
   auto transferEncodingIt = headers.find(Header::TRANSFER_ENCODING);
   if(transferEncodingIt != headers.end() && transferEncodingIt->second == Header::Value::TRANSFER_ENCODING_CHUNKED) {
@@ -115,91 +464,61 @@ oatpp::async::CoroutineStarter SimpleBodyDecoder::doChunkedDecodingAsync(const s
                                                                          const std::shared_ptr<oatpp::data::stream::AsyncWriteCallback>& writeCallback) {
   
   class ChunkedDecoder : public oatpp::async::Coroutine<ChunkedDecoder> {
-  private:
-    const v_int32 MAX_LINE_SIZE = 8;
   private:
     std::shared_ptr<oatpp::data::stream::InputStream> m_fromStream;
     std::shared_ptr<oatpp::data::stream::AsyncWriteCallback> m_writeCallback;
     std::shared_ptr<oatpp::data::buffer::IOBuffer> m_buffer = oatpp::data::buffer::IOBuffer::createShared();
-    v_int32 m_currLineLength;
-    v_char8 m_lineChar;
-    bool m_lineEnding;
-    v_char8 m_lineBuffer [16]; // used max 8
-    data::stream::AsyncInlineReadData m_skipData;
-    bool m_done = false;
-  private:
-    void prepareSkipRN() {
-      m_skipData.set(&m_lineBuffer[0], 2);
-      m_currLineLength = 0;
-      m_lineEnding = false;
-    }
+    ChunkedParser m_parser;
+    data::v_io_size m_bufferPos;
+    data::v_io_size m_bufferSize;
+    data::stream::AsyncInlineWriteData m_inlineData;
   public:
     
     ChunkedDecoder(const std::shared_ptr<oatpp::data::stream::InputStream>& fromStream,
                    const std::shared_ptr<oatpp::data::stream::AsyncWriteCallback>& writeCallback)
       : m_fromStream(fromStream)
       , m_writeCallback(writeCallback)
+      , m_bufferPos(0)
+      , m_bufferSize(0)
     {}
     
     Action act() override {
-      m_currLineLength = 0;
-      m_lineEnding = false;
-      return yieldTo(&ChunkedDecoder::readLineChar);
+      return yieldTo(&ChunkedDecoder::readAhead);
     }
     
-    Action readLineChar() {
-      auto res = m_fromStream->read(&m_lineChar, 1);
-      if(res == data::IOError::WAIT_RETRY) {
-        return m_fromStream->suggestInputStreamAction(res);
-      } else if(res == data::IOError::RETRY) {
+    Action readAhead() {
+      data::v_io_size readSize = m_parser.getReadAheadSize();
+      if(readSize > m_buffer->getSize()) {
+        readSize = m_buffer->getSize();
+      }
+      auto res = m_fromStream->read(m_buffer->getData(), readSize);
+      if(res > 0) {
+        m_bufferPos = 0;
+        m_bufferSize = res;
+        return parse();
+      } else if(res == data::IOError::WAIT_RETRY || res == data::IOError::RETRY) {
         return m_fromStream->suggestInputStreamAction(res);
-      } else if( res < 0) {
-        return error<Error>("[BodyDecoder::ChunkedDecoder] Can't read line char");
       }
-      return yieldTo(&ChunkedDecoder::onLineCharRead);
+      return error<Error>("[BodyDecoder::ChunkedDecoder] Can't read chunked body");
     }
     
-    Action onLineCharRead() {
-      if(!m_lineEnding) {
-        if(m_lineChar != '\r') {
-          if(m_currLineLength + 1 > MAX_LINE_SIZE){
-            return error<Error>("[BodyDecoder::ChunkedDecoder] too long line");
-          }
-          m_lineBuffer[m_currLineLength ++] = m_lineChar;
-          return yieldTo(&ChunkedDecoder::readLineChar);
-        } else {
-          m_lineEnding = true;
-          return yieldTo(&ChunkedDecoder::readLineChar);
+    Action parse() {
+      p_char8 data = (p_char8) m_buffer->getData();
+      while(m_bufferPos < m_bufferSize) {
+        data::v_io_size dataSize;
+        m_bufferPos += m_parser.parse(&data[m_bufferPos], m_bufferSize - m_bufferPos, dataSize);
+        if(m_parser.hasError()) {
+          return error<Error>(m_parser.getErrorMessage());
         }
-      } else {
-        if(m_lineChar != '\n') {
-          OATPP_LOGD("[BodyDecoder::ChunkedDecoder]", "Warning - invalid line breaker")
+        if(dataSize > 0) {
+          m_inlineData.set(&data[m_bufferPos - dataSize], dataSize);
+          return m_writeCallback->writeAsyncInline(this, m_inlineData, yieldTo(&ChunkedDecoder::parse));
         }
       }
-      if(m_currLineLength == 0) {
-        return error<Error>("Error reading stream. 0-length line");
-      }
-      m_lineBuffer[m_currLineLength] = 0;
-      return yieldTo(&ChunkedDecoder::onLineRead);
-    }
-    
-    Action onLineRead() {
-      data::v_io_size countToRead = strtol((const char*) m_lineBuffer, nullptr, 16);
-      if(countToRead > 0) {
-        prepareSkipRN();
-        return oatpp::data::stream::transferAsync(m_fromStream, m_writeCallback, countToRead, m_buffer).next(yieldTo(&ChunkedDecoder::skipRN));
-      }
-      m_done = true;
-      prepareSkipRN();
-      return yieldTo(&ChunkedDecoder::skipRN);
-    }
-    
-    Action skipRN() {
-      if(m_done) {
-        return oatpp::data::stream::readExactSizeDataAsyncInline(this, m_fromStream.get(), m_skipData, finish());
-      } else {
-        return oatpp::data::stream::readExactSizeDataAsyncInline(this, m_fromStream.get(), m_skipData, yieldTo(&ChunkedDecoder::readLineChar));
+      if(m_parser.isDone()) {
+        return finish();
       }
+      return yieldTo(&ChunkedDecoder::readAhead);
     }
     
   };
@@ -208,9 +527,9 @@ oatpp::async::CoroutineStarter SimpleBodyDecoder::doChunkedDecodingAsync(const s
   
 }
 
-oatpp::async::CoroutineStarter SimpleBodyDecoder::decodeAsync(const Headers& headers,
-                                                              const std::shared_ptr<oatpp::data::stream::InputStream>& bodyStream,
-                                                              const std::shared_ptr<oatpp::data::stream::AsyncWriteCallback>& writeCallback) const {
+oatpp::async::CoroutineStarter SimpleBodyDecoder::doTransferDecodingAsync(const Headers& headers,
+                                                                          const std::shared_ptr<oatpp::data::stream::InputStream>& bodyStream,
+                                                                          const std::shared_ptr<oatpp::data::stream::AsyncWriteCallback>& writeCallback) {
   auto transferEncodingIt = headers.find(Header::TRANSFER_ENCODING);
   if(transferEncodingIt != headers.end() && transferEncodingIt->second == Header::Value::TRANSFER_ENCODING_CHUNKED) {
     return doChunkedDecodingAsync(bodyStream, writeCallback);
@@ -233,5 +552,45 @@ oatpp::async::CoroutineStarter SimpleBodyDecoder::decodeAsync(const Headers& hea
     }
   }
 }
+
+const v_int64 SimpleBodyDecoder::DEFAULT_MAX_INFLATED_SIZE = 10 * 1024 * 1024;
+
+SimpleBodyDecoder::SimpleBodyDecoder(bool inflate, v_int64 maxInflatedSize)
+  : m_inflate(inflate)
+  , m_maxInflatedSize(maxInflatedSize)
+{}
+
+bool SimpleBodyDecoder::isInflated(const Headers& headers) const {
+  return m_inflate && isDeflateEncoded(headers);
+}
+
+void SimpleBodyDecoder::decode(const Headers& headers,
+                               oatpp::data::stream::InputStream* bodyStream,
+                               oatpp::data::stream::WriteCallback* writeCallback) const {
+  if(isInflated(headers)) {
+    InflatingWriteCallback inflatingCallback(writeCallback, m_maxInflatedSize);
+    doTransferDecoding(headers, bodyStream, &inflatingCallback);
+    inflatingCallback.checkFinished();
+  } else {
+    doTransferDecoding(headers, bodyStream, writeCallback);
+  }
+}
+
+oatpp::async::CoroutineStarter SimpleBodyDecoder::decodeAsync(const Headers& headers,
+                                                              const std::shared_ptr<oatpp::data::stream::InputStream>& bodyStream,
+                                                              const std::shared_ptr<oatpp::data::stream::AsyncWriteCallback>& writeCallback) const {
+  if(isInflated(headers)) {
+    auto inflatingCallback = std::make_shared<AsyncInflatingWriteCallback>(writeCallback, m_maxInflatedSize);
+    return new InflatingDecoder(doTransferDecodingAsync(headers, bodyStream, inflatingCallback), inflatingCallback);
+  }
+  return doTransferDecodingAsync(headers, bodyStream, writeCallback);
+}
+
+void SimpleBodyDecoder::removeDecodedHeaders(Headers& headers) const {
+  if(isInflated(headers)) {
+    headers.erase(Header::CONTENT_ENCODING);
+    headers.erase(Header::CONTENT_LENGTH);
+  }
+}
   
 }}}}}
@@ -30,20 +30,50 @@
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace incoming {
 
 /**
- * Default implementation of &id:oatpp::web::protocol::http::incoming::BodyDecoder;.
+ * Default implementation of &id:oatpp::web::protocol::http::incoming::BodyDecoder;. <br>
+ * Chunked bodies are parsed from a read-ahead buffer. Read-ahead is limited to the bytes which are known to belong to the body,
+ * so data following the body (pipelined request, next keep-alive response) is never consumed. <br>
+ * If enabled, bodies with `Content-Encoding: gzip` or `Content-Encoding: deflate` are inflated provided oatpp is built with zlib
+ * (see &id:oatpp::web::protocol::http::encoding::Deflate;). Other content-codings are passed as is.
  */
 class SimpleBodyDecoder : public BodyDecoder {
+public:
+  /**
+   * Default max size of inflated body - `10485760` bytes (10 MB).
+   */
+  static const v_int64 DEFAULT_MAX_INFLATED_SIZE;
 private:
-  static data::v_io_size readLine(data::stream::InputStream* fromStream, p_char8 buffer, data::v_io_size maxLineSize);
-
   static void doChunkedDecoding(data::stream::InputStream* from, data::stream::WriteCallback* writeCallback);
   
   static oatpp::async::CoroutineStarter doChunkedDecodingAsync(const std::shared_ptr<data::stream::InputStream>& fromStream,
                                                                const std::shared_ptr<data::stream::AsyncWriteCallback>& writeCallback);
+
+  static void doTransferDecoding(const Headers& headers,
+                                 data::stream::InputStream* bodyStream,
+                                 data::stream::WriteCallback* writeCallback);
+
+  static oatpp::async::CoroutineStarter doTransferDecodingAsync(const Headers& headers,
+                                                                const std::shared_ptr<data::stream::InputStream>& bodyStream,
+                                                                const std::shared_ptr<data::stream::AsyncWriteCallback>& writeCallback);
+private:
+  bool m_inflate;
+  v_int64 m_maxInflatedSize;
+private:
+  bool isInflated(const Headers& headers) const;
 public:
 
+  /**
+   * Constructor.
+   * @param inflate - inflate bodies with `Content-Encoding: gzip` or `Content-Encoding: deflate`.
+   * Disabled by default - such bodies are passed as is.
+   * @param maxInflatedSize - max size of inflated body. Decoding of larger bodies fails with `413`.
+   */
+  SimpleBodyDecoder(bool inflate = false, v_int64 maxInflatedSize = DEFAULT_MAX_INFLATED_SIZE);
+
   /**
    * Decode bodyStream and write decoded data to toStream.
+   * @throws - &id:oatpp::web::protocol::http::HttpError; with 400 status if compressed body is invalid or truncated,
+   * and with 413 status if inflated body exceeds `maxInflatedSize`.
    * @param headers - Headers map. &id:oatpp::web::protocol::http::Headers;.
    * @param bodyStream - pointer to &id:oatpp::data::stream::InputStream;.
    * @param writeCallback - &id:oatpp::data::stream::WriteCallback;.
@@ -60,6 +90,12 @@ public:
   oatpp::async::CoroutineStarter decodeAsync(const Headers& headers,
                                              const std::shared_ptr<oatpp::data::stream::InputStream>& bodyStream,
                                              const std::shared_ptr<oatpp::data::stream::AsyncWriteCallback>& writeCallback) const override;
+
+  /**
+   * Remove `Content-Encoding` and `Content-Length` headers of the inflated body.
+   * @param headers - Headers map. &id:oatpp::web::protocol::http::Headers;.
+   */
+  void removeDecodedHeaders(Headers& headers) const override;
   
   
 };
@@ -70,6 +70,23 @@ public:
    * @return - &id:oatpp::async::CoroutineStarter;.
    */
   virtual oatpp::async::CoroutineStarter writeToStreamAsync(const std::shared_ptr<OutputStream>& stream) = 0;
+
+  /**
+   * Get body data if the whole body is available in memory. <br>
+   * Such body is written together with headers in one vectored write - &id:oatpp::data::stream::OutputStream::writeVectored;.
+   * @return - pointer to body data or `nullptr` if body data is not available in memory.
+   */
+  virtual p_char8 getKnownData() {
+    return nullptr;
+  }
+
+  /**
+   * Get size of the data returned by &l:Body::getKnownData ();.
+   * @return - size of the data in bytes or `-1` if body data is not available in memory.
+   */
+  virtual data::v_io_size getKnownSize() {
+    return -1;
+  }
   
 };
   
@@ -62,6 +62,18 @@ public:
    * @param stream - pointer to &id:oatpp::data::stream::OutputStream;.
    */
   void writeToStream(OutputStream* stream) noexcept override;
+
+  /**
+   * Get buffer data.
+   * @return - pointer to buffer data.
+   */
+  p_char8 getKnownData() override;
+
+  /**
+   * Get buffer size.
+   * @return - size of the buffer in bytes.
+   */
+  data::v_io_size getKnownSize() override;
   
 public:
 
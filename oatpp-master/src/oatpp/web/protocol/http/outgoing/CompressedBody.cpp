@@ -0,0 +1,427 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "CompressedBody.hpp"
+
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+#include <cstring>
+#include <memory>
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+namespace {
+
+/*
+ * Compresses data written to it and writes `Transfer-Encoding: chunked` frames to the underlying stream.
+ * Frame is assembled in place - [size CRLF][compressed data][CRLF] - and is written with one call.
+ */
+class EncoderStream : public oatpp::data::stream::OutputStream {
+private:
+  static constexpr data::v_io_size HEADER_SPACE = 18; // 16 hex digits + CRLF
+  static constexpr data::v_io_size TRAILER_SPACE = 7; // CRLF + "0\r\n\r\n"
+private:
+  encoding::DeflateEncoder m_encoder;
+  OutputStream* m_stream;
+  data::v_io_size m_chunkSize;
+  std::unique_ptr<v_char8[]> m_buffer;
+  data::v_io_size m_dataSize;
+  p_char8 m_pending;
+  data::v_io_size m_pendingSize;
+  bool m_done;
+private:
+
+  void sealChunk(bool last) {
+
+    p_char8 data = &m_buffer[HEADER_SPACE];
+    p_char8 end = &data[m_dataSize];
+
+    if(m_dataSize > 0) {
+      static const char* const HEX = "0123456789ABCDEF";
+      p_char8 pos = data;
+      *(-- pos) = '\n';
+      *(-- pos) = '\r';
+      data::v_io_size size = m_dataSize;
+      do {
+        *(-- pos) = HEX[size & 15];
+        size >>= 4;
+      } while (size > 0);
+      m_pending = pos;
+      *(end ++) = '\r';
+      *(end ++) = '\n';
+    } else {
+      m_pending = data;
+    }
+
+    if(last) {
+      std::memcpy(end, "0\r\n\r\n", 5);
+      end += 5;
+      m_done = true;
+    }
+
+    m_pendingSize = end - m_pending;
+    m_dataSize = 0;
+
+  }
+
+  void encode(bool finish) {
+    m_dataSize += m_encoder.process(&m_buffer[HEADER_SPACE + m_dataSize], m_chunkSize - m_dataSize, finish);
+    if(finish && m_encoder.isFinished()) {
+      sealChunk(true);
+    } else if(m_dataSize == m_chunkSize) {
+      sealChunk(false);
+    }
+  }
+
+public:
+
+  EncoderStream(const oatpp::String& encoding, v_int32 level, OutputStream* stream, data::v_io_size chunkSize)
+    : m_encoder(encoding, level)
+    , m_stream(stream)
+    , m_chunkSize(chunkSize)
+    , m_buffer(new v_char8[HEADER_SPACE + chunkSize + TRAILER_SPACE])
+    , m_dataSize(0)
+    , m_pending(nullptr)
+    , m_pendingSize(0)
+    , m_done(false)
+  {}
+
+  /*
+   * Write pending frame to the underlying stream.
+   * Returns positive value if there is nothing pending, or the I/O result of the underlying stream.
+   */
+  data::v_io_size flush() {
+    while(m_pendingSize > 0) {
+      auto res = m_stream->write(m_pending, m_pendingSize);
+      if(res <= 0) {
+        return res;
+      }
+      m_pending += res;
+      m_pendingSize -= res;
+    }
+    return 1;
+  }
+
+  data::v_io_size write(const void *data, data::v_io_size count) override {
+    m_encoder.setInput(data, count);
+    while(true) {
+      auto res = flush();
+      if(res <= 0) {
+        data::v_io_size consumed = count - m_encoder.getInputSize();
+        return consumed > 0 ? consumed : res;
+      }
+      if(m_encoder.getInputSize() == 0) {
+        return count;
+      }
+      encode(false);
+    }
+  }
+
+  oatpp::async::Action suggestOutputStreamAction(data::v_io_size ioResult) override {
+    return m_stream->suggestOutputStreamAction(ioResult);
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    m_stream->setOutputStreamIOMode(ioMode);
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return m_stream->getOutputStreamIOMode();
+  }
+
+  /*
+   * Produce the next frame of the compressed stream end.
+   * Returns `false` if the last frame was already produced.
+   */
+  bool sealNext() {
+    if(m_done) {
+      return false;
+    }
+    m_encoder.setInput(nullptr, 0);
+    encode(true);
+    return true;
+  }
+
+  /*
+   * Write compressed stream end to the blocking stream.
+   */
+  bool finish() {
+    while(flush() > 0) {
+      if(!sealNext()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool hasPending() const {
+    return m_pendingSize > 0;
+  }
+
+  /*
+   * Hand pending frame to the caller to be written asynchronously.
+   */
+  void takePending(oatpp::data::stream::AsyncInlineWriteData& inlineData) {
+    inlineData.set(m_pending, m_pendingSize);
+    m_pending += m_pendingSize;
+    m_pendingSize = 0;
+  }
+
+};
+
+bool startsWithCI(const oatpp::data::share::StringKeyLabel& label, const char* prefix) {
+  v_int32 size = (v_int32) std::strlen(prefix);
+  return label.getSize() >= size && base::StrBuffer::equalsCI(label.getData(), prefix, size);
+}
+
+}
+
+const data::v_io_size CompressedBody::DEFAULT_MIN_SIZE = 1024;
+const data::v_io_size CompressedBody::DEFAULT_CHUNK_SIZE = 16384;
+
+CompressedBody::CompressedBody(const std::shared_ptr<Body>& body,
+                               const oatpp::String& encoding,
+                               v_int32 level,
+                               data::v_io_size minSize,
+                               data::v_io_size chunkSize)
+  : m_body(body)
+  , m_encoding(encoding)
+  , m_level(level)
+  , m_minSize(minSize)
+  , m_chunkSize(chunkSize)
+  , m_encode(false)
+{
+  if(!encoding || !encoding::Deflate::isSupportedEncoding(encoding)) {
+    throw std::runtime_error("[oatpp::web::protocol::http::outgoing::CompressedBody::CompressedBody()]: Error. Encoding is not supported.");
+  }
+}
+
+std::shared_ptr<CompressedBody> CompressedBody::createShared(const std::shared_ptr<Body>& body,
+                                                             const oatpp::String& encoding,
+                                                             v_int32 level,
+                                                             data::v_io_size minSize,
+                                                             data::v_io_size chunkSize)
+{
+  return std::make_shared<CompressedBody>(body, encoding, level, minSize, chunkSize);
+}
+
+bool CompressedBody::isCompressibleContentType(const oatpp::data::share::StringKeyLabel& contentType) {
+
+  if(startsWithCI(contentType, "image/")) {
+    return startsWithCI(contentType, "image/svg");
+  }
+
+  static const char* const COMPRESSED_TYPES[] = {
+    "video/",
+    "audio/",
+    "font/woff",
+    "application/zip",
+    "application/gzip",
+    "application/x-gzip",
+    "application/x-bzip2",
+    "application/x-7z-compressed",
+    "application/x-rar-compressed"
+  };
+
+  for(const char* type : COMPRESSED_TYPES) {
+    if(startsWithCI(contentType, type)) {
+      return false;
+    }
+  }
+
+  return true;
+
+}
+
+oatpp::String CompressedBody::getEncodedETag(const oatpp::data::share::StringKeyLabel& etag, const oatpp::String& encoding) {
+
+  const char* data = (const char*) etag.getData();
+  v_int32 size = etag.getSize();
+
+  if(size >= 2 && data[0] == 'W' && data[1] == '/') {
+    data += 2;
+    size -= 2;
+  }
+
+  if(size < 2 || data[0] != '"' || data[size - 1] != '"') {
+    return nullptr;
+  }
+
+  /* W/"<opaque-tag>-<encoding>" */
+  std::string result;
+  result.reserve(size + encoding->getSize() + 3);
+  result.append("W/");
+  result.append(data, size - 1);
+  result.push_back('-');
+  result.append((const char*) encoding->getData(), encoding->getSize());
+  result.push_back('"');
+
+  return oatpp::String(result.data(), (v_int32) result.size(), true);
+
+}
+
+bool CompressedBody::shouldEncode(Headers& headers) const {
+
+  if(headers.find(Header::CONTENT_ENCODING) != headers.end() || headers.find(Header::TRANSFER_ENCODING) != headers.end()) {
+    return false;
+  }
+
+  /* range of the identity representation - can't be sent encoded */
+  if(headers.find(Header::CONTENT_RANGE) != headers.end()) {
+    return false;
+  }
+
+  auto contentLengthIt = headers.find(Header::CONTENT_LENGTH);
+  if(contentLengthIt == headers.end()) {
+    return false;
+  }
+
+  bool success;
+  auto contentLength = oatpp::utils::conversion::strToInt64(contentLengthIt->second.toString(), success);
+  if(!success || contentLength < m_minSize) {
+    return false;
+  }
+
+  auto contentTypeIt = headers.find(Header::CONTENT_TYPE);
+  return contentTypeIt == headers.end() || isCompressibleContentType(contentTypeIt->second);
+
+}
+
+void CompressedBody::declareHeaders(Headers& headers) noexcept {
+
+  m_body->declareHeaders(headers);
+  m_encode = shouldEncode(headers);
+
+  if(m_encode) {
+
+    headers.erase(Header::CONTENT_LENGTH);
+    headers[Header::TRANSFER_ENCODING] = Header::Value::TRANSFER_ENCODING_CHUNKED;
+    headers[Header::CONTENT_ENCODING] = m_encoding;
+
+    /* encoded representation has its own validator and doesn't support ranges */
+    headers.erase(Header::ACCEPT_RANGES);
+    auto etagIt = headers.find(Header::ETAG);
+    if(etagIt != headers.end()) {
+      auto etag = getEncodedETag(etagIt->second, m_encoding);
+      if(etag) {
+        etagIt->second = etag;
+      } else {
+        headers.erase(Header::ETAG);
+      }
+    }
+
+  }
+
+}
+
+void CompressedBody::writeToStream(OutputStream* stream) noexcept {
+
+  if(!m_encode) {
+    m_body->writeToStream(stream);
+    return;
+  }
+
+  if(stream->getOutputStreamIOMode() != oatpp::data::stream::IOMode::BLOCKING) {
+    OATPP_LOGE("[oatpp::web::protocol::http::outgoing::CompressedBody::writeToStream()]", "Error. Blocking method called for NON_BLOCKING stream.");
+  }
+
+  try {
+    EncoderStream encoderStream(m_encoding, m_level, stream, m_chunkSize);
+    m_body->writeToStream(&encoderStream);
+    if(!encoderStream.finish()) {
+      OATPP_LOGE("[oatpp::web::protocol::http::outgoing::CompressedBody::writeToStream()]", "Error. Can't write data.");
+    }
+  } catch (std::exception& e) {
+    OATPP_LOGE("[oatpp::web::protocol::http::outgoing::CompressedBody::writeToStream()]", "Error. %s", e.what());
+  }
+
+}
+
+oatpp::async::CoroutineStarter CompressedBody::writeToStreamAsync(const std::shared_ptr<OutputStream>& stream) {
+
+  class WriteCoroutine : public oatpp::async::Coroutine<WriteCoroutine> {
+  private:
+    std::shared_ptr<CompressedBody> m_body;
+    std::shared_ptr<OutputStream> m_stream;
+    std::shared_ptr<EncoderStream> m_encoderStream;
+    data::stream::AsyncInlineWriteData m_inlineData;
+  public:
+
+    WriteCoroutine(const std::shared_ptr<CompressedBody>& body,
+                   const std::shared_ptr<OutputStream>& stream)
+      : m_body(body)
+      , m_stream(stream)
+      , m_encoderStream(std::make_shared<EncoderStream>(body->m_encoding, body->m_level, stream.get(), body->m_chunkSize))
+    {}
+
+    Action act() override {
+      return m_body->m_body->writeToStreamAsync(m_encoderStream).next(yieldTo(&WriteCoroutine::writeStreamEnd));
+    }
+
+    Action writeStreamEnd() {
+      if(!m_encoderStream->hasPending() && !m_encoderStream->sealNext()) {
+        return finish();
+      }
+      m_encoderStream->takePending(m_inlineData);
+      return yieldTo(&WriteCoroutine::writePending);
+    }
+
+    Action writePending() {
+      return oatpp::data::stream::writeExactSizeDataAsyncInline(this, m_stream.get(), m_inlineData, yieldTo(&WriteCoroutine::writeStreamEnd));
+    }
+
+  };
+
+  if(!m_encode) {
+    return m_body->writeToStreamAsync(stream);
+  }
+
+  if(stream->getOutputStreamIOMode() != oatpp::data::stream::IOMode::NON_BLOCKING) {
+    throw std::runtime_error("[oatpp::web::protocol::http::outgoing::CompressedBody::writeToStreamAsync()]: Error. Async method called for BLOCKING stream.");
+  }
+
+  return WriteCoroutine::start(shared_from_this(), stream);
+
+}
+
+p_char8 CompressedBody::getKnownData() {
+  if(m_encode) {
+    return nullptr;
+  }
+  return m_body->getKnownData();
+}
+
+data::v_io_size CompressedBody::getKnownSize() {
+  if(m_encode) {
+    return -1;
+  }
+  return m_body->getKnownSize();
+}
+
+bool CompressedBody::isEncoded() const {
+  return m_encode;
+}
+
+}}}}}
@@ -0,0 +1,159 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_web_protocol_http_outgoing_CompressedBody_hpp
+#define oatpp_web_protocol_http_outgoing_CompressedBody_hpp
+
+#include "./Body.hpp"
+
+#include "oatpp/web/protocol/http/encoding/Deflate.hpp"
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+/**
+ * Body wrapper compressing content of another body with `Content-Encoding: gzip` or `Content-Encoding: deflate`. <br>
+ * Compressed data is sent with `Transfer-Encoding: chunked` - one chunk per `chunkSize` bytes of compressed data. <br>
+ * Wrapped body is sent as is if it is smaller than `minSize`, doesn't declare `Content-Length`,
+ * already has `Content-Encoding` or `Content-Range`, or its `Content-Type` is an already compressed format (images, video, archives...).
+ * The decision is made in &l:CompressedBody::declareHeaders ();. <br>
+ * *Note:* bodies sent with `Transfer-Encoding: chunked` are never compressed - this includes streaming
+ * &id:oatpp::web::protocol::http::outgoing::DtoBody; (serialized while being sent)
+ * and &id:oatpp::web::protocol::http::outgoing::ChunkedBufferBody; with `chunked` option set.
+ */
+class CompressedBody : public oatpp::base::Countable, public Body, public std::enable_shared_from_this<CompressedBody> {
+public:
+  /**
+   * Default min size of the body to compress - `1024` bytes.
+   */
+  static const data::v_io_size DEFAULT_MIN_SIZE;
+
+  /**
+   * Default size of compressed data chunk - `16384` bytes.
+   */
+  static const data::v_io_size DEFAULT_CHUNK_SIZE;
+public:
+  /**
+   * Check if content of this type is worth compressing.
+   * @param contentType - value of `Content-Type` header.
+   * @return - `false` for already compressed formats.
+   */
+  static bool isCompressibleContentType(const oatpp::data::share::StringKeyLabel& contentType);
+
+  /**
+   * ETag of the encoded representation - weak, with encoding appended to the opaque tag. <br>
+   * `"abc"` or `W/"abc"` -> `W/"abc-gzip"`.
+   * @param etag - ETag of the wrapped body.
+   * @param encoding - content encoding.
+   * @return - encoded ETag or `nullptr` if `etag` is malformed.
+   */
+  static oatpp::String getEncodedETag(const oatpp::data::share::StringKeyLabel& etag, const oatpp::String& encoding);
+private:
+  std::shared_ptr<Body> m_body;
+  oatpp::String m_encoding;
+  v_int32 m_level;
+  data::v_io_size m_minSize;
+  data::v_io_size m_chunkSize;
+  bool m_encode;
+private:
+  bool shouldEncode(Headers& headers) const;
+public:
+
+  /**
+   * Constructor.
+   * @param body - body to compress.
+   * @param encoding - `gzip` or `deflate`. See &id:oatpp::web::protocol::http::encoding::Deflate::isSupportedEncoding;.
+   * @param level - compression level. See &id:oatpp::web::protocol::http::encoding::DeflateEncoder;.
+   * @param minSize - bodies smaller than `minSize` are sent uncompressed.
+   * @param chunkSize - max size of compressed data chunk.
+   * @throws - `std::runtime_error` if encoding is not supported.
+   */
+  CompressedBody(const std::shared_ptr<Body>& body,
+                 const oatpp::String& encoding,
+                 v_int32 level = encoding::DeflateEncoder::LEVEL_DEFAULT,
+                 data::v_io_size minSize = DEFAULT_MIN_SIZE,
+                 data::v_io_size chunkSize = DEFAULT_CHUNK_SIZE);
+public:
+
+  /**
+   * Create shared CompressedBody.
+   * @param body - body to compress.
+   * @param encoding - `gzip` or `deflate`.
+   * @param level - compression level.
+   * @param minSize - bodies smaller than `minSize` are sent uncompressed.
+   * @param chunkSize - max size of compressed data chunk.
+   * @return - `std::shared_ptr` to CompressedBody.
+   */
+  static std::shared_ptr<CompressedBody> createShared(const std::shared_ptr<Body>& body,
+                                                      const oatpp::String& encoding,
+                                                      v_int32 level = encoding::DeflateEncoder::LEVEL_DEFAULT,
+                                                      data::v_io_size minSize = DEFAULT_MIN_SIZE,
+                                                      data::v_io_size chunkSize = DEFAULT_CHUNK_SIZE);
+
+  /**
+   * Declare headers of the wrapped body. If body is compressed - replace `Content-Length` with
+   * `Transfer-Encoding: chunked` and add `Content-Encoding`. <br>
+   * `Accept-Ranges` is removed and `ETag` is replaced with &l:CompressedBody::getEncodedETag (); so that
+   * the encoded and the identity representations never share a validator.
+   * Partial responses (with `Content-Range`) are not compressed.
+   * @param headers - &id:oatpp::web::protocol::http::Headers;.
+   */
+  void declareHeaders(Headers& headers) noexcept override;
+
+  /**
+   * Write compressed body data to stream.
+   * @param stream - pointer to &id:oatpp::data::stream::OutputStream;.
+   */
+  void writeToStream(OutputStream* stream) noexcept override;
+
+  /**
+   * Write compressed body data to stream in asynchronous manner.
+   * @param stream - &id:oatpp::data::stream::OutputStream;.
+   * @return - &id:oatpp::async::CoroutineStarter;.
+   */
+  oatpp::async::CoroutineStarter writeToStreamAsync(const std::shared_ptr<OutputStream>& stream) override;
+
+  /**
+   * Known data of the wrapped body if it is sent uncompressed.
+   * @return - pointer to body data or `nullptr`.
+   */
+  p_char8 getKnownData() override;
+
+  /**
+   * Size of the data returned by &l:CompressedBody::getKnownData ();.
+   * @return - size of the data or `-1`.
+   */
+  data::v_io_size getKnownSize() override;
+
+  /**
+   * Check if body is sent compressed. Meaningful after &l:CompressedBody::declareHeaders (); is called.
+   * @return - `true` if body is compressed.
+   */
+  bool isEncoded() const;
+
+};
+
+}}}}}
+
+#endif // oatpp_web_protocol_http_outgoing_CompressedBody_hpp
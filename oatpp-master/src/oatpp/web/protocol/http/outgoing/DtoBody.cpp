@@ -26,22 +26,47 @@
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
 
+const data::v_io_size DtoBody::STREAMING_CHUNK_SIZE = 16 * 1024;
+
 DtoBody::DtoBody(const oatpp::data::mapping::type::AbstractObjectWrapper& dto,
                  oatpp::data::mapping::ObjectMapper* objectMapper,
-                 bool chunked)
-  : ChunkedBufferBody(oatpp::data::stream::ChunkedBuffer::createShared(), chunked)
+                 bool chunked,
+                 bool streaming)
+  : ChunkedBufferBody(oatpp::data::stream::ChunkedBuffer::createShared(), chunked || streaming)
   , m_dto(dto)
   , m_objectMapper(objectMapper)
+  , m_streaming(streaming)
 {}
 
 std::shared_ptr<DtoBody> DtoBody::createShared(const oatpp::data::mapping::type::AbstractObjectWrapper& dto,
                                                oatpp::data::mapping::ObjectMapper* objectMapper,
-                                               bool chunked) {
-  return Shared_Http_Outgoing_DtoBody_Pool::allocateShared(dto, objectMapper, chunked);
+                                               bool chunked,
+                                               bool streaming) {
+  return Shared_Http_Outgoing_DtoBody_Pool::allocateShared(dto, objectMapper, chunked, streaming);
+}
+
+bool DtoBody::fillStreamingBuffer() {
+
+  if(!m_writer) {
+    if(!m_dto) {
+      return false;
+    }
+    m_writer = m_objectMapper->createWriter(m_dto);
+  }
+
+  while(m_buffer->getSize() < STREAMING_CHUNK_SIZE) {
+    if(!m_writer->writeNext(m_buffer)) {
+      m_writer.reset();
+      return false;
+    }
+  }
+
+  return true;
+
 }
 
 void DtoBody::declareHeaders(Headers& headers) noexcept {
-  if(m_dto) {
+  if(m_dto && !m_streaming) {
     m_objectMapper->write(m_buffer, m_dto);
   }
   ChunkedBufferBody::declareHeaders(headers);
@@ -52,4 +77,93 @@ void DtoBody::declareHeaders(Headers& headers) noexcept {
   }
 }
 
+void DtoBody::writeToStream(OutputStream* stream) noexcept {
+
+  if(!m_streaming) {
+    ChunkedBufferBody::writeToStream(stream);
+    return;
+  }
+
+  v_char8 chunkHeader[16];
+  bool hasMore = true;
+
+  while(hasMore) {
+
+    hasMore = fillStreamingBuffer();
+
+    if(m_buffer->getSize() > 0) {
+      v_int32 headerSize = oatpp::utils::conversion::primitiveToCharSequence(m_buffer->getSize(), chunkHeader, 16, "%X\r\n");
+      bool res = oatpp::data::stream::writeExactSizeData(stream, chunkHeader, headerSize) == headerSize &&
+                 m_buffer->flushToStream(stream) &&
+                 oatpp::data::stream::writeExactSizeData(stream, "\r\n", 2) == 2;
+      m_buffer->clear();
+      if(!res) {
+        OATPP_LOGE("[oatpp::web::protocol::http::outgoing::DtoBody::writeToStream()]", "Error. Can't write data.");
+        return;
+      }
+    }
+
+  }
+
+  if(oatpp::data::stream::writeExactSizeData(stream, "0\r\n\r\n", 5) != 5) {
+    OATPP_LOGE("[oatpp::web::protocol::http::outgoing::DtoBody::writeToStream()]", "Error. Can't write data trailing bytes.");
+  }
+
+}
+
+DtoBody::StreamingCoroutine::StreamingCoroutine(const std::shared_ptr<DtoBody>& body,
+                                                const std::shared_ptr<OutputStream>& stream)
+  : m_body(body)
+  , m_stream(stream)
+  , m_hasMore(true)
+  , m_nextAction(Action::createActionByType(Action::TYPE_FINISH))
+{}
+
+async::Action DtoBody::StreamingCoroutine::act() {
+
+  m_hasMore = m_body->fillStreamingBuffer();
+
+  if(m_body->m_buffer->getSize() == 0) {
+    return yieldTo(&StreamingCoroutine::writeEndOfChunks);
+  }
+
+  m_inlineWriteData.set(m_chunkHeader, oatpp::utils::conversion::primitiveToCharSequence(m_body->m_buffer->getSize(),
+                                                                                         m_chunkHeader, 16, "%X\r\n"));
+  m_nextAction = yieldTo(&StreamingCoroutine::writeChunkData);
+  return yieldTo(&StreamingCoroutine::writeCurrData);
+
+}
+
+async::Action DtoBody::StreamingCoroutine::writeChunkData() {
+  return m_body->m_buffer->flushToStreamAsync(m_stream).next(yieldTo(&StreamingCoroutine::writeChunkSeparator));
+}
+
+async::Action DtoBody::StreamingCoroutine::writeChunkSeparator() {
+  m_body->m_buffer->clear();
+  m_inlineWriteData.set("\r\n", 2);
+  if(m_hasMore) {
+    m_nextAction = yieldTo(&StreamingCoroutine::act);
+  } else {
+    m_nextAction = yieldTo(&StreamingCoroutine::writeEndOfChunks);
+  }
+  return yieldTo(&StreamingCoroutine::writeCurrData);
+}
+
+async::Action DtoBody::StreamingCoroutine::writeEndOfChunks() {
+  m_inlineWriteData.set("0\r\n\r\n", 5);
+  m_nextAction = finish();
+  return yieldTo(&StreamingCoroutine::writeCurrData);
+}
+
+async::Action DtoBody::StreamingCoroutine::writeCurrData() {
+  return oatpp::data::stream::writeExactSizeDataAsyncInline(this, m_stream.get(), m_inlineWriteData, Action::clone(m_nextAction));
+}
+
+oatpp::async::CoroutineStarter DtoBody::writeToStreamAsync(const std::shared_ptr<OutputStream>& stream) {
+  if(m_streaming) {
+    return StreamingCoroutine::start(std::static_pointer_cast<DtoBody>(shared_from_this()), stream);
+  }
+  return ChunkedBufferBody::writeToStreamAsync(stream);
+}
+
 }}}}}
@@ -41,19 +41,56 @@ class DtoBody : public ChunkedBufferBody {
 public:
   OBJECT_POOL(Http_Outgoing_DtoBody_Pool, DtoBody, 32)
   SHARED_OBJECT_POOL(Shared_Http_Outgoing_DtoBody_Pool, DtoBody, 32)
+public:
+  /**
+   * In streaming mode serialized data is sent in chunks of at least this size
+   * (the last chunk may be smaller). A chunk exceeds this size by at most one top-level element of the DTO.
+   */
+  static const data::v_io_size STREAMING_CHUNK_SIZE;
+private:
+
+  class StreamingCoroutine : public oatpp::async::Coroutine<StreamingCoroutine> {
+  private:
+    std::shared_ptr<DtoBody> m_body;
+    std::shared_ptr<OutputStream> m_stream;
+    bool m_hasMore;
+    Action m_nextAction;
+    oatpp::data::stream::AsyncInlineWriteData m_inlineWriteData;
+    v_char8 m_chunkHeader[16];
+  public:
+
+    StreamingCoroutine(const std::shared_ptr<DtoBody>& body,
+                       const std::shared_ptr<OutputStream>& stream);
+
+    Action act() override;
+    Action writeChunkData();
+    Action writeChunkSeparator();
+    Action writeEndOfChunks();
+    Action writeCurrData();
+
+  };
+
+private:
+  bool fillStreamingBuffer();
 private:
   oatpp::data::mapping::type::AbstractObjectWrapper m_dto;
   oatpp::data::mapping::ObjectMapper* m_objectMapper;
+  bool m_streaming;
+  std::shared_ptr<oatpp::data::mapping::ObjectMapper::Writer> m_writer;
 public:
   /**
    * Constructor.
    * @param dto - &id:oatpp::data::mapping::type::AbstractObjectWrapper;.
    * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper;.
    * @param chunked - set `true` to send using HTTP chunked transfer encoding. Set `false` to send as body with specified `Content-Length` header.
+   * @param streaming - set `true` to serialize DTO while sending. DTO is written to stream through the buffer of
+   * bounded size (see &l:DtoBody::STREAMING_CHUNK_SIZE;) instead of being serialized as a whole before sending.
+   * See &id:oatpp::data::mapping::ObjectMapper::createWriter;. Streaming body is always sent using HTTP chunked transfer encoding.
    */
   DtoBody(const oatpp::data::mapping::type::AbstractObjectWrapper& dto,
           oatpp::data::mapping::ObjectMapper* objectMapper,
-          bool chunked = false);
+          bool chunked = false,
+          bool streaming = false);
 public:
 
   /**
@@ -61,11 +98,13 @@ public:
    * @param dto - &id:oatpp::data::mapping::type::AbstractObjectWrapper;.
    * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper;.
    * @param chunked - set `true` to send using HTTP chunked transfer encoding. Set `false` to send as body with specified `Content-Length` header.
+   * @param streaming - set `true` to serialize DTO while sending. See &l:DtoBody::DtoBody ();.
    * @return - `std::shared_ptr` to DtoBody.
    */
   static std::shared_ptr<DtoBody> createShared(const oatpp::data::mapping::type::AbstractObjectWrapper& dto,
                                                oatpp::data::mapping::ObjectMapper* objectMapper,
-                                               bool chunked = false);
+                                               bool chunked = false,
+                                               bool streaming = false);
 
   /**
    * Add `Transfer-Encoding: chunked` header if `chunked` option was set to `true`.<br>
@@ -76,6 +115,20 @@ public:
    * @param headers - &id:oatpp::web::protocol::http::Headers;.
    */
   void declareHeaders(Headers& headers) noexcept override;
+
+  /**
+   * Write body data to stream. In streaming mode DTO is serialized while writing.
+   * @param stream - pointer to &id:oatpp::data::stream::OutputStream;.
+   */
+  void writeToStream(OutputStream* stream) noexcept override;
+
+  /**
+   * Same as &l:DtoBody::writeToStream (); but async. In streaming mode coroutine yields while waiting for the stream
+   * so that only one chunk of serialized data is held in memory.
+   * @param stream - `std::shared_ptr` to &id:oatpp::data::stream::OutputStream;.
+   * @return - &id:oatpp::async::CoroutineStarter;.
+   */
+  oatpp::async::CoroutineStarter writeToStreamAsync(const std::shared_ptr<OutputStream>& stream) override;
   
 };
 
@@ -0,0 +1,682 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "FileBody.hpp"
+
+#include "oatpp/core/data/stream/StreamBufferedProxy.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+#include <ctime>
+#include <cstring>
+#include <limits>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if defined(WIN32) || defined(_WIN32)
+  #include <io.h>
+  #include <WinSock2.h>
+#else
+  #include <unistd.h>
+  #include <errno.h>
+  #include <sys/socket.h>
+#endif
+
+#if defined(__linux__)
+  #include <sys/sendfile.h>
+  #include <poll.h>
+#endif
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+FileBody::FileBody(std::FILE* file, bool ownsFile)
+  : m_file(file)
+  , m_ownsFile(ownsFile)
+  , m_fileSize(0)
+  , m_modifiedTime(0)
+  , m_offset(0)
+  , m_size(0)
+{
+
+  if(m_file == nullptr) {
+    throw std::runtime_error("[oatpp::web::protocol::http::outgoing::FileBody::FileBody()]: Error. File is null.");
+  }
+
+#if defined(WIN32) || defined(_WIN32)
+  struct _stat64 fileStat;
+  if(_fstat64(_fileno(m_file), &fileStat) != 0) {
+#else
+  struct stat fileStat;
+  if(fstat(fileno(m_file), &fileStat) != 0) {
+#endif
+    if(m_ownsFile) {
+      std::fclose(m_file);
+    }
+    throw std::runtime_error("[oatpp::web::protocol::http::outgoing::FileBody::FileBody()]: Error. Can't stat file.");
+  }
+
+#if defined(WIN32) || defined(_WIN32)
+  bool isRegularFile = (fileStat.st_mode & _S_IFMT) == _S_IFREG;
+#else
+  bool isRegularFile = S_ISREG(fileStat.st_mode);
+#endif
+
+  if(!isRegularFile) {
+    if(m_ownsFile) {
+      std::fclose(m_file);
+    }
+    throw std::runtime_error("[oatpp::web::protocol::http::outgoing::FileBody::FileBody()]: Error. Not a regular file.");
+  }
+
+  m_fileSize = (v_int64) fileStat.st_size;
+  m_modifiedTime = (v_int64) fileStat.st_mtime;
+  m_size = m_fileSize;
+
+}
+
+FileBody::FileBody(const char* filename)
+  : FileBody(std::fopen(filename, "rb"), true)
+{}
+
+FileBody::~FileBody() {
+  if(m_ownsFile) {
+    std::fclose(m_file);
+  }
+}
+
+std::shared_ptr<FileBody> FileBody::createShared(const char* filename) {
+  return Shared_Http_Outgoing_FileBody_Pool::allocateShared(filename);
+}
+
+FileBody::RangeResult FileBody::resolveRange(const oatpp::data::share::StringKeyLabel& header, v_int64 fileSize, v_int64& start, v_int64& end) {
+
+  p_char8 data = header.getData();
+  v_int32 size = header.getSize();
+
+  if(size < 6 || !base::StrBuffer::equalsCI(data, "bytes=", 6)) {
+    return RangeResult::NONE;
+  }
+
+  v_int32 pos = 6;
+  for(v_int32 i = pos; i < size; i ++) {
+    if(data[i] == ',') {
+      return RangeResult::NONE; // multiple ranges are not supported - serve the whole file
+    }
+  }
+
+  auto parseNumber = [data, size](v_int32& pos, v_int64& value) {
+    v_int32 begin = pos;
+    value = 0;
+    while(pos < size && data[pos] >= '0' && data[pos] <= '9') {
+      if(value > (std::numeric_limits<v_int64>::max() - 9) / 10) {
+        return false;
+      }
+      value = value * 10 + (data[pos] - '0');
+      pos ++;
+    }
+    return pos > begin;
+  };
+
+  while(pos < size && data[pos] == ' ') pos ++;
+
+  if(pos < size && data[pos] == '-') {
+
+    pos ++;
+    v_int64 suffix;
+    if(!parseNumber(pos, suffix) || pos != size) {
+      return RangeResult::NONE;
+    }
+    if(suffix == 0 || fileSize == 0) {
+      return RangeResult::UNSATISFIABLE;
+    }
+    start = suffix < fileSize ? fileSize - suffix : 0;
+    end = fileSize - 1;
+    return RangeResult::SATISFIABLE;
+
+  }
+
+  if(!parseNumber(pos, start) || pos >= size || data[pos] != '-') {
+    return RangeResult::NONE;
+  }
+  pos ++;
+
+  if(pos == size) {
+    end = fileSize - 1;
+  } else if(!parseNumber(pos, end) || pos != size) {
+    return RangeResult::NONE;
+  } else if(end < start) {
+    return RangeResult::NONE;
+  }
+
+  if(start >= fileSize) {
+    return RangeResult::UNSATISFIABLE;
+  }
+
+  if(end >= fileSize) {
+    end = fileSize - 1;
+  }
+
+  return RangeResult::SATISFIABLE;
+
+}
+
+bool FileBody::matchETag(const oatpp::data::share::StringKeyLabel& header, const oatpp::String& etag) {
+
+  p_char8 tagData = etag->getData();
+  v_int32 tagSize = etag->getSize();
+  if(tagSize > 2 && tagData[0] == 'W' && tagData[1] == '/') {
+    tagData += 2;
+    tagSize -= 2;
+  }
+
+  p_char8 data = header.getData();
+  v_int32 size = header.getSize();
+  v_int32 pos = 0;
+
+  while(pos < size) {
+
+    while(pos < size && (data[pos] == ' ' || data[pos] == '\t' || data[pos] == ',')) pos ++;
+    v_int32 begin = pos;
+    while(pos < size && data[pos] != ',') pos ++;
+    v_int32 end = pos;
+    while(end > begin && (data[end - 1] == ' ' || data[end - 1] == '\t')) end --;
+
+    if(end - begin == 1 && data[begin] == '*') {
+      return true;
+    }
+    if(end - begin > 2 && data[begin] == 'W' && data[begin + 1] == '/') {
+      begin += 2;
+    }
+    if(end - begin == tagSize && std::memcmp(&data[begin], tagData, tagSize) == 0) {
+      return true;
+    }
+
+  }
+
+  return false;
+
+}
+
+oatpp::String FileBody::formatHttpDate(v_int64 time) {
+  std::time_t t = (std::time_t) time;
+  std::tm tm;
+#if defined(WIN32) || defined(_WIN32)
+  gmtime_s(&tm, &t);
+#else
+  gmtime_r(&t, &tm);
+#endif
+  char buffer[64];
+  auto size = std::strftime(buffer, sizeof(buffer), "%a, %d %b %Y %H:%M:%S GMT", &tm);
+  return oatpp::String(buffer, (v_int32) size, true);
+}
+
+bool FileBody::parseHttpDate(const oatpp::data::share::StringKeyLabel& date, v_int64& time) {
+
+  static const char* const MONTHS = "JanFebMarAprMayJunJulAugSepOctNovDec";
+
+  p_char8 data = date.getData();
+  v_int32 size = date.getSize();
+  v_int32 pos = 0;
+
+  auto parseNumber = [data, size, &pos](v_int32 maxDigits, v_int32& result) {
+    v_int32 begin = pos;
+    result = 0;
+    while(pos < size && pos - begin < maxDigits && data[pos] >= '0' && data[pos] <= '9') {
+      result = result * 10 + (data[pos ++] - '0');
+    }
+    return pos > begin;
+  };
+
+  auto parseMonth = [data, size, &pos](v_int32& result) {
+    if(pos + 3 > size) {
+      return false;
+    }
+    for(v_int32 i = 0; i < 12; i ++) {
+      if(std::memcmp(&data[pos], &MONTHS[i * 3], 3) == 0) {
+        result = i + 1;
+        pos += 3;
+        return true;
+      }
+    }
+    return false;
+  };
+
+  auto skip = [data, size, &pos](v_char8 c) {
+    if(pos < size && data[pos] == c) {
+      pos ++;
+      return true;
+    }
+    return false;
+  };
+
+  auto parseTime = [&parseNumber, &skip](v_int32& hour, v_int32& minute, v_int32& second) {
+    return parseNumber(2, hour) && skip(':') && parseNumber(2, minute) && skip(':') && parseNumber(2, second);
+  };
+
+  /* skip day name */
+  while(pos < size && data[pos] != ',' && data[pos] != ' ') pos ++;
+
+  v_int32 year, month, day, hour, minute, second;
+
+  if(skip(',')) {
+
+    /* IMF-fixdate "Sun, 06 Nov 1994 08:49:37 GMT" or RFC 850 "Sunday, 06-Nov-94 08:49:37 GMT" */
+    skip(' ');
+    if(!parseNumber(2, day)) return false;
+    v_char8 separator = pos < size ? data[pos] : 0;
+    if((separator != ' ' && separator != '-') || !skip(separator)) return false;
+    if(!parseMonth(month) || !skip(separator)) return false;
+    v_int32 yearBegin = pos;
+    if(!parseNumber(4, year)) return false;
+    if(pos - yearBegin == 2) {
+      year += year < 70 ? 2000 : 1900;
+    }
+    if(!skip(' ') || !parseTime(hour, minute, second)) return false;
+    if(!skip(' ') || pos + 3 != size || std::memcmp(&data[pos], "GMT", 3) != 0) return false;
+
+  } else {
+
+    /* asctime "Sun Nov  6 08:49:37 1994" */
+    if(!skip(' ') || !parseMonth(month) || !skip(' ')) return false;
+    skip(' ');
+    if(!parseNumber(2, day) || !skip(' ') || !parseTime(hour, minute, second) || !skip(' ')) return false;
+    if(!parseNumber(4, year) || pos != size) return false;
+
+  }
+
+  if(day < 1 || day > 31 || hour > 23 || minute > 59 || second > 60) {
+    return false;
+  }
+
+  /* days since epoch - proleptic Gregorian calendar */
+  v_int64 y = month <= 2 ? year - 1 : year;
+  v_int64 era = (y >= 0 ? y : y - 399) / 400;
+  v_int64 yearOfEra = y - era * 400;
+  v_int64 dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  v_int64 dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  v_int64 days = era * 146097 + dayOfEra - 719468;
+
+  time = days * 86400 + hour * 3600 + minute * 60 + second;
+  return true;
+
+}
+
+std::shared_ptr<Response> FileBody::createResponse(const char* filename, const Headers& requestHeaders) {
+
+  std::FILE* file = std::fopen(filename, "rb");
+  if(file == nullptr) {
+    return nullptr;
+  }
+
+  std::shared_ptr<FileBody> body;
+  try {
+    body = Shared_Http_Outgoing_FileBody_Pool::allocateShared(file, true);
+  } catch (std::runtime_error&) {
+    return nullptr; // directory or something else which can't be served. File is closed by FileBody.
+  }
+
+  auto etag = body->getETag();
+  auto lastModified = formatHttpDate(body->getModifiedTime());
+
+  bool notModified = false;
+  auto it = requestHeaders.find(Header::IF_NONE_MATCH);
+  if(it != requestHeaders.end()) {
+    notModified = matchETag(it->second, etag);
+  } else {
+    it = requestHeaders.find(Header::IF_MODIFIED_SINCE);
+    v_int64 since;
+    notModified = it != requestHeaders.end() && parseHttpDate(it->second, since) && body->getModifiedTime() <= since;
+  }
+
+  std::shared_ptr<Response> response;
+
+  if(notModified) {
+    response = Response::createShared(Status::CODE_304, nullptr);
+  } else {
+
+    v_int64 start = 0;
+    v_int64 end = 0;
+    RangeResult range = RangeResult::NONE;
+
+    it = requestHeaders.find(Header::RANGE);
+    if(it != requestHeaders.end()) {
+      range = resolveRange(it->second, body->getFileSize(), start, end);
+    }
+
+    switch(range) {
+
+      case RangeResult::SATISFIABLE:
+        body->setRange(start, end - start + 1);
+        response = Response::createShared(Status::CODE_206, body);
+        response->putHeader(Header::CONTENT_RANGE, ContentRange(ContentRange::UNIT_BYTES, start, end, body->getFileSize(), true).toString());
+        break;
+
+      case RangeResult::UNSATISFIABLE: {
+        response = Response::createShared(Status::CODE_416, nullptr);
+        v_char8 buffer[64];
+        v_int32 size = std::snprintf((char*) buffer, sizeof(buffer), "bytes */%lld", (long long) body->getFileSize());
+        response->putHeader(Header::CONTENT_RANGE, oatpp::String((const char*) buffer, size, true));
+        break;
+      }
+
+      default:
+        response = Response::createShared(Status::CODE_200, body);
+
+    }
+
+  }
+
+  response->putHeader(Header::ACCEPT_RANGES, ContentRange::UNIT_BYTES);
+  response->putHeader(Header::ETAG, etag);
+  response->putHeader(Header::LAST_MODIFIED, lastModified);
+
+  return response;
+
+}
+
+void FileBody::setRange(v_int64 offset, v_int64 size) {
+  if(offset < 0 || size < 0 || offset + size > m_fileSize) {
+    throw std::runtime_error("[oatpp::web::protocol::http::outgoing::FileBody::setRange()]: Error. Invalid range.");
+  }
+  m_offset = offset;
+  m_size = size;
+}
+
+v_int64 FileBody::getFileSize() const {
+  return m_fileSize;
+}
+
+v_int64 FileBody::getModifiedTime() const {
+  return m_modifiedTime;
+}
+
+oatpp::String FileBody::getETag() const {
+  char buffer[64];
+  auto size = std::snprintf(buffer, sizeof(buffer), "W/\"%llx-%llx\"", (unsigned long long) m_fileSize, (unsigned long long) m_modifiedTime);
+  return oatpp::String(buffer, (v_int32) size, true);
+}
+
+void FileBody::declareHeaders(Headers& headers) noexcept {
+  headers[Header::CONTENT_LENGTH] = oatpp::utils::conversion::int64ToStr(m_size);
+}
+
+oatpp::network::Connection* FileBody::getConnection(OutputStream* stream, bool flush) {
+  auto proxy = dynamic_cast<oatpp::data::stream::OutputStreamBufferedProxy*>(stream);
+  if(proxy != nullptr) {
+    auto connection = dynamic_cast<oatpp::network::Connection*>(proxy->getOutputStream().get());
+    if(connection != nullptr && flush) {
+      proxy->flush();
+    }
+    return connection;
+  }
+  return dynamic_cast<oatpp::network::Connection*>(stream);
+}
+
+bool FileBody::waitWritable(oatpp::network::Connection* connection) {
+
+#if defined(__linux__)
+
+  /* EAGAIN on a blocking socket - SO_SNDTIMEO expired */
+  if(connection->getOutputStreamIOMode() == oatpp::data::stream::IOMode::BLOCKING) {
+    return false;
+  }
+
+  struct pollfd pollEntry;
+  pollEntry.fd = connection->getHandle();
+  pollEntry.events = POLLOUT;
+  pollEntry.revents = 0;
+
+  v_int32 res;
+  do {
+    res = ::poll(&pollEntry, 1, -1);
+  } while(res < 0 && errno == EINTR);
+
+  return res > 0 && (pollEntry.revents & (POLLERR | POLLHUP | POLLNVAL)) == 0;
+
+#else
+
+  (void) connection;
+  return false;
+
+#endif
+
+}
+
+void FileBody::abortConnection(OutputStream* stream) {
+
+  OATPP_LOGE("[oatpp::web::protocol::http::outgoing::FileBody::abortConnection()]", "Error. Body is incomplete. Closing connection.");
+
+  /* Content-Length is already sent - the only way to tell the client that the body is incomplete. */
+  auto connection = getConnection(stream, false);
+  if(connection != nullptr) {
+#if defined(WIN32) || defined(_WIN32)
+    ::shutdown(connection->getHandle(), SD_BOTH);
+#else
+    ::shutdown(connection->getHandle(), SHUT_RDWR);
+#endif
+  }
+
+}
+
+data::v_io_size FileBody::readChunk(p_char8 buffer, v_int64 offset, v_int32 count) {
+#if defined(WIN32) || defined(_WIN32)
+  if(_fseeki64(m_file, offset, SEEK_SET) != 0) {
+    return data::IOError::BROKEN_PIPE;
+  }
+  return (data::v_io_size) std::fread(buffer, 1, count, m_file);
+#else
+  auto res = ::pread(fileno(m_file), buffer, count, (off_t) offset);
+  if(res < 0) {
+    return data::IOError::BROKEN_PIPE;
+  }
+  return res;
+#endif
+}
+
+data::v_io_size FileBody::sendFile(data::v_io_handle handle, v_int64& offset, v_int64 count) {
+
+#if defined(__linux__)
+
+  /* max number of bytes transferred by one sendfile call on Linux */
+  if(count > 0x7ffff000) {
+    count = 0x7ffff000;
+  }
+
+  off_t fileOffset = (off_t) offset;
+  auto res = ::sendfile(handle, fileno(m_file), &fileOffset, (size_t) count);
+
+  if(res > 0) {
+    offset = (v_int64) fileOffset;
+    return res;
+  }
+
+  if(res < 0) {
+    auto e = errno;
+    if(e == EAGAIN || e == EWOULDBLOCK) {
+      return data::IOError::WAIT_RETRY;
+    } else if(e == EINTR) {
+      return data::IOError::RETRY;
+    } else if(e == EPIPE || e == ECONNRESET) {
+      return data::IOError::BROKEN_PIPE;
+    }
+  }
+
+  /* EOF, or sendfile is not supported for this file - copy through buffer */
+  return data::IOError::ZERO_VALUE;
+
+#else
+
+  (void) handle;
+  (void) offset;
+  (void) count;
+  return data::IOError::ZERO_VALUE;
+
+#endif
+
+}
+
+bool FileBody::copyToStream(OutputStream* stream, v_int64 offset, v_int64 count) {
+
+  std::unique_ptr<v_char8[]> buffer(new v_char8[COPY_BUFFER_SIZE]);
+
+  while(count > 0) {
+
+    v_int32 chunkSize = count < COPY_BUFFER_SIZE ? (v_int32) count : COPY_BUFFER_SIZE;
+    auto res = readChunk(buffer.get(), offset, chunkSize);
+    if(res <= 0) {
+      OATPP_LOGE("[oatpp::web::protocol::http::outgoing::FileBody::copyToStream()]", "Error. Can't read file.");
+      return false;
+    }
+
+    if(oatpp::data::stream::writeExactSizeData(stream, buffer.get(), res) != res) {
+      return false;
+    }
+
+    offset += res;
+    count -= res;
+
+  }
+
+  return true;
+
+}
+
+void FileBody::writeToStream(OutputStream* stream) noexcept {
+
+  v_int64 offset = m_offset;
+  v_int64 bytesLeft = m_size;
+
+  auto connection = getConnection(stream, true);
+
+  if(connection != nullptr) {
+
+    while(bytesLeft > 0) {
+
+      auto res = sendFile(connection->getHandle(), offset, bytesLeft);
+
+      if(res > 0) {
+        bytesLeft -= res;
+      } else if(res == data::IOError::RETRY) {
+        continue;
+      } else if(res == data::IOError::WAIT_RETRY) {
+        if(!waitWritable(connection)) {
+          abortConnection(stream);
+          return;
+        }
+      } else if(res == data::IOError::ZERO_VALUE) {
+        break; // EOF - file was truncated, or sendfile is not supported. Let copyToStream() decide.
+      } else {
+        abortConnection(stream);
+        return;
+      }
+
+    }
+
+  }
+
+  if(bytesLeft > 0 && !copyToStream(stream, offset, bytesLeft)) {
+    abortConnection(stream);
+  }
+
+}
+
+FileBody::WriteToStreamCoroutine::WriteToStreamCoroutine(const std::shared_ptr<FileBody>& body,
+                                                         const std::shared_ptr<OutputStream>& stream)
+  : m_body(body)
+  , m_stream(stream)
+  , m_connection(nullptr)
+  , m_offset(body->m_offset)
+  , m_bytesLeft(body->m_size)
+{}
+
+async::Action FileBody::WriteToStreamCoroutine::act() {
+  auto proxy = dynamic_cast<oatpp::data::stream::OutputStreamBufferedProxy*>(m_stream.get());
+  if(proxy != nullptr && dynamic_cast<oatpp::network::Connection*>(proxy->getOutputStream().get()) != nullptr) {
+    return proxy->flushAsync().next(yieldTo(&WriteToStreamCoroutine::selectTarget));
+  }
+  return yieldTo(&WriteToStreamCoroutine::selectTarget);
+}
+
+async::Action FileBody::WriteToStreamCoroutine::selectTarget() {
+  m_connection = getConnection(m_stream.get(), false);
+  if(m_connection != nullptr) {
+    return yieldTo(&WriteToStreamCoroutine::sendFile);
+  }
+  return yieldTo(&WriteToStreamCoroutine::readChunk);
+}
+
+async::Action FileBody::WriteToStreamCoroutine::sendFile() {
+
+  if(m_bytesLeft == 0) {
+    return finish();
+  }
+
+  auto res = m_body->sendFile(m_connection->getHandle(), m_offset, m_bytesLeft);
+
+  if(res > 0) {
+    m_bytesLeft -= res;
+    return m_connection->suggestOutputStreamAction(res);
+  } else if(res == data::IOError::RETRY || res == data::IOError::WAIT_RETRY) {
+    return m_connection->suggestOutputStreamAction(res);
+  } else if(res == data::IOError::ZERO_VALUE) {
+    return yieldTo(&WriteToStreamCoroutine::readChunk);
+  }
+
+  return error(oatpp::data::AsyncIOError::ERROR_BROKEN_PIPE);
+
+}
+
+async::Action FileBody::WriteToStreamCoroutine::readChunk() {
+
+  if(m_bytesLeft == 0) {
+    return finish();
+  }
+
+  if(!m_buffer) {
+    m_buffer.reset(new v_char8[COPY_BUFFER_SIZE]);
+  }
+
+  v_int32 chunkSize = m_bytesLeft < COPY_BUFFER_SIZE ? (v_int32) m_bytesLeft : COPY_BUFFER_SIZE;
+  auto res = m_body->readChunk(m_buffer.get(), m_offset, chunkSize);
+  if(res <= 0) {
+    return error<Error>("[oatpp::web::protocol::http::outgoing::FileBody::WriteToStreamCoroutine::readChunk()]: Error. Can't read file.");
+  }
+
+  m_offset += res;
+  m_bytesLeft -= res;
+  m_inlineData.set(m_buffer.get(), res);
+
+  return yieldTo(&WriteToStreamCoroutine::writeChunk);
+
+}
+
+async::Action FileBody::WriteToStreamCoroutine::writeChunk() {
+  return oatpp::data::stream::writeExactSizeDataAsyncInline(this, m_stream.get(), m_inlineData, yieldTo(&WriteToStreamCoroutine::readChunk));
+}
+
+oatpp::async::CoroutineStarter FileBody::writeToStreamAsync(const std::shared_ptr<OutputStream>& stream) {
+  return WriteToStreamCoroutine::start(shared_from_this(), stream);
+}
+
+}}}}}
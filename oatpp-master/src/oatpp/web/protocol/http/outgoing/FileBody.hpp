@@ -0,0 +1,210 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_web_protocol_http_outgoing_FileBody_hpp
+#define oatpp_web_protocol_http_outgoing_FileBody_hpp
+
+#include "./Body.hpp"
+#include "./Response.hpp"
+
+#include "oatpp/network/Connection.hpp"
+
+#include <cstdio>
+
+namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+/**
+ * Implementation of &id:oatpp::web::protocol::http::outgoing::Body; class.
+ * Uses file (or a part of the file) as data source for http body. <br>
+ * When body is written to &id:oatpp::network::Connection; (directly or through
+ * &id:oatpp::data::stream::OutputStreamBufferedProxy;) on Linux, data is transferred with `sendfile(2)`
+ * without copying it to user space. For other streams file is copied through the buffer.
+ */
+class FileBody : public oatpp::base::Countable, public Body, public std::enable_shared_from_this<FileBody> {
+public:
+  OBJECT_POOL(Http_Outgoing_FileBody_Pool, FileBody, 32)
+  SHARED_OBJECT_POOL(Shared_Http_Outgoing_FileBody_Pool, FileBody, 32)
+public:
+  /**
+   * Size of the chunk used to copy file when `sendfile` is not applicable.
+   */
+  static constexpr v_int32 COPY_BUFFER_SIZE = 65536;
+private:
+
+  enum class RangeResult : v_int32 {
+    NONE = 0,
+    SATISFIABLE = 1,
+    UNSATISFIABLE = 2
+  };
+
+private:
+  static RangeResult resolveRange(const oatpp::data::share::StringKeyLabel& header, v_int64 fileSize, v_int64& start, v_int64& end);
+  static bool matchETag(const oatpp::data::share::StringKeyLabel& header, const oatpp::String& etag);
+  static oatpp::String formatHttpDate(v_int64 time);
+  static bool parseHttpDate(const oatpp::data::share::StringKeyLabel& date, v_int64& time);
+  static oatpp::network::Connection* getConnection(OutputStream* stream, bool flush);
+  static bool waitWritable(oatpp::network::Connection* connection);
+  static void abortConnection(OutputStream* stream);
+private:
+  std::FILE* m_file;
+  bool m_ownsFile;
+  v_int64 m_fileSize;
+  v_int64 m_modifiedTime;
+  v_int64 m_offset;
+  v_int64 m_size;
+private:
+  data::v_io_size readChunk(p_char8 buffer, v_int64 offset, v_int32 count);
+  data::v_io_size sendFile(data::v_io_handle handle, v_int64& offset, v_int64 count);
+  bool copyToStream(OutputStream* stream, v_int64 offset, v_int64 count);
+public:
+
+  /**
+   * Constructor. Throws `std::runtime_error` if file is not a regular file.
+   * @param file - opened file.
+   * @param ownsFile - if `true` file is closed in destructor (or in constructor if it throws).
+   */
+  FileBody(std::FILE* file, bool ownsFile);
+
+  /**
+   * Constructor. Throws `std::runtime_error` if file can't be opened or is not a regular file.
+   * @param filename - path to file.
+   */
+  FileBody(const char* filename);
+
+  /**
+   * Non-virtual destructor. Closes file if owns it.
+   */
+  ~FileBody();
+
+public:
+
+  /**
+   * Create shared FileBody.
+   * @param filename - path to file.
+   * @return - `std::shared_ptr` to FileBody.
+   */
+  static std::shared_ptr<FileBody> createShared(const char* filename);
+
+  /**
+   * Create response for the file taking into account request headers. <br>
+   * <ul>
+   *   <li>`If-None-Match` matching file `ETag`, or `If-Modified-Since` not earlier than file modification time results in `304 Not Modified`.
+   *   `If-Modified-Since` is ignored if `If-None-Match` is present or if the date can't be parsed.</li>
+   *   <li>Satisfiable single range in `Range` header results in `206 Partial Content` with `Content-Range` header.</li>
+   *   <li>Unsatisfiable range results in `416 Requested Range Not Satisfiable`.</li>
+   *   <li>Otherwise `200 OK` with the whole file.</li>
+   * </ul>
+   * `ETag`, `Last-Modified` and `Accept-Ranges` headers are set for all responses.
+   * @param filename - path to file.
+   * @param requestHeaders - headers of the incoming request.
+   * @return - `std::shared_ptr` to &id:oatpp::web::protocol::http::outgoing::Response; or `nullptr` if file can't be opened
+   * or is not a regular file.
+   */
+  static std::shared_ptr<Response> createResponse(const char* filename, const Headers& requestHeaders);
+
+  /**
+   * Limit body to the part of the file.
+   * @param offset - offset of the first byte.
+   * @param size - number of bytes.
+   */
+  void setRange(v_int64 offset, v_int64 size);
+
+  /**
+   * Get size of the whole file.
+   * @return - size of the file in bytes.
+   */
+  v_int64 getFileSize() const;
+
+  /**
+   * Get time of the last modification of the file.
+   * @return - seconds since epoch.
+   */
+  v_int64 getModifiedTime() const;
+
+  /**
+   * Get weak `ETag` of the file - built from file size and modification time.
+   * @return - &id:oatpp::String;.
+   */
+  oatpp::String getETag() const;
+
+  /**
+   * Declare `Content-Length` header.
+   * @param headers - &id:oatpp::web::protocol::http::Headers;.
+   */
+  void declareHeaders(Headers& headers) noexcept override;
+
+  /**
+   * Write file data to stream. <br>
+   * If the whole body can't be written (file was truncated, write timed out) the connection is shut down -
+   * `Content-Length` is already sent and the connection can't be reused.
+   * @param stream - pointer to &id:oatpp::data::stream::OutputStream;.
+   */
+  void writeToStream(OutputStream* stream) noexcept override;
+
+public:
+
+  /**
+   * Coroutine used to write &l:FileBody; to &id:oatpp::data::stream::OutputStream;.
+   */
+  class WriteToStreamCoroutine : public oatpp::async::Coroutine<WriteToStreamCoroutine> {
+  private:
+    std::shared_ptr<FileBody> m_body;
+    std::shared_ptr<OutputStream> m_stream;
+    oatpp::network::Connection* m_connection;
+    v_int64 m_offset;
+    v_int64 m_bytesLeft;
+    std::unique_ptr<v_char8[]> m_buffer;
+    oatpp::data::stream::AsyncInlineWriteData m_inlineData;
+  public:
+
+    /**
+     * Constructor.
+     * @param body - &l:FileBody;.
+     * @param stream - &id:oatpp::data::stream::OutputStream;.
+     */
+    WriteToStreamCoroutine(const std::shared_ptr<FileBody>& body, const std::shared_ptr<OutputStream>& stream);
+
+    Action act() override;
+    Action selectTarget();
+    Action sendFile();
+    Action readChunk();
+    Action writeChunk();
+
+  };
+
+public:
+
+  /**
+   * Start &l:FileBody::WriteToStreamCoroutine; to write file data to stream.
+   * @param stream - &id:oatpp::data::stream::OutputStream;.
+   * @return - &id:oatpp::async::CoroutineStarter;.
+   */
+  oatpp::async::CoroutineStarter writeToStreamAsync(const std::shared_ptr<OutputStream>& stream) override;
+
+};
+
+}}}}}
+
+#endif /* oatpp_web_protocol_http_outgoing_FileBody_hpp */
@@ -24,7 +24,9 @@
 
 #include "./Response.hpp"
 
-#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+#include <cstring>
 
 namespace oatpp { namespace web { namespace protocol { namespace http { namespace outgoing {
 
@@ -47,6 +49,14 @@ protocol::http::Headers& Response::getHeaders() {
   return m_headers;
 }
 
+std::shared_ptr<Body> Response::getBody() const {
+  return m_body;
+}
+
+void Response::setBody(const std::shared_ptr<Body>& body) {
+  m_body = body;
+}
+
 void Response::putHeader(const oatpp::data::share::StringKeyLabelCI_FAST& key, const oatpp::data::share::StringKeyLabel& value) {
   m_headers[key] = value;
 }
@@ -76,35 +86,103 @@ std::shared_ptr<const Response::ConnectionHandler::ParameterMap> Response::getCo
   return m_connectionUpgradeParameters;
 }
 
-void Response::send(data::stream::OutputStream* stream) {
-  
+v_int32 Response::getStatusDescriptionSize() const {
+  if(m_status.description == nullptr) {
+    return 0;
+  }
+  return (v_int32) std::strlen(m_status.description);
+}
+
+v_int32 Response::prepareHeadersSection() {
+
   if(m_body){
     m_body->declareHeaders(m_headers);
   } else {
     m_headers[Header::CONTENT_LENGTH] = "0";
   }
 
-  oatpp::data::stream::ChunkedBuffer buffer;
+  v_char8 code[16];
+  v_int32 size = 9 + utils::conversion::int32ToCharSequence(m_status.code, code, 16) + 1 + getStatusDescriptionSize() + 2;
 
-  buffer.write("HTTP/1.1 ", 9);
-  buffer.writeAsString(m_status.code);
-  buffer.write(" ", 1);
-  buffer.OutputStream::write(m_status.description);
-  buffer.write("\r\n", 2);
-  
-  auto it = m_headers.begin();
-  while(it != m_headers.end()) {
-    buffer.write(it->first.getData(), it->first.getSize());
-    buffer.write(": ", 2);
-    buffer.write(it->second.getData(), it->second.getSize());
-    buffer.write("\r\n", 2);
-    it ++;
+  for(auto& pair : m_headers) {
+    size += pair.first.getSize() + 2 + pair.second.getSize() + 2;
+  }
+
+  return size + 2;
+
+}
+
+void Response::writeHeadersSection(p_char8 buffer) {
+
+  v_int32 pos = 0;
+
+  std::memcpy(&buffer[pos], "HTTP/1.1 ", 9);
+  pos += 9;
+  pos += utils::conversion::int32ToCharSequence(m_status.code, &buffer[pos], 16);
+  buffer[pos ++] = ' ';
+  v_int32 descriptionSize = getStatusDescriptionSize();
+  std::memcpy(&buffer[pos], m_status.description, descriptionSize);
+  pos += descriptionSize;
+  buffer[pos ++] = '\r';
+  buffer[pos ++] = '\n';
+
+  for(auto& pair : m_headers) {
+    std::memcpy(&buffer[pos], pair.first.getData(), pair.first.getSize());
+    pos += pair.first.getSize();
+    buffer[pos ++] = ':';
+    buffer[pos ++] = ' ';
+    std::memcpy(&buffer[pos], pair.second.getData(), pair.second.getSize());
+    pos += pair.second.getSize();
+    buffer[pos ++] = '\r';
+    buffer[pos ++] = '\n';
   }
 
-  buffer.write("\r\n", 2);
-  buffer.flushToStream(stream);
+  buffer[pos ++] = '\r';
+  buffer[pos ++] = '\n';
+
+}
+
+v_int32 Response::prepareIOVectors(p_char8 headersSection, v_int32 headersSectionSize, data::stream::IOVector* vectors) {
+
+  vectors[0].data = headersSection;
+  vectors[0].size = headersSectionSize;
+
   if(m_body) {
+    p_char8 bodyData = m_body->getKnownData();
+    if(bodyData != nullptr) {
+      vectors[1].data = bodyData;
+      vectors[1].size = m_body->getKnownSize();
+      return 2;
+    }
+  }
+
+  return 1;
+
+}
+
+void Response::send(data::stream::OutputStream* stream) {
+
+  v_int32 headersSectionSize = prepareHeadersSection();
+
+  v_char8 stackBuffer[HEADERS_STACK_BUFFER_SIZE];
+  oatpp::String heapBuffer;
+  p_char8 headersSection = stackBuffer;
+  if(headersSectionSize > HEADERS_STACK_BUFFER_SIZE) {
+    heapBuffer = oatpp::String(headersSectionSize);
+    headersSection = heapBuffer->getData();
+  }
+
+  writeHeadersSection(headersSection);
+
+  data::stream::IOVector vectors[2];
+  v_int32 count = prepareIOVectors(headersSection, headersSectionSize, vectors);
+
+  if(m_body && count == 1) {
+    /* Body is not in memory - headers go to the (buffered) stream to be sent together with the beginning of the body. */
+    data::stream::writeExactSizeData(stream, headersSection, headersSectionSize);
     m_body->writeToStream(stream);
+  } else {
+    data::stream::writeExactSizeVectored(stream, vectors, count);
   }
   
 }
@@ -115,47 +193,49 @@ oatpp::async::CoroutineStarter Response::sendAsync(const std::shared_ptr<data::s
   private:
     std::shared_ptr<Response> m_response;
     std::shared_ptr<data::stream::OutputStream> m_stream;
-    std::shared_ptr<oatpp::data::stream::ChunkedBuffer> m_buffer;
+    oatpp::String m_headersSection;
+    data::stream::IOVector m_vectors[2];
+    v_int32 m_vectorsCount;
+    data::stream::AsyncInlineWriteVectoredData m_inlineData;
+    data::stream::AsyncInlineWriteData m_inlineHeaders;
   public:
     
     SendAsyncCoroutine(const std::shared_ptr<Response>& response,
                        const std::shared_ptr<data::stream::OutputStream>& stream)
       : m_response(response)
       , m_stream(stream)
-      , m_buffer(oatpp::data::stream::ChunkedBuffer::createShared())
+      , m_vectorsCount(0)
     {}
     
     Action act() override {
-    
-      if(m_response->m_body){
-        m_response->m_body->declareHeaders(m_response->m_headers);
-      } else {
-        m_response->m_headers[Header::CONTENT_LENGTH] = "0";
+
+      v_int32 headersSectionSize = m_response->prepareHeadersSection();
+      m_headersSection = oatpp::String(headersSectionSize);
+      m_response->writeHeadersSection(m_headersSection->getData());
+
+      m_vectorsCount = m_response->prepareIOVectors(m_headersSection->getData(), headersSectionSize, m_vectors);
+
+      if(m_response->m_body && m_vectorsCount == 1) {
+        /* Body is not in memory - headers go to the (buffered) stream to be sent together with the beginning of the body. */
+        m_inlineHeaders.set(m_headersSection->getData(), headersSectionSize);
+        return yieldTo(&SendAsyncCoroutine::writeHeaders);
       }
-      
-      m_buffer->write("HTTP/1.1 ", 9);
-      m_buffer->writeAsString(m_response->m_status.code);
-      m_buffer->write(" ", 1);
-      m_buffer->OutputStream::write(m_response->m_status.description);
-      m_buffer->write("\r\n", 2);
-
-      http::Utils::writeHeaders(m_response->m_headers, m_buffer.get());
-      
-      m_buffer->write("\r\n", 2);
-      
-      return yieldTo(&SendAsyncCoroutine::writeHeaders);
+
+      m_inlineData.set(m_vectors, m_vectorsCount);
+      return yieldTo(&SendAsyncCoroutine::writeVectored);
     
     }
     
     Action writeHeaders() {
-      return m_buffer->flushToStreamAsync(m_stream).next(yieldTo(&SendAsyncCoroutine::writeBody));
+      return data::stream::writeExactSizeDataAsyncInline(this, m_stream.get(), m_inlineHeaders, yieldTo(&SendAsyncCoroutine::writeBody));
+    }
+
+    Action writeVectored() {
+      return data::stream::writeExactSizeVectoredAsyncInline(this, m_stream.get(), m_inlineData, finish());
     }
     
     Action writeBody() {
-      if(m_response->m_body) {
-        return m_response->m_body->writeToStreamAsync(m_stream).next(finish());
-      }
-      return finish();
+      return m_response->m_body->writeToStreamAsync(m_stream).next(finish());
     }
     
   };
@@ -56,6 +56,13 @@ private:
   std::shared_ptr<Body> m_body;
   std::shared_ptr<ConnectionHandler> m_connectionUpgradeHandler;
   std::shared_ptr<const ConnectionHandler::ParameterMap> m_connectionUpgradeParameters;
+private:
+  static constexpr v_int32 HEADERS_STACK_BUFFER_SIZE = 1024;
+private:
+  v_int32 getStatusDescriptionSize() const;
+  v_int32 prepareHeadersSection();
+  void writeHeadersSection(p_char8 buffer);
+  v_int32 prepareIOVectors(p_char8 headersSection, v_int32 headersSectionSize, data::stream::IOVector* vectors);
 public:
   /**
    * Constructor.
@@ -85,6 +92,18 @@ public:
    */
   Headers& getHeaders();
 
+  /**
+   * Get body.
+   * @return - &id:oatpp::web::protocol::http::outgoing::Body;.
+   */
+  std::shared_ptr<Body> getBody() const;
+
+  /**
+   * Replace body. Ex.: wrap body with encoding body in &id:oatpp::web::server::handler::ResponseInterceptor;.
+   * @param body - &id:oatpp::web::protocol::http::outgoing::Body;.
+   */
+  void setBody(const std::shared_ptr<Body>& body);
+
   /**
    * Add http header.
    * @param key - &id:oatpp::data::share::StringKeyLabelCI_FAST;.
@@ -128,7 +147,10 @@ public:
   std::shared_ptr<const ConnectionHandler::ParameterMap> getConnectionUpgradeParameters();
 
   /**
-   * Write this Response to stream.
+   * Write this Response to stream. <br>
+   * Headers section and in-memory body (see &id:oatpp::web::protocol::http::outgoing::Body::getKnownData;) are written
+   * in one vectored write - &id:oatpp::data::stream::OutputStream::writeVectored;. <br>
+   * Otherwise headers are written with a regular write, so that a buffered stream sends them together with the body.
    * @param stream - pointer to &id:oatpp::data::stream::OutputStream;.
    */
   void send(data::stream::OutputStream* stream);
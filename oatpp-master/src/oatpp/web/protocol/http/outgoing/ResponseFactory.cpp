@@ -43,8 +43,9 @@ ResponseFactory::createResponse(const Status& status, const std::shared_ptr<oatp
 std::shared_ptr<Response>
 ResponseFactory::createResponse(const Status& status,
                                 const oatpp::data::mapping::type::AbstractObjectWrapper& dto,
-                                oatpp::data::mapping::ObjectMapper* objectMapper) {
-  return Response::createShared(status, DtoBody::createShared(dto, objectMapper));
+                                oatpp::data::mapping::ObjectMapper* objectMapper,
+                                bool streaming) {
+  return Response::createShared(status, DtoBody::createShared(dto, objectMapper, false, streaming));
 }
 
   
@@ -60,11 +60,13 @@ public:
    * @param status - &id:oatpp::web::protocol::http::Status;.
    * @param dto - see [Data Transfer Object (DTO)](https://oatpp.io/docs/components/dto/).
    * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper;.
+   * @param streaming - serialize DTO while sending. See &id:oatpp::web::protocol::http::outgoing::DtoBody::DtoBody;.
    * @return - `std::shared_ptr` to &id:oatpp::web::protocol::http::outgoing::Response;.
    */
   static std::shared_ptr<Response> createResponse(const Status& status,
                                                   const oatpp::data::mapping::type::AbstractObjectWrapper& dto,
-                                                  oatpp::data::mapping::ObjectMapper* objectMapper);
+                                                  oatpp::data::mapping::ObjectMapper* objectMapper,
+                                                  bool streaming = false);
   
 };
   
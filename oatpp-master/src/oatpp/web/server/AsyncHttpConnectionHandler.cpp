@@ -61,10 +61,21 @@ void AsyncHttpConnectionHandler::setErrorHandler(const std::shared_ptr<handler::
   }
 }
 
+void AsyncHttpConnectionHandler::setBodyDecoder(const std::shared_ptr<const BodyDecoder>& bodyDecoder) {
+  m_bodyDecoder = bodyDecoder;
+  if(!m_bodyDecoder) {
+    m_bodyDecoder = std::make_shared<oatpp::web::protocol::http::incoming::SimpleBodyDecoder>();
+  }
+}
+
 void AsyncHttpConnectionHandler::addRequestInterceptor(const std::shared_ptr<handler::RequestInterceptor>& interceptor) {
   m_requestInterceptors.pushBack(interceptor);
 }
 
+void AsyncHttpConnectionHandler::addResponseInterceptor(const std::shared_ptr<handler::ResponseInterceptor>& interceptor) {
+  m_responseInterceptors.pushBack(interceptor);
+}
+
 void AsyncHttpConnectionHandler::handleConnection(const std::shared_ptr<IOStream>& connection,
                                                   const std::shared_ptr<const ParameterMap>& params)
 {
@@ -74,14 +85,16 @@ void AsyncHttpConnectionHandler::handleConnection(const std::shared_ptr<IOStream
   connection->setOutputStreamIOMode(oatpp::data::stream::IOMode::NON_BLOCKING);
   connection->setInputStreamIOMode(oatpp::data::stream::IOMode::NON_BLOCKING);
   
+  /* input keeps bytes of pipelined requests while responses are written - buffers can't be shared */
   auto ioBuffer = oatpp::data::buffer::IOBuffer::createShared();
-  auto outStream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(connection, ioBuffer);
+  auto outStream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(connection, oatpp::data::buffer::IOBuffer::createShared());
   auto inStream = oatpp::data::stream::InputStreamBufferedProxy::createShared(connection, ioBuffer);
   
   m_executor->execute<HttpProcessor::Coroutine>(m_router.get(),
                                                 m_bodyDecoder,
                                                 m_errorHandler,
                                                 &m_requestInterceptors,
+                                                &m_responseInterceptors,
                                                 connection,
                                                 ioBuffer,
                                                 outStream,
@@ -51,7 +51,8 @@ private:
   std::shared_ptr<HttpRouter> m_router;
   std::shared_ptr<handler::ErrorHandler> m_errorHandler;
   HttpProcessor::RequestInterceptors m_requestInterceptors;
-  std::shared_ptr<const BodyDecoder> m_bodyDecoder; // TODO make bodyDecoder configurable here
+  HttpProcessor::ResponseInterceptors m_responseInterceptors;
+  std::shared_ptr<const BodyDecoder> m_bodyDecoder;
 public:
   AsyncHttpConnectionHandler(const std::shared_ptr<HttpRouter>& router, v_int32 threadCount = THREAD_NUM_DEFAULT);
   AsyncHttpConnectionHandler(const std::shared_ptr<HttpRouter>& router, const std::shared_ptr<oatpp::async::Executor>& executor);
@@ -64,8 +65,12 @@ public:
                                                                   const std::shared_ptr<oatpp::async::Executor>& executor);
   
   void setErrorHandler(const std::shared_ptr<handler::ErrorHandler>& errorHandler);
+
+  void setBodyDecoder(const std::shared_ptr<const BodyDecoder>& bodyDecoder);
   
   void addRequestInterceptor(const std::shared_ptr<handler::RequestInterceptor>& interceptor);
+
+  void addResponseInterceptor(const std::shared_ptr<handler::ResponseInterceptor>& interceptor);
   
   void handleConnection(const std::shared_ptr<IOStream>& connection, const std::shared_ptr<const ParameterMap>& params) override;
 
@@ -31,18 +31,486 @@
 
 #include "oatpp/core/concurrency/Thread.hpp"
 
+#include <unordered_set>
+#include <limits>
+#include <mutex>
+#include <cstring>
+
+#if defined(__linux__) || defined(linux) || defined(__linux)
+  #define OATPP_HTTP_CONNECTION_HANDLER_EPOLL
+  #include <sys/epoll.h>
+  #include <sys/eventfd.h>
+  #include <poll.h>
+  #include <sys/socket.h>
+  #include <sys/time.h>
+  #include <unistd.h>
+#endif
+
 namespace oatpp { namespace web { namespace server {
 
+namespace {
+
+/* Set thread affinity group CPUs [0..cpu_count - 1]. Leave one cpu free of workers */
+void setWorkerThreadAffinity(std::thread& thread) {
+
+  /* Get hardware concurrency -1 in order to have 1cpu free of workers. */
+  v_int32 concurrency = oatpp::concurrency::getHardwareConcurrency();
+  if(concurrency > 1) {
+    concurrency -= 1;
+  }
+
+  oatpp::concurrency::setThreadAffinityToCpuRange(thread.native_handle(), 0, concurrency - 1 /* -1 because 0-based index */);
+
+}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// HttpConnectionHandler::WorkerPool
+
+/**
+ * Fixed set of threads sharing one epoll instance. <br>
+ * Connections are registered with `EPOLLONESHOT` so that only one worker picks up a readable connection.
+ * Worker processes requests available on the connection and re-arms the connection if it should be kept alive. <br>
+ * Input buffer lives with the connection so that bytes of a partially received pipelined request are not lost. <br>
+ * Each request has to be received within `readTimeout` in total - a client which stops sending, or sends
+ * the request byte by byte, is dropped when the deadline expires. Writes are limited by `SO_SNDTIMEO` -
+ * a client which stops reading the response is dropped as well (&id:oatpp::network::Connection; reports
+ * an expired timeout of a blocking socket as an error). Neither can pin the worker.
+ */
+class HttpConnectionHandler::WorkerPool {
+private:
+
+  /**
+   * Input stream of the parked connection. <br>
+   * Reads stop at the request deadline - `SO_RCVTIMEO` covers the first read of the request,
+   * the following reads wait for the remaining time only. Expired deadline is reported as a broken pipe
+   * so that readers don't retry and the connection is dropped.
+   */
+  class TimedInputStream : public oatpp::data::stream::InputStream {
+  private:
+    std::shared_ptr<oatpp::data::stream::IOStream> m_connection;
+    oatpp::data::v_io_handle m_handle;
+    std::chrono::steady_clock::time_point m_deadline;
+    bool m_waitReadable;
+  public:
+
+    TimedInputStream(const std::shared_ptr<oatpp::data::stream::IOStream>& connection, oatpp::data::v_io_handle handle)
+      : m_connection(connection)
+      , m_handle(handle)
+      , m_waitReadable(false)
+    {}
+
+    void setDeadline(const std::chrono::steady_clock::time_point& deadline) {
+      m_deadline = deadline;
+      m_waitReadable = false;
+    }
+
+    data::v_io_size read(void *data, data::v_io_size count) override;
+
+    oatpp::async::Action suggestInputStreamAction(data::v_io_size ioResult) override {
+      return m_connection->suggestInputStreamAction(ioResult);
+    }
+
+    void setInputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+      m_connection->setInputStreamIOMode(ioMode);
+    }
+
+    oatpp::data::stream::IOMode getInputStreamIOMode() override {
+      return m_connection->getInputStreamIOMode();
+    }
+
+  };
+
+  struct Entry {
+    std::shared_ptr<oatpp::data::stream::IOStream> connection;
+    oatpp::data::v_io_handle handle;
+    std::shared_ptr<TimedInputStream> timedInput;
+    /* connection with timed reads - used to read requests. Responses are written to the connection directly. */
+    std::shared_ptr<oatpp::data::stream::IOStream> timedConnection;
+    std::shared_ptr<oatpp::data::buffer::IOBuffer> inBuffer;
+    std::shared_ptr<oatpp::data::stream::InputStreamBufferedProxy> inStream;
+  };
+
+private:
+  HttpConnectionHandler* m_handler;
+  std::chrono::duration<v_int64, std::micro> m_readTimeout;
+  std::atomic<bool> m_running;
+  oatpp::data::v_io_handle m_eventQueue;
+  oatpp::data::v_io_handle m_wakeupTrigger;
+  std::vector<std::thread> m_threads;
+  std::mutex m_entriesMutex;
+  std::unordered_set<Entry*> m_entries;
+private:
+  void run();
+  bool processRequest(Entry* entry);
+  bool arm(Entry* entry, int operation);
+  void drop(Entry* entry);
+  bool setTimeouts(oatpp::data::v_io_handle handle, const std::chrono::duration<v_int64, std::micro>& timeout);
+public:
+
+  static bool isSupported();
+
+  WorkerPool(HttpConnectionHandler* handler, v_int32 workersCount, const std::chrono::duration<v_int64, std::micro>& readTimeout);
+  ~WorkerPool();
+
+  /**
+   * Park connection until it becomes readable.
+   * @param connection
+   * @return - `false` if connection can't be parked (not an &id:oatpp::network::Connection;, or pool is stopped).
+   */
+  bool park(const std::shared_ptr<oatpp::data::stream::IOStream>& connection);
+
+  void stop();
+
+};
+
+#if defined(OATPP_HTTP_CONNECTION_HANDLER_EPOLL)
+
+bool HttpConnectionHandler::WorkerPool::isSupported() {
+  return true;
+}
+
+HttpConnectionHandler::WorkerPool::WorkerPool(HttpConnectionHandler* handler, v_int32 workersCount, const std::chrono::duration<v_int64, std::micro>& readTimeout)
+  : m_handler(handler)
+  , m_readTimeout(readTimeout)
+  , m_running(true)
+{
+
+  m_eventQueue = ::epoll_create1(0);
+  if(m_eventQueue == -1) {
+    OATPP_LOGE("[oatpp::web::server::HttpConnectionHandler::WorkerPool::WorkerPool()]", "Error. Call to ::epoll_create1() failed. errno=%d", errno);
+    throw std::runtime_error("[oatpp::web::server::HttpConnectionHandler::WorkerPool::WorkerPool()]: Error. Call to ::epoll_create1() failed.");
+  }
+
+  m_wakeupTrigger = ::eventfd(0, EFD_NONBLOCK);
+  if(m_wakeupTrigger == -1) {
+    ::close(m_eventQueue);
+    OATPP_LOGE("[oatpp::web::server::HttpConnectionHandler::WorkerPool::WorkerPool()]", "Error. Call to ::eventfd() failed. errno=%d", errno);
+    throw std::runtime_error("[oatpp::web::server::HttpConnectionHandler::WorkerPool::WorkerPool()]: Error. Call to ::eventfd() failed.");
+  }
+
+  // Level-triggered and never read - once triggered wakes all workers.
+  struct epoll_event event;
+  std::memset(&event, 0, sizeof(struct epoll_event));
+  event.events = EPOLLIN;
+  event.data.ptr = nullptr;
+  ::epoll_ctl(m_eventQueue, EPOLL_CTL_ADD, m_wakeupTrigger, &event);
+
+  for(v_int32 i = 0; i < workersCount; i ++) {
+    m_threads.push_back(std::thread(&WorkerPool::run, this));
+    setWorkerThreadAffinity(m_threads.back());
+  }
+
+}
+
+HttpConnectionHandler::WorkerPool::~WorkerPool() {
+  stop();
+  ::close(m_wakeupTrigger);
+  ::close(m_eventQueue);
+}
+
+bool HttpConnectionHandler::WorkerPool::arm(Entry* entry, int operation) {
+
+  struct epoll_event event;
+  std::memset(&event, 0, sizeof(struct epoll_event));
+  event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+  event.data.ptr = entry;
+
+  if(::epoll_ctl(m_eventQueue, operation, entry->handle, &event) == -1) {
+    OATPP_LOGE("[oatpp::web::server::HttpConnectionHandler::WorkerPool::arm()]", "Error. Call to epoll_ctl failed. operation=%d, errno=%d", operation, errno);
+    return false;
+  }
+
+  return true;
+
+}
+
+void HttpConnectionHandler::WorkerPool::drop(Entry* entry) {
+  ::epoll_ctl(m_eventQueue, EPOLL_CTL_DEL, entry->handle, nullptr);
+  {
+    std::lock_guard<std::mutex> lock(m_entriesMutex);
+    m_entries.erase(entry);
+  }
+  delete entry;
+}
+
+data::v_io_size HttpConnectionHandler::WorkerPool::TimedInputStream::read(void *data, data::v_io_size count) {
+
+  if(m_waitReadable && m_deadline != std::chrono::steady_clock::time_point::max()) {
+
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(m_deadline - std::chrono::steady_clock::now()).count();
+    if(remaining <= 0) {
+      return data::IOError::BROKEN_PIPE;
+    }
+    if(remaining > std::numeric_limits<int>::max()) {
+      remaining = std::numeric_limits<int>::max();
+    }
+
+    struct pollfd pollEntry;
+    pollEntry.fd = m_handle;
+    pollEntry.events = POLLIN;
+    pollEntry.revents = 0;
+
+    auto res = ::poll(&pollEntry, 1, (int) remaining);
+    if(res == 0) {
+      return data::IOError::BROKEN_PIPE; // deadline expired
+    } else if(res < 0) {
+      return errno == EINTR ? data::IOError::RETRY : data::IOError::BROKEN_PIPE;
+    }
+
+  }
+
+  m_waitReadable = true;
+
+  auto res = m_connection->read(data, count);
+  if(res == data::IOError::WAIT_RETRY) {
+    return data::IOError::BROKEN_PIPE;
+  }
+  return res;
+
+}
+
+bool HttpConnectionHandler::WorkerPool::setTimeouts(oatpp::data::v_io_handle handle, const std::chrono::duration<v_int64, std::micro>& timeout) {
+
+  auto micros = std::chrono::duration_cast<std::chrono::microseconds>(timeout).count();
+
+  struct timeval tv;
+  tv.tv_sec = (time_t) (micros / 1000000);
+  tv.tv_usec = (suseconds_t) (micros % 1000000);
+
+  if(::setsockopt(handle, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) != 0 ||
+     ::setsockopt(handle, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv)) != 0)
+  {
+    OATPP_LOGE("[oatpp::web::server::HttpConnectionHandler::WorkerPool::setTimeouts()]", "Error. Call to setsockopt failed. errno=%d", errno);
+    return false;
+  }
+
+  return true;
+
+}
+
+bool HttpConnectionHandler::WorkerPool::park(const std::shared_ptr<oatpp::data::stream::IOStream>& connection) {
+
+  auto networkConnection = dynamic_cast<oatpp::network::Connection*>(connection.get());
+  if(networkConnection == nullptr || !m_running) {
+    return false;
+  }
+
+  if(!setTimeouts(networkConnection->getHandle(), m_readTimeout)) {
+    return false;
+  }
+
+  Entry* entry = new Entry();
+  entry->connection = connection;
+  entry->handle = networkConnection->getHandle();
+  entry->timedInput = std::make_shared<TimedInputStream>(connection, entry->handle);
+  entry->timedConnection = oatpp::data::stream::CompoundIOStream::createShared(connection, entry->timedInput);
+  entry->inBuffer = oatpp::data::buffer::IOBuffer::createShared();
+  entry->inStream = oatpp::data::stream::InputStreamBufferedProxy::createShared(entry->timedInput, entry->inBuffer);
+
+  {
+    std::lock_guard<std::mutex> lock(m_entriesMutex);
+    if(!m_running) { // stop() has already shut down the connections
+      delete entry;
+      return false;
+    }
+    m_entries.insert(entry);
+  }
+
+  if(!arm(entry, EPOLL_CTL_ADD)) {
+    {
+      std::lock_guard<std::mutex> lock(m_entriesMutex);
+      m_entries.erase(entry);
+    }
+    delete entry;
+    return false;
+  }
+
+  return true;
+
+}
+
+void HttpConnectionHandler::WorkerPool::run() {
+
+  struct epoll_event event;
+
+  while(m_running) {
+
+    auto res = ::epoll_wait(m_eventQueue, &event, 1, -1);
+
+    if(res <= 0) {
+      if(res < 0 && errno != EINTR) {
+        OATPP_LOGE("[oatpp::web::server::HttpConnectionHandler::WorkerPool::run()]", "Error. Call to epoll_wait failed. errno=%d", errno);
+        return;
+      }
+      continue;
+    }
+
+    auto entry = (Entry*) event.data.ptr;
+    if(entry == nullptr) {
+      continue; // wakeup trigger
+    }
+
+    bool keepAlive = false;
+    try {
+      keepAlive = processRequest(entry);
+    } catch (std::exception& e) {
+      OATPP_LOGE("[oatpp::web::server::HttpConnectionHandler::WorkerPool::run()]", "Error. Unhandled exception: '%s'. Dropping connection.", e.what());
+    } catch (...) {
+      OATPP_LOGE("[oatpp::web::server::HttpConnectionHandler::WorkerPool::run()]", "Error. Unknown exception. Dropping connection.");
+    }
+
+    if(!keepAlive || !m_running || !arm(entry, EPOLL_CTL_MOD)) {
+      drop(entry);
+    }
+
+  }
+
+}
+
+void HttpConnectionHandler::WorkerPool::stop() {
+
+  {
+    /* Unblock workers stuck in reads or writes - parked and active connections are shut down. */
+    std::lock_guard<std::mutex> lock(m_entriesMutex);
+    m_running = false;
+    for(auto entry : m_entries) {
+      ::shutdown(entry->handle, SHUT_RDWR);
+    }
+  }
+
+  eventfd_write(m_wakeupTrigger, 1);
+
+  for(auto& thread : m_threads) {
+    if(thread.joinable()) {
+      thread.join();
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(m_entriesMutex);
+  for(auto entry : m_entries) {
+    ::epoll_ctl(m_eventQueue, EPOLL_CTL_DEL, entry->handle, nullptr);
+    delete entry;
+  }
+  m_entries.clear();
+
+}
+
+#else
+
+bool HttpConnectionHandler::WorkerPool::isSupported() {
+  return false;
+}
+
+HttpConnectionHandler::WorkerPool::WorkerPool(HttpConnectionHandler* handler, v_int32 workersCount, const std::chrono::duration<v_int64, std::micro>& readTimeout)
+  : m_handler(handler)
+  , m_readTimeout(readTimeout)
+  , m_running(false)
+  , m_eventQueue(0)
+  , m_wakeupTrigger(0)
+{
+  (void) workersCount;
+}
+
+HttpConnectionHandler::WorkerPool::~WorkerPool() {}
+
+data::v_io_size HttpConnectionHandler::WorkerPool::TimedInputStream::read(void *data, data::v_io_size count) {
+  return m_connection->read(data, count);
+}
+
+bool HttpConnectionHandler::WorkerPool::setTimeouts(oatpp::data::v_io_handle handle, const std::chrono::duration<v_int64, std::micro>& timeout) {
+  (void) handle;
+  (void) timeout;
+  return false;
+}
+
+bool HttpConnectionHandler::WorkerPool::park(const std::shared_ptr<oatpp::data::stream::IOStream>& connection) {
+  (void) connection;
+  return false;
+}
+
+void HttpConnectionHandler::WorkerPool::stop() {}
+
+#endif
+
+bool HttpConnectionHandler::WorkerPool::processRequest(Entry* entry) {
+
+  const v_int32 bufferSize = oatpp::data::buffer::IOBuffer::BUFFER_SIZE;
+  v_char8 outBuffer [bufferSize];
+
+  auto& connection = entry->connection;
+  auto& inStream = entry->inStream;
+  p_char8 inBuffer = (p_char8) entry->inBuffer->getData();
+
+  auto outStream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(connection, outBuffer, bufferSize);
+
+  v_int32 connectionState = oatpp::web::protocol::http::outgoing::CommunicationUtils::CONNECTION_STATE_CLOSE;
+  std::shared_ptr<oatpp::web::protocol::http::outgoing::Response> response;
+
+  do {
+
+    if(m_readTimeout.count() > 0) {
+      entry->timedInput->setDeadline(std::chrono::steady_clock::now() + m_readTimeout);
+    } else {
+      entry->timedInput->setDeadline(std::chrono::steady_clock::time_point::max());
+    }
+
+    response = HttpProcessor::processRequest(m_handler->m_router.get(), entry->timedConnection, m_handler->m_bodyDecoder,
+                                             m_handler->m_errorHandler, &m_handler->m_requestInterceptors,
+                                             &m_handler->m_responseInterceptors,
+                                             inBuffer, bufferSize, inStream, connectionState);
+
+    if(!response) {
+      outStream->flush();
+      return false;
+    }
+
+    response->send(outStream.get());
+
+  } while(connectionState == oatpp::web::protocol::http::outgoing::CommunicationUtils::CONNECTION_STATE_KEEP_ALIVE &&
+          HttpProcessor::hasBufferedRequest(inStream, inBuffer));
+
+  outStream->flush();
+
+  if(connectionState == oatpp::web::protocol::http::outgoing::CommunicationUtils::CONNECTION_STATE_KEEP_ALIVE) {
+    return true;
+  }
+
+  if(connectionState == oatpp::web::protocol::http::outgoing::CommunicationUtils::CONNECTION_STATE_UPGRADE) {
+    auto handler = response->getConnectionUpgradeHandler();
+    if(handler) {
+      // Upgraded connection is long-living - do not occupy pool worker with it and don't limit its I/O.
+      setTimeouts(entry->handle, std::chrono::microseconds(0));
+      auto params = response->getConnectionUpgradeParameters();
+      std::thread thread([handler, connection, params] {
+        handler->handleConnection(connection, params);
+      });
+      thread.detach();
+    } else {
+      OATPP_LOGD("[oatpp::web::server::HttpConnectionHandler::WorkerPool::processRequest()]", "Warning. ConnectionUpgradeHandler not set!");
+    }
+  }
+
+  return false;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// HttpConnectionHandler::Task
+
 HttpConnectionHandler::Task::Task(HttpRouter* router,
                                   const std::shared_ptr<oatpp::data::stream::IOStream>& connection,
                                   const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder,
                                   const std::shared_ptr<handler::ErrorHandler>& errorHandler,
-                                  HttpProcessor::RequestInterceptors* requestInterceptors)
+                                  HttpProcessor::RequestInterceptors* requestInterceptors,
+                                  HttpProcessor::ResponseInterceptors* responseInterceptors)
   : m_router(router)
   , m_connection(connection)
   , m_bodyDecoder(bodyDecoder)
   , m_errorHandler(errorHandler)
   , m_requestInterceptors(requestInterceptors)
+  , m_responseInterceptors(responseInterceptors)
 {}
 
 std::shared_ptr<HttpConnectionHandler::Task>
@@ -50,33 +518,40 @@ HttpConnectionHandler::Task::createShared(HttpRouter* router,
                                           const std::shared_ptr<oatpp::data::stream::IOStream>& connection,
                                           const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder,
                                           const std::shared_ptr<handler::ErrorHandler>& errorHandler,
-                                          HttpProcessor::RequestInterceptors* requestInterceptors) {
-  return std::make_shared<Task>(router, connection, bodyDecoder, errorHandler, requestInterceptors);
+                                          HttpProcessor::RequestInterceptors* requestInterceptors,
+                                          HttpProcessor::ResponseInterceptors* responseInterceptors) {
+  return std::make_shared<Task>(router, connection, bodyDecoder, errorHandler, requestInterceptors, responseInterceptors);
 }
 
 void HttpConnectionHandler::Task::run(){
   
   const v_int32 bufferSize = oatpp::data::buffer::IOBuffer::BUFFER_SIZE;
-  v_char8 buffer [bufferSize];
+  v_char8 inBuffer [bufferSize];
+  v_char8 outBuffer [bufferSize];
   
-  auto outStream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(m_connection, buffer, bufferSize);
-  auto inStream = oatpp::data::stream::InputStreamBufferedProxy::createShared(m_connection, buffer, bufferSize);
+  auto outStream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(m_connection, outBuffer, bufferSize);
+  auto inStream = oatpp::data::stream::InputStreamBufferedProxy::createShared(m_connection, inBuffer, bufferSize);
   
   v_int32 connectionState = oatpp::web::protocol::http::outgoing::CommunicationUtils::CONNECTION_STATE_CLOSE;
   std::shared_ptr<oatpp::web::protocol::http::outgoing::Response> response;
   do {
   
-    response = HttpProcessor::processRequest(m_router, m_connection, m_bodyDecoder, m_errorHandler, m_requestInterceptors, buffer, bufferSize, inStream, connectionState);
+    response = HttpProcessor::processRequest(m_router, m_connection, m_bodyDecoder, m_errorHandler, m_requestInterceptors, m_responseInterceptors, inBuffer, bufferSize, inStream, connectionState);
     
     if(response) {
-      outStream->setBufferPosition(0, 0, false);
       response->send(outStream.get());
-      outStream->flush();
+      /* responses to pipelined requests are flushed together */
+      if(!HttpProcessor::hasBufferedRequest(inStream, inBuffer)) {
+        outStream->flush();
+      }
     } else {
+      outStream->flush();
       return;
     }
     
   } while(connectionState == oatpp::web::protocol::http::outgoing::CommunicationUtils::CONNECTION_STATE_KEEP_ALIVE);
+
+  outStream->flush();
   
   if(connectionState == oatpp::web::protocol::http::outgoing::CommunicationUtils::CONNECTION_STATE_UPGRADE) {
     auto handler = response->getConnectionUpgradeHandler();
@@ -89,14 +564,36 @@ void HttpConnectionHandler::Task::run(){
   
 }
 
-HttpConnectionHandler::HttpConnectionHandler(const std::shared_ptr<HttpRouter>& router)
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// HttpConnectionHandler
+
+HttpConnectionHandler::HttpConnectionHandler(const std::shared_ptr<HttpRouter>& router,
+                                             v_int32 workersCount,
+                                             const std::chrono::duration<v_int64, std::micro>& readTimeout)
   : m_router(router)
   , m_bodyDecoder(std::make_shared<oatpp::web::protocol::http::incoming::SimpleBodyDecoder>())
   , m_errorHandler(handler::DefaultErrorHandler::createShared())
-{}
+{
+  if(workersCount > 0) {
+    if(WorkerPool::isSupported()) {
+      m_workerPool = std::make_shared<WorkerPool>(this, workersCount, readTimeout);
+    } else {
+      OATPP_LOGW("[oatpp::web::server::HttpConnectionHandler::HttpConnectionHandler()]",
+                 "Worker pool is not supported on this platform. Using thread per connection.");
+    }
+  }
+}
 
-std::shared_ptr<HttpConnectionHandler> HttpConnectionHandler::createShared(const std::shared_ptr<HttpRouter>& router){
-  return std::make_shared<HttpConnectionHandler>(router);
+HttpConnectionHandler::~HttpConnectionHandler() {
+  if(m_workerPool) {
+    m_workerPool->stop();
+  }
+}
+
+std::shared_ptr<HttpConnectionHandler> HttpConnectionHandler::createShared(const std::shared_ptr<HttpRouter>& router,
+                                                                          v_int32 workersCount,
+                                                                          const std::chrono::duration<v_int64, std::micro>& readTimeout){
+  return std::make_shared<HttpConnectionHandler>(router, workersCount, readTimeout);
 }
 
 void HttpConnectionHandler::setErrorHandler(const std::shared_ptr<handler::ErrorHandler>& errorHandler){
@@ -106,9 +603,20 @@ void HttpConnectionHandler::setErrorHandler(const std::shared_ptr<handler::Error
   }
 }
 
+void HttpConnectionHandler::setBodyDecoder(const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder) {
+  m_bodyDecoder = bodyDecoder;
+  if(!m_bodyDecoder) {
+    m_bodyDecoder = std::make_shared<oatpp::web::protocol::http::incoming::SimpleBodyDecoder>();
+  }
+}
+
 void HttpConnectionHandler::addRequestInterceptor(const std::shared_ptr<handler::RequestInterceptor>& interceptor) {
   m_requestInterceptors.pushBack(interceptor);
 }
+
+void HttpConnectionHandler::addResponseInterceptor(const std::shared_ptr<handler::ResponseInterceptor>& interceptor) {
+  m_responseInterceptors.pushBack(interceptor);
+}
   
 void HttpConnectionHandler::handleConnection(const std::shared_ptr<oatpp::data::stream::IOStream>& connection,
                                              const std::shared_ptr<const ParameterMap>& params)
@@ -119,23 +627,26 @@ void HttpConnectionHandler::handleConnection(const std::shared_ptr<oatpp::data::
   connection->setOutputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
   connection->setInputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
 
-  /* Create working thread */
-  std::thread thread(&Task::run, Task(m_router.get(), connection, m_bodyDecoder, m_errorHandler, &m_requestInterceptors));
-  
-  /* Get hardware concurrency -1 in order to have 1cpu free of workers. */
-  v_int32 concurrency = oatpp::concurrency::getHardwareConcurrency();
-  if(concurrency > 1) {
-    concurrency -= 1;
+  if(m_workerPool && m_workerPool->park(connection)) {
+    return;
   }
-  
-  /* Set thread affinity group CPUs [0..cpu_count - 1]. Leave one cpu free of workers */
-  oatpp::concurrency::setThreadAffinityToCpuRange(thread.native_handle(), 0, concurrency - 1 /* -1 because 0-based index */);
-  
+
+  handleConnectionInThread(connection);
+
+}
+
+void HttpConnectionHandler::handleConnectionInThread(const std::shared_ptr<IOStream>& connection) {
+
+  /* Create working thread */
+  std::thread thread(&Task::run, Task(m_router.get(), connection, m_bodyDecoder, m_errorHandler, &m_requestInterceptors, &m_responseInterceptors));
+  setWorkerThreadAffinity(thread);
   thread.detach();
 }
 
 void HttpConnectionHandler::stop() {
-  // DO NOTHING
+  if(m_workerPool) {
+    m_workerPool->stop();
+  }
 }
 
 }}}
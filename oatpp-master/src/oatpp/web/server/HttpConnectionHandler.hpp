@@ -37,11 +37,15 @@
 #include "oatpp/core/data/stream/StreamBufferedProxy.hpp"
 #include "oatpp/core/data/buffer/IOBuffer.hpp"
 
+#include <chrono>
+
 namespace oatpp { namespace web { namespace server {
 
 /**
  * Simple ConnectionHandler (&id:oatpp::network::server::ConnectionHandler;) for handling HTTP communication. <br>
- * Will create one thread per each connection to handle communication.
+ * By default will create one thread per each connection to handle communication. <br>
+ * If created with `workersCount > 0` - connections are parked in event queue between requests and fixed number of
+ * worker threads process requests on readable connections (Linux only, &id:oatpp::network::Connection; only).
  */
 class HttpConnectionHandler : public base::Countable, public network::server::ConnectionHandler {
 private:
@@ -53,43 +57,70 @@ private:
     std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder> m_bodyDecoder;
     std::shared_ptr<handler::ErrorHandler> m_errorHandler;
     HttpProcessor::RequestInterceptors* m_requestInterceptors;
+    HttpProcessor::ResponseInterceptors* m_responseInterceptors;
   public:
     Task(HttpRouter* router,
          const std::shared_ptr<oatpp::data::stream::IOStream>& connection,
          const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder,
          const std::shared_ptr<handler::ErrorHandler>& errorHandler,
-         HttpProcessor::RequestInterceptors* requestInterceptors);
+         HttpProcessor::RequestInterceptors* requestInterceptors,
+         HttpProcessor::ResponseInterceptors* responseInterceptors);
   public:
     
     static std::shared_ptr<Task> createShared(HttpRouter* router,
                                               const std::shared_ptr<oatpp::data::stream::IOStream>& connection,
                                               const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder,
                                               const std::shared_ptr<handler::ErrorHandler>& errorHandler,
-                                              HttpProcessor::RequestInterceptors* requestInterceptors);
+                                              HttpProcessor::RequestInterceptors* requestInterceptors,
+         HttpProcessor::ResponseInterceptors* responseInterceptors);
     
     void run();
     
   };
+
+  class WorkerPool; // FWD
   
 private:
   std::shared_ptr<HttpRouter> m_router;
   std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder> m_bodyDecoder;
   std::shared_ptr<handler::ErrorHandler> m_errorHandler;
   HttpProcessor::RequestInterceptors m_requestInterceptors;
+  HttpProcessor::ResponseInterceptors m_responseInterceptors;
+  std::shared_ptr<WorkerPool> m_workerPool;
+private:
+  void handleConnectionInThread(const std::shared_ptr<IOStream>& connection);
 public:
   /**
    * Constructor.
    * @param router - &id:oatpp::web::server::HttpRouter; to route incoming requests.
+   * @param workersCount - number of worker threads processing requests. <br>
+   * `0` - create one thread per connection. <br>
+   * `> 0` - park connections in event queue between requests, process requests on fixed number of threads.
+   * Falls back to thread per connection where event queue is not available.
+   * @param readTimeout - in worker-pool mode - max time to receive a whole request, and max time a single
+   * write of the response may block. Connection is dropped when the timeout expires so that slow clients
+   * can't pin worker threads. `0` - no limit.
+   */
+  HttpConnectionHandler(const std::shared_ptr<HttpRouter>& router,
+                        v_int32 workersCount = 0,
+                        const std::chrono::duration<v_int64, std::micro>& readTimeout = std::chrono::seconds(30));
+
+  /**
+   * Destructor. Stops worker threads if any.
    */
-  HttpConnectionHandler(const std::shared_ptr<HttpRouter>& router);
+  ~HttpConnectionHandler();
 public:
 
   /**
    * Create shared HttpConnectionHandler.
    * @param router - &id:oatpp::web::server::HttpRouter; to route incoming requests.
+   * @param workersCount - number of worker threads processing requests. `0` - create one thread per connection.
+   * @param readTimeout - in worker-pool mode - max time to receive a whole request and to complete a single write.
    * @return - `std::shared_ptr` to HttpConnectionHandler.
    */
-  static std::shared_ptr<HttpConnectionHandler> createShared(const std::shared_ptr<HttpRouter>& router);
+  static std::shared_ptr<HttpConnectionHandler> createShared(const std::shared_ptr<HttpRouter>& router,
+                                                             v_int32 workersCount = 0,
+                                                             const std::chrono::duration<v_int64, std::micro>& readTimeout = std::chrono::seconds(30));
 
   /**
    * Set root error handler for all requests coming through this Connection Handler.
@@ -98,12 +129,25 @@ public:
    */
   void setErrorHandler(const std::shared_ptr<handler::ErrorHandler>& errorHandler);
 
+  /**
+   * Set body decoder for all requests coming through this Connection Handler. <br>
+   * Default is &id:oatpp::web::protocol::http::incoming::SimpleBodyDecoder; with inflation disabled.
+   * @param bodyDecoder - &id:oatpp::web::protocol::http::incoming::BodyDecoder;.
+   */
+  void setBodyDecoder(const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder);
+
   /**
    * Set request interceptor. Request intercepted after route is resolved but before corresponding route endpoint is called.
    * @param interceptor - &id:oatpp::web::server::handler::RequestInterceptor;.
    */
   void addRequestInterceptor(const std::shared_ptr<handler::RequestInterceptor>& interceptor);
 
+  /**
+   * Add response interceptor. Response intercepted after it is formed by the endpoint (or by request interceptor) but before it is sent.
+   * @param interceptor - &id:oatpp::web::server::handler::ResponseInterceptor;.
+   */
+  void addResponseInterceptor(const std::shared_ptr<handler::ResponseInterceptor>& interceptor);
+
   /**
    * Implementation of &id:oatpp::network::server::ConnectionHandler::handleConnection;.
    * @param connection - &id:oatpp::data::stream::IOStream; representing connection.
@@ -111,7 +155,8 @@ public:
   void handleConnection(const std::shared_ptr<IOStream>& connection, const std::shared_ptr<const ParameterMap>& params) override;
 
   /**
-   * Tell all worker threads to exit when done.
+   * Tell all worker threads to exit when done. <br>
+   * In worker-pool mode parked and active connections are shut down so that workers don't block on them.
    */
   void stop() override;
   
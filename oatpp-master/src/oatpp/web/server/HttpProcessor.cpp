@@ -26,18 +26,76 @@
 
 namespace oatpp { namespace web { namespace server {
 
+v_int32 HttpProcessor::getNextRequestPosition(const RequestHeadersReader::Result& headersReadResult) {
+
+  auto& headers = headersReadResult.headers;
+
+  if(headers.find(protocol::http::Header::TRANSFER_ENCODING) != headers.end()) {
+    return -1;
+  }
+
+  auto it = headers.find(protocol::http::Header::CONTENT_LENGTH);
+  if(it == headers.end()) {
+    return headersReadResult.bufferPosStart;
+  }
+
+  p_char8 data = it->second.getData();
+  v_int32 size = it->second.getSize();
+  v_int64 contentLength = 0;
+
+  if(size == 0) {
+    return -1;
+  }
+
+  for(v_int32 i = 0; i < size; i ++) {
+    if(data[i] < '0' || data[i] > '9' || contentLength > headersReadResult.bufferPosEnd) {
+      return -1;
+    }
+    contentLength = contentLength * 10 + (data[i] - '0');
+  }
+
+  if(headersReadResult.bufferPosStart + contentLength > headersReadResult.bufferPosEnd) {
+    return -1;
+  }
+
+  return headersReadResult.bufferPosStart + (v_int32) contentLength;
+
+}
+
+bool HttpProcessor::hasBufferedRequest(const std::shared_ptr<oatpp::data::stream::InputStreamBufferedProxy>& inStream, p_char8 buffer) {
+  auto bufferedSize = inStream->compactBuffer();
+  return bufferedSize > 0 && RequestHeadersReader::findSectionEnd(buffer, (v_int32) bufferedSize) > 0;
+}
+
+std::shared_ptr<protocol::http::outgoing::Response>
+HttpProcessor::interceptResponse(ResponseInterceptors* responseInterceptors,
+                                 const std::shared_ptr<protocol::http::incoming::Request>& request,
+                                 const std::shared_ptr<protocol::http::outgoing::Response>& response) {
+  std::shared_ptr<protocol::http::outgoing::Response> result = response;
+  auto currInterceptor = responseInterceptors->getFirstNode();
+  while (currInterceptor != nullptr) {
+    result = currInterceptor->getData()->intercept(request, result);
+    currInterceptor = currInterceptor->getNext();
+  }
+  return result;
+}
+
 std::shared_ptr<protocol::http::outgoing::Response>
 HttpProcessor::processRequest(HttpRouter* router,
                               const std::shared_ptr<oatpp::data::stream::IOStream>& connection,
                               const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder,
                               const std::shared_ptr<handler::ErrorHandler>& errorHandler,
                               RequestInterceptors* requestInterceptors,
+                              ResponseInterceptors* responseInterceptors,
                               void* buffer,
                               v_int32 bufferSize,
                               const std::shared_ptr<oatpp::data::stream::InputStreamBufferedProxy>& inStream,
                               v_int32& connectionState) {
   
-  RequestHeadersReader headersReader(buffer, bufferSize, 4096);
+  /* bytes of the pipelined request are handed over to the headers reader */
+  auto bufferedSize = inStream->compactBuffer();
+  inStream->setBufferPosition(0, 0, false);
+  RequestHeadersReader headersReader(buffer, bufferSize, 4096, (v_int32) bufferedSize);
   oatpp::web::protocol::http::HttpError::Info error;
   auto headersReadResult = headersReader.readHeaders(connection, error);
   
@@ -70,6 +128,7 @@ HttpProcessor::processRequest(HttpRouter* router,
                                                                  bodyDecoder);
   
   std::shared_ptr<protocol::http::outgoing::Response> response;
+  bool handled = false;
   try{
     auto currInterceptor = requestInterceptors->getFirstNode();
     while (currInterceptor != nullptr) {
@@ -82,12 +141,24 @@ HttpProcessor::processRequest(HttpRouter* router,
     if(!response) {
       response = route.getEndpoint()->handle(request);
     }
+    response = interceptResponse(responseInterceptors, request, response);
+    handled = true;
   } catch (oatpp::web::protocol::http::HttpError& error) {
-    return errorHandler->handleError(error.getInfo().status, error.getMessage());
+    response = errorHandler->handleError(error.getInfo().status, error.getMessage());
   } catch (std::exception& error) {
-    return errorHandler->handleError(protocol::http::Status::CODE_500, error.what());
+    response = errorHandler->handleError(protocol::http::Status::CODE_500, error.what());
   } catch (...) {
-    return errorHandler->handleError(protocol::http::Status::CODE_500, "Unknown error");
+    response = errorHandler->handleError(protocol::http::Status::CODE_500, "Unknown error");
+  }
+
+  /* skip the body if it wasn't read by the endpoint - the next pipelined request starts right after it */
+  v_int32 nextRequestPosition = getNextRequestPosition(headersReadResult);
+  if(nextRequestPosition >= 0) {
+    inStream->setBufferPosition(nextRequestPosition, headersReadResult.bufferPosEnd, nextRequestPosition != headersReadResult.bufferPosEnd);
+  }
+
+  if(!handled) {
+    return response;
   }
   
   response->putHeaderIfNotExists(protocol::http::Header::SERVER, protocol::http::Header::Value::SERVER);
@@ -101,6 +172,14 @@ HttpProcessor::processRequest(HttpRouter* router,
   
 oatpp::async::Action HttpProcessor::Coroutine::onHeadersParsed(const RequestHeadersReader::Result& headersReadResult) {
   
+  m_nextRequestPosition = getNextRequestPosition(headersReadResult);
+  m_bufferPosEnd = headersReadResult.bufferPosEnd;
+
+  auto& bodyStream = m_inStream;
+  bodyStream->setBufferPosition(headersReadResult.bufferPosStart,
+                                headersReadResult.bufferPosEnd,
+                                headersReadResult.bufferPosStart != headersReadResult.bufferPosEnd);
+
   m_currentRoute = m_router->getRoute(headersReadResult.startingLine.method.toString(), headersReadResult.startingLine.path.toString());
   
   if(!m_currentRoute) {
@@ -108,11 +187,6 @@ oatpp::async::Action HttpProcessor::Coroutine::onHeadersParsed(const RequestHead
     return yieldTo(&HttpProcessor::Coroutine::onResponseFormed);
   }
   
-  auto& bodyStream = m_inStream;
-  bodyStream->setBufferPosition(headersReadResult.bufferPosStart,
-                                headersReadResult.bufferPosEnd,
-                                headersReadResult.bufferPosStart != headersReadResult.bufferPosEnd);
-  
   m_currentRequest = protocol::http::incoming::Request::createShared(headersReadResult.startingLine,
                                                                      m_currentRoute.matchMap,
                                                                      headersReadResult.headers,
@@ -123,7 +197,7 @@ oatpp::async::Action HttpProcessor::Coroutine::onHeadersParsed(const RequestHead
   while (currInterceptor != nullptr) {
     m_currentResponse = currInterceptor->getData()->intercept(m_currentRequest);
     if(m_currentResponse) {
-      return yieldTo(&HttpProcessor::Coroutine::onResponseFormed);
+      return onResponse(m_currentResponse);
     }
     currInterceptor = currInterceptor->getNext();
   }
@@ -133,7 +207,11 @@ oatpp::async::Action HttpProcessor::Coroutine::onHeadersParsed(const RequestHead
 }
   
 HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::act() {
-  RequestHeadersReader headersReader(m_ioBuffer->getData(), m_ioBuffer->getSize(), 4096);
+  m_nextRequestPosition = -1;
+  /* bytes of the pipelined request are handed over to the headers reader */
+  auto bufferedSize = m_inStream->compactBuffer();
+  m_inStream->setBufferPosition(0, 0, false);
+  RequestHeadersReader headersReader(m_ioBuffer->getData(), m_ioBuffer->getSize(), 4096, (v_int32) bufferedSize);
   return headersReader.readHeadersAsync(m_connection).callbackTo(&HttpProcessor::Coroutine::onHeadersParsed);
 }
 
@@ -142,7 +220,7 @@ HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::onRequestFormed() {
 }
 
 HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::onResponse(const std::shared_ptr<protocol::http::outgoing::Response>& response) {
-  m_currentResponse = response;
+  m_currentResponse = interceptResponse(m_responseInterceptors, m_currentRequest, response);
   return yieldTo(&HttpProcessor::Coroutine::onResponseFormed);
 }
   
@@ -150,10 +228,25 @@ HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::onResponseFormed() {
   
   m_currentResponse->putHeaderIfNotExists(protocol::http::Header::SERVER, protocol::http::Header::Value::SERVER);
   m_connectionState = oatpp::web::protocol::http::outgoing::CommunicationUtils::considerConnectionState(m_currentRequest, m_currentResponse);
-  m_outStream->setBufferPosition(0, 0, false);
-  return m_currentResponse->sendAsync(m_outStream).next(m_outStream->flushAsync()).next(yieldTo(&HttpProcessor::Coroutine::onRequestDone));
+  return m_currentResponse->sendAsync(m_outStream).next(yieldTo(&HttpProcessor::Coroutine::onResponseSent));
   
 }
+
+HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::onResponseSent() {
+
+  if(m_nextRequestPosition >= 0) {
+    m_inStream->setBufferPosition(m_nextRequestPosition, m_bufferPosEnd, m_nextRequestPosition != m_bufferPosEnd);
+  }
+
+  if(m_connectionState == oatpp::web::protocol::http::outgoing::CommunicationUtils::CONNECTION_STATE_KEEP_ALIVE &&
+     hasBufferedRequest(m_inStream, (p_char8) m_ioBuffer->getData()))
+  {
+    return yieldTo(&HttpProcessor::Coroutine::act);
+  }
+
+  return m_outStream->flushAsync().next(yieldTo(&HttpProcessor::Coroutine::onRequestDone));
+
+}
   
 HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::onRequestDone() {
   
@@ -189,7 +282,12 @@ HttpProcessor::Coroutine::Action HttpProcessor::Coroutine::handleError(const std
       return propagateError();
     }
 
-    m_currentResponse = m_errorHandler->handleError(protocol::http::Status::CODE_500, error->what());
+    if(error->is<protocol::http::AsyncHttpError>()) {
+      auto httpError = static_cast<const protocol::http::AsyncHttpError*>(error.get());
+      m_currentResponse = m_errorHandler->handleError(httpError->getStatus(), error->what());
+    } else {
+      m_currentResponse = m_errorHandler->handleError(protocol::http::Status::CODE_500, error->what());
+    }
     return yieldTo(&HttpProcessor::Coroutine::onResponseFormed);
 
   }
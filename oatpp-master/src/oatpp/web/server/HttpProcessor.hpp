@@ -44,6 +44,7 @@ namespace oatpp { namespace web { namespace server {
 class HttpProcessor {
 public:
   typedef oatpp::collection::LinkedList<std::shared_ptr<oatpp::web::server::handler::RequestInterceptor>> RequestInterceptors;
+  typedef oatpp::collection::LinkedList<std::shared_ptr<oatpp::web::server::handler::ResponseInterceptor>> ResponseInterceptors;
   typedef oatpp::web::protocol::http::incoming::RequestHeadersReader RequestHeadersReader;
 public:
   
@@ -65,18 +66,56 @@ public:
   
 public:
   
+  /**
+   * Position in the input buffer where the next pipelined request starts, once the current request is processed.
+   * @param headersReadResult - &id:oatpp::web::protocol::http::incoming::RequestHeadersReader::Result; of the current request.
+   * @return - position right after the body of the current request, or `-1` if the body is not entirely in the buffer.
+   */
+  static v_int32 getNextRequestPosition(const RequestHeadersReader::Result& headersReadResult);
+
+  /**
+   * Check if the input buffer already holds complete headers of the next (pipelined) request. <br>
+   * Buffered bytes are moved to the beginning of the buffer. See &id:oatpp::data::stream::InputStreamBufferedProxy::compactBuffer;.
+   * @param inStream - &id:oatpp::data::stream::InputStreamBufferedProxy; of the connection.
+   * @param buffer - buffer of the `inStream`.
+   * @return - `true` if the next request can be read without waiting for the connection.
+   */
+  static bool hasBufferedRequest(const std::shared_ptr<oatpp::data::stream::InputStreamBufferedProxy>& inStream, p_char8 buffer);
+
+  /**
+   * Pass response through response interceptors in the order they were added.
+   * @param responseInterceptors - &l:HttpProcessor::ResponseInterceptors;.
+   * @param request - request the response is formed for.
+   * @param response - response formed for the request.
+   * @return - response to send.
+   */
+  static std::shared_ptr<protocol::http::outgoing::Response>
+  interceptResponse(ResponseInterceptors* responseInterceptors,
+                    const std::shared_ptr<protocol::http::incoming::Request>& request,
+                    const std::shared_ptr<protocol::http::outgoing::Response>& response);
+
+public:
+
+  /**
+   * Coroutine processing requests of one connection. <br>
+   * Pipelined requests are processed one by one in the order they were received. Responses are accumulated in the
+   * `outStream` and are flushed only when there is no complete request left in the input buffer.
+   */
   class Coroutine : public oatpp::async::Coroutine<HttpProcessor::Coroutine> {
   private:
     HttpRouter* m_router;
     std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder> m_bodyDecoder;
     std::shared_ptr<handler::ErrorHandler> m_errorHandler;
     RequestInterceptors* m_requestInterceptors;
+    ResponseInterceptors* m_responseInterceptors;
     std::shared_ptr<oatpp::data::stream::IOStream> m_connection;
     std::shared_ptr<oatpp::data::buffer::IOBuffer> m_ioBuffer;
     std::shared_ptr<oatpp::data::stream::OutputStreamBufferedProxy> m_outStream;
     std::shared_ptr<oatpp::data::stream::InputStreamBufferedProxy> m_inStream;
     v_int32 m_connectionState;
   private:
+    v_int32 m_nextRequestPosition;
+    v_int32 m_bufferPosEnd;
     oatpp::web::server::HttpRouter::BranchRouter::Route m_currentRoute;
     std::shared_ptr<protocol::http::incoming::Request> m_currentRequest;
     std::shared_ptr<protocol::http::outgoing::Response> m_currentResponse;
@@ -86,6 +125,7 @@ public:
               const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder,
               const std::shared_ptr<handler::ErrorHandler>& errorHandler,
               RequestInterceptors* requestInterceptors,
+              ResponseInterceptors* responseInterceptors,
               const std::shared_ptr<oatpp::data::stream::IOStream>& connection,
               const std::shared_ptr<oatpp::data::buffer::IOBuffer>& ioBuffer,
               const std::shared_ptr<oatpp::data::stream::OutputStreamBufferedProxy>& outStream,
@@ -94,11 +134,14 @@ public:
       , m_bodyDecoder(bodyDecoder)
       , m_errorHandler(errorHandler)
       , m_requestInterceptors(requestInterceptors)
+      , m_responseInterceptors(responseInterceptors)
       , m_connection(connection)
       , m_ioBuffer(ioBuffer)
       , m_outStream(outStream)
       , m_inStream(inStream)
       , m_connectionState(oatpp::web::protocol::http::outgoing::CommunicationUtils::CONNECTION_STATE_KEEP_ALIVE)
+      , m_nextRequestPosition(-1)
+      , m_bufferPosEnd(0)
     {}
     
     Action act() override;
@@ -108,6 +151,7 @@ public:
     Action onRequestFormed();
     Action onResponse(const std::shared_ptr<protocol::http::outgoing::Response>& response);
     Action onResponseFormed();
+    Action onResponseSent();
     Action onRequestDone();
     
     Action handleError(const std::shared_ptr<const Error>& error) override;
@@ -115,13 +159,19 @@ public:
   };
   
 public:
-  
+
+  /**
+   * Read and process one request. <br>
+   * Bytes left in the `inStream` buffer after the previous request are treated as the beginning of this request.
+   * `buffer` must be the buffer of the `inStream`.
+   */
   static std::shared_ptr<protocol::http::outgoing::Response>
   processRequest(HttpRouter* router,
                  const std::shared_ptr<oatpp::data::stream::IOStream>& connection,
                  const std::shared_ptr<const oatpp::web::protocol::http::incoming::BodyDecoder>& bodyDecoder,
                  const std::shared_ptr<handler::ErrorHandler>& errorHandler,
                  RequestInterceptors* requestInterceptors,
+                 ResponseInterceptors* responseInterceptors,
                  void* buffer,
                  v_int32 bufferSize,
                  const std::shared_ptr<oatpp::data::stream::InputStreamBufferedProxy>& inStream,
@@ -0,0 +1,175 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "CompressionInterceptor.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace web { namespace server { namespace handler {
+
+namespace {
+
+typedef oatpp::web::protocol::http::Header Header;
+
+bool isBlank(v_char8 a) {
+  return a == ' ' || a == '\t';
+}
+
+bool tokenEquals(p_char8 data, v_int32 size, const char* token) {
+  return size == (v_int32) std::strlen(token) && base::StrBuffer::equalsCI(data, token, size);
+}
+
+/*
+ * qvalue = ( "0" [ "." 0*3DIGIT ] ) / ( "1" [ "." 0*3("0") ] ) - parsed as thousandths.
+ */
+v_int32 parseQValue(p_char8 data, v_int32 size, v_int32& pos) {
+  if(pos >= size || data[pos] < '0' || data[pos] > '9') {
+    return 0;
+  }
+  v_int32 result = (data[pos ++] - '0') * 1000;
+  if(pos < size && data[pos] == '.') {
+    pos ++;
+    v_int32 scale = 100;
+    while(pos < size && data[pos] >= '0' && data[pos] <= '9') {
+      result += (data[pos ++] - '0') * scale;
+      scale /= 10;
+    }
+  }
+  return result > 1000 ? 1000 : result;
+}
+
+}
+
+CompressionInterceptor::CompressionInterceptor(v_int32 level, data::v_io_size minSize, data::v_io_size chunkSize)
+  : m_level(level)
+  , m_minSize(minSize)
+  , m_chunkSize(chunkSize)
+{}
+
+std::shared_ptr<CompressionInterceptor> CompressionInterceptor::createShared(v_int32 level,
+                                                                             data::v_io_size minSize,
+                                                                             data::v_io_size chunkSize)
+{
+  return std::make_shared<CompressionInterceptor>(level, minSize, chunkSize);
+}
+
+const char* CompressionInterceptor::selectEncoding(const oatpp::data::share::StringKeyLabel& acceptEncoding) {
+
+  v_int32 gzipQ = -1;
+  v_int32 deflateQ = -1;
+  v_int32 anyQ = -1;
+
+  p_char8 data = acceptEncoding.getData();
+  v_int32 size = acceptEncoding.getSize();
+  v_int32 pos = 0;
+
+  while(pos < size) {
+
+    while(pos < size && (isBlank(data[pos]) || data[pos] == ',')) {
+      pos ++;
+    }
+
+    v_int32 tokenStart = pos;
+    while(pos < size && data[pos] != ',' && data[pos] != ';' && !isBlank(data[pos])) {
+      pos ++;
+    }
+    v_int32 tokenSize = pos - tokenStart;
+
+    v_int32 q = 1000;
+    while(pos < size && data[pos] != ',') {
+      if(data[pos ++] == ';') {
+        while(pos < size && isBlank(data[pos])) {
+          pos ++;
+        }
+        if(pos + 1 < size && (data[pos] == 'q' || data[pos] == 'Q') && data[pos + 1] == '=') {
+          pos += 2;
+          q = parseQValue(data, size, pos);
+        }
+      }
+    }
+
+    p_char8 token = &data[tokenStart];
+    if(tokenEquals(token, tokenSize, Header::Value::CONTENT_ENCODING_GZIP) || tokenEquals(token, tokenSize, "x-gzip")) {
+      gzipQ = q;
+    } else if(tokenEquals(token, tokenSize, Header::Value::CONTENT_ENCODING_DEFLATE)) {
+      deflateQ = q;
+    } else if(tokenEquals(token, tokenSize, "*")) {
+      anyQ = q;
+    }
+
+  }
+
+  if(gzipQ < 0) {
+    gzipQ = anyQ;
+  }
+  if(deflateQ < 0) {
+    deflateQ = anyQ;
+  }
+
+  if(gzipQ > 0 && gzipQ >= deflateQ) {
+    return Header::Value::CONTENT_ENCODING_GZIP;
+  }
+  if(deflateQ > 0) {
+    return Header::Value::CONTENT_ENCODING_DEFLATE;
+  }
+  return nullptr;
+
+}
+
+std::shared_ptr<CompressionInterceptor::OutgoingResponse>
+CompressionInterceptor::intercept(const std::shared_ptr<IncomingRequest>& request,
+                                  const std::shared_ptr<OutgoingResponse>& response)
+{
+
+  if(!protocol::http::encoding::Deflate::isSupported()) {
+    return response;
+  }
+
+  auto body = response->getBody();
+  v_int32 code = response->getStatus().code;
+
+  /* 206 - ranges refer to the identity representation */
+  if(!body || code < 200 || code == 204 || code == 206 || code == 304) {
+    return response;
+  }
+
+  response->putHeaderIfNotExists(Header::VARY, Header::ACCEPT_ENCODING);
+
+  auto& headers = request->getHeaders();
+  auto acceptEncodingIt = headers.find(Header::ACCEPT_ENCODING);
+  if(acceptEncodingIt == headers.end()) {
+    return response;
+  }
+
+  const char* encoding = selectEncoding(acceptEncodingIt->second);
+  if(encoding != nullptr) {
+    response->setBody(protocol::http::outgoing::CompressedBody::createShared(body, encoding, m_level, m_minSize, m_chunkSize));
+  }
+
+  return response;
+
+}
+
+}}}}
@@ -0,0 +1,95 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_web_server_handler_CompressionInterceptor_hpp
+#define oatpp_web_server_handler_CompressionInterceptor_hpp
+
+#include "./Interceptor.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/CompressedBody.hpp"
+
+namespace oatpp { namespace web { namespace server { namespace handler {
+
+/**
+ * Response interceptor compressing response bodies according to `Accept-Encoding` of the request. <br>
+ * Body is wrapped with &id:oatpp::web::protocol::http::outgoing::CompressedBody; which decides if it is worth
+ * compressing once headers are declared. Chunked bodies such as streaming &id:oatpp::web::protocol::http::outgoing::DtoBody;
+ * are sent uncompressed. Does nothing if oatpp is built without zlib (`-DOATPP_USE_ZLIB=ON` is required). <br>
+ * Usage: `connectionHandler->addResponseInterceptor(CompressionInterceptor::createShared());`.
+ */
+class CompressionInterceptor : public ResponseInterceptor {
+private:
+  v_int32 m_level;
+  data::v_io_size m_minSize;
+  data::v_io_size m_chunkSize;
+public:
+
+  /**
+   * Constructor.
+   * @param level - compression level. See &id:oatpp::web::protocol::http::encoding::DeflateEncoder;.
+   * @param minSize - bodies smaller than `minSize` are sent uncompressed.
+   * @param chunkSize - max size of compressed data chunk.
+   */
+  CompressionInterceptor(v_int32 level = protocol::http::encoding::DeflateEncoder::LEVEL_DEFAULT,
+                         data::v_io_size minSize = protocol::http::outgoing::CompressedBody::DEFAULT_MIN_SIZE,
+                         data::v_io_size chunkSize = protocol::http::outgoing::CompressedBody::DEFAULT_CHUNK_SIZE);
+public:
+
+  /**
+   * Create shared CompressionInterceptor.
+   * @param level - compression level.
+   * @param minSize - bodies smaller than `minSize` are sent uncompressed.
+   * @param chunkSize - max size of compressed data chunk.
+   * @return - `std::shared_ptr` to CompressionInterceptor.
+   */
+  static std::shared_ptr<CompressionInterceptor>
+  createShared(v_int32 level = protocol::http::encoding::DeflateEncoder::LEVEL_DEFAULT,
+               data::v_io_size minSize = protocol::http::outgoing::CompressedBody::DEFAULT_MIN_SIZE,
+               data::v_io_size chunkSize = protocol::http::outgoing::CompressedBody::DEFAULT_CHUNK_SIZE);
+
+  /**
+   * Select content-coding acceptable by the client. <br>
+   * `gzip` is preferred over `deflate` if both have the same quality value.
+   * @param acceptEncoding - value of `Accept-Encoding` header. Ex.: `gzip, deflate;q=0.5, *;q=0`.
+   * @return - &id:oatpp::web::protocol::http::Header::Value::CONTENT_ENCODING_GZIP;,
+   * &id:oatpp::web::protocol::http::Header::Value::CONTENT_ENCODING_DEFLATE; or `nullptr` if none is acceptable.
+   */
+  static const char* selectEncoding(const oatpp::data::share::StringKeyLabel& acceptEncoding);
+
+  /**
+   * Wrap response body with &id:oatpp::web::protocol::http::outgoing::CompressedBody; if the client accepts
+   * `gzip` or `deflate` content-coding.
+   * @param request - request the response is formed for.
+   * @param response - response to be sent.
+   * @return - `response`.
+   */
+  std::shared_ptr<OutgoingResponse> intercept(const std::shared_ptr<IncomingRequest>& request,
+                                              const std::shared_ptr<OutgoingResponse>& response) override;
+
+};
+
+}}}}
+
+#endif // oatpp_web_server_handler_CompressionInterceptor_hpp
@@ -62,6 +62,40 @@ public:
   virtual std::shared_ptr<OutgoingResponse> intercept(std::shared_ptr<IncomingRequest>& request) = 0;
   
 };
+
+/**
+ * ResponseInterceptor. <br>
+ * Intercepts response formed for the routed request before response is sent.
+ */
+class ResponseInterceptor {
+public:
+  /**
+   * Convenience typedef for &id:oatpp::web::protocol::http::incoming::Request;.
+   */
+  typedef oatpp::web::protocol::http::incoming::Request IncomingRequest;
+
+  /**
+   * Convenience typedef for &id:oatpp::web::protocol::http::outgoing::Response;.
+   */
+  typedef oatpp::web::protocol::http::outgoing::Response OutgoingResponse;
+public:
+
+  /**
+   * Default virtual destructor.
+   */
+  virtual ~ResponseInterceptor() = default;
+
+  /**
+   * Intercept response. <br>
+   * Same as &l:RequestInterceptor::intercept (); - no "heavy" nor I/O operations here.
+   * @param request - request the response is formed for.
+   * @param response - response to be sent.
+   * @return - response to send. Either modified `response` or a new one. Must not be `nullptr`.
+   */
+  virtual std::shared_ptr<OutgoingResponse> intercept(const std::shared_ptr<IncomingRequest>& request,
+                                                      const std::shared_ptr<OutgoingResponse>& response) = 0;
+
+};
   
 }}}}
 
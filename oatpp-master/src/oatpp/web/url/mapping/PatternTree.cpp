@@ -0,0 +1,273 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "PatternTree.hpp"
+
+#include <limits>
+
+namespace oatpp { namespace web { namespace url { namespace mapping {
+
+PatternTree::Node::Node()
+  : endpointIndex(-1)
+  , minIndex(std::numeric_limits<v_int32>::max())
+{}
+
+PatternTree::PatternTree()
+  : m_patternsCount(0)
+{}
+
+v_int32 PatternTree::add(const std::shared_ptr<Pattern>& pattern) {
+
+  v_int32 index = m_patternsCount ++;
+
+  if(!pattern) {
+    return index;
+  }
+
+  Node* node = &m_root;
+  if(node->minIndex > index) {
+    node->minIndex = index;
+  }
+
+  auto curr = pattern->m_parts->getFirstNode();
+  while(curr != nullptr) {
+
+    const std::shared_ptr<Pattern::Part>& part = curr->getData();
+    curr = curr->getNext();
+
+    if(part->function == Pattern::Part::FUNCTION_CONST) {
+
+      auto& child = node->constChildren[StringKeyLabel(part->text)];
+      if(!child) {
+        child.reset(new Node());
+      }
+      node = child.get();
+
+    } else if(part->function == Pattern::Part::FUNCTION_VAR) {
+
+      StringKeyLabel name(part->text);
+      Node* child = nullptr;
+      for(auto& varChild : node->varChildren) {
+        if(varChild->name == name) {
+          child = varChild.get();
+          break;
+        }
+      }
+      if(child == nullptr) {
+        child = new Node();
+        child->name = name;
+        node->varChildren.push_back(std::unique_ptr<Node>(child));
+      }
+      node = child;
+
+    } else if(part->function == Pattern::Part::FUNCTION_ANY_END) {
+
+      if(!node->tailChild) {
+        node->tailChild.reset(new Node());
+      }
+      node = node->tailChild.get();
+
+    }
+
+    if(node->minIndex > index) {
+      node->minIndex = index;
+    }
+
+  }
+
+  if(node->endpointIndex < 0) {
+    node->endpointIndex = index;
+  }
+
+  return index;
+
+}
+
+v_int32 PatternTree::skipSlashes(p_char8 data, v_int32 size, v_int32 pos) {
+  while(pos < size && data[pos] == '/') {
+    pos ++;
+  }
+  return pos;
+}
+
+void PatternTree::accept(const Node* node, const std::vector<Variable>& variables, const StringKeyLabel& tail, Result& result) {
+  if(node->endpointIndex >= 0 && node->endpointIndex < result.index) {
+    result.index = node->endpointIndex;
+    result.variables = variables;
+    result.tail = tail;
+  }
+}
+
+void PatternTree::acceptTail(const Node* node, const StringKeyLabel& url, v_int32 pos, std::vector<Variable>& variables, Result& result) {
+  pos = skipSlashes(url.getData(), url.getSize(), pos);
+  if(pos < url.getSize()) {
+    accept(node, variables, StringKeyLabel(url.getMemoryHandle(), &url.getData()[pos], url.getSize() - pos), result);
+  } else {
+    accept(node, variables, StringKeyLabel(), result);
+  }
+}
+
+void PatternTree::matchConst(const Node* node, const StringKeyLabel& url, v_int32 pos, std::vector<Variable>& variables, Result& result) {
+
+  p_char8 data = url.getData();
+  v_int32 size = url.getSize();
+
+  v_int32 segmentEnd = pos;
+  while(segmentEnd < size && data[segmentEnd] != '/') {
+    segmentEnd ++;
+  }
+
+  /* const part may be followed by '/', by the end of url, or by '?' - try each possible end of the part */
+  for(v_int32 i = pos + 1; i <= segmentEnd; i ++) {
+
+    if(i < segmentEnd && data[i] != '?') {
+      continue;
+    }
+
+    auto it = node->constChildren.find(StringKeyLabel(nullptr, &data[pos], i - pos));
+    if(it == node->constChildren.end() || it->second->minIndex >= result.index) {
+      continue;
+    }
+
+    const Node* child = it->second.get();
+
+    if(i < size && data[i] == '?') {
+      /* only patterns ending here, or ending with tail, match url with query */
+      StringKeyLabel tail(url.getMemoryHandle(), &data[i], size - i);
+      accept(child, variables, tail, result);
+      if(child->tailChild) {
+        accept(child->tailChild.get(), variables, tail, result);
+      }
+    } else {
+      matchChildren(child, url, i, false, variables, result);
+    }
+
+  }
+
+}
+
+void PatternTree::matchVar(const Node* node, const StringKeyLabel& url, v_int32 pos, std::vector<Variable>& variables, Result& result) {
+
+  p_char8 data = url.getData();
+  v_int32 size = url.getSize();
+
+  if(pos >= size) {
+    return;
+  }
+
+  v_int32 end = pos;
+  while(end < size && data[end] != '/' && data[end] != '?') {
+    end ++;
+  }
+
+  if(end < size && data[end] == '?') {
+
+    StringKeyLabel tail(url.getMemoryHandle(), &data[end], size - end);
+    variables.push_back({node->name, StringKeyLabel(url.getMemoryHandle(), &data[pos], end - pos)});
+    accept(node, variables, tail, result);
+    if(node->tailChild) {
+      accept(node->tailChild.get(), variables, tail, result);
+    }
+    variables.pop_back();
+
+    /* for patterns continuing after variable, '?' is treated as a part of the variable */
+    while(end < size && data[end] != '/') {
+      end ++;
+    }
+    variables.push_back({node->name, StringKeyLabel(url.getMemoryHandle(), &data[pos], end - pos)});
+    matchChildren(node, url, end, true, variables, result);
+    variables.pop_back();
+
+  } else {
+    variables.push_back({node->name, StringKeyLabel(url.getMemoryHandle(), &data[pos], end - pos)});
+    matchChildren(node, url, end, false, variables, result);
+    variables.pop_back();
+  }
+
+}
+
+void PatternTree::matchChildren(const Node* node, const StringKeyLabel& url, v_int32 pos, bool skipEnding,
+                                std::vector<Variable>& variables, Result& result)
+{
+
+  if(node->minIndex >= result.index) {
+    return;
+  }
+
+  p_char8 data = url.getData();
+  v_int32 size = url.getSize();
+
+  if(!skipEnding) {
+
+    if(node->endpointIndex >= 0 && node->endpointIndex < result.index && skipSlashes(data, size, pos) == size) {
+      accept(node, variables, StringKeyLabel(), result);
+    }
+
+    if(node->tailChild && node->tailChild->minIndex < result.index) {
+      acceptTail(node->tailChild.get(), url, pos, variables, result);
+    }
+
+  }
+
+  pos = skipSlashes(data, size, pos);
+
+  if(!node->constChildren.empty()) {
+    matchConst(node, url, pos, variables, result);
+  }
+
+  for(auto& child : node->varChildren) {
+    if(child->minIndex < result.index) {
+      matchVar(child.get(), url, pos, variables, result);
+    }
+  }
+
+}
+
+v_int32 PatternTree::match(const StringKeyLabel& url, Pattern::MatchMap& matchMap) const {
+
+  Result result;
+  result.index = std::numeric_limits<v_int32>::max();
+
+  std::vector<Variable> variables;
+  matchChildren(&m_root, url, 0, false, variables, result);
+
+  if(result.index == std::numeric_limits<v_int32>::max()) {
+    return -1;
+  }
+
+  for(auto& variable : result.variables) {
+    matchMap.m_variables[variable.name] = variable.value;
+  }
+  matchMap.m_tail = result.tail;
+
+  return result.index;
+
+}
+
+v_int32 PatternTree::getPatternsCount() const {
+  return m_patternsCount;
+}
+
+}}}}
@@ -0,0 +1,127 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#ifndef oatpp_web_url_mapping_PatternTree_hpp
+#define oatpp_web_url_mapping_PatternTree_hpp
+
+#include "./Pattern.hpp"
+
+#include <unordered_map>
+#include <vector>
+#include <memory>
+
+namespace oatpp { namespace web { namespace url { namespace mapping {
+
+/**
+ * Radix tree compiled from &id:oatpp::web::url::mapping::Pattern;s. <br>
+ * Static path segments are stored in hashed child maps, `{var}` and `*` parts are stored as dedicated child nodes.
+ * Lookup returns the first added pattern which matches the url - same precedence and the same
+ * &id:oatpp::web::url::mapping::Pattern::MatchMap; as matching patterns one by one in the order they were added.
+ */
+class PatternTree {
+private:
+  typedef oatpp::data::share::StringKeyLabel StringKeyLabel;
+private:
+
+  struct Node {
+
+    Node();
+
+    /**
+     * Name of the variable for `{var}` node.
+     */
+    StringKeyLabel name;
+
+    /**
+     * Index of the pattern ending at this node. -1 if none.
+     */
+    v_int32 endpointIndex;
+
+    /**
+     * Minimal pattern index in the subtree including this node. Used to prune lookup.
+     */
+    v_int32 minIndex;
+
+    std::unordered_map<StringKeyLabel, std::unique_ptr<Node>> constChildren;
+    std::vector<std::unique_ptr<Node>> varChildren;
+    std::unique_ptr<Node> tailChild;
+
+  };
+
+  struct Variable {
+    StringKeyLabel name;
+    StringKeyLabel value;
+  };
+
+  struct Result {
+    v_int32 index;
+    std::vector<Variable> variables;
+    StringKeyLabel tail;
+  };
+
+private:
+  static v_int32 skipSlashes(p_char8 data, v_int32 size, v_int32 pos);
+  static void accept(const Node* node, const std::vector<Variable>& variables, const StringKeyLabel& tail, Result& result);
+  static void acceptTail(const Node* node, const StringKeyLabel& url, v_int32 pos, std::vector<Variable>& variables, Result& result);
+  static void matchConst(const Node* node, const StringKeyLabel& url, v_int32 pos, std::vector<Variable>& variables, Result& result);
+  static void matchVar(const Node* node, const StringKeyLabel& url, v_int32 pos, std::vector<Variable>& variables, Result& result);
+  static void matchChildren(const Node* node, const StringKeyLabel& url, v_int32 pos, bool skipEnding,
+                            std::vector<Variable>& variables, Result& result);
+private:
+  Node m_root;
+  v_int32 m_patternsCount;
+public:
+
+  /**
+   * Constructor.
+   */
+  PatternTree();
+
+  /**
+   * Add pattern to the tree. Pattern receives index equal to the number of patterns added before it.
+   * @param pattern - &id:oatpp::web::url::mapping::Pattern;.
+   * @return - index of the added pattern.
+   */
+  v_int32 add(const std::shared_ptr<Pattern>& pattern);
+
+  /**
+   * Find the first added pattern matching url.
+   * @param url - url to match.
+   * @param matchMap - &id:oatpp::web::url::mapping::Pattern::MatchMap; to put resolved variables and url tail to.
+   * @return - index of the matched pattern or -1 if no pattern matches.
+   */
+  v_int32 match(const StringKeyLabel& url, Pattern::MatchMap& matchMap) const;
+
+  /**
+   * Get count of patterns added to the tree.
+   * @return
+   */
+  v_int32 getPatternsCount() const;
+
+};
+
+}}}}
+
+#endif /* oatpp_web_url_mapping_PatternTree_hpp */
@@ -25,17 +25,19 @@
 #ifndef oatpp_web_url_mapping_Router_hpp
 #define oatpp_web_url_mapping_Router_hpp
 
-#include "./Pattern.hpp"
+#include "./PatternTree.hpp"
 
 #include "oatpp/core/Types.hpp"
 
 #include <utility>
-#include <list>
+#include <vector>
 
 namespace oatpp { namespace web { namespace url { namespace mapping {
 
 /**
- * Class responsible to map "Path" to "Route" by "Path-Pattern".
+ * Class responsible to map "Path" to "Route" by "Path-Pattern". <br>
+ * Patterns are compiled into &id:oatpp::web::url::mapping::PatternTree;. If several patterns match the path,
+ * the one which was routed first wins.
  * @tparam Endpoint - endpoint of the route.
  */
 template<class Endpoint>
@@ -97,7 +99,8 @@ public:
   };
   
 private:
-  std::list<Pair> m_endpointsByPattern;
+  std::vector<Pair> m_endpointsByPattern;
+  PatternTree m_tree;
 public:
   
   static std::shared_ptr<Router> createShared(){
@@ -112,6 +115,7 @@ public:
   void route(const oatpp::String& pathPattern, const std::shared_ptr<Endpoint>& endpoint) {
     auto pattern = Pattern::parse(pathPattern);
     m_endpointsByPattern.push_back({pattern, endpoint});
+    m_tree.add(pattern);
   }
 
   /**
@@ -121,11 +125,10 @@ public:
    */
   Route getRoute(const StringKeyLabel& path){
 
-    for(auto& pair : m_endpointsByPattern) {
-      Pattern::MatchMap matchMap;
-      if(pair.first->match(path, matchMap)) {
-        return Route(pair.second.get(), matchMap);
-      }
+    Pattern::MatchMap matchMap;
+    v_int32 index = m_tree.match(path, matchMap);
+    if(index >= 0) {
+      return Route(m_endpointsByPattern[index].second.get(), matchMap);
     }
 
     return Route();
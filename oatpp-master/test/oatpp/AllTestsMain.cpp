@@ -3,30 +3,66 @@
 #include "oatpp/web/FullAsyncTest.hpp"
 #include "oatpp/web/FullAsyncClientTest.hpp"
 #include "oatpp/web/server/api/ApiControllerTest.hpp"
+#include "oatpp/web/server/HttpConnectionHandlerTest.hpp"
+#include "oatpp/web/server/HttpPipeliningPerfTest.hpp"
+#include "oatpp/web/server/HttpPipeliningTest.hpp"
+#include "oatpp/web/client/ConnectionPoolPerfTest.hpp"
+#include "oatpp/web/client/ConnectionPoolTest.hpp"
 
 #include "oatpp/web/mime/multipart/StatefulParserTest.hpp"
+#include "oatpp/web/protocol/http/HeaderMapTest.hpp"
+#include "oatpp/web/protocol/http/incoming/RequestHeadersReaderPerfTest.hpp"
+#include "oatpp/web/protocol/http/incoming/RequestHeadersReaderTest.hpp"
+#include "oatpp/web/protocol/http/incoming/SimpleBodyDecoderPerfTest.hpp"
+#include "oatpp/web/protocol/http/incoming/SimpleBodyDecoderTest.hpp"
+#include "oatpp/web/protocol/http/outgoing/ResponsePerfTest.hpp"
+#include "oatpp/web/protocol/http/outgoing/ResponseTest.hpp"
+#include "oatpp/web/protocol/http/outgoing/FileBodyPerfTest.hpp"
+#include "oatpp/web/protocol/http/outgoing/FileBodyTest.hpp"
+#include "oatpp/web/protocol/http/outgoing/DtoBodyPerfTest.hpp"
+#include "oatpp/web/protocol/http/outgoing/DtoBodyTest.hpp"
+#include "oatpp/web/protocol/http/outgoing/CompressedBodyPerfTest.hpp"
+#include "oatpp/web/protocol/http/outgoing/CompressedBodyTest.hpp"
+#include "oatpp/web/url/mapping/RouterPerfTest.hpp"
+#include "oatpp/web/url/mapping/RouterTest.hpp"
 
 #include "oatpp/network/virtual_/PipeTest.hpp"
 #include "oatpp/network/virtual_/InterfaceTest.hpp"
+#include "oatpp/network/ServerPerfTest.hpp"
+#include "oatpp/network/ServerTest.hpp"
 #include "oatpp/network/UrlTest.hpp"
 
 #include "oatpp/core/data/stream/ChunkedBufferTest.hpp"
 #include "oatpp/core/data/share/MemoryLabelTest.hpp"
 
 #include "oatpp/parser/json/mapping/DeserializerTest.hpp"
+#include "oatpp/parser/json/mapping/DeserializerReaderPerfTest.hpp"
+#include "oatpp/parser/json/mapping/DeserializerReaderTest.hpp"
 #include "oatpp/parser/json/mapping/DTOMapperPerfTest.hpp"
 #include "oatpp/parser/json/mapping/DTOMapperTest.hpp"
+#include "oatpp/parser/json/UtilsPerfTest.hpp"
+#include "oatpp/parser/json/UtilsTest.hpp"
 
 #include "oatpp/encoding/UnicodeTest.hpp"
 #include "oatpp/encoding/Base64Test.hpp"
 
 #include "oatpp/core/async/LockTest.hpp"
+#include "oatpp/core/async/ExecutorPerfTest.hpp"
+#include "oatpp/core/async/ExecutorTest.hpp"
+#include "oatpp/core/async/IOEventWorkerPerfTest.hpp"
+#include "oatpp/core/async/IOEventWorkerTest.hpp"
+#include "oatpp/core/async/TimerWorkerPerfTest.hpp"
+#include "oatpp/core/async/TimerWorkerTest.hpp"
+#include "oatpp/core/async/CoroutineArenaTest.hpp"
 
 #include "oatpp/core/parser/CaretTest.hpp"
+#include "oatpp/core/utils/ConversionUtilsPerfTest.hpp"
+#include "oatpp/core/utils/ConversionUtilsTest.hpp"
 
 #include "oatpp/core/data/mapping/type/TypeTest.hpp"
 #include "oatpp/core/base/collection/LinkedListTest.hpp"
 #include "oatpp/core/base/memory/MemoryPoolTest.hpp"
+#include "oatpp/core/base/memory/MemoryPoolPerfTest.hpp"
 #include "oatpp/core/base/memory/PerfTest.hpp"
 #include "oatpp/core/base/CommandLineArgumentsTest.hpp"
 #include "oatpp/core/base/RegRuleTest.hpp"
@@ -60,22 +96,42 @@ void runTests() {
   OATPP_RUN_TEST(oatpp::test::core::data::mapping::type::TypeTest);
 
   OATPP_RUN_TEST(oatpp::test::async::LockTest);
+  OATPP_RUN_TEST(oatpp::test::async::ExecutorTest);
+  OATPP_RUN_TEST(oatpp::test::async::IOEventWorkerTest);
+  OATPP_RUN_TEST(oatpp::test::async::TimerWorkerTest);
+  OATPP_RUN_TEST(oatpp::test::async::CoroutineArenaTest);
+
+  OATPP_RUN_TEST(oatpp::test::core::utils::ConversionUtilsTest);
 
   OATPP_RUN_TEST(oatpp::test::parser::CaretTest);
   OATPP_RUN_TEST(oatpp::test::parser::json::mapping::DeserializerTest);
+  OATPP_RUN_TEST(oatpp::test::parser::json::mapping::DeserializerReaderTest);
   OATPP_RUN_TEST(oatpp::test::parser::json::mapping::DTOMapperPerfTest);
   OATPP_RUN_TEST(oatpp::test::parser::json::mapping::DTOMapperTest);
+  OATPP_RUN_TEST(oatpp::test::parser::json::UtilsTest);
 
   OATPP_RUN_TEST(oatpp::test::encoding::Base64Test);
   OATPP_RUN_TEST(oatpp::test::encoding::UnicodeTest);
 
   OATPP_RUN_TEST(oatpp::test::network::UrlTest);
+  OATPP_RUN_TEST(oatpp::test::network::ServerTest);
   OATPP_RUN_TEST(oatpp::test::network::virtual_::PipeTest);
   OATPP_RUN_TEST(oatpp::test::network::virtual_::InterfaceTest);
 
   OATPP_RUN_TEST(oatpp::test::web::mime::multipart::StatefulParserTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::HeaderMapTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::incoming::RequestHeadersReaderTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::incoming::SimpleBodyDecoderTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::outgoing::ResponseTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::outgoing::FileBodyTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::outgoing::DtoBodyTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::outgoing::CompressedBodyTest);
+  OATPP_RUN_TEST(oatpp::test::web::url::mapping::RouterTest);
 
   OATPP_RUN_TEST(oatpp::test::web::server::api::ApiControllerTest);
+  OATPP_RUN_TEST(oatpp::test::web::server::HttpConnectionHandlerTest);
+  OATPP_RUN_TEST(oatpp::test::web::server::HttpPipeliningTest);
+  OATPP_RUN_TEST(oatpp::test::web::client::ConnectionPoolTest);
 
   {
 
@@ -85,6 +141,9 @@ void runTests() {
     oatpp::test::web::FullTest test_port(8000, 10);
     test_port.run();
 
+    oatpp::test::web::FullTest test_port_pool(8000, 10, 4);
+    test_port_pool.run();
+
   }
 
   {
@@ -108,6 +167,35 @@ void runTests() {
   }
 
 }
+
+#ifdef OATPP_ENABLE_PERF_TESTS
+
+/*
+ * Benchmarks. Enabled with -DOATPP_BUILD_PERF_TESTS=ON
+ */
+void runPerfTests() {
+
+  OATPP_RUN_TEST(oatpp::test::async::IOEventWorkerPerfTest);
+  OATPP_RUN_TEST(oatpp::test::async::TimerWorkerPerfTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::outgoing::FileBodyPerfTest);
+  OATPP_RUN_TEST(oatpp::test::web::client::ConnectionPoolPerfTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::incoming::SimpleBodyDecoderPerfTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::outgoing::CompressedBodyPerfTest);
+  OATPP_RUN_TEST(oatpp::test::core::utils::ConversionUtilsPerfTest);
+  OATPP_RUN_TEST(oatpp::test::network::ServerPerfTest);
+  OATPP_RUN_TEST(oatpp::test::async::ExecutorPerfTest);
+  OATPP_RUN_TEST(oatpp::test::web::url::mapping::RouterPerfTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::incoming::RequestHeadersReaderPerfTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::outgoing::ResponsePerfTest);
+  OATPP_RUN_TEST(oatpp::test::web::server::HttpPipeliningPerfTest);
+  OATPP_RUN_TEST(oatpp::test::parser::json::UtilsPerfTest);
+  OATPP_RUN_TEST(oatpp::test::web::protocol::http::outgoing::DtoBodyPerfTest);
+  OATPP_RUN_TEST(oatpp::test::parser::json::mapping::DeserializerReaderPerfTest);
+  OATPP_RUN_TEST(oatpp::test::memory::MemoryPoolPerfTest);
+
+}
+
+#endif
   
 }
 
@@ -116,6 +204,10 @@ int main() {
   oatpp::base::Environment::init();
   
   runTests();
+
+#ifdef OATPP_ENABLE_PERF_TESTS
+  runPerfTests();
+#endif
   
   /* Print how much objects were created during app running, and what have left-probably leaked */
   /* Disable object counting for release builds using '-D OATPP_DISABLE_ENV_OBJECT_COUNTERS' flag for better performance */
@@ -0,0 +1,159 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "CoroutineArenaTest.hpp"
+
+#include "oatpp/core/async/CoroutineArena.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace oatpp { namespace test { namespace async {
+
+namespace {
+
+typedef oatpp::async::CoroutineArena CoroutineArena;
+
+void testSizeClasses() {
+
+#ifndef OATPP_DISABLE_POOL_ALLOCATIONS
+
+  /* free entries are reused LIFO - the next allocation of the same size class gets the same memory */
+  for(v_int32 i = 0; i < CoroutineArena::SIZE_CLASSES_COUNT; i ++) {
+
+    std::size_t maxSize = CoroutineArena::MIN_ENTRY_SIZE << i;
+    std::size_t minSize = i == 0 ? 1 : (maxSize >> 1) + 1;
+
+    void* ptr = CoroutineArena::allocate(maxSize);
+    CoroutineArena::deallocate(ptr, maxSize);
+
+    void* sameClass = CoroutineArena::allocate(minSize);
+    OATPP_ASSERT(sameClass == ptr);
+
+    void* nextClass = CoroutineArena::allocate(maxSize + 1);
+    OATPP_ASSERT(nextClass != ptr);
+
+    CoroutineArena::deallocate(nextClass, maxSize + 1);
+    CoroutineArena::deallocate(sameClass, minSize);
+
+  }
+
+#endif
+
+}
+
+void testReuse(CoroutineArena* arena) {
+
+  const v_int32 count = 1000;
+  const v_int32 entriesPerChunk = CoroutineArena::CHUNK_MEMORY_SIZE / CoroutineArena::MIN_ENTRY_SIZE;
+
+  std::vector<void*> entries(count);
+
+  for(v_int32 iteration = 0; iteration < 3; iteration ++) {
+
+    auto before = arena->getStats();
+
+    for(auto& entry : entries) {
+      entry = CoroutineArena::allocate(CoroutineArena::MIN_ENTRY_SIZE);
+    }
+
+    auto after = arena->getStats();
+    OATPP_ASSERT(after.allocations - before.allocations == count);
+
+#ifndef OATPP_DISABLE_POOL_ALLOCATIONS
+    if(iteration == 0) {
+      OATPP_ASSERT(after.heapAllocations - before.heapAllocations <= (count + entriesPerChunk - 1) / entriesPerChunk);
+    } else {
+      /* memory freed in the previous iteration is reused */
+      OATPP_ASSERT(after.heapAllocations == before.heapAllocations);
+    }
+#else
+    (void) entriesPerChunk;
+#endif
+
+    for(auto entry : entries) {
+      CoroutineArena::deallocate(entry, CoroutineArena::MIN_ENTRY_SIZE);
+    }
+
+  }
+
+}
+
+void testHeapFallback(CoroutineArena* arena) {
+
+  std::size_t size = CoroutineArena::MAX_ENTRY_SIZE + 1;
+
+  auto before = arena->getStats();
+  void* ptr = CoroutineArena::allocate(size);
+  auto after = arena->getStats();
+
+  OATPP_ASSERT(after.allocations - before.allocations == 1);
+  OATPP_ASSERT(after.heapAllocations - before.heapAllocations == 1);
+
+  std::memset(ptr, 0, size);
+  CoroutineArena::deallocate(ptr, size);
+
+}
+
+void testRelease(CoroutineArena* arena) {
+
+  /* memory allocated in arena stays valid after the arena is released - as after the processor is destroyed */
+  void* ptr = CoroutineArena::allocate(CoroutineArena::MIN_ENTRY_SIZE);
+  CoroutineArena::setThreadArena(nullptr);
+  CoroutineArena::release(arena);
+
+  std::memset(ptr, 0, CoroutineArena::MIN_ENTRY_SIZE);
+  CoroutineArena::deallocate(ptr, CoroutineArena::MIN_ENTRY_SIZE);
+
+  /* released arena is reused */
+  std::vector<CoroutineArena*> acquired;
+  bool reused = false;
+  for(v_int32 i = 0; i < 1000 && !reused; i ++) {
+    acquired.push_back(CoroutineArena::acquire());
+    reused = acquired.back() == arena;
+  }
+  OATPP_ASSERT(reused);
+
+  for(auto a : acquired) {
+    CoroutineArena::release(a);
+  }
+
+}
+
+}
+
+void CoroutineArenaTest::onRun() {
+
+  auto arena = CoroutineArena::acquire();
+  CoroutineArena::setThreadArena(arena);
+
+  testSizeClasses();
+  testReuse(arena);
+  testHeapFallback(arena);
+  testRelease(arena);
+
+}
+
+}}}
@@ -0,0 +1,195 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ExecutorPerfTest.hpp"
+
+#include "oatpp/core/async/Executor.hpp"
+
+#include <algorithm>
+#include <list>
+#include <thread>
+#include <vector>
+
+namespace oatpp { namespace test { namespace async {
+
+namespace {
+
+static constexpr v_int32 HEAVY_ITERATIONS = 200;
+static constexpr v_int64 HEAVY_ITERATION_MICROS = 20;
+static constexpr v_int32 LIGHT_ITERATIONS = 5;
+static constexpr v_int32 HEAVY_COUNT = 8;
+static constexpr v_int32 ROUNDS = 50;
+
+void burnCpu(v_int64 micros) {
+  v_int64 start = oatpp::base::Environment::getMicroTickCount();
+  while(oatpp::base::Environment::getMicroTickCount() - start < micros) {}
+}
+
+class HeavyCoroutine : public oatpp::async::Coroutine<HeavyCoroutine> {
+private:
+  v_int32 m_counter;
+public:
+
+  HeavyCoroutine()
+    : m_counter(0)
+  {}
+
+  Action act() override {
+    if(m_counter < HEAVY_ITERATIONS) {
+      m_counter ++;
+      burnCpu(HEAVY_ITERATION_MICROS);
+      return repeat();
+    }
+    return finish();
+  }
+
+};
+
+class LightCoroutine : public oatpp::async::Coroutine<LightCoroutine> {
+private:
+  v_int64 m_submitTick;
+  v_int64* m_latency;
+  v_int32 m_counter;
+public:
+
+  LightCoroutine(v_int64 submitTick, v_int64* latency)
+    : m_submitTick(submitTick)
+    , m_latency(latency)
+    , m_counter(0)
+  {}
+
+  Action act() override {
+    if(m_counter < LIGHT_ITERATIONS) {
+      m_counter ++;
+      return repeat();
+    }
+    *m_latency = oatpp::base::Environment::getMicroTickCount() - m_submitTick;
+    return finish();
+  }
+
+};
+
+class NoopCoroutine : public oatpp::async::Coroutine<NoopCoroutine> {
+public:
+
+  Action act() override {
+    return finish();
+  }
+
+};
+
+/*
+ * Submit load so that all heavy coroutines land on the same processor (Executor balances round-robin).
+ * Return p99 latency of light coroutines in microseconds.
+ */
+v_int64 runSkewedLoad(v_int32 processorsCount, bool useWorkStealing) {
+
+  const v_int32 lightCount = processorsCount * ROUNDS - HEAVY_COUNT;
+
+  std::vector<v_int64> latencies(lightCount, -1);
+
+  oatpp::async::Executor executor(processorsCount, 1, 1, oatpp::async::Executor::IO_WORKER_TYPE_EVENT, useWorkStealing);
+
+  v_int32 lightIndex = 0;
+  for(v_int32 round = 0; round < ROUNDS; round ++) {
+    for(v_int32 i = 0; i < processorsCount; i ++) {
+      if(i == 0 && round < HEAVY_COUNT) {
+        executor.execute<HeavyCoroutine>();
+      } else {
+        executor.execute<LightCoroutine>(oatpp::base::Environment::getMicroTickCount(), &latencies[lightIndex ++]);
+      }
+    }
+  }
+
+  executor.waitTasksFinished();
+  executor.stop();
+  executor.join();
+
+  OATPP_ASSERT(lightIndex == lightCount);
+  for(auto latency : latencies) {
+    OATPP_ASSERT(latency >= 0);
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  return latencies[lightCount * 99 / 100];
+
+}
+
+void runSubmitThroughput(const char* tag, v_int32 producersCount, v_int32 submissionsCount) {
+
+  oatpp::async::Executor executor(2, 1, 1);
+
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+
+  std::list<std::thread> producers;
+  for(v_int32 i = 0; i < producersCount; i ++) {
+    producers.push_back(std::thread([&executor, producersCount, submissionsCount] {
+      for(v_int32 j = 0; j < submissionsCount / producersCount; j ++) {
+        executor.execute<NoopCoroutine>();
+      }
+    }));
+  }
+
+  for(auto& producer : producers) {
+    producer.join();
+  }
+
+  v_int64 submitTime = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  while(executor.getTasksCount() > 0) {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+
+  v_int64 totalTime = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  executor.stop();
+  executor.join();
+
+  OATPP_LOGD(tag, "producers=%d, submitted %d coroutines: submit=%lld(submissions/sec), executed=%lld(coroutines/sec)",
+             producersCount, submissionsCount,
+             (v_int64) submissionsCount * 1000000 / (submitTime + 1), (v_int64) submissionsCount * 1000000 / (totalTime + 1));
+
+}
+
+}
+
+void ExecutorPerfTest::onRun() {
+
+  for(v_int32 producersCount = 1; producersCount <= 8; producersCount *= 2) {
+    runSubmitThroughput(TAG, producersCount, 200000);
+  }
+
+  for(v_int32 processorsCount = 8; processorsCount <= 32; processorsCount *= 2) {
+
+    v_int64 p99Default = runSkewedLoad(processorsCount, false);
+    v_int64 p99Stealing = runSkewedLoad(processorsCount, true);
+
+    OATPP_LOGD(TAG, "processors=%d, light coroutines p99 latency: round-robin=%lld(micro), work-stealing=%lld(micro)",
+               processorsCount, p99Default, p99Stealing);
+
+  }
+
+}
+
+}}}
@@ -0,0 +1,174 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ExecutorTest.hpp"
+
+#include "oatpp/core/async/Executor.hpp"
+
+#include <functional>
+#include <list>
+#include <thread>
+#include <memory>
+
+namespace oatpp { namespace test { namespace async {
+
+namespace {
+
+class CountingCoroutine : public oatpp::async::Coroutine<CountingCoroutine> {
+private:
+  std::atomic<v_int32>* m_counter;
+public:
+
+  CountingCoroutine(std::atomic<v_int32>* counter)
+    : m_counter(counter)
+  {}
+
+  Action act() override {
+    ++ (*m_counter);
+    return finish();
+  }
+
+};
+
+/*
+ * Occupy processor thread until released.
+ */
+class BlockingCoroutine : public oatpp::async::Coroutine<BlockingCoroutine> {
+private:
+  std::atomic<bool>* m_started;
+  std::atomic<bool>* m_released;
+public:
+
+  BlockingCoroutine(std::atomic<bool>* started, std::atomic<bool>* released)
+    : m_started(started)
+    , m_released(released)
+  {}
+
+  Action act() override {
+    *m_started = true;
+    while(!*m_released) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return finish();
+  }
+
+};
+
+void waitFor(const std::function<bool()>& condition, v_int64 timeoutMicros) {
+  v_int64 start = oatpp::base::Environment::getMicroTickCount();
+  while(!condition() && oatpp::base::Environment::getMicroTickCount() - start < timeoutMicros) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+/*
+ * Concurrent producers - each submitted coroutine is executed exactly once.
+ */
+void testConcurrentSubmit(bool useWorkStealing) {
+
+  const v_int32 producersCount = 8;
+  const v_int32 submissionsCount = 2000;
+
+  std::unique_ptr<std::atomic<v_int32>[]> counters(new std::atomic<v_int32>[producersCount * submissionsCount]);
+  for(v_int32 i = 0; i < producersCount * submissionsCount; i ++) {
+    counters[i] = 0;
+  }
+
+  oatpp::async::Executor executor(4, 1, 1, oatpp::async::Executor::IO_WORKER_TYPE_EVENT, useWorkStealing);
+
+  std::list<std::thread> producers;
+  for(v_int32 i = 0; i < producersCount; i ++) {
+    std::atomic<v_int32>* producerCounters = &counters[i * submissionsCount];
+    producers.push_back(std::thread([&executor, producerCounters] {
+      for(v_int32 j = 0; j < submissionsCount; j ++) {
+        executor.execute<CountingCoroutine>(&producerCounters[j]);
+      }
+    }));
+  }
+
+  for(auto& producer : producers) {
+    producer.join();
+  }
+
+  executor.waitTasksFinished();
+  executor.stop();
+  executor.join();
+
+  for(v_int32 i = 0; i < producersCount * submissionsCount; i ++) {
+    OATPP_ASSERT(counters[i] == 1);
+  }
+
+}
+
+/*
+ * Coroutines queued on a processor whose thread is busy are taken over by the idle processor.
+ */
+void testStealFromBusyProcessor() {
+
+  const v_int32 tasksCount = 20;
+
+  std::atomic<bool> started(false);
+  std::atomic<bool> released(false);
+  std::atomic<v_int32> counter(0);
+
+  oatpp::async::Executor executor(2, 1, 1, oatpp::async::Executor::IO_WORKER_TYPE_EVENT, true);
+
+  executor.execute<BlockingCoroutine>(&started, &released);
+  waitFor([&started] { return started.load(); }, 5 * 1000 * 1000);
+  OATPP_ASSERT(started);
+
+  // half of them lands behind the blocking coroutine
+  for(v_int32 i = 0; i < tasksCount; i ++) {
+    executor.execute<CountingCoroutine>(&counter);
+  }
+
+  waitFor([&counter] { return counter == tasksCount; }, 5 * 1000 * 1000);
+  bool allExecuted = (counter == tasksCount);
+
+  released = true;
+
+  executor.waitTasksFinished();
+  executor.stop();
+  executor.join();
+
+  OATPP_ASSERT(allExecuted);
+
+}
+
+}
+
+void ExecutorTest::onRun() {
+
+  OATPP_LOGD(TAG, "concurrent submit...");
+  testConcurrentSubmit(false);
+
+  OATPP_LOGD(TAG, "concurrent submit with work-stealing...");
+  testConcurrentSubmit(true);
+
+  OATPP_LOGD(TAG, "steal from busy processor...");
+  testStealFromBusyProcessor();
+
+}
+
+}}}
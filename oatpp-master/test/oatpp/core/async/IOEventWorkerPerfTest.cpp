@@ -0,0 +1,209 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "IOEventWorkerPerfTest.hpp"
+
+#include "oatpp/core/async/Executor.hpp"
+#include "oatpp/network/Connection.hpp"
+
+#if !defined(WIN32) && !defined(_WIN32)
+#include <sys/socket.h>
+#endif
+
+namespace oatpp { namespace test { namespace async {
+
+#if !defined(WIN32) && !defined(_WIN32)
+
+namespace {
+
+static constexpr v_int32 PAIRS_COUNT = 256;
+static constexpr v_int32 REQUESTS_PER_PAIR = 200;
+static constexpr v_int32 REQUEST_SIZE = 256;
+static constexpr v_int32 RESPONSE_SIZE = 1024;
+
+/*
+ * Read request - write response. Repeat.
+ */
+class ServerCoroutine : public oatpp::async::Coroutine<ServerCoroutine> {
+private:
+  std::shared_ptr<oatpp::network::Connection> m_connection;
+  v_int32 m_counter;
+  v_char8 m_buffer[RESPONSE_SIZE];
+  oatpp::data::stream::AsyncInlineReadData m_inlineRead;
+  oatpp::data::stream::AsyncInlineWriteData m_inlineWrite;
+public:
+
+  ServerCoroutine(const std::shared_ptr<oatpp::network::Connection>& connection)
+    : m_connection(connection)
+    , m_counter(0)
+  {}
+
+  Action act() override {
+    if(m_counter == REQUESTS_PER_PAIR) {
+      return finish();
+    }
+    m_inlineRead.set(m_buffer, REQUEST_SIZE);
+    return yieldTo(&ServerCoroutine::readRequest);
+  }
+
+  Action readRequest() {
+    return oatpp::data::stream::readExactSizeDataAsyncInline(this, m_connection.get(), m_inlineRead,
+                                                             yieldTo(&ServerCoroutine::onRequest));
+  }
+
+  Action onRequest() {
+    std::memset(m_buffer, m_buffer[0], RESPONSE_SIZE);
+    m_inlineWrite.set(m_buffer, RESPONSE_SIZE);
+    return yieldTo(&ServerCoroutine::writeResponse);
+  }
+
+  Action writeResponse() {
+    return oatpp::data::stream::writeExactSizeDataAsyncInline(this, m_connection.get(), m_inlineWrite,
+                                                              yieldTo(&ServerCoroutine::onResponseSent));
+  }
+
+  Action onResponseSent() {
+    m_counter ++;
+    return yieldTo(&ServerCoroutine::act);
+  }
+
+};
+
+/*
+ * Write request - read response. Repeat.
+ */
+class ClientCoroutine : public oatpp::async::Coroutine<ClientCoroutine> {
+private:
+  std::shared_ptr<oatpp::network::Connection> m_connection;
+  std::atomic<v_int32>* m_errors;
+  v_int32 m_counter;
+  v_char8 m_buffer[RESPONSE_SIZE];
+  oatpp::data::stream::AsyncInlineReadData m_inlineRead;
+  oatpp::data::stream::AsyncInlineWriteData m_inlineWrite;
+public:
+
+  ClientCoroutine(const std::shared_ptr<oatpp::network::Connection>& connection, std::atomic<v_int32>* errors)
+    : m_connection(connection)
+    , m_errors(errors)
+    , m_counter(0)
+  {}
+
+  Action act() override {
+    if(m_counter == REQUESTS_PER_PAIR) {
+      return finish();
+    }
+    std::memset(m_buffer, (v_char8) m_counter, REQUEST_SIZE);
+    m_inlineWrite.set(m_buffer, REQUEST_SIZE);
+    return yieldTo(&ClientCoroutine::writeRequest);
+  }
+
+  Action writeRequest() {
+    return oatpp::data::stream::writeExactSizeDataAsyncInline(this, m_connection.get(), m_inlineWrite,
+                                                              yieldTo(&ClientCoroutine::onRequestSent));
+  }
+
+  Action onRequestSent() {
+    m_inlineRead.set(m_buffer, RESPONSE_SIZE);
+    return yieldTo(&ClientCoroutine::readResponse);
+  }
+
+  Action readResponse() {
+    return oatpp::data::stream::readExactSizeDataAsyncInline(this, m_connection.get(), m_inlineRead,
+                                                             yieldTo(&ClientCoroutine::onResponse));
+  }
+
+  Action onResponse() {
+    if(m_buffer[0] != (v_char8) m_counter || m_buffer[RESPONSE_SIZE - 1] != (v_char8) m_counter) {
+      ++ (*m_errors);
+    }
+    m_counter ++;
+    return yieldTo(&ClientCoroutine::act);
+  }
+
+  Action handleError(const std::shared_ptr<const Error>& error) override {
+    (void) error;
+    ++ (*m_errors);
+    return finish();
+  }
+
+};
+
+std::shared_ptr<oatpp::network::Connection> createConnection(oatpp::data::v_io_handle handle) {
+  auto connection = std::make_shared<oatpp::network::Connection>(handle);
+  connection->setInputStreamIOMode(oatpp::data::stream::IOMode::NON_BLOCKING);
+  return connection;
+}
+
+void runPingPong(const char* tag, const char* modeName, v_int32 ioWorkerType) {
+
+  oatpp::async::Executor executor(2, 4, 1, ioWorkerType);
+  std::atomic<v_int32> errors(0);
+
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+
+  for(v_int32 i = 0; i < PAIRS_COUNT; i ++) {
+    int handles[2];
+    auto res = ::socketpair(AF_UNIX, SOCK_STREAM, 0, handles);
+    OATPP_ASSERT(res == 0);
+    executor.execute<ServerCoroutine>(createConnection(handles[0]));
+    executor.execute<ClientCoroutine>(createConnection(handles[1]), &errors);
+  }
+
+  executor.waitTasksFinished();
+
+  ticks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  executor.stop();
+  executor.join();
+
+  OATPP_ASSERT(errors == 0);
+  OATPP_ASSERT(executor.getTasksCount() == 0);
+
+  v_int64 requests = (v_int64) PAIRS_COUNT * REQUESTS_PER_PAIR;
+
+  OATPP_LOGD(tag, "%s: %lld(requests/sec)", modeName, requests * 1000000 / (ticks + 1));
+
+}
+
+}
+
+void IOEventWorkerPerfTest::onRun() {
+
+  for(v_int32 i = 0; i < 2; i ++) {
+    runPingPong(TAG, "re-arm    ", oatpp::async::Executor::IO_WORKER_TYPE_EVENT);
+    runPingPong(TAG, "persistent", oatpp::async::Executor::IO_WORKER_TYPE_EVENT_PERSISTENT);
+    runPingPong(TAG, "io_uring  ", oatpp::async::Executor::IO_WORKER_TYPE_URING);
+  }
+
+}
+
+#else
+
+void IOEventWorkerPerfTest::onRun() {
+  OATPP_LOGD(TAG, "Skipped. socketpair() is not available.");
+}
+
+#endif
+
+}}}
@@ -0,0 +1,161 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "TimerWorkerPerfTest.hpp"
+
+#include "oatpp/core/async/Processor.hpp"
+#include "oatpp/core/async/worker/TimerWorker.hpp"
+
+namespace oatpp { namespace test { namespace async {
+
+namespace {
+
+static constexpr v_int32 IDLE_COROUTINES_COUNT = 100000;
+static constexpr v_int32 COROUTINES_COUNT = 2000;
+static constexpr v_int32 WAITS_PER_COROUTINE = 500;
+static constexpr v_int64 MAX_WAIT_MICROS = 500;
+
+/*
+ * Long sleeping coroutine - like one waiting for keep-alive timeout.
+ */
+class IdleCoroutine : public oatpp::async::Coroutine<IdleCoroutine> {
+private:
+  std::atomic<bool>* m_done;
+public:
+
+  IdleCoroutine(std::atomic<bool>* done)
+    : m_done(done)
+  {}
+
+  Action act() override {
+    if(*m_done) {
+      return finish();
+    }
+    return waitRepeat(std::chrono::milliseconds(100));
+  }
+
+};
+
+class SleepCoroutine : public oatpp::async::Coroutine<SleepCoroutine> {
+private:
+  v_int32 m_id;
+  v_int32 m_counter;
+  v_int64 m_deadline;
+  std::atomic<v_int64>* m_totalLateness;
+  std::atomic<v_int32>* m_totalWaits;
+  v_int64 m_lateness;
+public:
+
+  SleepCoroutine(v_int32 id, std::atomic<v_int64>* totalLateness, std::atomic<v_int32>* totalWaits)
+    : m_id(id)
+    , m_counter(0)
+    , m_deadline(0)
+    , m_totalLateness(totalLateness)
+    , m_totalWaits(totalWaits)
+    , m_lateness(0)
+  {}
+
+  Action act() override {
+
+    if(m_counter > 0) {
+      auto now = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch());
+      OATPP_ASSERT(now.count() >= m_deadline);
+      m_lateness += now.count() - m_deadline;
+    }
+
+    if(m_counter < WAITS_PER_COROUTINE) {
+      m_counter ++;
+      v_int64 waitMicros = (m_id * 7919 + m_counter * 104729) % MAX_WAIT_MICROS;
+      auto now = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch());
+      m_deadline = now.count() + waitMicros;
+      return waitRepeat(std::chrono::microseconds(waitMicros));
+    }
+
+    *m_totalLateness += m_lateness;
+    *m_totalWaits += m_counter;
+    return finish();
+
+  }
+
+};
+
+void runTimerChurn(const char* tag, oatpp::async::worker::TimerWorker::Backend backend) {
+
+  std::atomic<v_int64> totalLateness(0);
+  std::atomic<v_int32> totalWaits(0);
+  std::atomic<bool> idleDone(false);
+
+  auto timer = std::make_shared<oatpp::async::worker::TimerWorker>(std::chrono::milliseconds(1), backend);
+
+  {
+
+    oatpp::async::Processor processor;
+    processor.addWorker(timer);
+
+    for(v_int32 i = 0; i < IDLE_COROUTINES_COUNT; i ++) {
+      processor.execute<IdleCoroutine>(&idleDone);
+    }
+
+    while(processor.iterate(100)) {}
+
+    v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+
+    for(v_int32 i = 0; i < COROUTINES_COUNT; i ++) {
+      processor.execute<SleepCoroutine>(i, &totalLateness, &totalWaits);
+    }
+
+    while(totalWaits < COROUTINES_COUNT * WAITS_PER_COROUTINE) {
+      while(processor.iterate(100)) {}
+      processor.waitForTasks(std::chrono::milliseconds(10));
+    }
+
+    v_int64 elapsed = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+    idleDone = true;
+
+    while(processor.getTasksCount() > 0) {
+      while(processor.iterate(100)) {}
+      processor.waitForTasks(std::chrono::milliseconds(10));
+    }
+
+    OATPP_ASSERT(totalWaits == COROUTINES_COUNT * WAITS_PER_COROUTINE);
+
+    OATPP_LOGD(tag, "%d sleeping coroutines, %d scheduled waits in %lld(micro), %lld(waits/sec), average lateness=%lld(micro)",
+               IDLE_COROUTINES_COUNT, totalWaits.load(), elapsed, (v_int64) totalWaits * 1000000 / elapsed, totalLateness / totalWaits);
+
+  }
+
+  timer->stop();
+  timer->join();
+
+}
+
+}
+
+void TimerWorkerPerfTest::onRun() {
+  runTimerChurn("TimerWorker::LINEAR_SCAN", oatpp::async::worker::TimerWorker::Backend::LINEAR_SCAN);
+  runTimerChurn("TimerWorker::MIN_HEAP", oatpp::async::worker::TimerWorker::Backend::MIN_HEAP);
+}
+
+}}}
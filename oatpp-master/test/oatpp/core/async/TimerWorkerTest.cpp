@@ -0,0 +1,104 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "TimerWorkerTest.hpp"
+
+#include "oatpp/core/async/Executor.hpp"
+
+namespace oatpp { namespace test { namespace async {
+
+namespace {
+
+static constexpr v_int32 COROUTINES_COUNT = 100;
+static constexpr v_int32 WAITS_PER_COROUTINE = 5;
+
+class SleepCoroutine : public oatpp::async::Coroutine<SleepCoroutine> {
+private:
+  v_int32 m_id;
+  v_int32 m_counter;
+  v_int64 m_deadline;
+  std::atomic<v_int32>* m_totalWaits;
+public:
+
+  SleepCoroutine(v_int32 id, std::atomic<v_int32>* totalWaits)
+    : m_id(id)
+    , m_counter(0)
+    , m_deadline(0)
+    , m_totalWaits(totalWaits)
+  {}
+
+  Action act() override {
+
+    auto now = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch());
+
+    if(m_counter > 0) {
+      OATPP_ASSERT(now.count() >= m_deadline);
+      ++ (*m_totalWaits);
+    }
+
+    if(m_counter < WAITS_PER_COROUTINE) {
+      m_counter ++;
+      v_int64 waitMicros = 1000 + (m_id * 7919 + m_counter * 104729) % 5000;
+      m_deadline = now.count() + waitMicros;
+      return waitRepeat(std::chrono::microseconds(waitMicros));
+    }
+
+    return finish();
+
+  }
+
+};
+
+void runSleepers(v_int32 timerWorkerType) {
+
+  std::atomic<v_int32> totalWaits(0);
+
+  oatpp::async::Executor executor(1, 1, 1, oatpp::async::Executor::IO_WORKER_TYPE_NAIVE, false, timerWorkerType);
+
+  for(v_int32 i = 0; i < COROUTINES_COUNT; i ++) {
+    executor.execute<SleepCoroutine>(i, &totalWaits);
+  }
+
+  executor.waitTasksFinished();
+  OATPP_ASSERT(totalWaits == COROUTINES_COUNT * WAITS_PER_COROUTINE);
+
+  /* Leave sleepers in the timer queue - they are deleted together with the worker */
+  for(v_int32 i = 0; i < COROUTINES_COUNT; i ++) {
+    executor.execute<SleepCoroutine>(i, &totalWaits);
+  }
+
+  executor.stop();
+  executor.join();
+
+}
+
+}
+
+void TimerWorkerTest::onRun() {
+  runSleepers(oatpp::async::Executor::TIMER_WORKER_TYPE_LINEAR_SCAN);
+  runSleepers(oatpp::async::Executor::TIMER_WORKER_TYPE_MIN_HEAP);
+}
+
+}}}
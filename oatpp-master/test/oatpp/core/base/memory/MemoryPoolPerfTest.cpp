@@ -0,0 +1,202 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "MemoryPoolPerfTest.hpp"
+
+#include "oatpp/core/base/memory/MemoryPool.hpp"
+
+#include <condition_variable>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace oatpp { namespace test { namespace memory {
+
+namespace {
+
+  constexpr const char* const POOL_NAME = "MemoryPoolPerfTest_Pool";
+  constexpr v_int32 POOL_ENTRY_SIZE = 64;
+  constexpr v_int32 THREADS_COUNT = 8;
+  constexpr v_int32 OPS_PER_THREAD = 500000;
+  constexpr v_int32 BATCH_SIZE = 64;
+  constexpr std::size_t MAX_QUEUED_BATCHES = 64;
+
+  /*
+   * Sum statistics of shards of the test pool.
+   */
+  oatpp::base::Environment::MemoryPoolsStatistics getTestPoolStatistics() {
+    oatpp::base::Environment::MemoryPoolsStatistics stats = {0, 0, 0, 0};
+    std::lock_guard<oatpp::concurrency::SpinLock> lock(oatpp::base::memory::MemoryPool::POOLS_SPIN_LOCK);
+    for(auto& pair : oatpp::base::memory::MemoryPool::POOLS) {
+      auto pool = pair.second;
+      if(pool->getName().compare(0, std::strlen(POOL_NAME), POOL_NAME) == 0) {
+        stats.cacheHits += pool->getCacheHits();
+        stats.cacheMisses += pool->getCacheMisses();
+        stats.objectsCount += pool->getObjectsCount();
+        stats.bytesHeld += pool->getMemorySize();
+      }
+    }
+    return stats;
+  }
+
+  /*
+   * Each thread obtains and frees entries in batches.
+   */
+  void runSameThread(oatpp::base::memory::ThreadDistributedMemoryPool* pool) {
+    void* entries[BATCH_SIZE];
+    for(v_int32 i = 0; i < OPS_PER_THREAD; i += BATCH_SIZE) {
+      for(v_int32 j = 0; j < BATCH_SIZE; j ++) {
+        entries[j] = pool->obtain();
+        *((v_int32*) entries[j]) = j;
+      }
+      for(v_int32 j = 0; j < BATCH_SIZE; j ++) {
+        OATPP_ASSERT(*((v_int32*) entries[j]) == j);
+        oatpp::base::memory::MemoryPool::free(entries[j]);
+      }
+    }
+  }
+
+  /*
+   * Entries are obtained by producer threads and freed by consumer threads -
+   * like buffers allocated by IO worker and released by processor.
+   */
+  class CrossThreadQueue {
+  private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::list<std::vector<void*>> m_batches;
+    v_int32 m_producersLeft;
+  public:
+
+    CrossThreadQueue(v_int32 producers)
+      : m_producersLeft(producers)
+    {}
+
+    void produce(oatpp::base::memory::ThreadDistributedMemoryPool* pool) {
+      for(v_int32 i = 0; i < OPS_PER_THREAD; i += BATCH_SIZE) {
+        std::vector<void*> batch(BATCH_SIZE);
+        for(v_int32 j = 0; j < BATCH_SIZE; j ++) {
+          batch[j] = pool->obtain();
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]{ return m_batches.size() < MAX_QUEUED_BATCHES; });
+        m_batches.push_back(std::move(batch));
+        m_cv.notify_all();
+      }
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_producersLeft --;
+      m_cv.notify_all();
+    }
+
+    void consume() {
+      while(true) {
+        std::vector<void*> batch;
+        {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          m_cv.wait(lock, [this]{ return !m_batches.empty() || m_producersLeft == 0; });
+          if(m_batches.empty()) {
+            return;
+          }
+          batch = std::move(m_batches.front());
+          m_batches.pop_front();
+          m_cv.notify_all();
+        }
+        for(void* entry : batch) {
+          oatpp::base::memory::MemoryPool::free(entry);
+        }
+      }
+    }
+
+  };
+
+  void runCrossThread(oatpp::base::memory::ThreadDistributedMemoryPool* pool) {
+    CrossThreadQueue queue(THREADS_COUNT / 2);
+    std::list<std::thread> threads;
+    for(v_int32 i = 0; i < THREADS_COUNT / 2; i ++) {
+      threads.push_back(std::thread(&CrossThreadQueue::produce, &queue, pool));
+      threads.push_back(std::thread(&CrossThreadQueue::consume, &queue));
+    }
+    for(auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  void measure(const char* tag, v_int32 cacheSize, bool crossThread) {
+
+    oatpp::base::memory::ThreadDistributedMemoryPool pool(POOL_NAME, POOL_ENTRY_SIZE, 128,
+                                                         oatpp::base::memory::ThreadDistributedMemoryPool::SHARDS_COUNT_DEFAULT,
+                                                         cacheSize);
+
+    v_int64 ops = (v_int64) OPS_PER_THREAD * (crossThread ? THREADS_COUNT / 2 : THREADS_COUNT);
+    v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+
+    if(crossThread) {
+      runCrossThread(&pool);
+    } else {
+      std::list<std::thread> threads;
+      for(v_int32 i = 0; i < THREADS_COUNT; i ++) {
+        threads.push_back(std::thread(&runSameThread, &pool));
+      }
+      for(auto& thread : threads) {
+        thread.join();
+      }
+    }
+
+    v_int64 micros = oatpp::base::Environment::getMicroTickCount() - ticks;
+    if(micros == 0) {
+      micros = 1;
+    }
+
+    /* exited threads returned their caches - nothing is leaked or stuck in caches */
+    auto stats = getTestPoolStatistics();
+    OATPP_ASSERT(stats.objectsCount == 0);
+    if(cacheSize > 0) {
+      OATPP_ASSERT(stats.cacheMisses > 0);
+    } else {
+      OATPP_ASSERT(stats.cacheHits == 0 && stats.cacheMisses == 0);
+    }
+
+    OATPP_LOGD("MemoryPoolPerfTest", "%s, cache=%d: %lld(obtain+free/sec), hits=%lld, misses=%lld, held=%lld(bytes)",
+               tag, cacheSize, ops * 1000000 / micros, stats.cacheHits, stats.cacheMisses, stats.bytesHeld);
+
+  }
+  
+}
+
+void MemoryPoolPerfTest::onRun() {
+
+  for(v_int32 cacheSize : {0, oatpp::base::memory::ThreadDistributedMemoryPool::CACHE_SIZE_DEFAULT}) {
+    measure("same thread", cacheSize, false);
+    measure("cross thread", cacheSize, true);
+  }
+
+  auto stats = oatpp::base::Environment::getMemoryPoolsStatistics();
+  OATPP_LOGD(TAG, "all pools: hits=%lld, misses=%lld, objects=%lld, held=%lld(bytes)",
+             stats.cacheHits, stats.cacheMisses, stats.objectsCount, stats.bytesHeld);
+
+}
+
+}}}
@@ -27,6 +27,11 @@
 #include "oatpp/core/base/memory/MemoryPool.hpp"
 #include "oatpp-test/Checker.hpp"
 
+#include <cstring>
+#include <list>
+#include <thread>
+#include <vector>
+
 namespace oatpp { namespace test { namespace memory {
 
 namespace {
@@ -137,6 +142,119 @@ void testPool(v_int32 objectsNumber, v_int32 garbageNumber, v_int32 chunkSize){
   
 }
   
+/*
+ * Pools with thread cache created one after another reuse the same cache slot.
+ * Entries left in thread cache by destroyed pool must not be given out by the new pool.
+ */
+void testThreadCacheSlotReuse(){
+
+  for(v_int32 i = 0; i < 1000; i++){
+
+    base::memory::MemoryPool pool("MemoryPoolTest::CachedPool", sizeof(TestClass), 16, 8);
+
+    TestClass* objects[20];
+    for(v_int32 j = 0; j < 20; j++){
+      objects[j] = new (pool.obtain()) TestClass(j);
+    }
+#ifndef OATPP_DISABLE_POOL_ALLOCATIONS
+    OATPP_ASSERT(pool.getObjectsCount() == 20);
+#endif
+
+    for(v_int32 j = 0; j < 20; j++){
+      OATPP_ASSERT(objects[j]->a == j);
+      objects[j]->~TestClass();
+      oatpp::base::memory::MemoryPool::free(objects[j]);
+    }
+
+  }
+
+}
+
+/*
+ * Sum statistics of shards of the pools which names start with `name`.
+ */
+oatpp::base::Environment::MemoryPoolsStatistics getPoolStatistics(const char* name) {
+  oatpp::base::Environment::MemoryPoolsStatistics stats = {0, 0, 0, 0};
+  std::lock_guard<oatpp::concurrency::SpinLock> lock(oatpp::base::memory::MemoryPool::POOLS_SPIN_LOCK);
+  for(auto& pair : oatpp::base::memory::MemoryPool::POOLS) {
+    auto pool = pair.second;
+    if(pool->getName().compare(0, std::strlen(name), name) == 0) {
+      stats.cacheHits += pool->getCacheHits();
+      stats.cacheMisses += pool->getCacheMisses();
+      stats.objectsCount += pool->getObjectsCount();
+    }
+  }
+  return stats;
+}
+
+/*
+ * Entries obtained and freed by several threads - either each thread frees own entries,
+ * or entries are freed by other threads. Exited threads must return their caches to the pool.
+ */
+void testThreadCache(v_int32 cacheSize, bool crossThread){
+
+  const char* name = "MemoryPoolTest::ThreadCache";
+  const v_int32 threadsCount = 4;
+  const v_int32 entriesCount = 10000;
+
+  base::memory::ThreadDistributedMemoryPool pool(name, sizeof(TestClass), 128,
+                                                 base::memory::ThreadDistributedMemoryPool::SHARDS_COUNT_DEFAULT,
+                                                 cacheSize);
+
+  std::vector<std::vector<TestClass*>> entries(threadsCount);
+
+  std::list<std::thread> threads;
+  for(v_int32 i = 0; i < threadsCount; i++){
+    threads.push_back(std::thread([&pool, &entries, i, crossThread]{
+      auto& own = entries[i];
+      for(v_int32 j = 0; j < entriesCount; j++){
+        own.push_back(new (pool.obtain()) TestClass(j));
+      }
+      if(!crossThread){
+        for(v_int32 j = 0; j < entriesCount; j++){
+          OATPP_ASSERT(own[j]->a == j);
+          own[j]->~TestClass();
+          oatpp::base::memory::MemoryPool::free(own[j]);
+        }
+      }
+    }));
+  }
+  for(auto& thread : threads){
+    thread.join();
+  }
+
+  if(crossThread){
+    threads.clear();
+    for(v_int32 i = 0; i < threadsCount; i++){
+      auto& other = entries[(i + 1) % threadsCount];
+      threads.push_back(std::thread([&other]{
+        for(v_int32 j = 0; j < entriesCount; j++){
+          OATPP_ASSERT(other[j]->a == j);
+          other[j]->~TestClass();
+          oatpp::base::memory::MemoryPool::free(other[j]);
+        }
+      }));
+    }
+    for(auto& thread : threads){
+      thread.join();
+    }
+  }
+
+  auto stats = getPoolStatistics(name);
+#ifndef OATPP_DISABLE_POOL_ALLOCATIONS
+  OATPP_ASSERT(stats.objectsCount == 0);
+#endif
+  if(cacheSize == 0){
+    OATPP_ASSERT(stats.cacheHits == 0 && stats.cacheMisses == 0);
+  }
+#if !defined(OATPP_DISABLE_POOL_ALLOCATIONS) && !defined(OATPP_COMPAT_BUILD_NO_THREAD_LOCAL)
+  else {
+    OATPP_ASSERT(stats.cacheMisses > 0);
+  }
+#endif
+
+}
+
   void doStdSimpleAlloc(){
     TestClass* obj = new TestClass(10);
     delete obj;
@@ -170,6 +288,13 @@ void MemoryPoolTest::onRun() {
     PerformanceChecker checker("Alloc Time -  new");
     testStdNew(objectsNumber, garbageNumber, chunkSize);
   }
+
+  testThreadCacheSlotReuse();
+
+  for(v_int32 cacheSize : {0, 8, base::memory::ThreadDistributedMemoryPool::CACHE_SIZE_DEFAULT}){
+    testThreadCache(cacheSize, false);
+    testThreadCache(cacheSize, true);
+  }
   
   v_int32 iterationsCount = 10000000;
 
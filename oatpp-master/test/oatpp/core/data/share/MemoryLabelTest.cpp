@@ -98,6 +98,35 @@ void MemoryLabelTest::onRun() {
   OATPP_ASSERT(oatpp::base::StrBuffer::equals("goes", stringMapCI_FAST["KEY3"].getData(), 4));
   OATPP_ASSERT(oatpp::base::StrBuffer::equals("here", stringMapCI_FAST["KEY4"].getData(), 4));
   
+  { // cached hash of the memory handle is same as hash of the labeled data
+
+    for(v_int32 size : {0, 1, 7, 24, 31, 32, 100, 300}) {
+
+      oatpp::String text(size);
+      for(v_int32 i = 0; i < size; i++) {
+        text->getData()[i] = (v_char8) ('A' + i % 26);
+      }
+
+      oatpp::data::share::StringKeyLabel label(text.getPtr(), text->getData(), text->getSize());
+      oatpp::data::share::StringKeyLabel copyLabel(nullptr, text->getData(), text->getSize());
+      oatpp::data::share::StringKeyLabelCI labelCI(text.getPtr(), text->getData(), text->getSize());
+      oatpp::data::share::StringKeyLabelCI lowerLabelCI(text->toLowerCase());
+
+      OATPP_ASSERT(std::hash<oatpp::data::share::StringKeyLabel>()(label) == std::hash<oatpp::data::share::StringKeyLabel>()(copyLabel));
+      OATPP_ASSERT(std::hash<oatpp::data::share::StringKeyLabel>()(label) == oatpp::base::StrBuffer::hash(text->getData(), size));
+      OATPP_ASSERT(std::hash<oatpp::String>()(text) == text->getHash());
+      OATPP_ASSERT(std::hash<oatpp::data::share::StringKeyLabelCI>()(labelCI) == std::hash<oatpp::data::share::StringKeyLabelCI>()(lowerLabelCI));
+      OATPP_ASSERT(labelCI == lowerLabelCI);
+
+      if(size > 1) {
+        oatpp::data::share::StringKeyLabel subLabel(text.getPtr(), text->getData() + 1, size - 1);
+        OATPP_ASSERT(std::hash<oatpp::data::share::StringKeyLabel>()(subLabel) == oatpp::base::StrBuffer::hash(text->getData() + 1, size - 1));
+      }
+
+    }
+
+  }
+  
   {
     
     v_int32 iterationsCount = 100;
@@ -0,0 +1,191 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "ConversionUtilsPerfTest.hpp"
+
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace oatpp { namespace test { namespace core { namespace utils {
+
+namespace {
+
+namespace conversion = oatpp::utils::conversion;
+
+static constexpr v_int32 VALUES_COUNT = 100000;
+static constexpr v_int32 ITERATIONS = 10;
+
+v_float64 opsPerSecond(v_int64 ticks) {
+  return (v_float64) VALUES_COUNT * ITERATIONS / (ticks > 0 ? ticks : 1); // ops per microsecond == Mops/s
+}
+
+void runIntegersBenchmark(const char* tag) {
+
+  std::mt19937_64 random(1);
+  std::vector<v_int64> values(VALUES_COUNT);
+  for(auto& value : values) {
+    value = (v_int64) random() >> (random() % 64); // mix of short and long numbers
+  }
+
+  std::vector<std::string> texts(VALUES_COUNT);
+  char buffer[32];
+  v_int64 checksum = 0;
+
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < ITERATIONS; i ++) {
+    for(v_int32 j = 0; j < VALUES_COUNT; j ++) {
+      checksum += std::snprintf(buffer, 32, "%lld", (long long) values[j]);
+    }
+  }
+  v_int64 snprintfTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < ITERATIONS; i ++) {
+    for(v_int32 j = 0; j < VALUES_COUNT; j ++) {
+      checksum -= conversion::int64ToCharSequence(values[j], (p_char8) buffer, 32);
+    }
+  }
+  v_int64 formatTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+  OATPP_ASSERT(checksum == 0);
+
+  for(v_int32 j = 0; j < VALUES_COUNT; j ++) {
+    v_int32 size = conversion::int64ToCharSequence(values[j], (p_char8) buffer, 32);
+    texts[j].assign(buffer, size);
+    std::snprintf(buffer, 32, "%lld", (long long) values[j]);
+    OATPP_ASSERT(texts[j] == buffer);
+  }
+
+  ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < ITERATIONS; i ++) {
+    for(v_int32 j = 0; j < VALUES_COUNT; j ++) {
+      checksum += std::strtoll(texts[j].c_str(), nullptr, 10);
+    }
+  }
+  v_int64 strtollTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < ITERATIONS; i ++) {
+    for(v_int32 j = 0; j < VALUES_COUNT; j ++) {
+      v_int64 value;
+      conversion::charSequenceToInt64(texts[j].data(), (v_int32) texts[j].size(), value);
+      checksum -= value;
+    }
+  }
+  v_int64 parseTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+  OATPP_ASSERT(checksum == 0);
+
+  OATPP_LOGD(tag, "int64 format: snprintf %.1f(Mops/s), int64ToCharSequence %.1f(Mops/s)",
+             opsPerSecond(snprintfTicks), opsPerSecond(formatTicks));
+  OATPP_LOGD(tag, "int64 parse:  strtoll %.1f(Mops/s), charSequenceToInt64 %.1f(Mops/s)",
+             opsPerSecond(strtollTicks), opsPerSecond(parseTicks));
+
+}
+
+void runFloatsBenchmark(const char* tag) {
+
+  std::mt19937_64 random(2);
+  std::uniform_real_distribution<v_float64> distribution(-1000, 1000);
+  std::vector<v_float64> values(VALUES_COUNT);
+  for(v_int32 j = 0; j < VALUES_COUNT; j ++) {
+    // half of the values are "human" numbers with few decimal digits
+    values[j] = (j % 2 == 0) ? distribution(random) : (v_float64)((v_int64) (distribution(random) * 100)) / 100;
+  }
+
+  std::vector<std::string> texts(VALUES_COUNT);
+  char buffer[32];
+  v_int64 checksum = 0;
+
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < ITERATIONS; i ++) {
+    for(v_int32 j = 0; j < VALUES_COUNT; j ++) {
+      checksum += std::snprintf(buffer, 32, "%f", values[j]);
+    }
+  }
+  v_int64 snprintfTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  // "%.17g" - shortest printf pattern which always round-trips
+  ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < ITERATIONS; i ++) {
+    for(v_int32 j = 0; j < VALUES_COUNT; j ++) {
+      checksum += std::snprintf(buffer, 32, "%.17g", values[j]);
+    }
+  }
+  v_int64 snprintfRoundTripTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < ITERATIONS; i ++) {
+    for(v_int32 j = 0; j < VALUES_COUNT; j ++) {
+      checksum += conversion::float64ToCharSequence(values[j], (p_char8) buffer, 32);
+    }
+  }
+  v_int64 formatTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  for(v_int32 j = 0; j < VALUES_COUNT; j ++) {
+    v_int32 size = conversion::float64ToCharSequence(values[j], (p_char8) buffer, 32);
+    texts[j].assign(buffer, size);
+  }
+
+  v_float64 sum = 0;
+  ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < ITERATIONS; i ++) {
+    for(v_int32 j = 0; j < VALUES_COUNT; j ++) {
+      sum += std::strtod(texts[j].c_str(), nullptr);
+    }
+  }
+  v_int64 strtodTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  v_float64 parsedSum = 0;
+  ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < ITERATIONS; i ++) {
+    for(v_int32 j = 0; j < VALUES_COUNT; j ++) {
+      v_float64 value;
+      conversion::charSequenceToFloat64(texts[j].data(), (v_int32) texts[j].size(), value);
+      parsedSum += value;
+    }
+  }
+  v_int64 parseTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+  OATPP_ASSERT(sum == parsedSum);
+
+  OATPP_LOGD(tag, "float64 format: snprintf(%%f) %.1f(Mops/s), snprintf(%%.17g) %.1f(Mops/s), float64ToCharSequence %.1f(Mops/s)",
+             opsPerSecond(snprintfTicks), opsPerSecond(snprintfRoundTripTicks), opsPerSecond(formatTicks));
+  OATPP_LOGD(tag, "float64 parse:  strtod %.1f(Mops/s), charSequenceToFloat64 %.1f(Mops/s), checksum=%d",
+             opsPerSecond(strtodTicks), opsPerSecond(parseTicks), (v_int32) checksum);
+
+}
+
+}
+
+void ConversionUtilsPerfTest::onRun() {
+
+  runIntegersBenchmark(TAG);
+  runFloatsBenchmark(TAG);
+
+}
+
+}}}}
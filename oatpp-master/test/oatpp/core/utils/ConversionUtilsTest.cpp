@@ -0,0 +1,243 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "ConversionUtilsTest.hpp"
+
+#include "oatpp/core/utils/ConversionUtils.hpp"
+#include "oatpp/core/parser/Caret.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+
+namespace oatpp { namespace test { namespace core { namespace utils {
+
+namespace {
+
+namespace conversion = oatpp::utils::conversion;
+
+static constexpr v_int32 ROUND_TRIP_CHECKS = 300000;
+
+std::string formatFloat64(v_float64 value) {
+  v_char8 buffer[32];
+  v_int32 size = conversion::float64ToCharSequence(value, buffer, 32);
+  OATPP_ASSERT(size > 0);
+  return std::string((const char*) buffer, size);
+}
+
+std::string formatFloat32(v_float32 value) {
+  v_char8 buffer[32];
+  v_int32 size = conversion::float32ToCharSequence(value, buffer, 32);
+  OATPP_ASSERT(size > 0);
+  return std::string((const char*) buffer, size);
+}
+
+void checkFormatting() {
+
+  OATPP_ASSERT(conversion::int32ToStr(0) == "0");
+  OATPP_ASSERT(conversion::int32ToStr(-7) == "-7");
+  OATPP_ASSERT(conversion::int32ToStr(2147483647) == "2147483647");
+  OATPP_ASSERT(conversion::int32ToStr(-2147483647 - 1) == "-2147483648");
+  OATPP_ASSERT(conversion::int64ToStr(9223372036854775807LL) == "9223372036854775807");
+  OATPP_ASSERT(conversion::int64ToStr(-9223372036854775807LL - 1) == "-9223372036854775808");
+
+  { // result doesn't fit the buffer
+    v_char8 buffer[4];
+    OATPP_ASSERT(conversion::int32ToCharSequence(123, buffer, 4) == 3);
+    OATPP_ASSERT(conversion::int32ToCharSequence(1234, buffer, 4) == 0);
+  }
+
+  OATPP_ASSERT(formatFloat64(0.0) == "0.0");
+  OATPP_ASSERT(formatFloat64(-0.0) == "-0.0");
+  OATPP_ASSERT(formatFloat64(1.0) == "1.0");
+  OATPP_ASSERT(formatFloat64(-1.5) == "-1.5");
+  OATPP_ASSERT(formatFloat64(0.1) == "0.1");
+  OATPP_ASSERT(formatFloat64(0.32) == "0.32");
+  OATPP_ASSERT(formatFloat64(100.0) == "100.0");
+  OATPP_ASSERT(formatFloat64(123456.789) == "123456.789");
+  OATPP_ASSERT(formatFloat64(1e20) == "100000000000000000000.0");
+  OATPP_ASSERT(formatFloat64(1e21) == "1e+21");
+  OATPP_ASSERT(formatFloat64(0.000001) == "0.000001");
+  OATPP_ASSERT(formatFloat64(1e-7) == "1e-7");
+  OATPP_ASSERT(formatFloat64(1.25e-100) == "1.25e-100");
+  OATPP_ASSERT(formatFloat64(5e-324) == "5e-324");
+  OATPP_ASSERT(formatFloat64(1.7976931348623157e308) == "1.7976931348623157e+308");
+  OATPP_ASSERT(formatFloat64(std::numeric_limits<v_float64>::infinity()) == "inf");
+  OATPP_ASSERT(formatFloat64(-std::numeric_limits<v_float64>::infinity()) == "-inf");
+  OATPP_ASSERT(formatFloat64(std::numeric_limits<v_float64>::quiet_NaN()) == "nan");
+
+  OATPP_ASSERT(formatFloat32(0.32f) == "0.32");
+  OATPP_ASSERT(formatFloat32(101.1f) == "101.1");
+  OATPP_ASSERT(formatFloat32(3.1415927f) == "3.1415927");
+  OATPP_ASSERT(formatFloat32(16777216.0f) == "16777216.0");
+  OATPP_ASSERT(formatFloat32(3.4028235e38f) == "3.4028235e+38");
+  OATPP_ASSERT(formatFloat32(1e-45f) == "1e-45");
+
+}
+
+void checkParsing() {
+
+  v_int32 i32;
+  v_int64 i64;
+  v_word64 u64;
+  v_float32 f32;
+  v_float64 f64;
+
+  OATPP_ASSERT(conversion::charSequenceToInt32("-2147483648", 11, i32) == 11 && i32 == -2147483647 - 1);
+  OATPP_ASSERT(conversion::charSequenceToInt32("2147483648", 10, i32) == 0);
+  OATPP_ASSERT(conversion::charSequenceToInt64("-9223372036854775808", 20, i64) == 20 && i64 == -9223372036854775807LL - 1);
+  OATPP_ASSERT(conversion::charSequenceToInt64("9223372036854775808", 19, i64) == 0);
+  OATPP_ASSERT(conversion::charSequenceToUInt64("ffffffffffffffff", 16, u64, 16) == 16 && u64 == 0xFFFFFFFFFFFFFFFFULL);
+  OATPP_ASSERT(conversion::charSequenceToUInt64("1ffffffffffffffff", 17, u64, 16) == 0);
+  OATPP_ASSERT(conversion::charSequenceToInt64("+12;", 4, i64) == 3 && i64 == 12);
+  OATPP_ASSERT(conversion::charSequenceToInt64("-", 1, i64) == 0);
+  OATPP_ASSERT(conversion::charSequenceToInt64("", 0, i64) == 0);
+
+  // only `size` chars are read
+  OATPP_ASSERT(conversion::charSequenceToInt64("12345", 3, i64) == 3 && i64 == 123);
+  OATPP_ASSERT(conversion::charSequenceToFloat64("1.2345", 4, f64) == 4 && f64 == 1.23);
+  OATPP_ASSERT(conversion::charSequenceToFloat64("1e5", 2, f64) == 1 && f64 == 1.0);
+
+  OATPP_ASSERT(conversion::charSequenceToFloat64("-0.5e-3", 7, f64) == 7 && f64 == -0.0005);
+  OATPP_ASSERT(conversion::charSequenceToFloat64(".5", 2, f64) == 2 && f64 == 0.5);
+  OATPP_ASSERT(conversion::charSequenceToFloat64("5.", 2, f64) == 2 && f64 == 5.0);
+  OATPP_ASSERT(conversion::charSequenceToFloat64("1e+", 3, f64) == 1 && f64 == 1.0);
+  OATPP_ASSERT(conversion::charSequenceToFloat64("1E400", 5, f64) == 5 && f64 == std::numeric_limits<v_float64>::infinity());
+  OATPP_ASSERT(conversion::charSequenceToFloat64("-0", 2, f64) == 2 && f64 == 0 && std::signbit(f64));
+  OATPP_ASSERT(conversion::charSequenceToFloat64("-inf", 4, f64) == 4 && f64 == -std::numeric_limits<v_float64>::infinity());
+  OATPP_ASSERT(conversion::charSequenceToFloat64("nan", 3, f64) == 3 && std::isnan(f64));
+  OATPP_ASSERT(conversion::charSequenceToFloat64(".", 1, f64) == 0);
+  OATPP_ASSERT(conversion::charSequenceToFloat64("e5", 2, f64) == 0);
+  OATPP_ASSERT(conversion::charSequenceToFloat64("123456789012345678901234567890", 30, f64) == 30 && f64 == 123456789012345678901234567890.0);
+  OATPP_ASSERT(conversion::charSequenceToFloat32("0.32", 4, f32) == 4 && f32 == 0.32f);
+  OATPP_ASSERT(conversion::charSequenceToFloat32("7.038531e-26", 12, f32) == 12 && f32 == 7.038531e-26f);
+
+  bool success;
+  OATPP_ASSERT(conversion::strToInt32("123", success) == 123 && success);
+  conversion::strToInt32("123a", success);
+  OATPP_ASSERT(!success);
+  conversion::strToInt32("", success);
+  OATPP_ASSERT(!success);
+  OATPP_ASSERT(conversion::strToFloat64("2.5", success) == 2.5 && success);
+
+  { // caret doesn't read past it's data
+    oatpp::String text("12345", 5, true);
+    oatpp::parser::Caret caret(text->getData(), 3);
+    OATPP_ASSERT(caret.parseInt() == 123);
+    OATPP_ASSERT(caret.getPosition() == 3);
+    OATPP_ASSERT(!caret.hasError());
+    oatpp::parser::Caret hexCaret("1aF\r\n");
+    OATPP_ASSERT(hexCaret.parseUnsignedInt(16) == 0x1AF);
+    OATPP_ASSERT(hexCaret.getPosition() == 3);
+    oatpp::parser::Caret badCaret("abc");
+    badCaret.parseFloat64();
+    OATPP_ASSERT(badCaret.hasError());
+  }
+
+}
+
+/*
+ * Every finite value has to parse back to itself - with strtod/strtof and with the new parser.
+ * Parser has to agree with strtod/strtof on random decimal literals.
+ */
+void checkRoundTrip() {
+
+  std::mt19937_64 random(0);
+
+  for(v_int32 i = 0; i < ROUND_TRIP_CHECKS; i ++) {
+
+    v_word64 bits64 = random();
+    v_float64 value64;
+    std::memcpy(&value64, &bits64, sizeof(value64));
+    if(std::isfinite(value64)) {
+      auto text = formatFloat64(value64);
+      v_float64 parsed;
+      OATPP_ASSERT(std::strtod(text.c_str(), nullptr) == value64);
+      OATPP_ASSERT(conversion::charSequenceToFloat64(text.data(), (v_int32) text.size(), parsed) == (v_int32) text.size());
+      OATPP_ASSERT(parsed == value64);
+    }
+
+    v_word32 bits32 = (v_word32) random();
+    v_float32 value32;
+    std::memcpy(&value32, &bits32, sizeof(value32));
+    if(std::isfinite(value32)) {
+      auto text = formatFloat32(value32);
+      v_float32 parsed;
+      OATPP_ASSERT(std::strtof(text.c_str(), nullptr) == value32);
+      OATPP_ASSERT(conversion::charSequenceToFloat32(text.data(), (v_int32) text.size(), parsed) == (v_int32) text.size());
+      OATPP_ASSERT(parsed == value32);
+    }
+
+  }
+
+  const char* digits = "0123456789";
+
+  for(v_int32 i = 0; i < ROUND_TRIP_CHECKS; i ++) {
+
+    std::string text;
+    if(random() % 2) text += '-';
+    v_int32 integralDigits = random() % 12;
+    for(v_int32 d = 0; d < integralDigits; d ++) text += digits[random() % 10];
+    if(random() % 2) {
+      text += '.';
+      v_int32 fractionDigits = random() % 12;
+      for(v_int32 d = 0; d < fractionDigits; d ++) text += digits[random() % 10];
+    }
+    if(random() % 3 == 0) {
+      text += 'e';
+      text += (random() % 2) ? '-' : '+';
+      text += std::to_string(random() % 50);
+    }
+
+    char* end;
+    v_float64 expected64 = std::strtod(text.c_str(), &end);
+    v_int32 expectedSize = (v_int32)(end - text.c_str());
+    v_float64 parsed64;
+    v_int32 size = conversion::charSequenceToFloat64(text.data(), (v_int32) text.size(), parsed64);
+    OATPP_ASSERT(size == expectedSize);
+    OATPP_ASSERT(size == 0 || std::memcmp(&parsed64, &expected64, sizeof(v_float64)) == 0);
+
+    v_float32 expected32 = std::strtof(text.c_str(), &end);
+    v_float32 parsed32;
+    size = conversion::charSequenceToFloat32(text.data(), (v_int32) text.size(), parsed32);
+    OATPP_ASSERT(size == expectedSize);
+    OATPP_ASSERT(size == 0 || std::memcmp(&parsed32, &expected32, sizeof(v_float32)) == 0);
+
+  }
+
+}
+
+}
+
+void ConversionUtilsTest::onRun() {
+
+  checkFormatting();
+  checkParsing();
+  checkRoundTrip();
+
+}
+
+}}}}
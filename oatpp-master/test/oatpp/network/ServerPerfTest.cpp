@@ -0,0 +1,128 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ServerPerfTest.hpp"
+
+#include "oatpp/network/server/Server.hpp"
+#include "oatpp/network/server/SimpleTCPConnectionProvider.hpp"
+#include "oatpp/network/client/SimpleTCPConnectionProvider.hpp"
+
+#include <thread>
+#include <list>
+
+namespace oatpp { namespace test { namespace network {
+
+namespace {
+
+static constexpr v_word16 PORT = 8000;
+static constexpr v_int32 CLIENTS_COUNT = 8;
+static constexpr v_int32 CONNECTIONS_COUNT = 8000;
+
+/*
+ * Count connection and close it right away.
+ */
+class CountingConnectionHandler : public oatpp::network::server::ConnectionHandler {
+private:
+  std::atomic<v_int32> m_counter;
+public:
+
+  CountingConnectionHandler()
+    : m_counter(0)
+  {}
+
+  void handleConnection(const std::shared_ptr<IOStream>& connection, const std::shared_ptr<const ParameterMap>& params) override {
+    (void) connection;
+    (void) params;
+    ++ m_counter;
+  }
+
+  void stop() override {
+    // DO NOTHING
+  }
+
+  v_int32 getCount() {
+    return m_counter;
+  }
+
+};
+
+/*
+ * Return connections accepted per second.
+ */
+v_int64 runConnectionStorm(v_int32 listenersCount) {
+
+  auto serverProvider = oatpp::network::server::SimpleTCPConnectionProvider::createShared(PORT, listenersCount);
+  auto handler = std::make_shared<CountingConnectionHandler>();
+  auto server = oatpp::network::server::Server::createShared(serverProvider, handler);
+
+  std::thread serverThread([server] {
+    server->run();
+  });
+
+  auto clientProvider = oatpp::network::client::SimpleTCPConnectionProvider::createShared("127.0.0.1", PORT);
+
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+
+  std::list<std::thread> clients;
+  for(v_int32 i = 0; i < CLIENTS_COUNT; i ++) {
+    clients.push_back(std::thread([clientProvider] {
+      v_char8 byte;
+      for(v_int32 j = 0; j < CONNECTIONS_COUNT / CLIENTS_COUNT; j ++) {
+        auto connection = clientProvider->getConnection();
+        OATPP_ASSERT(connection);
+        // wait for server to close connection - server side takes TIME_WAIT.
+        auto res = connection->read(&byte, 1);
+        OATPP_ASSERT(res <= 0);
+      }
+    }));
+  }
+
+  for(auto& client : clients) {
+    client.join();
+  }
+
+  ticks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  server->stop();
+  serverProvider->close();
+  serverThread.join();
+
+  OATPP_ASSERT(handler->getCount() == CONNECTIONS_COUNT);
+
+  return (v_int64) CONNECTIONS_COUNT * 1000000 / (ticks + 1);
+
+}
+
+}
+
+void ServerPerfTest::onRun() {
+
+  for(v_int32 listenersCount = 1; listenersCount <= 4; listenersCount *= 2) {
+    v_int64 rate = runConnectionStorm(listenersCount);
+    OATPP_LOGD(TAG, "listeners=%d, clients=%d: %lld(connections/sec)", listenersCount, CLIENTS_COUNT, rate);
+  }
+
+}
+
+}}}
@@ -0,0 +1,108 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "UtilsPerfTest.hpp"
+
+#include "oatpp/parser/json/Utils.hpp"
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace test { namespace parser { namespace json {
+
+namespace {
+
+typedef oatpp::parser::json::Utils Utils;
+
+static constexpr v_int32 TEXT_SIZE = 1024 * 1024;
+static constexpr v_int32 ITERATIONS = 100;
+
+/*
+ * Text of safe chars with the special sequence inserted every `period` bytes.
+ */
+oatpp::String createText(v_int32 size, v_int32 period, const char* special) {
+  oatpp::data::stream::ChunkedBuffer buffer;
+  const char* words = "The quick brown fox jumps over the lazy dog. ";
+  v_int32 wordsSize = (v_int32) std::strlen(words);
+  v_int32 written = 0;
+  while(written < size) {
+    for(v_int32 i = 0; i < period && written < size; i ++) {
+      buffer.writeChar(words[written % wordsSize]);
+      written ++;
+    }
+    buffer << special;
+    written += (v_int32) std::strlen(special);
+  }
+  return buffer.toString();
+}
+
+void runThroughput(const char* tag, const char* name, v_int32 period, const char* special) {
+
+  auto text = createText(TEXT_SIZE, period, special);
+  auto escaped = Utils::escapeString(text->getData(), text->getSize());
+  oatpp::data::stream::ChunkedBuffer quoted;
+  quoted << "\"" << escaped << "\"";
+  auto quotedText = quoted.toString();
+
+  v_float64 megabytes = (v_float64) text->getSize() * ITERATIONS / (1024 * 1024);
+
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < ITERATIONS; i ++) {
+    Utils::escapeString(text->getData(), text->getSize());
+  }
+  v_int64 escapeTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  oatpp::data::stream::ChunkedBuffer stream;
+  ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < ITERATIONS; i ++) {
+    stream.clear();
+    Utils::escapeStringToStream(&stream, text->getData(), text->getSize());
+  }
+  v_int64 streamTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+  OATPP_ASSERT(stream.toString() == escaped);
+
+  ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < ITERATIONS; i ++) {
+    oatpp::parser::Caret caret(quotedText);
+    Utils::parseString(caret);
+  }
+  v_int64 parseTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  OATPP_LOGD(tag, "%s: escapeString %.0f(MB/s), escapeStringToStream %.0f(MB/s), parseString %.0f(MB/s)", name,
+             megabytes * 1000000 / escapeTicks, megabytes * 1000000 / streamTicks, megabytes * 1000000 / parseTicks);
+
+}
+
+}
+
+void UtilsPerfTest::onRun() {
+
+  runThroughput(TAG, "No escapes", TEXT_SIZE, "");
+  runThroughput(TAG, "Escape every 256 bytes", 256, "\"");
+  runThroughput(TAG, "Escape every 16 bytes", 16, "\n");
+
+}
+
+}}}}
@@ -0,0 +1,149 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "UtilsTest.hpp"
+
+#include "oatpp/parser/json/Utils.hpp"
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace test { namespace parser { namespace json {
+
+namespace {
+
+typedef oatpp::parser::json::Utils Utils;
+
+static constexpr v_int32 TEXT_SIZE = 64 * 1024;
+
+oatpp::String escapeToStream(const oatpp::String& str) {
+  oatpp::data::stream::ChunkedBuffer buffer;
+  Utils::escapeStringToStream(&buffer, str->getData(), str->getSize());
+  return buffer.toString();
+}
+
+oatpp::String unescape(const oatpp::String& str) {
+  v_int32 errorCode;
+  v_int32 errorPosition;
+  auto result = Utils::unescapeString(str->getData(), str->getSize(), errorCode, errorPosition);
+  OATPP_ASSERT(errorCode == 0);
+  return result;
+}
+
+oatpp::String parse(const oatpp::String& escaped) {
+  oatpp::data::stream::ChunkedBuffer buffer;
+  buffer << "\"" << escaped << "\"";
+  auto quoted = buffer.toString();
+  oatpp::parser::Caret caret(quoted);
+  auto result = Utils::parseString(caret);
+  OATPP_ASSERT(!caret.hasError());
+  OATPP_ASSERT(caret.getPosition() == caret.getDataSize());
+  return result;
+}
+
+/*
+ * Text of safe chars with the special sequence inserted every `period` bytes.
+ */
+oatpp::String createText(v_int32 size, v_int32 period, const char* special) {
+  oatpp::data::stream::ChunkedBuffer buffer;
+  const char* words = "The quick brown fox jumps over the lazy dog. ";
+  v_int32 wordsSize = (v_int32) std::strlen(words);
+  v_int32 written = 0;
+  while(written < size) {
+    for(v_int32 i = 0; i < period && written < size; i ++) {
+      buffer.writeChar(words[written % wordsSize]);
+      written ++;
+    }
+    buffer << special;
+    written += (v_int32) std::strlen(special);
+  }
+  return buffer.toString();
+}
+
+void checkSpecialAtEveryPosition() {
+
+  const char* specials[] = {"\"", "\\", "/", "\n", "\x01", "\xD0\x96", "\xF0\x9F\x98\x80"};
+
+  for(const char* special : specials) {
+    for(v_int32 size = 0; size < 80; size ++) {
+      for(v_int32 pos = 0; pos <= size; pos ++) {
+
+        oatpp::data::stream::ChunkedBuffer buffer;
+        for(v_int32 i = 0; i < size; i ++) {
+          if(i == pos) {
+            buffer << special;
+          }
+          buffer.writeChar('a' + i % 26);
+        }
+        auto text = buffer.toString();
+
+        auto escaped = Utils::escapeString(text->getData(), text->getSize());
+        OATPP_ASSERT(escapeToStream(text) == escaped);
+        OATPP_ASSERT(unescape(escaped) == text);
+        OATPP_ASSERT(parse(escaped) == text);
+
+      }
+    }
+  }
+
+}
+
+/*
+ * Long texts - escaped text goes through the bulk-copy path between special chars.
+ */
+void checkLongText(v_int32 period, const char* special) {
+  auto text = createText(TEXT_SIZE, period, special);
+  auto escaped = Utils::escapeString(text->getData(), text->getSize());
+  OATPP_ASSERT(escapeToStream(text) == escaped);
+  OATPP_ASSERT(unescape(escaped) == text);
+  OATPP_ASSERT(parse(escaped) == text);
+}
+
+}
+
+void UtilsTest::onRun() {
+
+  OATPP_ASSERT(escapeToStream("a\"b\\c/d") == "a\\\"b\\\\c\\/d");
+  OATPP_ASSERT(escapeToStream("\b\f\n\r\t\x01") == "\\b\\f\\n\\r\\t\\u0001");
+  OATPP_ASSERT(escapeToStream("\xD0\x96") == Utils::escapeString((p_char8) "\xD0\x96", 2));
+  OATPP_ASSERT(unescape("\\u0416") == "\xD0\x96");
+  OATPP_ASSERT(unescape("\\uD83D\\uDE00") == "\xF0\x9F\x98\x80");
+
+  { // truncated utf-8 sequence at the end of data is replaced with '?'
+    auto escaped = Utils::escapeString((p_char8) "abc\xF0\x9F", 5);
+    OATPP_ASSERT(escaped == "abc????????????");
+    OATPP_ASSERT(escapeToStream(oatpp::String("abc\xF0\x9F", 5, true)) == escaped);
+  }
+
+  checkSpecialAtEveryPosition();
+
+  checkLongText(TEXT_SIZE, "");
+  checkLongText(256, "\"");
+  checkLongText(16, "\n");
+  checkLongText(100, "\xF0\x9F\x98\x80");
+
+}
+
+}}}}
@@ -31,6 +31,10 @@
 
 #include "oatpp-test/Checker.hpp"
 
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+
+#include <vector>
+
 namespace oatpp { namespace test { namespace parser { namespace json { namespace mapping {
   
 namespace {
@@ -38,6 +42,14 @@ namespace {
 typedef oatpp::parser::json::mapping::Serializer Serializer;
 typedef oatpp::parser::json::mapping::Deserializer Deserializer;
 
+typedef oatpp::data::mapping::type::Type Type;
+
+template<class T>
+using List = oatpp::data::mapping::type::List<T>;
+
+template<class T>
+using Fields = oatpp::data::mapping::type::ListMap<oatpp::String, T>;
+
 #include OATPP_CODEGEN_BEGIN(DTO)
   
   class Test1 : public oatpp::data::mapping::type::Object {
@@ -61,7 +73,102 @@ typedef oatpp::parser::json::mapping::Deserializer Deserializer;
     
   };
   
+  /*
+   * DTO with many fields to measure field lookup.
+   */
+  class Test2 : public oatpp::data::mapping::type::Object {
+
+    DTO_INIT(Test2, Object)
+
+    DTO_FIELD(Int32, field_int32_00);
+    DTO_FIELD(Int32, field_int32_01);
+    DTO_FIELD(Int32, field_int32_02);
+    DTO_FIELD(Int32, field_int32_03);
+    DTO_FIELD(Int32, field_int32_04);
+    DTO_FIELD(Int32, field_int32_05);
+    DTO_FIELD(Int32, field_int32_06);
+    DTO_FIELD(Int32, field_int32_07);
+    DTO_FIELD(Int32, field_int32_08);
+    DTO_FIELD(Int32, field_int32_09);
+    DTO_FIELD(Int32, field_int32_10);
+    DTO_FIELD(Int32, field_int32_11);
+    DTO_FIELD(Int32, field_int32_12);
+    DTO_FIELD(Int32, field_int32_13);
+    DTO_FIELD(Int32, field_int32_14);
+    DTO_FIELD(Int32, field_int32_15);
+    DTO_FIELD(Int32, field_int32_16);
+    DTO_FIELD(Int32, field_int32_17);
+    DTO_FIELD(Int32, field_int32_18);
+    DTO_FIELD(Int32, field_int32_19);
+    DTO_FIELD(Int32, field_int32_20);
+    DTO_FIELD(Int32, field_int32_21);
+    DTO_FIELD(Int32, field_int32_22);
+    DTO_FIELD(Int32, field_int32_23);
+    DTO_FIELD(Int32, field_int32_24);
+    DTO_FIELD(Int32, field_int32_25);
+    DTO_FIELD(Int32, field_int32_26);
+    DTO_FIELD(Int32, field_int32_27);
+    DTO_FIELD(Int32, field_int32_28);
+    DTO_FIELD(Int32, field_int32_29);
+    DTO_FIELD(Int32, field_int32_30);
+    DTO_FIELD(Int32, field_int32_31);
+
+  };
+  
 #include OATPP_CODEGEN_END(DTO)
+
+static constexpr v_int32 TEST2_FIELDS_COUNT = 32;
+
+oatpp::String createTest2Json() {
+  oatpp::data::stream::ChunkedBuffer buffer;
+  buffer << "{";
+  for(v_int32 i = 0; i < TEST2_FIELDS_COUNT; i ++) {
+    if(i > 0) {
+      buffer << ",";
+    }
+    buffer << "\"field_int32_" << (i < 10 ? "0" : "") << i << "\":" << i;
+  }
+  buffer << "}";
+  return buffer.toString();
+}
+
+/*
+ * Compare key lookup - std::string + std::unordered_map (previous implementation) vs perfect hash lookup in place.
+ */
+void runKeyLookupBenchmark(const char* tag, v_int32 numIterations) {
+
+  auto properties = Test2::Z__CLASS_GET_FIELDS_MAP();
+  std::vector<oatpp::String> keys;
+  for(auto property : properties->getList()) {
+    keys.push_back(oatpp::String(property->name));
+  }
+
+  v_int64 totalLookups = (v_int64) numIterations * (v_int64) keys.size();
+  v_int64 found = 0;
+
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < numIterations; i ++) {
+    for(auto& key : keys) {
+      std::string stdKey((const char*) key->getData(), key->getSize());
+      found += properties->getMap().find(stdKey) != properties->getMap().end();
+    }
+  }
+  v_int64 mapTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < numIterations; i ++) {
+    for(auto& key : keys) {
+      found += properties->find((const char*) key->getData(), key->getSize()) != nullptr;
+    }
+  }
+  v_int64 hashTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  OATPP_ASSERT(found == totalLookups * 2);
+
+  OATPP_LOGD(tag, "Key lookup: std::string + unordered_map %.1f(ns/field), perfect hash %.1f(ns/field)",
+             mapTicks * 1000.0 / totalLookups, hashTicks * 1000.0 / totalLookups);
+
+}
   
 }
   
@@ -90,6 +197,76 @@ void DTOMapperPerfTest::onRun() {
     }
   }
 
+  auto test2_Text = createTest2Json();
+
+  { // all fields are found. escaped keys are found too.
+    auto test2 = mapper->readFromString<Test2>(test2_Text);
+    OATPP_ASSERT(test2->field_int32_00->getValue() == 0);
+    OATPP_ASSERT(test2->field_int32_17->getValue() == 17);
+    OATPP_ASSERT(test2->field_int32_31->getValue() == 31);
+    auto escaped = mapper->readFromString<Test2>("{\"field\\u005fint32_05\": 5}");
+    OATPP_ASSERT(escaped->field_int32_05->getValue() == 5);
+    auto properties = Test2::Z__CLASS_GET_FIELDS_MAP();
+    OATPP_ASSERT(properties->find("field_int32_1", 13) == nullptr);
+    OATPP_ASSERT(properties->find("field_int32_100", 15) == nullptr);
+  }
+
+  {
+    v_int32 wideIterations = numIterations / 10;
+    oatpp::parser::Caret caret(test2_Text);
+    v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+    for(v_int32 i = 0; i < wideIterations; i ++) {
+      caret.setPosition(0);
+      mapper->readFromCaret<Test2>(caret);
+    }
+    ticks = oatpp::base::Environment::getMicroTickCount() - ticks;
+    OATPP_LOGD(TAG, "Deserializer, %d fields DTO: %.1f(ns/field)", TEST2_FIELDS_COUNT,
+               ticks * 1000.0 / ((v_int64) wideIterations * TEST2_FIELDS_COUNT));
+  }
+
+  runKeyLookupBenchmark(TAG, numIterations / 10);
+
+  { // mappers dispatch on class id - check that ids are resolved for all known types
+    OATPP_ASSERT(String::Class::getType()->classId == Type::CLASS_ID_STRING);
+    OATPP_ASSERT(Int8::Class::getType()->classId == Type::CLASS_ID_INT8);
+    OATPP_ASSERT(Int64::Class::getType()->classId == Type::CLASS_ID_INT64);
+    OATPP_ASSERT(Float64::Class::getType()->classId == Type::CLASS_ID_FLOAT64);
+    OATPP_ASSERT(Boolean::Class::getType()->classId == Type::CLASS_ID_BOOLEAN);
+    OATPP_ASSERT(List<Int32>::ObjectWrapper::Class::getType()->classId == Type::CLASS_ID_LIST);
+    OATPP_ASSERT(Fields<String>::ObjectWrapper::Class::getType()->classId == Type::CLASS_ID_LIST_MAP);
+    OATPP_ASSERT(Test1::ObjectWrapper::Class::getType()->classId == Type::CLASS_ID_OBJECT);
+  }
+
+  {
+    v_int32 listSize = 10000;
+    v_int32 listIterations = 20;
+    auto list = List<Test1::ObjectWrapper>::createShared();
+    for(v_int32 i = 0; i < listSize; i ++) {
+      list->pushBack(Test1::createTestInstance());
+    }
+
+    auto list_Text = mapper->writeToString(list);
+    auto parsedList = mapper->readFromString<List<Test1::ObjectWrapper>>(list_Text);
+    OATPP_ASSERT(parsedList->count() == listSize);
+    OATPP_ASSERT(mapper->writeToString(parsedList) == list_Text);
+
+    v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+    for(v_int32 i = 0; i < listIterations; i ++) {
+      mapper->writeToString(list);
+    }
+    v_int64 writeTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+    ticks = oatpp::base::Environment::getMicroTickCount();
+    for(v_int32 i = 0; i < listIterations; i ++) {
+      mapper->readFromString<List<Test1::ObjectWrapper>>(list_Text);
+    }
+    v_int64 readTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+    v_int64 totalItems = (v_int64) listIterations * listSize;
+    OATPP_LOGD(TAG, "List of %d DTOs: serialize %.1f(ns/item), deserialize %.1f(ns/item)", listSize,
+               writeTicks * 1000.0 / totalItems, readTicks * 1000.0 / totalItems);
+  }
+
 }
   
 }}}}}
@@ -0,0 +1,132 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "DeserializerReaderPerfTest.hpp"
+
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace test { namespace parser { namespace json { namespace mapping {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+typedef oatpp::data::mapping::type::Object DTO;
+typedef oatpp::parser::json::mapping::Deserializer Deserializer;
+typedef oatpp::parser::json::mapping::ObjectMapper ObjectMapper;
+
+class Item : public DTO {
+
+  DTO_INIT(Item, DTO)
+
+  DTO_FIELD(Int32, id);
+  DTO_FIELD(Int64, counter);
+  DTO_FIELD(Float32, ratio);
+  DTO_FIELD(Float64, weight);
+  DTO_FIELD(Boolean, enabled);
+  DTO_FIELD(String, name);
+  DTO_FIELD(Int8, skipped);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+typedef oatpp::data::mapping::type::List<Item::ObjectWrapper> ItemList;
+
+oatpp::String createLargeJson(const std::shared_ptr<ObjectMapper>& mapper, v_int32 itemsCount) {
+  auto list = ItemList::createShared();
+  for(v_int32 i = 0; i < itemsCount; i ++) {
+    auto item = Item::createShared();
+    item->id = i;
+    item->counter = (v_int64) i * 1000000;
+    item->ratio = 0.5;
+    item->weight = i * 0.25;
+    item->enabled = (i % 2 == 0);
+    item->name = "Item name with \"quotes\" and some text " + oatpp::utils::conversion::int32ToStr(i);
+    list->pushBack(item);
+  }
+  return mapper->writeToString(list);
+}
+
+void runPerf(const char* tag, const std::shared_ptr<ObjectMapper>& mapper) {
+
+  const v_int32 itemsCount = 100000;
+  const v_int32 chunkSize = 4096;
+  const v_int32 iterations = 5;
+
+  auto json = createLargeJson(mapper, itemsCount);
+  auto listType = ItemList::ObjectWrapper::Class::getType();
+  v_float64 megabytes = (v_float64) json->getSize() * iterations / (1024 * 1024);
+
+  /* body accumulated in buffer and parsed as a whole - as it was done before */
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < iterations; i ++) {
+    oatpp::data::stream::ChunkedBuffer buffer;
+    for(v_int32 pos = 0; pos < json->getSize(); pos += chunkSize) {
+      v_int32 size = json->getSize() - pos;
+      buffer.write(json->getData() + pos, size > chunkSize ? chunkSize : size);
+    }
+    auto body = buffer.toString();
+    oatpp::parser::Caret caret(body);
+    auto list = mapper->read(caret, listType);
+    OATPP_ASSERT(!caret.hasError());
+    OATPP_ASSERT(oatpp::data::mapping::type::static_wrapper_cast<ItemList>(list)->count() == itemsCount);
+  }
+  v_int64 bufferedTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  /* body fed to reader chunk by chunk */
+  ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < iterations; i ++) {
+    auto reader = mapper->createReader(listType);
+    for(v_int32 pos = 0; pos < json->getSize(); pos += chunkSize) {
+      v_int32 size = json->getSize() - pos;
+      OATPP_ASSERT(reader->feed(json->getData() + pos, size > chunkSize ? chunkSize : size));
+    }
+    auto list = reader->finish();
+    OATPP_ASSERT(!reader->hasError());
+    OATPP_ASSERT(oatpp::data::mapping::type::static_wrapper_cast<ItemList>(list)->count() == itemsCount);
+  }
+  v_int64 readerTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  OATPP_LOGD(tag, "json size=%d(bytes), chunk size=%d(bytes)", json->getSize(), chunkSize);
+  OATPP_LOGD(tag, "buffered: %.0f(MB/s), extra memory=%d(bytes)", megabytes * 1000000 / bufferedTicks, json->getSize() * 2);
+  OATPP_LOGD(tag, "reader:   %.0f(MB/s), extra memory=%d(bytes)", megabytes * 1000000 / readerTicks, chunkSize);
+
+}
+
+}
+
+void DeserializerReaderPerfTest::onRun() {
+
+  /* benchmark json is larger than the default Deserializer::Config::maxSize */
+  auto config = Deserializer::Config::createShared();
+  config->maxSize = 0;
+  runPerf(TAG, ObjectMapper::createShared(oatpp::parser::json::mapping::Serializer::Config::createShared(), config));
+
+}
+
+}}}}}
@@ -0,0 +1,287 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "DeserializerReaderTest.hpp"
+
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/parser/json/Utils.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace test { namespace parser { namespace json { namespace mapping {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+typedef oatpp::data::mapping::type::Object DTO;
+typedef oatpp::parser::json::mapping::Deserializer Deserializer;
+typedef oatpp::parser::json::mapping::ObjectMapper ObjectMapper;
+
+class Item : public DTO {
+
+  DTO_INIT(Item, DTO)
+
+  DTO_FIELD(Int32, id);
+  DTO_FIELD(Int64, counter);
+  DTO_FIELD(Float32, ratio);
+  DTO_FIELD(Float64, weight);
+  DTO_FIELD(Boolean, enabled);
+  DTO_FIELD(String, name);
+  DTO_FIELD(Int8, skipped);
+
+};
+
+class Root : public DTO {
+
+  DTO_INIT(Root, DTO)
+
+  DTO_FIELD(String, title);
+  DTO_FIELD(Item::ObjectWrapper, item);
+  DTO_FIELD(List<Item::ObjectWrapper>::ObjectWrapper, items);
+  DTO_FIELD(List<List<Int32>::ObjectWrapper>::ObjectWrapper, matrix);
+  DTO_FIELD(Fields<String>::ObjectWrapper, tags);
+  DTO_FIELD(Fields<Item::ObjectWrapper>::ObjectWrapper, itemsByName);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+typedef oatpp::data::mapping::type::List<Item::ObjectWrapper> ItemList;
+
+static const char* const SAMPLE =
+  "{\n"
+  "  \"title\": \"Escapes: \\\" \\\\ \\/ \\b\\f\\n\\r\\t \\u0416 \\uD83D\\uDE00 \xD0\x96\",\n"
+  "  \"unknown\": {\"a\": [1, 2.5e3, \"x\\\"]\", {\"b\": null}], \"c\": true},\n"
+  "  \"item\": {\"id\": -32, \"counter\": 9223372036854775807, \"ratio\": 0.25, \"weight\": -1.5e-3,"
+  " \"enabled\": false, \"name\": null, \"skipped\": 8},\n"
+  "  \"items\": [{\"id\": 1, \"name\": \"first\"}, {}],\n"
+  "  \"matrix\": [[1, 2, 3], [], [-4]],\n"
+  "  \"tags\": {\"k\\u0031\": \"v1\", \"k2\": null},\n"
+  "  \"itemsByName\": {\"x\": {\"id\": 7, \"enabled\": true}}\n"
+  "}\t\r\n";
+
+std::shared_ptr<ObjectMapper::Reader> createReader(const std::shared_ptr<ObjectMapper>& mapper) {
+  return mapper->createReader(Root::ObjectWrapper::Class::getType());
+}
+
+/*
+ * Feed data in portions split at the given positions.
+ */
+Root::ObjectWrapper readSplit(const std::shared_ptr<ObjectMapper>& mapper, const oatpp::String& json, v_int32 split1, v_int32 split2) {
+  auto reader = createReader(mapper);
+  OATPP_ASSERT(reader->feed(json->getData(), split1));
+  OATPP_ASSERT(reader->feed(json->getData() + split1, split2 - split1));
+  OATPP_ASSERT(reader->feed(json->getData() + split2, json->getSize() - split2));
+  auto result = oatpp::data::mapping::type::static_wrapper_cast<Root>(reader->finish());
+  OATPP_ASSERT(!reader->hasError());
+  return result;
+}
+
+/*
+ * Feed data in portions of `chunkSize` bytes. Feeding stops at the first error.
+ */
+std::shared_ptr<ObjectMapper::Reader> feedChunked(const std::shared_ptr<ObjectMapper>& mapper, const oatpp::String& json, v_int32 chunkSize) {
+  auto reader = createReader(mapper);
+  for(v_int32 pos = 0; pos < json->getSize(); pos += chunkSize) {
+    v_int32 size = json->getSize() - pos;
+    if(size > chunkSize) {
+      size = chunkSize;
+    }
+    if(!reader->feed(json->getData() + pos, size)) {
+      break;
+    }
+  }
+  return reader;
+}
+
+void checkError(const std::shared_ptr<ObjectMapper>& mapper, const char* json, v_int32 errorCode) {
+  oatpp::String str(json);
+  for(v_int32 chunkSize = 1; chunkSize <= str->getSize() + 1; chunkSize ++) {
+    auto reader = feedChunked(mapper, str, chunkSize);
+    auto result = reader->finish();
+    OATPP_ASSERT(reader->hasError());
+    OATPP_ASSERT(reader->getErrorCode() == errorCode);
+    OATPP_ASSERT(!result);
+  }
+}
+
+void checkSample(const std::shared_ptr<ObjectMapper>& mapper) {
+
+  oatpp::String json(SAMPLE);
+  auto expected = mapper->readFromString<Root>(json);
+  auto expectedJson = mapper->writeToString(expected);
+
+  auto obj = readSplit(mapper, json, 0, 0);
+  OATPP_ASSERT(obj->title == expected->title);
+  OATPP_ASSERT(obj->item->id->getValue() == -32);
+  OATPP_ASSERT(obj->item->counter->getValue() == 9223372036854775807LL);
+  OATPP_ASSERT(obj->item->enabled->getValue() == false);
+  OATPP_ASSERT(!obj->item->name);
+  OATPP_ASSERT(!obj->item->skipped);
+  OATPP_ASSERT(obj->items->count() == 2);
+  OATPP_ASSERT(obj->matrix->get(2)->get(0)->getValue() == -4);
+  OATPP_ASSERT(obj->tags->get("k1", nullptr) == "v1");
+  OATPP_ASSERT(obj->itemsByName->get("x", nullptr)->enabled->getValue());
+
+  obj = readSplit(mapper, "{\"items\": [{}, null], \"matrix\": null}", 12, 20);
+  OATPP_ASSERT(obj->items->count() == 2);
+  OATPP_ASSERT(obj->items->get(0));
+  OATPP_ASSERT(!obj->items->get(1));
+  OATPP_ASSERT(!obj->matrix);
+
+  /* every possible split into three portions */
+  for(v_int32 split1 = 0; split1 <= json->getSize(); split1 ++) {
+    for(v_int32 split2 = split1; split2 <= json->getSize(); split2 += 7) {
+      auto result = readSplit(mapper, json, split1, split2);
+      OATPP_ASSERT(mapper->writeToString(result) == expectedJson);
+    }
+  }
+
+  /* byte by byte */
+  auto reader = feedChunked(mapper, json, 1);
+  auto result = reader->finish();
+  OATPP_ASSERT(!reader->hasError());
+  OATPP_ASSERT(mapper->writeToString(result) == expectedJson);
+
+}
+
+void checkErrors(const std::shared_ptr<ObjectMapper>& mapper) {
+
+  checkError(mapper, "", Deserializer::ERROR_CODE_UNEXPECTED_END);
+  checkError(mapper, "{\"title\": \"abc", Deserializer::ERROR_CODE_UNEXPECTED_END);
+  checkError(mapper, "{\"title\" \"abc\"}", Deserializer::ERROR_CODE_OBJECT_SCOPE_COLON_MISSING);
+  checkError(mapper, "{\"title\": \"abc\" \"item\": {}}", Deserializer::ERROR_CODE_OBJECT_SCOPE_CLOSE);
+  checkError(mapper, "{\"matrix\": [[1 2]]}", Deserializer::ERROR_CODE_ARRAY_SCOPE_CLOSE);
+  checkError(mapper, "{\"title\": 1}", Deserializer::ERROR_CODE_VALUE_INVALID);
+  checkError(mapper, "{\"item\": {\"id\": 1.5}}", Deserializer::ERROR_CODE_VALUE_INVALID);
+  checkError(mapper, "{\"item\": {\"enabled\": 1}}", Deserializer::ERROR_CODE_VALUE_BOOLEAN);
+  checkError(mapper, "{\"items\": {}}", Deserializer::ERROR_CODE_ARRAY_SCOPE_OPEN);
+  checkError(mapper, "[]", Deserializer::ERROR_CODE_OBJECT_SCOPE_OPEN);
+  checkError(mapper, "{} {}", Deserializer::ERROR_CODE_UNEXPECTED_CHAR);
+  checkError(mapper, "null", Deserializer::ERROR_CODE_OBJECT_SCOPE_OPEN);
+  checkError(mapper, " 1", Deserializer::ERROR_CODE_OBJECT_SCOPE_OPEN);
+  checkError(mapper, "\"abc\"", Deserializer::ERROR_CODE_OBJECT_SCOPE_OPEN);
+  checkError(mapper, "{\"title\": \"\\x\"}", oatpp::parser::json::Utils::ERROR_CODE_INVALID_ESCAPED_CHAR);
+
+  {
+    auto config = Deserializer::Config::createShared();
+    config->allowUnknownFields = false;
+    auto strictMapper = ObjectMapper::createShared(oatpp::parser::json::mapping::Serializer::Config::createShared(), config);
+    checkError(strictMapper, "{\"title\": \"abc\", \"unknown\": 1}", Deserializer::ERROR_CODE_OBJECT_SCOPE_UNKNOWN_FIELD);
+  }
+
+  {
+    auto config = Deserializer::Config::createShared();
+    config->maxDepth = 3;
+    auto limitedMapper = ObjectMapper::createShared(oatpp::parser::json::mapping::Serializer::Config::createShared(), config);
+    auto reader = feedChunked(limitedMapper, "{\"matrix\": [[1]], \"unknown\": [{}]}", 4);
+    OATPP_ASSERT(reader->finish());
+    OATPP_ASSERT(!reader->hasError());
+    checkError(limitedMapper, "{\"unknown\": [[[]]]}", Deserializer::ERROR_CODE_MAX_DEPTH_EXCEEDED);
+  }
+
+  {
+    auto config = Deserializer::Config::createShared();
+    config->maxSize = 16;
+    auto limitedMapper = ObjectMapper::createShared(oatpp::parser::json::mapping::Serializer::Config::createShared(), config);
+    auto reader = feedChunked(limitedMapper, "{\"title\": \"abc\"}", 3);
+    OATPP_ASSERT(reader->finish());
+    OATPP_ASSERT(!reader->hasError());
+    checkError(limitedMapper, "{\"title\": \"abcd\"}", Deserializer::ERROR_CODE_MAX_SIZE_EXCEEDED);
+  }
+
+  {
+    /* streamed input is limited by default */
+    auto config = Deserializer::Config::createShared();
+    OATPP_ASSERT(config->maxSize > 0);
+  }
+
+  {
+    /* root list can't be null either */
+    auto reader = mapper->createReader(ItemList::ObjectWrapper::Class::getType());
+    OATPP_ASSERT(!reader->feed("null", 4));
+    OATPP_ASSERT(!reader->finish());
+    OATPP_ASSERT(reader->getErrorCode() == Deserializer::ERROR_CODE_ARRAY_SCOPE_OPEN);
+  }
+
+}
+
+oatpp::String createLargeJson(const std::shared_ptr<ObjectMapper>& mapper, v_int32 itemsCount) {
+  auto list = ItemList::createShared();
+  for(v_int32 i = 0; i < itemsCount; i ++) {
+    auto item = Item::createShared();
+    item->id = i;
+    item->counter = (v_int64) i * 1000000;
+    item->ratio = 0.5;
+    item->weight = i * 0.25;
+    item->enabled = (i % 2 == 0);
+    item->name = "Item name with \"quotes\" and some text " + oatpp::utils::conversion::int32ToStr(i);
+    list->pushBack(item);
+  }
+  return mapper->writeToString(list);
+}
+
+/*
+ * Reader fed in chunks produces the same list as the whole-buffer parse.
+ */
+void checkLargeList(const std::shared_ptr<ObjectMapper>& mapper) {
+
+  const v_int32 itemsCount = 1000;
+  auto json = createLargeJson(mapper, itemsCount);
+  auto listType = ItemList::ObjectWrapper::Class::getType();
+
+  oatpp::parser::Caret caret(json);
+  auto expected = mapper->read(caret, listType);
+  OATPP_ASSERT(!caret.hasError());
+
+  v_int32 chunkSizes[] = {1, 7, 4096};
+  for(auto chunkSize : chunkSizes) {
+    auto reader = mapper->createReader(listType);
+    for(v_int32 pos = 0; pos < json->getSize(); pos += chunkSize) {
+      v_int32 size = json->getSize() - pos;
+      OATPP_ASSERT(reader->feed(json->getData() + pos, size > chunkSize ? chunkSize : size));
+    }
+    auto list = reader->finish();
+    OATPP_ASSERT(!reader->hasError());
+    OATPP_ASSERT(oatpp::data::mapping::type::static_wrapper_cast<ItemList>(list)->count() == itemsCount);
+    OATPP_ASSERT(mapper->writeToString(list) == mapper->writeToString(expected));
+  }
+
+}
+
+}
+
+void DeserializerReaderTest::onRun() {
+
+  auto mapper = ObjectMapper::createShared();
+
+  checkSample(mapper);
+  checkErrors(mapper);
+  checkLargeList(mapper);
+
+}
+
+}}}}}
@@ -42,6 +42,7 @@
 #include "oatpp/network/virtual_/server/ConnectionProvider.hpp"
 #include "oatpp/network/virtual_/Interface.hpp"
 
+#include "oatpp/core/async/CoroutineArena.hpp"
 #include "oatpp/core/macro/component.hpp"
 
 #include "oatpp-test/web/ClientServerTestRunner.hpp"
@@ -158,6 +159,7 @@ void FullAsyncTest::onRun() {
     v_int32 iterationsStep = m_iterationsPerStep;
 
     auto lastTick = oatpp::base::Environment::getMicroTickCount();
+    auto arenaStats = oatpp::async::CoroutineArena::getTotalStats();
 
     for(v_int32 i = 0; i < iterationsStep * 10; i ++) {
 
@@ -264,6 +266,15 @@ void FullAsyncTest::onRun() {
       
     }
 
+    { // coroutine allocations per request
+      static constexpr v_int32 REQUESTS_PER_ITERATION = 7;
+      v_int64 requestsCount = iterationsStep * 10 * REQUESTS_PER_ITERATION;
+      auto stats = oatpp::async::CoroutineArena::getTotalStats();
+      OATPP_LOGV(TAG, "Coroutine allocations per request: arena=%.2f, heap=%.4f",
+                 (v_float64) (stats.allocations - arenaStats.allocations) / requestsCount,
+                 (v_float64) (stats.heapAllocations - arenaStats.heapAllocations) / requestsCount);
+    }
+
     connection.reset();
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
 
@@ -56,10 +56,12 @@ typedef oatpp::web::protocol::http::outgoing::MultipartBody MultipartBody;
 class TestComponent {
 private:
   v_int32 m_port;
+  v_int32 m_connectionWorkersCount;
 public:
 
-  TestComponent(v_int32 port)
+  TestComponent(v_int32 port, v_int32 connectionWorkersCount)
     : m_port(port)
+    , m_connectionWorkersCount(connectionWorkersCount)
   {}
 
   OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::virtual_::Interface>, virtualInterface)([] {
@@ -85,9 +87,9 @@ public:
     return oatpp::web::server::HttpRouter::createShared();
   }());
 
-  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::server::ConnectionHandler>, serverConnectionHandler)([] {
+  OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::network::server::ConnectionHandler>, serverConnectionHandler)([this] {
     OATPP_COMPONENT(std::shared_ptr<oatpp::web::server::HttpRouter>, router);
-    return oatpp::web::server::HttpConnectionHandler::createShared(router);
+    return oatpp::web::server::HttpConnectionHandler::createShared(router, m_connectionWorkersCount);
   }());
 
   OATPP_CREATE_COMPONENT(std::shared_ptr<oatpp::data::mapping::ObjectMapper>, objectMapper)([] {
@@ -133,7 +135,7 @@ std::shared_ptr<Multipart> createMultipart(const std::unordered_map<oatpp::Strin
   
 void FullTest::onRun() {
 
-  TestComponent component(m_port);
+  TestComponent component(m_port, m_connectionWorkersCount);
 
   oatpp::test::web::ClientServerTestRunner runner;
 
@@ -153,6 +155,8 @@ void FullTest::onRun() {
     v_int32 iterationsStep = m_iterationsPerStep;
 
     auto lastTick = oatpp::base::Environment::getMicroTickCount();
+    auto lastObjects = oatpp::base::Environment::getObjectsCreated();
+    auto lastPoolStats = oatpp::base::Environment::getMemoryPoolsStatistics();
 
     for(v_int32 i = 0; i < iterationsStep * 10; i ++) {
 
@@ -276,6 +280,15 @@ void FullTest::onRun() {
         auto ticks = oatpp::base::Environment::getMicroTickCount() - lastTick;
         lastTick = oatpp::base::Environment::getMicroTickCount();
         OATPP_LOGV("i", "%d, tick=%d", i + 1, ticks);
+
+        /* allocations per iteration - objects created and memory pool entries obtained (by client and server) */
+        auto objects = oatpp::base::Environment::getObjectsCreated();
+        auto poolStats = oatpp::base::Environment::getMemoryPoolsStatistics();
+        v_int64 obtained = (poolStats.cacheHits + poolStats.cacheMisses) - (lastPoolStats.cacheHits + lastPoolStats.cacheMisses);
+        OATPP_LOGV("i", "objects=%d, pool obtains=%d per iteration, pools held=%d(bytes)",
+                   (v_int32) ((objects - lastObjects) / iterationsStep), (v_int32) (obtained / iterationsStep), (v_int32) poolStats.bytesHeld);
+        lastObjects = objects;
+        lastPoolStats = poolStats;
       }
 
     }
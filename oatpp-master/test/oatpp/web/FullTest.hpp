@@ -33,12 +33,14 @@ class FullTest : public UnitTest {
 private:
   v_int32 m_port;
   v_int32 m_iterationsPerStep;
+  v_int32 m_connectionWorkersCount;
 public:
   
-  FullTest(v_int32 port, v_int32 iterationsPerStep)
+  FullTest(v_int32 port, v_int32 iterationsPerStep, v_int32 connectionWorkersCount = 0)
     : UnitTest("TEST[web::FullTest]")
     , m_port(port)
     , m_iterationsPerStep(iterationsPerStep)
+    , m_connectionWorkersCount(connectionWorkersCount)
   {}
 
   void onRun() override;
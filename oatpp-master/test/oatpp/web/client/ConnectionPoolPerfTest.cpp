@@ -0,0 +1,250 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "ConnectionPoolPerfTest.hpp"
+
+#include "oatpp/web/client/HttpRequestExecutor.hpp"
+#include "oatpp/web/server/AsyncHttpConnectionHandler.hpp"
+#include "oatpp/web/server/HttpRouter.hpp"
+
+#include "oatpp/network/server/Server.hpp"
+#include "oatpp/network/server/SimpleTCPConnectionProvider.hpp"
+#include "oatpp/network/client/SimpleTCPConnectionProvider.hpp"
+#include "oatpp/network/virtual_/server/ConnectionProvider.hpp"
+#include "oatpp/network/virtual_/client/ConnectionProvider.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace oatpp { namespace test { namespace web { namespace client {
+
+namespace {
+
+typedef oatpp::web::client::HttpRequestExecutor HttpRequestExecutor;
+typedef oatpp::web::client::ConnectionPool ConnectionPool;
+
+static constexpr v_word16 PORT = 8000;
+static constexpr v_int32 CALLS_COUNT = 100000;
+static constexpr v_int32 ASYNC_CALLS_COUNT = 10000;
+
+/*
+ * Unpooled TCP client takes new ephemeral port for every call. Keep number of such calls below ephemeral ports range.
+ */
+static constexpr v_int32 UNPOOLED_TCP_CALLS_COUNT = 10000;
+
+static const char* const RESPONSE_TEXT = "Hello Pool!";
+
+class HelloHandler : public oatpp::web::server::HttpRequestHandler {
+public:
+
+  std::shared_ptr<OutgoingResponse> handle(const std::shared_ptr<IncomingRequest>& request) override {
+    (void) request;
+    return ResponseFactory::createResponse(Status::CODE_200, RESPONSE_TEXT);
+  }
+
+  oatpp::async::CoroutineStarterForResult<const std::shared_ptr<OutgoingResponse>&>
+  handleAsync(const std::shared_ptr<IncomingRequest>& request) override {
+
+    class HelloCoroutine : public oatpp::async::CoroutineWithResult<HelloCoroutine, const std::shared_ptr<OutgoingResponse>&> {
+    public:
+
+      Action act() override {
+        return _return(ResponseFactory::createResponse(Status::CODE_200, RESPONSE_TEXT));
+      }
+
+    };
+
+    (void) request;
+    return HelloCoroutine::startForResult();
+
+  }
+
+};
+
+/*
+ * Make `count` sequential async calls.
+ */
+class ClientCoroutine : public oatpp::async::Coroutine<ClientCoroutine> {
+private:
+  std::shared_ptr<HttpRequestExecutor> m_executor;
+  v_int32 m_count;
+  v_int32 m_counter;
+public:
+
+  ClientCoroutine(const std::shared_ptr<HttpRequestExecutor>& executor, v_int32 count)
+    : m_executor(executor)
+    , m_count(count)
+    , m_counter(0)
+  {}
+
+  Action act() override {
+    if(m_counter == m_count) {
+      return finish();
+    }
+    return m_executor->executeAsync("GET", "/", HttpRequestExecutor::Headers(), nullptr).callbackTo(&ClientCoroutine::onResponse);
+  }
+
+  Action onResponse(const std::shared_ptr<HttpRequestExecutor::Response>& response) {
+    OATPP_ASSERT(response->getStatusCode() == 200);
+    return response->readBodyToStringAsync().callbackTo(&ClientCoroutine::onBody);
+  }
+
+  Action onBody(const oatpp::String& body) {
+    OATPP_ASSERT(body == RESPONSE_TEXT);
+    ++ m_counter;
+    return yieldTo(&ClientCoroutine::act);
+  }
+
+};
+
+/*
+ * Run server for the duration of the `lambda` call.
+ */
+template<class Lambda>
+void runServer(const std::shared_ptr<oatpp::network::ServerConnectionProvider>& serverProvider, const Lambda& lambda) {
+
+  auto router = oatpp::web::server::HttpRouter::createShared();
+  router->route("GET", "/", std::make_shared<HelloHandler>());
+
+  auto executor = std::make_shared<oatpp::async::Executor>(1, 1, 1);
+  auto connectionHandler = oatpp::web::server::AsyncHttpConnectionHandler::createShared(router, executor);
+  auto server = oatpp::network::server::Server::createShared(serverProvider, connectionHandler);
+
+  std::thread serverThread([server] {
+    server->run();
+  });
+
+  lambda();
+
+  server->stop();
+  serverProvider->close();
+  serverThread.join();
+
+  executor->waitTasksFinished();
+  executor->stop();
+  executor->join();
+
+}
+
+/*
+ * Make `count` sequential calls. Return calls per second.
+ */
+v_int64 runCalls(const std::shared_ptr<HttpRequestExecutor>& executor, v_int32 count) {
+
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+
+  for(v_int32 i = 0; i < count; i ++) {
+    auto response = executor->execute("GET", "/", HttpRequestExecutor::Headers(), nullptr);
+    OATPP_ASSERT(response->getStatusCode() == 200);
+    OATPP_ASSERT(response->readBodyToString() == RESPONSE_TEXT);
+  }
+
+  ticks = oatpp::base::Environment::getMicroTickCount() - ticks;
+  return (v_int64) count * 1000000 / (ticks + 1);
+
+}
+
+void runBenchmark(const char* tag,
+                  const char* transport,
+                  const std::shared_ptr<oatpp::network::ServerConnectionProvider>& serverProvider,
+                  const std::shared_ptr<oatpp::network::ClientConnectionProvider>& clientProvider,
+                  v_int32 unpooledCallsCount)
+{
+
+  runServer(serverProvider, [tag, transport, clientProvider, unpooledCallsCount] {
+
+    auto unpooledExecutor = HttpRequestExecutor::createShared(clientProvider);
+    v_int64 unpooledRate = runCalls(unpooledExecutor, unpooledCallsCount);
+
+    auto pool = ConnectionPool::createShared();
+    auto pooledExecutor = HttpRequestExecutor::createShared(clientProvider, std::make_shared<oatpp::web::protocol::http::incoming::SimpleBodyDecoder>(), pool);
+    v_int64 pooledRate = runCalls(pooledExecutor, CALLS_COUNT);
+
+    auto stats = pool->getStatistics();
+    OATPP_ASSERT(stats.misses == 1);
+    OATPP_ASSERT(stats.hits == CALLS_COUNT - 1);
+    OATPP_ASSERT(pool->getIdleCount() == 1);
+
+    OATPP_LOGD(tag, "%s: unpooled %lld(calls/sec), pooled %lld(calls/sec), hit rate %.4f",
+               transport, unpooledRate, pooledRate, stats.getHitRate());
+
+    pool->clear();
+
+  });
+
+}
+
+void testAsync(const char* tag) {
+
+  auto interface = oatpp::network::virtual_::Interface::createShared("ConnectionPoolPerfTest.async");
+  auto clientProvider = oatpp::network::virtual_::client::ConnectionProvider::createShared(interface);
+
+  runServer(oatpp::network::virtual_::server::ConnectionProvider::createShared(interface), [tag, clientProvider] {
+
+    auto pool = ConnectionPool::createShared();
+    auto executor = HttpRequestExecutor::createShared(clientProvider, std::make_shared<oatpp::web::protocol::http::incoming::SimpleBodyDecoder>(), pool);
+
+    oatpp::async::Executor clientExecutor(1, 1, 1);
+
+    v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+    clientExecutor.execute<ClientCoroutine>(executor, ASYNC_CALLS_COUNT);
+    clientExecutor.waitTasksFinished();
+    ticks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+    auto stats = pool->getStatistics();
+    OATPP_ASSERT(stats.hits == ASYNC_CALLS_COUNT - 1);
+    OATPP_LOGD(tag, "async virtual_: pooled %lld(calls/sec), hit rate %.4f",
+               (v_int64) ASYNC_CALLS_COUNT * 1000000 / (ticks + 1), stats.getHitRate());
+
+    pool->clear();
+    clientExecutor.stop();
+    clientExecutor.join();
+
+  });
+
+}
+
+}
+
+void ConnectionPoolPerfTest::onRun() {
+
+  {
+    auto interface = oatpp::network::virtual_::Interface::createShared("ConnectionPoolPerfTest");
+    runBenchmark(TAG, "virtual_",
+                 oatpp::network::virtual_::server::ConnectionProvider::createShared(interface),
+                 oatpp::network::virtual_::client::ConnectionProvider::createShared(interface),
+                 CALLS_COUNT);
+  }
+
+  runBenchmark(TAG, "tcp",
+               oatpp::network::server::SimpleTCPConnectionProvider::createShared(PORT),
+               oatpp::network::client::SimpleTCPConnectionProvider::createShared("127.0.0.1", PORT),
+               UNPOOLED_TCP_CALLS_COUNT);
+
+  testAsync(TAG);
+
+}
+
+}}}}
@@ -0,0 +1,341 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "ConnectionPoolTest.hpp"
+
+#include "oatpp/web/client/HttpRequestExecutor.hpp"
+#include "oatpp/web/protocol/http/outgoing/BufferBody.hpp"
+
+#include "oatpp/network/virtual_/server/ConnectionProvider.hpp"
+#include "oatpp/network/virtual_/client/ConnectionProvider.hpp"
+#include "oatpp/network/Connection.hpp"
+
+#include "oatpp/core/async/Executor.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <string>
+#include <thread>
+
+#if !defined(WIN32) && !defined(_WIN32)
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace oatpp { namespace test { namespace web { namespace client {
+
+namespace {
+
+typedef oatpp::web::client::HttpRequestExecutor HttpRequestExecutor;
+typedef oatpp::web::client::ConnectionPool ConnectionPool;
+typedef oatpp::web::protocol::http::outgoing::BufferBody BufferBody;
+
+static const char* const RESPONSE = "HTTP/1.1 200 OK\r\nContent-Length: 2\r\nConnection: keep-alive\r\n\r\nok";
+
+ConnectionPool::PooledConnection createPooledConnection(const std::shared_ptr<oatpp::data::stream::IOStream>& connection) {
+  ConnectionPool::PooledConnection result;
+  result.connection = connection;
+  result.createdAt = oatpp::base::Environment::getMicroTickCount();
+  result.reused = false;
+  return result;
+}
+
+void testValidation(const char* tag) {
+
+  ConnectionPool::PooledConnection pooled;
+
+  { /* closed virtual_ connection and connection with unexpected data are dropped */
+    auto pool = ConnectionPool::createShared();
+    auto pipeIn = oatpp::network::virtual_::Pipe::createShared();
+    auto pipeOut = oatpp::network::virtual_::Pipe::createShared();
+
+    pool->put("host", createPooledConnection(oatpp::network::virtual_::Socket::createShared(pipeIn, pipeOut)));
+    OATPP_ASSERT(pool->take("host", pooled) && pooled.reused);
+    pool->put("host", pooled);
+
+    pipeIn->getWriter()->write("X", 1);
+    OATPP_ASSERT(!pool->take("host", pooled));
+
+    pool->put("host", createPooledConnection(oatpp::network::virtual_::Socket::createShared(pipeIn, pipeOut)));
+    pipeIn->close();
+    OATPP_ASSERT(!pool->take("host", pooled));
+
+    auto stats = pool->getStatistics();
+    OATPP_ASSERT(stats.hits == 1 && stats.stale == 2 && stats.misses == 2);
+  }
+
+#if !defined(WIN32) && !defined(_WIN32)
+  { /* tcp connection closed by the server is dropped */
+    auto pool = ConnectionPool::createShared();
+    int fds[2];
+    OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+
+    pool->put("host", createPooledConnection(oatpp::network::Connection::createShared(fds[0])));
+    OATPP_ASSERT(pool->take("host", pooled));
+    pool->put("host", pooled);
+
+    ::close(fds[1]);
+    OATPP_ASSERT(!pool->take("host", pooled));
+    OATPP_ASSERT(pool->getStatistics().stale == 1);
+  }
+#endif
+
+  { /* connections idle for too long are dropped */
+    auto pool = ConnectionPool::createShared(16, std::chrono::milliseconds(1));
+    auto pipe = oatpp::network::virtual_::Pipe::createShared();
+    pool->put("host", createPooledConnection(oatpp::network::virtual_::Socket::createShared(pipe, pipe)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    OATPP_ASSERT(!pool->take("host", pooled));
+    OATPP_ASSERT(pool->getStatistics().stale == 1);
+  }
+
+  { /* no more than maxIdlePerHost connections are kept */
+    auto pool = ConnectionPool::createShared(2);
+    auto pipe = oatpp::network::virtual_::Pipe::createShared();
+    for(v_int32 i = 0; i < 4; i ++) {
+      pool->put("host", createPooledConnection(oatpp::network::virtual_::Socket::createShared(pipe, pipe)));
+    }
+    pool->put("other-host", createPooledConnection(oatpp::network::virtual_::Socket::createShared(pipe, pipe)));
+    OATPP_ASSERT(pool->getIdleCount() == 3);
+  }
+
+  OATPP_LOGD(tag, "validation OK");
+
+}
+
+/*
+ * Minimal HTTP server serving connections one by one. <br>
+ * Requests with numbers from `dropRequests` (1-based) are read but not answered - connection is closed instead,
+ * as if server closed the idle connection at the moment client reused it.
+ */
+class DroppingServer {
+private:
+  std::shared_ptr<oatpp::network::virtual_::server::ConnectionProvider> m_provider;
+  std::set<v_int32> m_dropRequests;
+  v_int32 m_requestsCount;
+  v_int32 m_connectionsCount;
+  std::thread m_thread;
+private:
+
+  static bool readRequest(oatpp::data::stream::IOStream* connection) {
+
+    std::string headers;
+    while(headers.size() < 4 || headers.compare(headers.size() - 4, 4, "\r\n\r\n") != 0) {
+      char c;
+      if(oatpp::data::stream::readExactSizeData(connection, &c, 1) != 1) {
+        return false;
+      }
+      headers.push_back(c);
+    }
+
+    auto pos = headers.find("Content-Length: ");
+    if(pos != std::string::npos) {
+      v_int32 size = std::atoi(headers.c_str() + pos + 16);
+      std::string body(size, '\0');
+      if(size > 0 && oatpp::data::stream::readExactSizeData(connection, &body[0], size) != size) {
+        return false;
+      }
+    }
+
+    return true;
+
+  }
+
+  void run() {
+    while(true) {
+      auto connection = m_provider->getConnection();
+      if(!connection) {
+        break;
+      }
+      m_connectionsCount ++;
+      while(readRequest(connection.get())) {
+        m_requestsCount ++;
+        if(m_dropRequests.find(m_requestsCount) != m_dropRequests.end()) {
+          break;
+        }
+        oatpp::data::stream::writeExactSizeData(connection.get(), RESPONSE, std::strlen(RESPONSE));
+      }
+    }
+  }
+
+public:
+
+  DroppingServer(const std::shared_ptr<oatpp::network::virtual_::Interface>& interface, const std::set<v_int32>& dropRequests)
+    : m_provider(oatpp::network::virtual_::server::ConnectionProvider::createShared(interface))
+    , m_dropRequests(dropRequests)
+    , m_requestsCount(0)
+    , m_connectionsCount(0)
+    , m_thread(&DroppingServer::run, this)
+  {}
+
+  void stop() {
+    m_provider->close();
+    m_thread.join();
+  }
+
+  v_int32 getRequestsCount() {
+    return m_requestsCount;
+  }
+
+  v_int32 getConnectionsCount() {
+    return m_connectionsCount;
+  }
+
+};
+
+/*
+ * Requests 2, 4 and 6 are dropped by the server on a reused connection:
+ * GET and PUT with in-memory body are retried on a new connection, POST is not.
+ */
+static const std::set<v_int32> DROP_REQUESTS = {2, 4, 6};
+
+void testRetry(const char* tag) {
+
+  auto interface = oatpp::network::virtual_::Interface::createShared("ConnectionPoolTest.retry");
+  DroppingServer server(interface, DROP_REQUESTS);
+
+  auto pool = ConnectionPool::createShared();
+  auto executor = HttpRequestExecutor::createShared(oatpp::network::virtual_::client::ConnectionProvider::createShared(interface),
+                                                    std::make_shared<oatpp::web::protocol::http::incoming::SimpleBodyDecoder>(),
+                                                    pool);
+
+  auto call = [&executor](const char* method, const std::shared_ptr<HttpRequestExecutor::Body>& body) {
+    auto response = executor->execute(method, "/", HttpRequestExecutor::Headers(), body);
+    OATPP_ASSERT(response->getStatusCode() == 200);
+    OATPP_ASSERT(response->readBodyToString() == "ok");
+  };
+
+  call("GET", nullptr);
+  call("GET", nullptr);
+
+  bool failed = false;
+  try {
+    call("POST", BufferBody::createShared("body"));
+  } catch (oatpp::web::client::RequestExecutor::RequestExecutionError&) {
+    failed = true;
+  }
+  OATPP_ASSERT(failed);
+
+  call("PUT", BufferBody::createShared("body"));
+  call("PUT", BufferBody::createShared("body"));
+
+  pool->clear();
+  server.stop();
+
+  OATPP_ASSERT(server.getRequestsCount() == 7);
+  OATPP_ASSERT(server.getConnectionsCount() == 4);
+
+  OATPP_LOGD(tag, "retry OK");
+
+}
+
+/*
+ * Make the same calls as in testRetry() asynchronously.
+ */
+class RetryCoroutine : public oatpp::async::Coroutine<RetryCoroutine> {
+private:
+  std::shared_ptr<HttpRequestExecutor> m_executor;
+  v_int32 m_counter;
+  v_int32* m_failedCounter;
+public:
+
+  RetryCoroutine(const std::shared_ptr<HttpRequestExecutor>& executor, v_int32* failedCounter)
+    : m_executor(executor)
+    , m_counter(0)
+    , m_failedCounter(failedCounter)
+  {}
+
+  Action act() override {
+    switch(m_counter ++) {
+      case 0:
+      case 1: return m_executor->executeAsync("GET", "/", HttpRequestExecutor::Headers(), nullptr).callbackTo(&RetryCoroutine::onResponse);
+      case 2: return m_executor->executeAsync("POST", "/", HttpRequestExecutor::Headers(), BufferBody::createShared("body"))
+                                .callbackTo(&RetryCoroutine::onResponse);
+      case 3:
+      case 4: return m_executor->executeAsync("PUT", "/", HttpRequestExecutor::Headers(), BufferBody::createShared("body"))
+                                .callbackTo(&RetryCoroutine::onResponse);
+      default: return finish();
+    }
+  }
+
+  Action onResponse(const std::shared_ptr<HttpRequestExecutor::Response>& response) {
+    OATPP_ASSERT(response->getStatusCode() == 200);
+    return response->readBodyToStringAsync().callbackTo(&RetryCoroutine::onBody);
+  }
+
+  Action onBody(const oatpp::String& body) {
+    OATPP_ASSERT(body == "ok");
+    return yieldTo(&RetryCoroutine::act);
+  }
+
+  Action handleError(const std::shared_ptr<const Error>& error) override {
+    (void) error;
+    ++ (*m_failedCounter);
+    /* only the POST call may fail - continue with the next call */
+    return m_counter == 3 ? yieldTo(&RetryCoroutine::act) : finish();
+  }
+
+};
+
+void testRetryAsync(const char* tag) {
+
+  auto interface = oatpp::network::virtual_::Interface::createShared("ConnectionPoolTest.retryAsync");
+  DroppingServer server(interface, DROP_REQUESTS);
+
+  auto pool = ConnectionPool::createShared();
+  auto executor = HttpRequestExecutor::createShared(oatpp::network::virtual_::client::ConnectionProvider::createShared(interface),
+                                                    std::make_shared<oatpp::web::protocol::http::incoming::SimpleBodyDecoder>(),
+                                                    pool);
+
+  v_int32 failedCounter = 0;
+
+  oatpp::async::Executor clientExecutor(1, 1, 1);
+  clientExecutor.execute<RetryCoroutine>(executor, &failedCounter);
+  clientExecutor.waitTasksFinished();
+  clientExecutor.stop();
+  clientExecutor.join();
+
+  pool->clear();
+  server.stop();
+
+  OATPP_ASSERT(failedCounter == 1);
+  OATPP_ASSERT(server.getRequestsCount() == 7);
+  OATPP_ASSERT(server.getConnectionsCount() == 4);
+
+  OATPP_LOGD(tag, "async retry OK");
+
+}
+
+}
+
+void ConnectionPoolTest::onRun() {
+  testValidation(TAG);
+  testRetry(TAG);
+  testRetryAsync(TAG);
+}
+
+}}}}
@@ -0,0 +1,279 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "HeaderMapTest.hpp"
+
+#include "oatpp/web/protocol/http/incoming/Request.hpp"
+#include "oatpp/web/protocol/http/incoming/SimpleBodyDecoder.hpp"
+#include "oatpp/web/protocol/http/outgoing/Response.hpp"
+#include "oatpp/web/protocol/http/outgoing/BufferBody.hpp"
+#include "oatpp/web/protocol/http/Http.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+#include <memory>
+#include <unordered_map>
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http {
+
+namespace {
+
+typedef oatpp::web::protocol::http::HeaderMap HeaderMap;
+typedef oatpp::web::protocol::http::Header Header;
+typedef oatpp::web::protocol::http::Status Status;
+typedef oatpp::data::share::StringKeyLabel StringKeyLabel;
+typedef oatpp::data::share::StringKeyLabelCI_FAST StringKeyLabelCI_FAST;
+
+static constexpr v_int32 REQUESTS_COUNT = 1000;
+
+/*
+ * Allocator counting allocations of the container it is used with.
+ */
+template<class T>
+class CountingAllocator {
+public:
+  typedef T value_type;
+public:
+  v_int64* counter;
+public:
+
+  CountingAllocator(v_int64* pCounter)
+    : counter(pCounter)
+  {}
+
+  template<class U>
+  CountingAllocator(const CountingAllocator<U>& other)
+    : counter(other.counter)
+  {}
+
+  T* allocate(std::size_t n) {
+    ++ (*counter);
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) {
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template<class U>
+  bool operator == (const CountingAllocator<U>& other) const {
+    return counter == other.counter;
+  }
+
+  template<class U>
+  bool operator != (const CountingAllocator<U>& other) const {
+    return counter != other.counter;
+  }
+
+};
+
+class DiscardStream : public oatpp::data::stream::OutputStream {
+public:
+
+  v_int64 bytes = 0;
+
+  data::v_io_size write(const void *data, data::v_io_size count) override {
+    (void) data;
+    bytes += count;
+    return count;
+  }
+
+  oatpp::async::Action suggestOutputStreamAction(data::v_io_size ioResult) override {
+    (void) ioResult;
+    throw std::runtime_error("[oatpp::test::web::protocol::http::DiscardStream::suggestOutputStreamAction()]: Error. Not implemented.");
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::BLOCKING;
+  }
+
+};
+
+oatpp::String headerName(v_int32 index) {
+  return "X-Header-" + oatpp::utils::conversion::int32ToStr(index);
+}
+
+void testMap() {
+
+  HeaderMap headers;
+  headers["Host"] = "localhost";
+  headers[Header::CONTENT_LENGTH] = "10";
+  headers.insert({"X-Custom", "custom"});
+  headers[oatpp::String("connection")] = "keep-alive";
+
+  OATPP_ASSERT(headers.size() == 4);
+
+  /* insertion order is preserved */
+  auto it = headers.begin();
+  OATPP_ASSERT((it ++)->first.equals("Host"));
+  OATPP_ASSERT((it ++)->first.equals("Content-Length"));
+  OATPP_ASSERT((it ++)->first.equals("X-Custom"));
+  OATPP_ASSERT((it ++)->first.equals("connection"));
+  OATPP_ASSERT(it == headers.end());
+
+  /* lookups are case-insensitive and work for interned and plain names */
+  OATPP_ASSERT(headers.find(Header::HOST)->second.equals("localhost"));
+  OATPP_ASSERT(headers.find("content-length")->second.equals("10"));
+  OATPP_ASSERT(headers.find(Header::CONNECTION)->second.equals("keep-alive"));
+  OATPP_ASSERT(headers.find(oatpp::String("x-custom"))->second.equals("custom"));
+  OATPP_ASSERT(headers.find(Header::CONTENT_TYPE) == headers.end());
+  OATPP_ASSERT(headers.find("X-Other") == headers.end());
+  OATPP_ASSERT(headers.count(Header::HOST) == 1);
+
+  /* insert doesn't overwrite, operator[] does */
+  OATPP_ASSERT(!headers.insert({Header::HOST, "other"}).second);
+  OATPP_ASSERT(headers[Header::HOST].equals("localhost"));
+  headers["HOST"] = "other";
+  OATPP_ASSERT(headers.find(Header::HOST)->second.equals("other"));
+  OATPP_ASSERT(headers.size() == 4);
+
+  OATPP_ASSERT(headers.erase("Content-Length") == 1);
+  OATPP_ASSERT(headers.erase("Content-Length") == 0);
+  OATPP_ASSERT(headers.size() == 3);
+  OATPP_ASSERT(headers.find(Header::CONTENT_LENGTH) == headers.end());
+  OATPP_ASSERT(headers.find("x-custom")->second.equals("custom"));
+  OATPP_ASSERT(std::next(headers.begin())->first.equals("X-Custom"));
+
+  OATPP_ASSERT(HeaderMap::getWellKnownId("transfer-encoding") >= 0);
+  OATPP_ASSERT(HeaderMap::getWellKnownId("X-Custom") == -1);
+
+  /* grow out of the inline storage */
+  HeaderMap big;
+  for(v_int32 i = 0; i < 100; i ++) {
+    big[headerName(i)] = oatpp::utils::conversion::int32ToStr(i);
+  }
+  big[Header::CONTENT_TYPE] = "text/plain";
+  OATPP_ASSERT(big.size() == 101);
+  OATPP_ASSERT(big.capacity() > HeaderMap::INLINE_CAPACITY);
+  for(v_int32 i = 0; i < 100; i ++) {
+    auto found = big.find(headerName(i));
+    OATPP_ASSERT(found != big.end());
+    OATPP_ASSERT(found->second.equals(oatpp::utils::conversion::int32ToStr(i)->c_str()));
+  }
+  OATPP_ASSERT(big.find(Header::CONTENT_TYPE)->second.equals("text/plain"));
+
+  HeaderMap copy(big);
+  OATPP_ASSERT(copy.size() == 101);
+  OATPP_ASSERT(copy.find(headerName(50))->second.equals("50"));
+
+  HeaderMap moved(std::move(big));
+  OATPP_ASSERT(moved.size() == 101);
+  OATPP_ASSERT(big.size() == 0);
+  OATPP_ASSERT(big.find(headerName(50)) == big.end());
+  OATPP_ASSERT(moved.find(Header::CONTENT_TYPE)->second.equals("text/plain"));
+
+  copy = headers;
+  OATPP_ASSERT(copy.size() == 3);
+  OATPP_ASSERT(copy.find(headerName(50)) == copy.end());
+  OATPP_ASSERT(copy.find(Header::HOST)->second.equals("other"));
+
+  copy.clear();
+  OATPP_ASSERT(copy.empty());
+  OATPP_ASSERT(copy.find(Header::HOST) == copy.end());
+
+}
+
+void testAllocations(const char* tag) {
+
+  oatpp::String headersText =
+    "Host: localhost:8000\r\n"
+    "User-Agent: oatpp-benchmark\r\n"
+    "Accept: application/json\r\n"
+    "Accept-Encoding: gzip, deflate\r\n"
+    "Accept-Language: en-US,en;q=0.5\r\n"
+    "Authorization: Bearer token\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "Content-Type: application/json\r\n"
+    "Content-Length: 0\r\n"
+    "\r\n";
+
+  oatpp::String body = "{\"message\": \"Hello World!\"}";
+  auto bodyDecoder = std::make_shared<oatpp::web::protocol::http::incoming::SimpleBodyDecoder>();
+  oatpp::web::protocol::http::RequestStartingLine startingLine;
+  oatpp::web::url::mapping::Pattern::MatchMap pathVariables;
+  DiscardStream stream;
+
+  for(v_int32 i = 0; i < REQUESTS_COUNT; i ++) {
+
+    oatpp::web::protocol::http::Headers headers;
+    oatpp::parser::Caret caret(headersText);
+    Status status;
+    oatpp::web::protocol::http::Parser::parseHeaders(headers, headersText.getPtr(), caret, status);
+    OATPP_ASSERT(status.code == 0);
+    OATPP_ASSERT(headers.size() == 10);
+
+    /* headers exceed the inline storage - map grew exactly once */
+    OATPP_ASSERT(headers.capacity() == HeaderMap::INLINE_CAPACITY * 2);
+
+    auto request = oatpp::web::protocol::http::incoming::Request::createShared(startingLine, pathVariables, headers, nullptr, bodyDecoder);
+    OATPP_ASSERT(request->getHeaders().find(Header::CONNECTION)->second.equals("keep-alive"));
+    OATPP_ASSERT(request->getHeaders().find(Header::CONTENT_LENGTH)->second.equals("0"));
+    OATPP_ASSERT(request->getHeaders().find(Header::TRANSFER_ENCODING) == request->getHeaders().end());
+
+    auto response = oatpp::web::protocol::http::outgoing::Response::createShared(
+      Status::CODE_200, oatpp::web::protocol::http::outgoing::BufferBody::createShared(body));
+    response->putHeader(Header::CONTENT_TYPE, "application/json");
+    response->putHeader(Header::CONNECTION, Header::Value::CONNECTION_KEEP_ALIVE);
+    response->putHeader(Header::SERVER, Header::Value::SERVER);
+    response->send(&stream);
+    OATPP_ASSERT(response->getHeaders().capacity() == HeaderMap::INLINE_CAPACITY);
+
+  }
+
+  /* the same headers in std::unordered_map - for reference */
+  v_int64 unorderedMapAllocations = 0;
+  {
+    oatpp::web::protocol::http::Headers headers;
+    oatpp::parser::Caret caret(headersText);
+    Status status;
+    oatpp::web::protocol::http::Parser::parseHeaders(headers, headersText.getPtr(), caret, status);
+
+    typedef CountingAllocator<std::pair<const StringKeyLabelCI_FAST, StringKeyLabel>> Allocator;
+    std::unordered_map<StringKeyLabelCI_FAST, StringKeyLabel, std::hash<StringKeyLabelCI_FAST>, std::equal_to<StringKeyLabelCI_FAST>, Allocator>
+      map(0, std::hash<StringKeyLabelCI_FAST>(), std::equal_to<StringKeyLabelCI_FAST>(), Allocator(&unorderedMapAllocations));
+
+    for(auto& pair : headers) {
+      map[pair.first] = pair.second;
+    }
+  }
+
+  OATPP_LOGD(tag, "allocations for 10 headers: HeaderMap=2, std::unordered_map=%lld", unorderedMapAllocations);
+
+  OATPP_ASSERT(unorderedMapAllocations >= 10);
+
+}
+
+}
+
+void HeaderMapTest::onRun() {
+  testMap();
+  testAllocations(TAG);
+}
+
+}}}}}
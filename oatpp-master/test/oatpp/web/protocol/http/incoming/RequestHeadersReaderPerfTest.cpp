@@ -0,0 +1,238 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "RequestHeadersReaderPerfTest.hpp"
+
+#include "oatpp/web/protocol/http/incoming/RequestHeadersReader.hpp"
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace incoming {
+
+namespace {
+
+typedef oatpp::web::protocol::http::incoming::RequestHeadersReader RequestHeadersReader;
+
+static constexpr v_int32 BUFFER_SIZE = 4096;
+static constexpr v_int32 ITERATIONS = 100000;
+
+static const char* REQUEST =
+  "GET /api/v1/users/100?fields=name,email HTTP/1.1\r\n"
+  "Host: localhost:8000\r\n"
+  "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/78.0 Safari/537.36\r\n"
+  "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,image/webp,*/*;q=0.8\r\n"
+  "Accept-Encoding: gzip, deflate, br\r\n"
+  "Accept-Language: en-US,en;q=0.9\r\n"
+  "Cache-Control: no-cache\r\n"
+  "Connection: keep-alive\r\n"
+  "Cookie: session=0123456789abcdef0123456789abcdef; theme=dark\r\n"
+  "\r\n"
+  "body";
+
+/*
+ * Stream serving data from memory in chunks of limited size.
+ */
+class MemoryStream : public oatpp::base::Countable, public oatpp::data::stream::IOStream {
+private:
+  const char* m_data;
+  v_int32 m_size;
+  v_int32 m_position;
+  v_int32 m_chunkSize;
+public:
+
+  MemoryStream(const char* data, v_int32 chunkSize)
+    : m_data(data)
+    , m_size((v_int32) std::strlen(data))
+    , m_position(0)
+    , m_chunkSize(chunkSize)
+  {}
+
+  void reset() {
+    m_position = 0;
+  }
+
+  data::v_io_size read(void *data, data::v_io_size count) override {
+    data::v_io_size size = m_size - m_position;
+    if(size == 0) {
+      return data::IOError::ZERO_VALUE;
+    }
+    if(size > count) size = count;
+    if(size > m_chunkSize) size = m_chunkSize;
+    std::memcpy(data, &m_data[m_position], size);
+    m_position += size;
+    return size;
+  }
+
+  data::v_io_size write(const void *data, data::v_io_size count) override {
+    (void) data;
+    return count;
+  }
+
+  oatpp::async::Action suggestInputStreamAction(data::v_io_size ioResult) override {
+    (void) ioResult;
+    return oatpp::async::Action::createActionByType(oatpp::async::Action::TYPE_REPEAT);
+  }
+
+  oatpp::async::Action suggestOutputStreamAction(data::v_io_size ioResult) override {
+    (void) ioResult;
+    return oatpp::async::Action::createActionByType(oatpp::async::Action::TYPE_REPEAT);
+  }
+
+  void setInputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  oatpp::data::stream::IOMode getInputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::BLOCKING;
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::BLOCKING;
+  }
+
+};
+
+/*
+ * Previous implementation - byte-by-byte accumulator with the copy of the section to ChunkedBuffer.
+ */
+v_int32 readHeadersAccumulator(MemoryStream& stream, p_char8 buffer, oatpp::web::protocol::http::Headers& headers) {
+
+  oatpp::data::stream::ChunkedBuffer bufferStream;
+  v_word32 sectionEnd = ('\r' << 24) | ('\n' << 16) | ('\r' << 8) | ('\n');
+  v_word32 accumulator = 0;
+  v_int32 bufferPosStart = -1;
+
+  while(bufferPosStart < 0) {
+    auto res = stream.read(buffer, BUFFER_SIZE);
+    if(res <= 0) {
+      return -1;
+    }
+    bufferStream.write(buffer, res);
+    for(v_int32 i = 0; i < res; i ++) {
+      accumulator <<= 8;
+      accumulator |= buffer[i];
+      if(accumulator == sectionEnd) {
+        bufferPosStart = i + 1;
+        break;
+      }
+    }
+  }
+
+  auto headersText = bufferStream.toString();
+  oatpp::parser::Caret caret (headersText);
+  oatpp::web::protocol::http::Status status;
+  oatpp::web::protocol::http::RequestStartingLine startingLine;
+  oatpp::web::protocol::http::Parser::parseRequestStartingLine(startingLine, headersText.getPtr(), caret, status);
+  oatpp::web::protocol::http::Parser::parseHeaders(headers, headersText.getPtr(), caret, status);
+
+  return bufferPosStart;
+
+}
+
+void runScan() {
+
+  v_char8 data[2048];
+  std::memset(data, 'a', sizeof(data));
+  for(v_int32 i = 40; i < 2000; i += 40) {
+    data[i] = '\r';
+    data[i + 1] = '\n';
+  }
+  std::memcpy(&data[2040], "\r\n\r\n", 4);
+
+  v_int64 found = 0;
+
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 n = 0; n < ITERATIONS; n ++) {
+    v_word32 sectionEnd = ('\r' << 24) | ('\n' << 16) | ('\r' << 8) | ('\n');
+    v_word32 accumulator = 0;
+    for(v_int32 i = 0; i < 2048; i ++) {
+      accumulator <<= 8;
+      accumulator |= data[i];
+      if(accumulator == sectionEnd) {
+        found += i + 1;
+        break;
+      }
+    }
+  }
+  v_int64 accumulatorTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 n = 0; n < ITERATIONS; n ++) {
+    found -= RequestHeadersReader::findSectionEnd(data, 2048);
+  }
+  v_int64 scanTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  OATPP_ASSERT(found == 0);
+
+  OATPP_LOGD("scan", "2048 bytes x %d: accumulator=%lld(MB/s), findSectionEnd=%lld(MB/s)",
+             ITERATIONS, (v_int64) 2048 * ITERATIONS / (accumulatorTicks + 1), (v_int64) 2048 * ITERATIONS / (scanTicks + 1));
+
+}
+
+void runReadHeaders() {
+
+  v_char8 buffer[BUFFER_SIZE];
+  MemoryStream stream(REQUEST, BUFFER_SIZE);
+  auto streamPtr = std::shared_ptr<MemoryStream>(&stream, [](MemoryStream*){});
+  v_int32 headersSize = (v_int32) (std::strstr(REQUEST, "\r\n\r\n") - REQUEST) + 4;
+
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 n = 0; n < ITERATIONS; n ++) {
+    stream.reset();
+    oatpp::web::protocol::http::Headers headers;
+    OATPP_ASSERT(readHeadersAccumulator(stream, buffer, headers) == headersSize);
+  }
+  v_int64 accumulatorTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 n = 0; n < ITERATIONS; n ++) {
+    stream.reset();
+    RequestHeadersReader reader(buffer, BUFFER_SIZE, 4096);
+    oatpp::web::protocol::http::HttpError::Info error;
+    auto result = reader.readHeaders(streamPtr, error);
+    OATPP_ASSERT(result.bufferPosStart == headersSize);
+  }
+  v_int64 readerTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  OATPP_LOGD("readHeaders", "%d bytes x %d: accumulator+ChunkedBuffer=%lld(req/sec), RequestHeadersReader=%lld(req/sec)",
+             headersSize, ITERATIONS, (v_int64) ITERATIONS * 1000000 / (accumulatorTicks + 1), (v_int64) ITERATIONS * 1000000 / (readerTicks + 1));
+
+}
+
+}
+
+void RequestHeadersReaderPerfTest::onRun() {
+
+  runScan();
+  runReadHeaders();
+
+}
+
+}}}}}}
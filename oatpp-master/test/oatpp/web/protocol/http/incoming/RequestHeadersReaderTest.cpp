@@ -0,0 +1,184 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "RequestHeadersReaderTest.hpp"
+
+#include "oatpp/web/protocol/http/incoming/RequestHeadersReader.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace incoming {
+
+namespace {
+
+typedef oatpp::web::protocol::http::incoming::RequestHeadersReader RequestHeadersReader;
+
+static constexpr v_int32 BUFFER_SIZE = 4096;
+
+static const char* REQUEST =
+  "GET /api/v1/users/100?fields=name,email HTTP/1.1\r\n"
+  "Host: localhost:8000\r\n"
+  "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/78.0 Safari/537.36\r\n"
+  "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,image/webp,*/*;q=0.8\r\n"
+  "Accept-Encoding: gzip, deflate, br\r\n"
+  "Accept-Language: en-US,en;q=0.9\r\n"
+  "Cache-Control: no-cache\r\n"
+  "Connection: keep-alive\r\n"
+  "Cookie: session=0123456789abcdef0123456789abcdef; theme=dark\r\n"
+  "\r\n"
+  "body";
+
+/*
+ * Stream serving data from memory in chunks of limited size.
+ */
+class MemoryStream : public oatpp::base::Countable, public oatpp::data::stream::IOStream {
+private:
+  const char* m_data;
+  v_int32 m_size;
+  v_int32 m_position;
+  v_int32 m_chunkSize;
+public:
+
+  MemoryStream(const char* data, v_int32 chunkSize)
+    : m_data(data)
+    , m_size((v_int32) std::strlen(data))
+    , m_position(0)
+    , m_chunkSize(chunkSize)
+  {}
+
+  data::v_io_size read(void *data, data::v_io_size count) override {
+    data::v_io_size size = m_size - m_position;
+    if(size == 0) {
+      return data::IOError::ZERO_VALUE;
+    }
+    if(size > count) size = count;
+    if(size > m_chunkSize) size = m_chunkSize;
+    std::memcpy(data, &m_data[m_position], size);
+    m_position += size;
+    return size;
+  }
+
+  data::v_io_size write(const void *data, data::v_io_size count) override {
+    (void) data;
+    return count;
+  }
+
+  oatpp::async::Action suggestInputStreamAction(data::v_io_size ioResult) override {
+    (void) ioResult;
+    return oatpp::async::Action::createActionByType(oatpp::async::Action::TYPE_REPEAT);
+  }
+
+  oatpp::async::Action suggestOutputStreamAction(data::v_io_size ioResult) override {
+    (void) ioResult;
+    return oatpp::async::Action::createActionByType(oatpp::async::Action::TYPE_REPEAT);
+  }
+
+  void setInputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  oatpp::data::stream::IOMode getInputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::BLOCKING;
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::BLOCKING;
+  }
+
+};
+
+void testSectionEnd() {
+
+  v_char8 data[256];
+
+  for(v_int32 size = 4; size < 100; size ++) {
+    for(v_int32 pos = 0; pos + 4 <= size; pos ++) {
+      std::memset(data, 'a', size);
+      data[pos] = '\r';
+      data[pos + 1] = '\n';
+      data[pos + 2] = '\r';
+      data[pos + 3] = '\n';
+      OATPP_ASSERT(RequestHeadersReader::findSectionEnd(data, size) == pos + 4);
+      data[pos + 2] = 'a';
+      OATPP_ASSERT(RequestHeadersReader::findSectionEnd(data, size) == -1);
+    }
+  }
+
+  const char* text = "a\r\n\r\r\n\n\r\n\r\n";
+  OATPP_ASSERT(RequestHeadersReader::findSectionEnd((p_char8) text, (v_int32) std::strlen(text)) == 11);
+
+}
+
+void testReadHeaders() {
+
+  v_char8 buffer[BUFFER_SIZE];
+  v_int32 headersSize = (v_int32) (std::strstr(REQUEST, "\r\n\r\n") - REQUEST) + 4;
+
+  /* chunk sizes splitting the section end between reads */
+  for(v_int32 chunkSize = 1; chunkSize < 64; chunkSize ++) {
+
+    MemoryStream stream(REQUEST, chunkSize);
+    RequestHeadersReader reader(buffer, BUFFER_SIZE, 4096);
+    oatpp::web::protocol::http::HttpError::Info error;
+    auto result = reader.readHeaders(std::shared_ptr<MemoryStream>(&stream, [](MemoryStream*){}), error);
+
+    OATPP_ASSERT(error.ioStatus > 0);
+    OATPP_ASSERT(result.bufferPosStart == headersSize);
+    OATPP_ASSERT(result.bufferPosEnd >= result.bufferPosStart);
+    OATPP_ASSERT(result.bufferPosEnd - result.bufferPosStart <= 4);
+    OATPP_ASSERT(std::memcmp(&buffer[result.bufferPosStart], "body", result.bufferPosEnd - result.bufferPosStart) == 0);
+    OATPP_ASSERT(result.startingLine.method.equals("GET"));
+    OATPP_ASSERT(result.startingLine.path.equals("/api/v1/users/100?fields=name,email"));
+    OATPP_ASSERT(result.headers.size() == 8);
+    OATPP_ASSERT(result.headers["Host"].equals("localhost:8000"));
+    OATPP_ASSERT(result.headers["Connection"].equals("keep-alive"));
+
+  }
+
+  /* headers section larger than the limit */
+  {
+    MemoryStream stream(REQUEST, 16);
+    RequestHeadersReader reader(buffer, BUFFER_SIZE, 64);
+    oatpp::web::protocol::http::HttpError::Info error;
+    reader.readHeaders(std::shared_ptr<MemoryStream>(&stream, [](MemoryStream*){}), error);
+    OATPP_ASSERT(error.ioStatus < 0);
+  }
+
+}
+
+}
+
+void RequestHeadersReaderTest::onRun() {
+
+  testSectionEnd();
+  testReadHeaders();
+
+}
+
+}}}}}}
@@ -0,0 +1,298 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "SimpleBodyDecoderTest.hpp"
+
+#include "oatpp/web/protocol/http/incoming/SimpleBodyDecoder.hpp"
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+#include "oatpp/core/async/Processor.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace incoming {
+
+namespace {
+
+typedef oatpp::web::protocol::http::Header Header;
+typedef oatpp::web::protocol::http::Headers Headers;
+typedef oatpp::web::protocol::http::incoming::SimpleBodyDecoder SimpleBodyDecoder;
+
+static const char* const NEXT_REQUEST = "GET / HTTP/1.1\r\n\r\n";
+
+/*
+ * Stream serving data from memory in portions of limited size.
+ * Every other read returns RETRY if `retry` is set.
+ */
+class MemoryStream : public oatpp::base::Countable, public oatpp::data::stream::InputStream {
+private:
+  oatpp::String m_data;
+  data::v_io_size m_position;
+  data::v_io_size m_portionSize;
+  bool m_retry;
+  v_int64 m_readCount;
+public:
+
+  MemoryStream(const oatpp::String& data, data::v_io_size portionSize, bool retry)
+    : m_data(data)
+    , m_position(0)
+    , m_portionSize(portionSize)
+    , m_retry(retry)
+    , m_readCount(0)
+  {}
+
+  data::v_io_size read(void *data, data::v_io_size count) override {
+    m_readCount ++;
+    if(m_retry && m_readCount % 2 == 0) {
+      return data::IOError::RETRY;
+    }
+    data::v_io_size size = m_data->getSize() - m_position;
+    if(size == 0) {
+      return data::IOError::ZERO_VALUE;
+    }
+    if(size > count) size = count;
+    if(size > m_portionSize) size = m_portionSize;
+    std::memcpy(data, m_data->getData() + m_position, size);
+    m_position += size;
+    return size;
+  }
+
+  oatpp::async::Action suggestInputStreamAction(data::v_io_size ioResult) override {
+    (void) ioResult;
+    return oatpp::async::Action::createActionByType(oatpp::async::Action::TYPE_REPEAT);
+  }
+
+  void setInputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  oatpp::data::stream::IOMode getInputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::BLOCKING;
+  }
+
+  oatpp::String getRemaining() const {
+    return oatpp::String((const char*) m_data->getData() + m_position, m_data->getSize() - m_position, true);
+  }
+
+  v_int64 getReadCount() const {
+    return m_readCount;
+  }
+
+};
+
+/*
+ * Collects decoded body. If `keepData` is not set - only counts bytes and their sum.
+ */
+class Collector : public oatpp::data::stream::WriteCallback, public oatpp::data::stream::AsyncWriteCallback {
+private:
+  bool m_keepData;
+  oatpp::data::stream::ChunkedBuffer m_buffer;
+public:
+  v_int64 size = 0;
+  v_int64 sum = 0;
+public:
+
+  Collector(bool keepData)
+    : m_keepData(keepData)
+  {}
+
+  data::v_io_size write(const void *data, data::v_io_size count) override {
+    if(m_keepData) {
+      m_buffer.write(data, count);
+    } else {
+      sum += ((p_char8) data)[0] + ((p_char8) data)[count - 1];
+    }
+    size += count;
+    return count;
+  }
+
+  oatpp::async::Action writeAsyncInline(oatpp::async::AbstractCoroutine* coroutine,
+                                        oatpp::data::stream::AsyncInlineWriteData& inlineData,
+                                        oatpp::async::Action&& nextAction) override
+  {
+    (void) coroutine;
+    write(inlineData.currBufferPtr, inlineData.bytesLeft);
+    inlineData.setEof();
+    return std::forward<oatpp::async::Action>(nextAction);
+  }
+
+  oatpp::String toString() {
+    return m_buffer.toString();
+  }
+
+};
+
+class DecodeCoroutine : public oatpp::async::Coroutine<DecodeCoroutine> {
+private:
+  std::shared_ptr<MemoryStream> m_stream;
+  std::shared_ptr<Collector> m_collector;
+  bool* m_failed;
+public:
+
+  DecodeCoroutine(const std::shared_ptr<MemoryStream>& stream, const std::shared_ptr<Collector>& collector, bool* failed)
+    : m_stream(stream)
+    , m_collector(collector)
+    , m_failed(failed)
+  {}
+
+  Action act() override {
+    SimpleBodyDecoder decoder;
+    Headers headers;
+    headers[Header::TRANSFER_ENCODING] = Header::Value::TRANSFER_ENCODING_CHUNKED;
+    return decoder.decodeAsync(headers, m_stream, m_collector).next(finish());
+  }
+
+  Action handleError(const std::shared_ptr<const Error>& error) override {
+    (void) error;
+    *m_failed = true;
+    return finish();
+  }
+
+};
+
+v_char8 getBodyByte(v_int64 index) {
+  return (v_char8) ('a' + index % 23);
+}
+
+oatpp::String createBody(v_int64 size) {
+  oatpp::data::stream::ChunkedBuffer buffer;
+  for(v_int64 i = 0; i < size; i ++) {
+    buffer.writeChar(getBodyByte(i));
+  }
+  return buffer.toString();
+}
+
+/*
+ * Chunked encoding of the body followed by the next request. Chunk extension is added to every third chunk.
+ */
+oatpp::String encodeChunked(v_int64 bodySize, data::v_io_size chunkSize) {
+  oatpp::data::stream::ChunkedBuffer buffer;
+  oatpp::String chunk = createBody(chunkSize);
+  v_int64 pos = 0;
+  v_int64 chunkIndex = 0;
+  while(pos < bodySize) {
+    data::v_io_size size = chunkSize;
+    if(size > bodySize - pos) {
+      size = (data::v_io_size) (bodySize - pos);
+    }
+    v_char8 line[32];
+    v_int32 lineSize = std::snprintf((char*) line, 32, (chunkIndex % 3 == 2) ? "%X;ext=1\r\n" : "%x\r\n", (v_int32) size);
+    buffer.write(line, lineSize);
+    /* body byte at position p is the same for chunks of the same alignment */
+    if(pos % 23 == 0) {
+      buffer.write(chunk->getData(), size);
+    } else {
+      for(v_int64 i = 0; i < size; i ++) {
+        buffer.writeChar(getBodyByte(pos + i));
+      }
+    }
+    buffer.write("\r\n", 2);
+    pos += size;
+    chunkIndex ++;
+  }
+  buffer.write("0\r\n\r\n", 5);
+  buffer << NEXT_REQUEST;
+  return buffer.toString();
+}
+
+bool decode(const oatpp::String& encoded, data::v_io_size portionSize, bool async, bool retry,
+            const std::shared_ptr<Collector>& collector, oatpp::String& remaining, v_int64& readCount)
+{
+  auto stream = std::make_shared<MemoryStream>(encoded, portionSize, retry);
+  bool failed = false;
+  if(async) {
+    oatpp::async::Processor processor;
+    processor.execute<DecodeCoroutine>(stream, collector, &failed);
+    while(processor.iterate(100)) {}
+  } else {
+    SimpleBodyDecoder decoder;
+    Headers headers;
+    headers[Header::TRANSFER_ENCODING] = Header::Value::TRANSFER_ENCODING_CHUNKED;
+    decoder.decode(headers, stream.get(), collector.get());
+  }
+  remaining = stream->getRemaining();
+  readCount = stream->getReadCount();
+  return !failed;
+}
+
+void checkDecoding() {
+
+  v_int64 bodySizes[] = {0, 1, 100, 4096, 4100, 20000};
+  data::v_io_size chunkSizes[] = {1, 7, 100, 4096, 10000};
+  data::v_io_size portionSizes[] = {1, 3, 4096};
+
+  for(v_int64 bodySize : bodySizes) {
+    auto body = createBody(bodySize);
+    for(data::v_io_size chunkSize : chunkSizes) {
+      auto encoded = encodeChunked(bodySize, chunkSize);
+      for(data::v_io_size portionSize : portionSizes) {
+        for(v_int32 mode = 0; mode < 3; mode ++) {
+          bool async = mode > 0;
+          bool retry = mode == 2;
+          auto collector = std::make_shared<Collector>(true);
+          oatpp::String remaining;
+          v_int64 readCount;
+          OATPP_ASSERT(decode(encoded, portionSize, async, retry, collector, remaining, readCount));
+          OATPP_ASSERT(collector->toString() == body);
+          /* data after the body is not consumed */
+          OATPP_ASSERT(remaining == NEXT_REQUEST);
+        }
+      }
+    }
+  }
+
+}
+
+void checkErrors() {
+
+  const char* invalid[] = {
+    "\r\n",                      // empty size line
+    "zz\r\nabc\r\n0\r\n\r\n",    // invalid size
+    "3\r\nabcXY0\r\n\r\n",       // no CRLF after data
+    "3\nabc\r\n0\r\n\r\n",       // invalid line breaker
+    "1000000000000000\r\n",      // too long size
+    "3\r\nab"                    // truncated
+  };
+
+  for(const char* text : invalid) {
+    for(data::v_io_size portionSize = 1; portionSize < 8; portionSize ++) {
+      auto collector = std::make_shared<Collector>(true);
+      oatpp::String remaining;
+      v_int64 readCount;
+      OATPP_ASSERT(!decode(text, portionSize, true, false, collector, remaining, readCount));
+      decode(text, portionSize, false, false, std::make_shared<Collector>(true), remaining, readCount);
+    }
+  }
+
+}
+
+}
+
+void SimpleBodyDecoderTest::onRun() {
+  checkDecoding();
+  checkErrors();
+}
+
+}}}}}}
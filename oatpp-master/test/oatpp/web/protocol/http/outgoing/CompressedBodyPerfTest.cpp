@@ -0,0 +1,198 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "CompressedBodyPerfTest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/CompressedBody.hpp"
+#include "oatpp/web/protocol/http/outgoing/BufferBody.hpp"
+#include "oatpp/web/protocol/http/encoding/Deflate.hpp"
+
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+namespace {
+
+typedef oatpp::web::protocol::http::outgoing::CompressedBody CompressedBody;
+typedef oatpp::web::protocol::http::outgoing::BufferBody BufferBody;
+typedef oatpp::web::protocol::http::encoding::Deflate Deflate;
+typedef oatpp::web::protocol::http::encoding::DeflateEncoder DeflateEncoder;
+typedef oatpp::web::protocol::http::encoding::DeflateDecoder DeflateDecoder;
+typedef oatpp::web::protocol::http::Header Header;
+typedef oatpp::web::protocol::http::Headers Headers;
+
+/*
+ * JSON-like text - compresses well.
+ */
+oatpp::String createText(v_int64 size) {
+  oatpp::data::stream::ChunkedBuffer buffer;
+  v_int64 i = 0;
+  while(buffer.getSize() < size) {
+    buffer << "{\"id\":" << i << ",\"name\":\"item-" << i * 7919 % 10007 << "\",\"tags\":[\"alpha\",\"beta\"],\"active\":" << (i % 3 == 0) << "},\n";
+    i ++;
+  }
+  return buffer.getSubstring(0, size);
+}
+
+/*
+ * Pseudo-random bytes - don't compress.
+ */
+oatpp::String createNoise(v_int64 size) {
+  oatpp::String result((v_int32) size);
+  p_char8 data = result->getData();
+  v_word32 state = 12345;
+  for(v_int64 i = 0; i < size; i ++) {
+    state = state * 1103515245 + 12345;
+    data[i] = (v_char8) (state >> 16);
+  }
+  return result;
+}
+
+oatpp::String encode(const oatpp::String& data, const char* encoding, v_int32 level, v_int32 portion, v_int32 outSize) {
+  DeflateEncoder encoder(encoding, level);
+  oatpp::data::stream::ChunkedBuffer result;
+  std::unique_ptr<v_char8[]> out(new v_char8[outSize]);
+  v_int32 pos = 0;
+  do {
+    v_int32 size = data->getSize() - pos;
+    if(size > portion) size = portion;
+    encoder.setInput(&data->getData()[pos], size);
+    pos += size;
+    bool finish = pos == data->getSize();
+    data::v_io_size produced;
+    while((produced = encoder.process(out.get(), outSize, finish)) > 0) {
+      result.write(out.get(), produced);
+    }
+    OATPP_ASSERT(encoder.getInputSize() == 0);
+  } while(pos < data->getSize());
+  OATPP_ASSERT(encoder.isFinished());
+  return result.toString();
+}
+
+oatpp::String decode(const oatpp::String& data, v_int32 portion, v_int32 outSize, bool& success) {
+  DeflateDecoder decoder;
+  oatpp::data::stream::ChunkedBuffer result;
+  std::unique_ptr<v_char8[]> out(new v_char8[outSize]);
+  v_int32 pos = 0;
+  while(pos < data->getSize()) {
+    v_int32 size = data->getSize() - pos;
+    if(size > portion) size = portion;
+    decoder.setInput(&data->getData()[pos], size);
+    pos += size;
+    data::v_io_size produced;
+    while((produced = decoder.process(out.get(), outSize)) > 0) {
+      result.write(out.get(), produced);
+    }
+  }
+  success = decoder.isFinished() && decoder.getErrorMessage() == nullptr;
+  return result.toString();
+}
+
+/*
+ * Stream discarding all data.
+ */
+class NullStream : public oatpp::data::stream::OutputStream {
+public:
+
+  v_int64 total = 0;
+
+  data::v_io_size write(const void *data, data::v_io_size count) override {
+    (void) data;
+    total += count;
+    return count;
+  }
+
+  oatpp::async::Action suggestOutputStreamAction(data::v_io_size ioResult) override {
+    (void) ioResult;
+    return oatpp::async::Action::createActionByType(oatpp::async::Action::TYPE_REPEAT);
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::BLOCKING;
+  }
+
+};
+
+void runBenchmark(const char* tag, const oatpp::String& data, v_int32 level) {
+
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+
+  NullStream stream;
+  Headers headers;
+  std::shared_ptr<oatpp::web::protocol::http::outgoing::Body> body = BufferBody::createShared(data);
+  if(level != 0) {
+    body = CompressedBody::createShared(body, Header::Value::CONTENT_ENCODING_GZIP, level);
+  }
+  body->declareHeaders(headers);
+  body->writeToStream(&stream);
+
+  v_int64 compressTime = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  v_int64 inflateTime = 0;
+  if(level != 0) {
+    auto encoded = encode(data, Header::Value::CONTENT_ENCODING_GZIP, level, 1 << 30, 16384);
+    ticks = oatpp::base::Environment::getMicroTickCount();
+    bool success;
+    auto decoded = decode(encoded, 1 << 30, 16384, success);
+    inflateTime = oatpp::base::Environment::getMicroTickCount() - ticks;
+    OATPP_ASSERT(success && decoded->getSize() == data->getSize());
+  }
+
+  OATPP_LOGD(tag, "level %d: %d -> %lld bytes (%.1f%%), encode %lld(micro) %.1fMB/s, decode %lld(micro)",
+             level, data->getSize(), stream.total, stream.total * 100.0 / data->getSize(),
+             compressTime, data->getSize() / (compressTime + 1.0), inflateTime);
+
+}
+
+}
+
+void CompressedBodyPerfTest::onRun() {
+
+  if(!Deflate::isSupported()) {
+    OATPP_LOGD(TAG, "oatpp is built without zlib. Skipping.");
+    return;
+  }
+
+  auto text = createText(16 * 1024 * 1024);
+  auto noise = createNoise(4 * 1024 * 1024);
+
+  OATPP_LOGD(TAG, "json-like text:");
+  v_int32 levels[] = {0, 1, 3, 6, 9};
+  for(v_int32 level : levels) {
+    runBenchmark(TAG, text, level);
+  }
+
+  OATPP_LOGD(TAG, "incompressible data:");
+  runBenchmark(TAG, noise, 0);
+  runBenchmark(TAG, noise, 1);
+  runBenchmark(TAG, noise, 6);
+
+}
+
+}}}}}}
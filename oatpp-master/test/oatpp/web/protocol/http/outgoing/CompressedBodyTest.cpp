@@ -0,0 +1,603 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "CompressedBodyTest.hpp"
+
+#include "oatpp/web/server/handler/CompressionInterceptor.hpp"
+#include "oatpp/web/protocol/http/outgoing/CompressedBody.hpp"
+#include "oatpp/web/protocol/http/outgoing/BufferBody.hpp"
+#include "oatpp/web/protocol/http/outgoing/Response.hpp"
+#include "oatpp/web/protocol/http/incoming/SimpleBodyDecoder.hpp"
+#include "oatpp/web/protocol/http/incoming/Request.hpp"
+#include "oatpp/web/protocol/http/encoding/Deflate.hpp"
+
+#include "oatpp/core/data/stream/BufferInputStream.hpp"
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+#include "oatpp/core/async/Processor.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+namespace {
+
+typedef oatpp::web::protocol::http::outgoing::CompressedBody CompressedBody;
+typedef oatpp::web::protocol::http::outgoing::BufferBody BufferBody;
+typedef oatpp::web::protocol::http::outgoing::Response Response;
+typedef oatpp::web::protocol::http::incoming::SimpleBodyDecoder SimpleBodyDecoder;
+typedef oatpp::web::protocol::http::encoding::Deflate Deflate;
+typedef oatpp::web::protocol::http::encoding::DeflateEncoder DeflateEncoder;
+typedef oatpp::web::protocol::http::encoding::DeflateDecoder DeflateDecoder;
+typedef oatpp::web::server::handler::CompressionInterceptor CompressionInterceptor;
+typedef oatpp::web::protocol::http::Header Header;
+typedef oatpp::web::protocol::http::Headers Headers;
+typedef oatpp::web::protocol::http::Status Status;
+
+oatpp::String substring(const oatpp::String& str, v_int32 pos, v_int32 size) {
+  return oatpp::String((const char*) &str->getData()[pos], size, true);
+}
+
+/*
+ * JSON-like text - compresses well.
+ */
+oatpp::String createText(v_int64 size) {
+  oatpp::data::stream::ChunkedBuffer buffer;
+  v_int64 i = 0;
+  while(buffer.getSize() < size) {
+    buffer << "{\"id\":" << i << ",\"name\":\"item-" << i * 7919 % 10007 << "\",\"tags\":[\"alpha\",\"beta\"],\"active\":" << (i % 3 == 0) << "},\n";
+    i ++;
+  }
+  return buffer.getSubstring(0, size);
+}
+
+/*
+ * Pseudo-random bytes - don't compress.
+ */
+oatpp::String createNoise(v_int64 size) {
+  oatpp::String result((v_int32) size);
+  p_char8 data = result->getData();
+  v_word32 state = 12345;
+  for(v_int64 i = 0; i < size; i ++) {
+    state = state * 1103515245 + 12345;
+    data[i] = (v_char8) (state >> 16);
+  }
+  return result;
+}
+
+oatpp::String encode(const oatpp::String& data, const char* encoding, v_int32 level, v_int32 portion, v_int32 outSize) {
+  DeflateEncoder encoder(encoding, level);
+  oatpp::data::stream::ChunkedBuffer result;
+  std::unique_ptr<v_char8[]> out(new v_char8[outSize]);
+  v_int32 pos = 0;
+  do {
+    v_int32 size = data->getSize() - pos;
+    if(size > portion) size = portion;
+    encoder.setInput(&data->getData()[pos], size);
+    pos += size;
+    bool finish = pos == data->getSize();
+    data::v_io_size produced;
+    while((produced = encoder.process(out.get(), outSize, finish)) > 0) {
+      result.write(out.get(), produced);
+    }
+    OATPP_ASSERT(encoder.getInputSize() == 0);
+  } while(pos < data->getSize());
+  OATPP_ASSERT(encoder.isFinished());
+  return result.toString();
+}
+
+oatpp::String decode(const oatpp::String& data, v_int32 portion, v_int32 outSize, bool& success) {
+  DeflateDecoder decoder;
+  oatpp::data::stream::ChunkedBuffer result;
+  std::unique_ptr<v_char8[]> out(new v_char8[outSize]);
+  v_int32 pos = 0;
+  while(pos < data->getSize()) {
+    v_int32 size = data->getSize() - pos;
+    if(size > portion) size = portion;
+    decoder.setInput(&data->getData()[pos], size);
+    pos += size;
+    data::v_io_size produced;
+    while((produced = decoder.process(out.get(), outSize)) > 0) {
+      result.write(out.get(), produced);
+    }
+  }
+  success = decoder.isFinished() && decoder.getErrorMessage() == nullptr;
+  return result.toString();
+}
+
+void testSelectEncoding() {
+
+  OATPP_ASSERT(CompressionInterceptor::selectEncoding("gzip") == Header::Value::CONTENT_ENCODING_GZIP);
+  OATPP_ASSERT(CompressionInterceptor::selectEncoding("deflate") == Header::Value::CONTENT_ENCODING_DEFLATE);
+  OATPP_ASSERT(CompressionInterceptor::selectEncoding("GZip, deflate, br") == Header::Value::CONTENT_ENCODING_GZIP);
+  OATPP_ASSERT(CompressionInterceptor::selectEncoding("deflate, gzip") == Header::Value::CONTENT_ENCODING_GZIP);
+  OATPP_ASSERT(CompressionInterceptor::selectEncoding("gzip;q=0.5, deflate") == Header::Value::CONTENT_ENCODING_DEFLATE);
+  OATPP_ASSERT(CompressionInterceptor::selectEncoding("gzip ; q=0.8,deflate;q=0.799") == Header::Value::CONTENT_ENCODING_GZIP);
+  OATPP_ASSERT(CompressionInterceptor::selectEncoding("x-gzip") == Header::Value::CONTENT_ENCODING_GZIP);
+  OATPP_ASSERT(CompressionInterceptor::selectEncoding("*") == Header::Value::CONTENT_ENCODING_GZIP);
+  OATPP_ASSERT(CompressionInterceptor::selectEncoding("gzip;q=0, *") == Header::Value::CONTENT_ENCODING_DEFLATE);
+  OATPP_ASSERT(CompressionInterceptor::selectEncoding("gzip;q=0, deflate;q=0.000") == nullptr);
+  OATPP_ASSERT(CompressionInterceptor::selectEncoding("identity") == nullptr);
+  OATPP_ASSERT(CompressionInterceptor::selectEncoding("br, *;q=0") == nullptr);
+  OATPP_ASSERT(CompressionInterceptor::selectEncoding("") == nullptr);
+  OATPP_ASSERT(CompressionInterceptor::selectEncoding(" , ;q=1") == nullptr);
+
+}
+
+void testCodec() {
+
+  const char* encodings[] = {Header::Value::CONTENT_ENCODING_GZIP, Header::Value::CONTENT_ENCODING_DEFLATE};
+  oatpp::String samples[] = {"", "a", createText(100000), createNoise(100000)};
+  v_int32 portions[] = {7, 4096, 1 << 30};
+
+  for(const char* encoding : encodings) {
+    for(auto& sample : samples) {
+      for(v_int32 portion : portions) {
+        auto encoded = encode(sample, encoding, DeflateEncoder::LEVEL_DEFAULT, portion, 100);
+        OATPP_ASSERT(encoded->getSize() > 0);
+        bool success;
+        auto decoded = decode(encoded, portion, 100, success);
+        OATPP_ASSERT(success);
+        OATPP_ASSERT(decoded == sample);
+      }
+    }
+  }
+
+  auto text = createText(100000);
+  auto encoded = encode(text, Header::Value::CONTENT_ENCODING_GZIP, DeflateEncoder::LEVEL_BEST, 1 << 30, 4096);
+  OATPP_ASSERT(encoded->getSize() < text->getSize() / 4);
+
+  { // truncated
+    bool success;
+    decode(substring(encoded, 0, encoded->getSize() / 2), 1 << 30, 4096, success);
+    OATPP_ASSERT(!success);
+  }
+
+  { // corrupted
+    auto corrupted = substring(encoded, 0, encoded->getSize());
+    corrupted->getData()[corrupted->getSize() / 2] ^= 0xFF;
+    corrupted->getData()[corrupted->getSize() / 2 + 1] ^= 0xFF;
+    bool success;
+    decode(corrupted, 1 << 30, 4096, success);
+    OATPP_ASSERT(!success);
+  }
+
+  { // data following compressed stream is ignored
+    bool success;
+    auto decoded = decode(encoded + "garbage", 1 << 30, 4096, success);
+    OATPP_ASSERT(success);
+    OATPP_ASSERT(decoded == text);
+  }
+
+}
+
+/*
+ * Stream accepting at most `maxWriteSize` bytes per call and returning WAIT_RETRY on every other call.
+ */
+class ThrottlingStream : public oatpp::base::Countable, public oatpp::data::stream::OutputStream {
+private:
+  oatpp::data::stream::ChunkedBuffer m_buffer;
+  data::v_io_size m_maxWriteSize;
+  v_int64 m_calls;
+public:
+
+  ThrottlingStream(data::v_io_size maxWriteSize)
+    : m_maxWriteSize(maxWriteSize)
+    , m_calls(0)
+  {}
+
+  data::v_io_size write(const void *data, data::v_io_size count) override {
+    m_calls ++;
+    if(m_calls % 2 == 0) {
+      return data::IOError::WAIT_RETRY;
+    }
+    if(count > m_maxWriteSize) {
+      count = m_maxWriteSize;
+    }
+    return m_buffer.write(data, count);
+  }
+
+  oatpp::async::Action suggestOutputStreamAction(data::v_io_size ioResult) override {
+    (void) ioResult;
+    return oatpp::async::Action::createActionByType(oatpp::async::Action::TYPE_REPEAT);
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::NON_BLOCKING;
+  }
+
+  oatpp::String toString() {
+    return m_buffer.toString();
+  }
+
+};
+
+class SendCoroutine : public oatpp::async::Coroutine<SendCoroutine> {
+private:
+  std::shared_ptr<Response> m_response;
+  std::shared_ptr<ThrottlingStream> m_stream;
+public:
+
+  SendCoroutine(const std::shared_ptr<Response>& response, const std::shared_ptr<ThrottlingStream>& stream)
+    : m_response(response)
+    , m_stream(stream)
+  {}
+
+  Action act() override {
+    return m_response->sendAsync(m_stream).next(finish());
+  }
+
+};
+
+class DecodeCoroutine : public oatpp::async::Coroutine<DecodeCoroutine> {
+private:
+  std::shared_ptr<SimpleBodyDecoder> m_decoder;
+  Headers m_headers;
+  std::shared_ptr<oatpp::data::stream::InputStream> m_stream;
+  oatpp::String* m_result;
+  v_int32* m_status;
+public:
+
+  DecodeCoroutine(const std::shared_ptr<SimpleBodyDecoder>& decoder,
+                  const Headers& headers,
+                  const std::shared_ptr<oatpp::data::stream::InputStream>& stream,
+                  oatpp::String* result,
+                  v_int32* status)
+    : m_decoder(decoder)
+    , m_headers(headers)
+    , m_stream(stream)
+    , m_result(result)
+    , m_status(status)
+  {}
+
+  Action act() override {
+    return m_decoder->decodeToStringAsync(m_headers, m_stream).callbackTo(&DecodeCoroutine::onBody);
+  }
+
+  Action onBody(const oatpp::String& body) {
+    *m_result = body;
+    return finish();
+  }
+
+  Action handleError(const std::shared_ptr<const Error>& error) override {
+    OATPP_ASSERT(error->is<oatpp::web::protocol::http::AsyncHttpError>());
+    *m_status = static_cast<const oatpp::web::protocol::http::AsyncHttpError*>(error.get())->getStatus().code;
+    return finish();
+  }
+
+};
+
+/*
+ * Decode body with SimpleBodyDecoder. Returns `nullptr` and sets error `status` if decoding failed.
+ */
+oatpp::String decodeBody(const std::shared_ptr<SimpleBodyDecoder>& decoder,
+                         const Headers& headers,
+                         const oatpp::String& body,
+                         bool async,
+                         v_int32& status)
+{
+
+  auto stream = std::make_shared<oatpp::data::stream::BufferInputStream>(body);
+  status = 0;
+
+  if(async) {
+    oatpp::String result;
+    oatpp::async::Processor processor;
+    processor.execute<DecodeCoroutine>(decoder, headers, stream, &result, &status);
+    while(processor.iterate(100)) {}
+    return status != 0 ? nullptr : result;
+  }
+
+  try {
+    return decoder->decodeToString(headers, stream.get());
+  } catch (oatpp::web::protocol::http::HttpError& e) {
+    status = e.getInfo().status.code;
+    return nullptr;
+  }
+
+}
+
+oatpp::String decodeBody(const Headers& headers, const oatpp::String& body, bool async, v_int32 expectedStatus = 0) {
+  v_int32 status;
+  auto result = decodeBody(std::make_shared<SimpleBodyDecoder>(true), headers, body, async, status);
+  OATPP_ASSERT(status == expectedStatus);
+  return result;
+}
+
+oatpp::String send(const std::shared_ptr<Response>& response, bool async) {
+  if(async) {
+    auto stream = std::make_shared<ThrottlingStream>(1000);
+    oatpp::async::Processor processor;
+    processor.execute<SendCoroutine>(response, stream);
+    while(processor.iterate(100)) {}
+    return stream->toString();
+  }
+  oatpp::data::stream::ChunkedBuffer buffer;
+  buffer.setOutputStreamIOMode(oatpp::data::stream::IOMode::BLOCKING);
+  response->send(&buffer);
+  return buffer.toString();
+}
+
+/*
+ * Send response and decode its body. Checks that body is encoded (or not) as expected.
+ */
+oatpp::String sendAndDecode(const std::shared_ptr<Response>& response, bool async, const char* expectedEncoding, v_int32 chunkSize) {
+
+  auto data = send(response, async);
+  auto& headers = response->getHeaders();
+
+  auto encodingIt = headers.find(Header::CONTENT_ENCODING);
+  if(expectedEncoding == nullptr) {
+    OATPP_ASSERT(encodingIt == headers.end() || encodingIt->second != Header::Value::CONTENT_ENCODING_GZIP);
+  } else {
+    OATPP_ASSERT(encodingIt != headers.end() && encodingIt->second == expectedEncoding);
+    OATPP_ASSERT(headers.find(Header::CONTENT_LENGTH) == headers.end());
+    OATPP_ASSERT(headers.find(Header::TRANSFER_ENCODING) != headers.end());
+  }
+
+  oatpp::parser::Caret caret(data);
+  OATPP_ASSERT(caret.findText("\r\n\r\n"));
+  caret.inc(4);
+  auto body = substring(data, caret.getPosition(), data->getSize() - caret.getPosition());
+
+  if(expectedEncoding != nullptr) {
+    /* chunks of compressed data are bounded */
+    oatpp::parser::Caret chunkCaret(body);
+    while(true) {
+      v_int32 size = (v_int32) chunkCaret.parseUnsignedInt(16);
+      OATPP_ASSERT(!chunkCaret.hasError());
+      OATPP_ASSERT(size <= chunkSize);
+      chunkCaret.inc(size + 4);
+      if(size == 0) {
+        break;
+      }
+    }
+    OATPP_ASSERT(chunkCaret.getPosition() == chunkCaret.getDataSize());
+  }
+
+  auto result = decodeBody(headers, body, async);
+  OATPP_ASSERT(result);
+  return result;
+
+}
+
+std::shared_ptr<oatpp::web::protocol::http::incoming::Request> createRequest(const char* acceptEncoding) {
+  oatpp::web::protocol::http::RequestStartingLine startingLine;
+  startingLine.method = "GET";
+  startingLine.path = "/";
+  startingLine.protocol = "HTTP/1.1";
+  Headers headers;
+  if(acceptEncoding != nullptr) {
+    headers[Header::ACCEPT_ENCODING] = acceptEncoding;
+  }
+  return oatpp::web::protocol::http::incoming::Request::createShared(startingLine, {}, headers, nullptr, nullptr);
+}
+
+std::shared_ptr<Response> createResponse(const char* acceptEncoding, const oatpp::String& body, const char* contentType) {
+  auto interceptor = CompressionInterceptor::createShared(DeflateEncoder::LEVEL_DEFAULT, 1024, 4096);
+  auto response = Response::createShared(Status::CODE_200, BufferBody::createShared(body));
+  if(contentType != nullptr) {
+    response->putHeader(Header::CONTENT_TYPE, contentType);
+  }
+  return interceptor->intercept(createRequest(acceptEncoding), response);
+}
+
+void testCompressedBody() {
+
+  auto text = createText(300000);
+  auto small = createText(1000);
+
+  for(v_int32 i = 0; i < 2; i ++) {
+
+    bool async = i == 1;
+
+    OATPP_ASSERT(sendAndDecode(createResponse("gzip", text, "application/json"), async, "gzip", 4096) == text);
+    OATPP_ASSERT(sendAndDecode(createResponse("deflate", text, nullptr), async, "deflate", 4096) == text);
+    OATPP_ASSERT(sendAndDecode(createResponse("gzip", createNoise(10000), nullptr), async, "gzip", 4096)->getSize() == 10000);
+
+    /* not encoded - client doesn't accept, small body, compressed format */
+    OATPP_ASSERT(sendAndDecode(createResponse(nullptr, text, nullptr), async, nullptr, 0) == text);
+    OATPP_ASSERT(sendAndDecode(createResponse("br", text, nullptr), async, nullptr, 0) == text);
+    OATPP_ASSERT(sendAndDecode(createResponse("gzip", small, nullptr), async, nullptr, 0) == small);
+    OATPP_ASSERT(sendAndDecode(createResponse("gzip", text, "image/png"), async, nullptr, 0) == text);
+    OATPP_ASSERT(sendAndDecode(createResponse("gzip", text, "image/svg+xml"), async, "gzip", 4096) == text);
+
+    { // already encoded
+      auto response = Response::createShared(Status::CODE_200, BufferBody::createShared(text));
+      response->putHeader(Header::CONTENT_ENCODING, "br");
+      response = CompressionInterceptor::createShared()->intercept(createRequest("gzip"), response);
+      auto data = send(response, async);
+      OATPP_ASSERT(response->getHeaders().find(Header::CONTENT_ENCODING)->second == "br");
+      OATPP_ASSERT(data->getSize() > text->getSize());
+    }
+
+  }
+
+  { // Vary header is set, no body - nothing to do
+    auto response = createResponse("gzip", text, nullptr);
+    OATPP_ASSERT(response->getHeaders().find(Header::VARY)->second == Header::ACCEPT_ENCODING);
+    auto noBody = Response::createShared(Status::CODE_204, nullptr);
+    noBody = CompressionInterceptor::createShared()->intercept(createRequest("gzip"), noBody);
+    OATPP_ASSERT(!noBody->getBody());
+    OATPP_ASSERT(noBody->getHeaders().find(Header::VARY) == noBody->getHeaders().end());
+  }
+
+}
+
+void testValidators() {
+
+  auto text = createText(100000);
+
+  OATPP_ASSERT(CompressedBody::getEncodedETag("\"abc\"", "gzip") == "W/\"abc-gzip\"");
+  OATPP_ASSERT(CompressedBody::getEncodedETag("W/\"abc\"", "deflate") == "W/\"abc-deflate\"");
+  OATPP_ASSERT(!CompressedBody::getEncodedETag("abc", "gzip"));
+
+  { // encoded - own validator, no ranges
+    auto response = Response::createShared(Status::CODE_200, BufferBody::createShared(text));
+    response->putHeader(Header::ETAG, "\"abc\"");
+    response->putHeader(Header::ACCEPT_RANGES, "bytes");
+    response = CompressionInterceptor::createShared()->intercept(createRequest("gzip"), response);
+    send(response, false);
+    auto& headers = response->getHeaders();
+    OATPP_ASSERT(headers.find(Header::CONTENT_ENCODING)->second == "gzip");
+    OATPP_ASSERT(headers.find(Header::ETAG)->second == "W/\"abc-gzip\"");
+    OATPP_ASSERT(headers.find(Header::ACCEPT_RANGES) == headers.end());
+  }
+
+  { // malformed ETag is dropped
+    auto response = Response::createShared(Status::CODE_200, BufferBody::createShared(text));
+    response->putHeader(Header::ETAG, "abc");
+    response = CompressionInterceptor::createShared()->intercept(createRequest("gzip"), response);
+    send(response, false);
+    OATPP_ASSERT(response->getHeaders().find(Header::ETAG) == response->getHeaders().end());
+  }
+
+  { // partial content of the identity representation is not encoded
+    auto response = Response::createShared(Status::CODE_206, BufferBody::createShared(text));
+    response->putHeader(Header::ETAG, "\"abc\"");
+    response->putHeader(Header::ACCEPT_RANGES, "bytes");
+    response->putHeader(Header::CONTENT_RANGE, "bytes 0-99999/200000");
+    response = CompressionInterceptor::createShared()->intercept(createRequest("gzip"), response);
+    send(response, false);
+    auto& headers = response->getHeaders();
+    OATPP_ASSERT(headers.find(Header::CONTENT_ENCODING) == headers.end());
+    OATPP_ASSERT(headers.find(Header::ETAG)->second == "\"abc\"");
+    OATPP_ASSERT(headers.find(Header::ACCEPT_RANGES)->second == "bytes");
+  }
+
+}
+
+void testDecoderErrors() {
+
+  auto text = createText(100000);
+  auto encoded = encode(text, Header::Value::CONTENT_ENCODING_GZIP, DeflateEncoder::LEVEL_DEFAULT, 1 << 30, 4096);
+
+  Headers headers;
+  headers[Header::CONTENT_ENCODING] = "gzip";
+
+  for(v_int32 i = 0; i < 2; i ++) {
+
+    bool async = i == 1;
+
+    auto truncated = substring(encoded, 0, encoded->getSize() - 10);
+    headers[Header::CONTENT_LENGTH] = oatpp::utils::conversion::int32ToStr(truncated->getSize());
+    OATPP_ASSERT(!decodeBody(headers, truncated, async, 400));
+
+    auto corrupted = substring(encoded, 0, encoded->getSize());
+    std::memset(&corrupted->getData()[100], 0xFF, 100);
+    headers[Header::CONTENT_LENGTH] = oatpp::utils::conversion::int32ToStr(corrupted->getSize());
+    OATPP_ASSERT(!decodeBody(headers, corrupted, async, 400));
+
+    headers[Header::CONTENT_LENGTH] = oatpp::utils::conversion::int32ToStr(encoded->getSize());
+    OATPP_ASSERT(decodeBody(headers, encoded, async) == text);
+
+    /* inflation is disabled by default */
+    v_int32 status;
+    OATPP_ASSERT(decodeBody(std::make_shared<SimpleBodyDecoder>(), headers, encoded, async, status) == encoded);
+
+    /* inflated size is limited */
+    auto limited = std::make_shared<SimpleBodyDecoder>(true, text->getSize() - 1);
+    OATPP_ASSERT(!decodeBody(limited, headers, encoded, async, status));
+    OATPP_ASSERT(status == 413);
+    limited = std::make_shared<SimpleBodyDecoder>(true, text->getSize());
+    OATPP_ASSERT(decodeBody(limited, headers, encoded, async, status) == text);
+
+    /* empty body and unknown encodings are passed as is */
+    headers[Header::CONTENT_LENGTH] = "0";
+    OATPP_ASSERT(decodeBody(headers, "", async) == "");
+    Headers brHeaders;
+    brHeaders[Header::CONTENT_ENCODING] = "br";
+    brHeaders[Header::CONTENT_LENGTH] = oatpp::utils::conversion::int32ToStr(encoded->getSize());
+    OATPP_ASSERT(decodeBody(brHeaders, encoded, async) == encoded);
+
+  }
+
+}
+
+void testDecodedHeaders() {
+
+  auto text = createText(10000);
+  auto encoded = encode(text, Header::Value::CONTENT_ENCODING_GZIP, DeflateEncoder::LEVEL_DEFAULT, 1 << 30, 4096);
+
+  oatpp::web::protocol::http::RequestStartingLine startingLine;
+  startingLine.method = "POST";
+  startingLine.path = "/";
+  startingLine.protocol = "HTTP/1.1";
+  Headers headers;
+  headers[Header::CONTENT_ENCODING] = "gzip";
+  headers[Header::CONTENT_LENGTH] = oatpp::utils::conversion::int32ToStr(encoded->getSize());
+
+  { /* Content-Encoding and Content-Length of the inflated body are removed */
+    auto request = oatpp::web::protocol::http::incoming::Request::createShared(startingLine, {}, headers,
+                                                                               std::make_shared<oatpp::data::stream::BufferInputStream>(encoded),
+                                                                               std::make_shared<SimpleBodyDecoder>(true));
+    OATPP_ASSERT(request->readBodyToString() == text);
+    OATPP_ASSERT(!request->getHeader(Header::CONTENT_ENCODING));
+    OATPP_ASSERT(!request->getHeader(Header::CONTENT_LENGTH));
+  }
+
+  { /* same for async */
+    auto request = oatpp::web::protocol::http::incoming::Request::createShared(startingLine, {}, headers,
+                                                                               std::make_shared<oatpp::data::stream::BufferInputStream>(encoded),
+                                                                               std::make_shared<SimpleBodyDecoder>(true));
+    auto starter = request->readBodyToStringAsync();
+    OATPP_ASSERT(!request->getHeader(Header::CONTENT_ENCODING));
+  }
+
+  { /* headers are kept if body is not inflated */
+    auto request = oatpp::web::protocol::http::incoming::Request::createShared(startingLine, {}, headers,
+                                                                               std::make_shared<oatpp::data::stream::BufferInputStream>(encoded),
+                                                                               std::make_shared<SimpleBodyDecoder>());
+    OATPP_ASSERT(request->readBodyToString() == encoded);
+    OATPP_ASSERT(request->getHeader(Header::CONTENT_ENCODING) == "gzip");
+    OATPP_ASSERT(request->getHeader(Header::CONTENT_LENGTH));
+  }
+
+}
+
+}
+
+void CompressedBodyTest::onRun() {
+
+  if(!Deflate::isSupported()) {
+    OATPP_LOGD(TAG, "oatpp is built without zlib. Skipping.");
+    OATPP_ASSERT(CompressionInterceptor::selectEncoding("gzip") == Header::Value::CONTENT_ENCODING_GZIP);
+    return;
+  }
+
+  testSelectEncoding();
+  testCodec();
+  testCompressedBody();
+  testValidators();
+  testDecoderErrors();
+  testDecodedHeaders();
+
+}
+
+}}}}}}
@@ -0,0 +1,144 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "DtoBodyPerfTest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/DtoBody.hpp"
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+namespace {
+
+typedef oatpp::web::protocol::http::outgoing::DtoBody DtoBody;
+typedef oatpp::web::protocol::http::Header Header;
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class ItemDto : public oatpp::data::mapping::type::Object {
+
+  DTO_INIT(ItemDto, Object)
+
+  DTO_FIELD(Int32, id);
+  DTO_FIELD(String, name);
+  DTO_FIELD(String, description);
+  DTO_FIELD(List<String>::ObjectWrapper, tags);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+typedef oatpp::data::mapping::type::List<ItemDto::ObjectWrapper> ItemList;
+
+static constexpr v_int32 ITEMS_COUNT = 100000;
+
+ItemDto::ObjectWrapper createItem(v_int32 id) {
+  auto item = ItemDto::createShared();
+  item->id = id;
+  item->name = "item-" + oatpp::utils::conversion::int32ToStr(id);
+  if(id % 3 != 0) {
+    item->description = "Item \"description\" with chars to escape\n";
+  }
+  item->tags = oatpp::data::mapping::type::List<oatpp::String>::createShared();
+  item->tags->pushBack("tag-a");
+  item->tags->pushBack("tag-b");
+  return item;
+}
+
+ItemList::ObjectWrapper createList(v_int32 count) {
+  auto list = ItemList::createShared();
+  for(v_int32 i = 0; i < count; i ++) {
+    list->pushBack(createItem(i));
+  }
+  return list;
+}
+
+/*
+ * Stream discarding all data.
+ */
+class NullStream : public oatpp::data::stream::OutputStream {
+public:
+
+  v_int64 total = 0;
+
+  data::v_io_size write(const void *data, data::v_io_size count) override {
+    (void) data;
+    total += count;
+    return count;
+  }
+
+  oatpp::async::Action suggestOutputStreamAction(data::v_io_size ioResult) override {
+    (void) ioResult;
+    return oatpp::async::Action::createActionByType(oatpp::async::Action::TYPE_REPEAT);
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::BLOCKING;
+  }
+
+};
+
+void runBenchmark(const char* tag, const ItemList::ObjectWrapper& list, bool streaming) {
+
+  auto mapper = oatpp::parser::json::mapping::ObjectMapper::createShared();
+
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+
+  auto body = DtoBody::createShared(list, mapper.get(), false, streaming);
+  oatpp::web::protocol::http::Headers headers;
+  body->declareHeaders(headers);
+  v_int64 buffered = DtoBody::STREAMING_CHUNK_SIZE;
+  if(!streaming) {
+    bool success;
+    buffered = oatpp::utils::conversion::strToInt64(headers[Header::CONTENT_LENGTH].toString(), success);
+  }
+
+  NullStream stream;
+  body->writeToStream(&stream);
+
+  v_int64 elapsed = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  OATPP_LOGD(tag, "%s: %d items, %lld bytes sent, peak body buffer ~%lld bytes, %lld(micro)",
+             streaming ? "streaming" : "buffered ", list->count(), stream.total, buffered, elapsed);
+
+}
+
+}
+
+void DtoBodyPerfTest::onRun() {
+
+  auto list = createList(ITEMS_COUNT);
+  runBenchmark(TAG, list, false);
+  runBenchmark(TAG, list, true);
+
+}
+
+}}}}}}
@@ -0,0 +1,263 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "DtoBodyTest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/DtoBody.hpp"
+#include "oatpp/web/protocol/http/outgoing/ResponseFactory.hpp"
+#include "oatpp/parser/json/mapping/ObjectMapper.hpp"
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+#include "oatpp/core/async/Processor.hpp"
+
+#include "oatpp/core/macro/codegen.hpp"
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+namespace {
+
+typedef oatpp::web::protocol::http::outgoing::DtoBody DtoBody;
+typedef oatpp::web::protocol::http::outgoing::Response Response;
+typedef oatpp::web::protocol::http::outgoing::ResponseFactory ResponseFactory;
+typedef oatpp::web::protocol::http::Header Header;
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class ItemDto : public oatpp::data::mapping::type::Object {
+
+  DTO_INIT(ItemDto, Object)
+
+  DTO_FIELD(Int32, id);
+  DTO_FIELD(String, name);
+  DTO_FIELD(String, description);
+  DTO_FIELD(List<String>::ObjectWrapper, tags);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+typedef oatpp::data::mapping::type::List<ItemDto::ObjectWrapper> ItemList;
+typedef oatpp::data::mapping::type::ListMap<oatpp::String, ItemDto::ObjectWrapper> ItemFields;
+
+ItemDto::ObjectWrapper createItem(v_int32 id) {
+  auto item = ItemDto::createShared();
+  item->id = id;
+  item->name = "item-" + oatpp::utils::conversion::int32ToStr(id);
+  if(id % 3 != 0) {
+    item->description = "Item \"description\" with chars to escape\n";
+  }
+  item->tags = oatpp::data::mapping::type::List<oatpp::String>::createShared();
+  item->tags->pushBack("tag-a");
+  item->tags->pushBack("tag-b");
+  return item;
+}
+
+ItemList::ObjectWrapper createList(v_int32 count) {
+  auto list = ItemList::createShared();
+  for(v_int32 i = 0; i < count; i ++) {
+    list->pushBack(createItem(i));
+  }
+  return list;
+}
+
+/*
+ * Stream accepting at most `maxWriteSize` bytes per call and returning WAIT_RETRY on every other call.
+ */
+class ThrottlingStream : public oatpp::base::Countable, public oatpp::data::stream::OutputStream {
+private:
+  oatpp::data::stream::ChunkedBuffer m_buffer;
+  data::v_io_size m_maxWriteSize;
+  v_int64 m_calls;
+public:
+
+  ThrottlingStream(data::v_io_size maxWriteSize)
+    : m_maxWriteSize(maxWriteSize)
+    , m_calls(0)
+  {}
+
+  data::v_io_size write(const void *data, data::v_io_size count) override {
+    m_calls ++;
+    if(m_calls % 2 == 0) {
+      return data::IOError::WAIT_RETRY;
+    }
+    if(count > m_maxWriteSize) {
+      count = m_maxWriteSize;
+    }
+    return m_buffer.write(data, count);
+  }
+
+  oatpp::async::Action suggestOutputStreamAction(data::v_io_size ioResult) override {
+    (void) ioResult;
+    return oatpp::async::Action::createActionByType(oatpp::async::Action::TYPE_REPEAT);
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::NON_BLOCKING;
+  }
+
+  oatpp::String toString() {
+    return m_buffer.toString();
+  }
+
+};
+
+class SendCoroutine : public oatpp::async::Coroutine<SendCoroutine> {
+private:
+  std::shared_ptr<Response> m_response;
+  std::shared_ptr<ThrottlingStream> m_stream;
+public:
+
+  SendCoroutine(const std::shared_ptr<Response>& response, const std::shared_ptr<ThrottlingStream>& stream)
+    : m_response(response)
+    , m_stream(stream)
+  {}
+
+  Action act() override {
+    return m_response->sendAsync(m_stream).next(finish());
+  }
+
+};
+
+/*
+ * Decode http response with chunked body. Returns body and the size of the largest chunk.
+ */
+oatpp::String decodeChunkedResponse(const oatpp::String& response, v_int32& maxChunkSize) {
+
+  oatpp::parser::Caret caret(response);
+  OATPP_ASSERT(caret.findText("\r\n\r\n"));
+  caret.inc(4);
+
+  oatpp::data::stream::ChunkedBuffer body;
+  maxChunkSize = 0;
+
+  while(true) {
+    v_int32 chunkSize = (v_int32) caret.parseUnsignedInt(16);
+    OATPP_ASSERT(!caret.hasError());
+    OATPP_ASSERT(caret.isAtText("\r\n", true));
+    if(chunkSize == 0) {
+      OATPP_ASSERT(caret.isAtText("\r\n", true));
+      break;
+    }
+    OATPP_ASSERT(caret.getPosition() + chunkSize + 2 <= caret.getDataSize());
+    body.write(caret.getCurrData(), chunkSize);
+    caret.inc(chunkSize);
+    OATPP_ASSERT(caret.isAtText("\r\n", true));
+    if(chunkSize > maxChunkSize) {
+      maxChunkSize = chunkSize;
+    }
+  }
+
+  OATPP_ASSERT(caret.getPosition() == caret.getDataSize());
+  return body.toString();
+
+}
+
+oatpp::String sendStreaming(const oatpp::data::mapping::type::AbstractObjectWrapper& dto,
+                            oatpp::data::mapping::ObjectMapper* mapper,
+                            bool async)
+{
+
+  auto response = ResponseFactory::createResponse(oatpp::web::protocol::http::Status::CODE_200, dto, mapper, true);
+  oatpp::String result;
+
+  if(async) {
+    auto stream = std::make_shared<ThrottlingStream>(1000);
+    oatpp::async::Processor processor;
+    processor.execute<SendCoroutine>(response, stream);
+    while(processor.iterate(100)) {}
+    result = stream->toString();
+  } else {
+    oatpp::data::stream::ChunkedBuffer buffer;
+    response->send(&buffer);
+    result = buffer.toString();
+  }
+
+  auto& headers = response->getHeaders();
+  OATPP_ASSERT(headers.find(Header::TRANSFER_ENCODING) != headers.end());
+  OATPP_ASSERT(headers.find(Header::CONTENT_LENGTH) == headers.end());
+  OATPP_ASSERT(headers.find(Header::CONTENT_TYPE) != headers.end());
+
+  return result;
+
+}
+
+void checkStreaming(const oatpp::data::mapping::type::AbstractObjectWrapper& dto,
+                    oatpp::data::mapping::ObjectMapper* mapper,
+                    v_int32 maxElementSize)
+{
+  auto expected = mapper->writeToString(dto);
+  for(v_int32 i = 0; i < 2; i ++) {
+    v_int32 maxChunkSize;
+    auto actual = decodeChunkedResponse(sendStreaming(dto, mapper, i == 1), maxChunkSize);
+    OATPP_ASSERT(actual == expected);
+    OATPP_ASSERT(maxChunkSize <= DtoBody::STREAMING_CHUNK_SIZE + maxElementSize);
+  }
+}
+
+void testStreaming() {
+
+  auto mapper = oatpp::parser::json::mapping::ObjectMapper::createShared();
+
+  auto noNullsConfig = oatpp::parser::json::mapping::Serializer::Config::createShared();
+  noNullsConfig->includeNullFields = false;
+  auto noNullsMapper = oatpp::parser::json::mapping::ObjectMapper::createShared(noNullsConfig);
+
+  auto list = createList(10000);
+  list->pushBack(nullptr);
+
+  auto fields = ItemFields::createShared();
+  for(v_int32 i = 0; i < 1000; i ++) {
+    fields->put("key-" + oatpp::utils::conversion::int32ToStr(i), createItem(i));
+  }
+  fields->put("null", nullptr);
+
+  checkStreaming(list, mapper.get(), 1024);
+  checkStreaming(list, noNullsMapper.get(), 1024);
+  checkStreaming(fields, mapper.get(), 1024);
+  checkStreaming(fields, noNullsMapper.get(), 1024);
+  checkStreaming(createItem(3), mapper.get(), 1024);
+  checkStreaming(createItem(3), noNullsMapper.get(), 1024);
+  checkStreaming(ItemList::createShared(), mapper.get(), 0);
+
+  { // null DTO - empty chunked body
+    v_int32 maxChunkSize;
+    auto body = decodeChunkedResponse(sendStreaming(ItemDto::ObjectWrapper(), mapper.get(), false), maxChunkSize);
+    OATPP_ASSERT(body->getSize() == 0);
+  }
+
+}
+
+}
+
+void DtoBodyTest::onRun() {
+
+  testStreaming();
+
+}
+
+}}}}}}
@@ -0,0 +1,156 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "FileBodyPerfTest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/FileBody.hpp"
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+#include "oatpp/core/data/stream/FileStream.hpp"
+#include "oatpp/network/Connection.hpp"
+
+#include <thread>
+#include <cstdio>
+
+#if !defined(WIN32) && !defined(_WIN32)
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+namespace {
+
+typedef oatpp::web::protocol::http::outgoing::FileBody FileBody;
+
+static const char* const FILE_NAME = "FileBodyPerfTest.tmp";
+
+/*
+ * Benchmark file sizes are capped at 64MB to keep the benchmark short. Larger files behave the same.
+ */
+static constexpr v_int64 MAX_BENCHMARK_FILE_SIZE = 64 * 1024 * 1024;
+
+#if !defined(WIN32) && !defined(_WIN32)
+
+oatpp::String createFile(v_int64 size) {
+  oatpp::String content((v_int32) size);
+  for(v_int32 i = 0; i < size; i ++) {
+    content->getData()[i] = (v_char8) ('a' + i % 26);
+  }
+  std::FILE* file = std::fopen(FILE_NAME, "wb");
+  OATPP_ASSERT(file);
+  OATPP_ASSERT(std::fwrite(content->getData(), 1, size, file) == (size_t) size);
+  std::fclose(file);
+  return content;
+}
+
+/*
+ * Run `send` with response streamed to socketpair and return everything the other side has received.
+ */
+template<class F>
+oatpp::String receive(v_int64 expectedSize, const F& send) {
+
+  int fds[2];
+  OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+
+  oatpp::data::stream::ChunkedBuffer received;
+  std::thread reader([fds, expectedSize, &received]{
+    v_char8 buffer[65536];
+    v_int64 total = expectedSize;
+    while(total > 0) {
+      auto res = ::read(fds[1], buffer, sizeof(buffer));
+      if(res <= 0) {
+        break;
+      }
+      received.write(buffer, res);
+      total -= res;
+    }
+  });
+
+  send(oatpp::network::Connection::createShared(fds[0]));
+
+  reader.join();
+  ::close(fds[1]);
+
+  return received.toString();
+
+}
+
+void runTransfer(const char* tag, v_int64 fileSize, bool zeroCopy) {
+
+  createFile(fileSize);
+
+  v_int32 iterations = (v_int32) (MAX_BENCHMARK_FILE_SIZE / fileSize);
+  if(iterations > 1000) {
+    iterations = 1000;
+  }
+
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+
+  receive(fileSize * iterations, [fileSize, iterations, zeroCopy](const std::shared_ptr<oatpp::network::Connection>& connection){
+
+    std::unique_ptr<v_char8[]> buffer(new v_char8[FileBody::COPY_BUFFER_SIZE]);
+
+    for(v_int32 i = 0; i < iterations; i ++) {
+      if(zeroCopy) {
+        FileBody::createShared(FILE_NAME)->writeToStream(connection.get());
+      } else {
+        oatpp::data::stream::FileInputStream file(FILE_NAME);
+        oatpp::data::stream::DefaultWriteCallback callback(connection.get());
+        auto res = oatpp::data::stream::transfer(&file, &callback, fileSize, buffer.get(), FileBody::COPY_BUFFER_SIZE);
+        OATPP_ASSERT(res == fileSize);
+      }
+    }
+
+  });
+
+  v_int64 elapsed = oatpp::base::Environment::getMicroTickCount() - ticks;
+  v_int64 megabytes = fileSize * iterations / (1024 * 1024);
+
+  OATPP_LOGD(tag, "file=%lld bytes x %d: %lld(micro), %lld(MB/sec)",
+             fileSize, iterations, elapsed, megabytes * 1000000 / (elapsed + 1));
+
+}
+
+#endif
+
+}
+
+void FileBodyPerfTest::onRun() {
+
+#if !defined(WIN32) && !defined(_WIN32)
+  v_int64 fileSizes[] = {4 * 1024, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024, MAX_BENCHMARK_FILE_SIZE};
+  for(auto fileSize : fileSizes) {
+    runTransfer("FileBody copy    ", fileSize, false);
+    runTransfer("FileBody sendfile", fileSize, true);
+  }
+#else
+  OATPP_LOGD(TAG, "Skipped. socketpair() is not available.");
+#endif
+
+  std::remove(FILE_NAME);
+
+}
+
+}}}}}}
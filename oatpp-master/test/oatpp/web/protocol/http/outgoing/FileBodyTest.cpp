@@ -0,0 +1,332 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "FileBodyTest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/FileBody.hpp"
+#include "oatpp/core/data/stream/StreamBufferedProxy.hpp"
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+#include "oatpp/core/async/Processor.hpp"
+#include "oatpp/network/Connection.hpp"
+
+#include <thread>
+#include <cstdio>
+
+#if !defined(WIN32) && !defined(_WIN32)
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+namespace {
+
+typedef oatpp::web::protocol::http::outgoing::FileBody FileBody;
+typedef oatpp::web::protocol::http::outgoing::Response Response;
+typedef oatpp::web::protocol::http::Header Header;
+typedef oatpp::web::protocol::http::Headers Headers;
+
+static const char* const FILE_NAME = "FileBodyTest.tmp";
+static constexpr v_int32 TEST_FILE_SIZE = 100000;
+
+oatpp::String createFile(v_int64 size) {
+  oatpp::String content((v_int32) size);
+  for(v_int32 i = 0; i < size; i ++) {
+    content->getData()[i] = (v_char8) ('a' + i % 26);
+  }
+  std::FILE* file = std::fopen(FILE_NAME, "wb");
+  OATPP_ASSERT(file);
+  OATPP_ASSERT(std::fwrite(content->getData(), 1, size, file) == (size_t) size);
+  std::fclose(file);
+  return content;
+}
+
+oatpp::String getHeader(const std::shared_ptr<Response>& response, const char* name) {
+  auto& headers = response->getHeaders();
+  auto it = headers.find(name);
+  if(it == headers.end()) {
+    return nullptr;
+  }
+  return it->second.toString();
+}
+
+oatpp::String getBody(const oatpp::String& output) {
+  p_char8 data = output->getData();
+  for(v_int32 i = 0; i + 3 < output->getSize(); i ++) {
+    if(data[i] == '\r' && data[i + 1] == '\n' && data[i + 2] == '\r' && data[i + 3] == '\n') {
+      return oatpp::String((const char*) &data[i + 4], output->getSize() - i - 4, true);
+    }
+  }
+  return nullptr;
+}
+
+std::shared_ptr<Response> requestFile(const char* headerName, const char* headerValue) {
+  Headers headers;
+  if(headerName != nullptr) {
+    headers[headerName] = oatpp::String(headerValue);
+  }
+  return FileBody::createResponse(FILE_NAME, headers);
+}
+
+oatpp::String sendToBuffer(const std::shared_ptr<Response>& response) {
+  oatpp::data::stream::ChunkedBuffer buffer;
+  response->send(&buffer);
+  return buffer.toString();
+}
+
+class SendCoroutine : public oatpp::async::Coroutine<SendCoroutine> {
+private:
+  std::shared_ptr<Response> m_response;
+  std::shared_ptr<oatpp::data::stream::OutputStreamBufferedProxy> m_stream;
+public:
+
+  SendCoroutine(const std::shared_ptr<Response>& response, const std::shared_ptr<oatpp::data::stream::OutputStreamBufferedProxy>& stream)
+    : m_response(response)
+    , m_stream(stream)
+  {}
+
+  Action act() override {
+    return m_response->sendAsync(m_stream).next(m_stream->flushAsync()).next(finish());
+  }
+
+};
+
+void testResponses() {
+
+  auto content = createFile(TEST_FILE_SIZE);
+
+  OATPP_ASSERT(FileBody::createResponse("FileBodyTest.not-exists", Headers()) == nullptr);
+
+  {
+    auto response = requestFile(nullptr, nullptr);
+    OATPP_ASSERT(response->getStatus().code == 200);
+    OATPP_ASSERT(getHeader(response, Header::ACCEPT_RANGES) == "bytes");
+    OATPP_ASSERT(getHeader(response, Header::ETAG));
+    OATPP_ASSERT(getHeader(response, Header::LAST_MODIFIED));
+    OATPP_ASSERT(getBody(sendToBuffer(response)) == content);
+  }
+
+  {
+    auto response = requestFile(Header::RANGE, "bytes=10-19");
+    OATPP_ASSERT(response->getStatus().code == 206);
+    OATPP_ASSERT(getHeader(response, Header::CONTENT_RANGE) == "bytes 10-19/100000");
+    OATPP_ASSERT(getBody(sendToBuffer(response)) == oatpp::String((const char*) content->getData() + 10, 10, true));
+  }
+
+  {
+    auto response = requestFile(Header::RANGE, "bytes=-5");
+    OATPP_ASSERT(response->getStatus().code == 206);
+    OATPP_ASSERT(getHeader(response, Header::CONTENT_RANGE) == "bytes 99995-99999/100000");
+    OATPP_ASSERT(getBody(sendToBuffer(response)) == oatpp::String((const char*) content->getData() + 99995, 5, true));
+  }
+
+  {
+    auto response = requestFile(Header::RANGE, "bytes=99990-200000");
+    OATPP_ASSERT(response->getStatus().code == 206);
+    OATPP_ASSERT(getHeader(response, Header::CONTENT_RANGE) == "bytes 99990-99999/100000");
+  }
+
+  {
+    auto response = requestFile(Header::RANGE, "bytes=100000-");
+    OATPP_ASSERT(response->getStatus().code == 416);
+    OATPP_ASSERT(getHeader(response, Header::CONTENT_RANGE) == "bytes */100000");
+  }
+
+  {
+    auto response = requestFile(Header::RANGE, "bytes=0-1,5-6");
+    OATPP_ASSERT(response->getStatus().code == 200);
+    auto response2 = requestFile(Header::RANGE, "bytes=abc");
+    OATPP_ASSERT(response2->getStatus().code == 200);
+  }
+
+  {
+    auto etag = getHeader(requestFile(nullptr, nullptr), Header::ETAG);
+    auto lastModified = getHeader(requestFile(nullptr, nullptr), Header::LAST_MODIFIED);
+    OATPP_ASSERT(requestFile(Header::IF_NONE_MATCH, etag->c_str())->getStatus().code == 304);
+    OATPP_ASSERT(requestFile(Header::IF_NONE_MATCH, ("\"other\", " + etag)->c_str())->getStatus().code == 304);
+    OATPP_ASSERT(requestFile(Header::IF_NONE_MATCH, "*")->getStatus().code == 304);
+    OATPP_ASSERT(requestFile(Header::IF_NONE_MATCH, "\"other\"")->getStatus().code == 200);
+    OATPP_ASSERT(requestFile(Header::IF_MODIFIED_SINCE, lastModified->c_str())->getStatus().code == 304);
+  }
+
+  {
+    /* file is created just now - any date in the future means "not modified", any date in the past - "modified" */
+    OATPP_ASSERT(requestFile(Header::IF_MODIFIED_SINCE, "Fri, 01 Jan 2100 00:00:00 GMT")->getStatus().code == 304);
+    OATPP_ASSERT(requestFile(Header::IF_MODIFIED_SINCE, "Friday, 01-Jan-60 00:00:00 GMT")->getStatus().code == 304);
+    OATPP_ASSERT(requestFile(Header::IF_MODIFIED_SINCE, "Fri Jan  1 00:00:00 2100")->getStatus().code == 304);
+    OATPP_ASSERT(requestFile(Header::IF_MODIFIED_SINCE, "Sun, 06 Nov 1994 08:49:37 GMT")->getStatus().code == 200);
+    OATPP_ASSERT(requestFile(Header::IF_MODIFIED_SINCE, "Sunday, 06-Nov-94 08:49:37 GMT")->getStatus().code == 200);
+    OATPP_ASSERT(requestFile(Header::IF_MODIFIED_SINCE, "Sun Nov  6 08:49:37 1994")->getStatus().code == 200);
+    OATPP_ASSERT(requestFile(Header::IF_MODIFIED_SINCE, "Fri, 01 Jan 2100 00:00:00")->getStatus().code == 200);
+    OATPP_ASSERT(requestFile(Header::IF_MODIFIED_SINCE, "garbage")->getStatus().code == 200);
+  }
+
+  {
+    /* directory can be opened with fopen on some platforms but must not be served */
+    OATPP_ASSERT(FileBody::createResponse(".", Headers()) == nullptr);
+  }
+
+}
+
+#if !defined(WIN32) && !defined(_WIN32)
+
+/*
+ * Run `send` with response streamed to socketpair and return everything the other side has received.
+ */
+template<class F>
+oatpp::String receive(v_int64 expectedSize, const F& send) {
+
+  int fds[2];
+  OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+
+  /* don't hang if the sender stops short without closing the connection */
+  struct timeval tv;
+  tv.tv_sec = 5;
+  tv.tv_usec = 0;
+  OATPP_ASSERT(::setsockopt(fds[1], SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) == 0);
+
+  oatpp::data::stream::ChunkedBuffer received;
+  std::thread reader([fds, expectedSize, &received]{
+    v_char8 buffer[65536];
+    v_int64 total = expectedSize;
+    while(total > 0) {
+      auto res = ::read(fds[1], buffer, sizeof(buffer));
+      if(res <= 0) {
+        break;
+      }
+      received.write(buffer, res);
+      total -= res;
+    }
+  });
+
+  send(oatpp::network::Connection::createShared(fds[0]));
+
+  reader.join();
+  ::close(fds[1]);
+
+  return received.toString();
+
+}
+
+void testConnectionOutput() {
+
+  auto content = createFile(TEST_FILE_SIZE);
+  auto expected = sendToBuffer(requestFile(nullptr, nullptr));
+
+  auto actual = receive(expected->getSize(), [](const std::shared_ptr<oatpp::network::Connection>& connection){
+    auto outStream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(connection, oatpp::data::buffer::IOBuffer::createShared());
+    requestFile(nullptr, nullptr)->send(outStream.get());
+    outStream->flush();
+  });
+  OATPP_ASSERT(actual == expected);
+
+  auto actualAsync = receive(expected->getSize(), [](const std::shared_ptr<oatpp::network::Connection>& connection){
+    auto outStream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(connection, oatpp::data::buffer::IOBuffer::createShared());
+    oatpp::async::Processor processor;
+    processor.execute<SendCoroutine>(requestFile(nullptr, nullptr), outStream);
+    while(processor.iterate(100)) {}
+  });
+  OATPP_ASSERT(actualAsync == expected);
+
+  auto expectedRange = sendToBuffer(requestFile(Header::RANGE, "bytes=1000-"));
+  auto actualRange = receive(expectedRange->getSize(), [](const std::shared_ptr<oatpp::network::Connection>& connection){
+    auto outStream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(connection, oatpp::data::buffer::IOBuffer::createShared());
+    requestFile(Header::RANGE, "bytes=1000-")->send(outStream.get());
+    outStream->flush();
+  });
+  OATPP_ASSERT(actualRange == expectedRange);
+
+  /* sync send to non-blocking socket waits for the socket to become writable */
+  auto bigContent = createFile(TEST_FILE_SIZE * 40);
+  auto expectedBig = sendToBuffer(requestFile(nullptr, nullptr));
+  auto actualBig = receive(expectedBig->getSize(), [](const std::shared_ptr<oatpp::network::Connection>& connection){
+    connection->setOutputStreamIOMode(oatpp::data::stream::IOMode::NON_BLOCKING);
+    auto outStream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(connection, oatpp::data::buffer::IOBuffer::createShared());
+    requestFile(nullptr, nullptr)->send(outStream.get());
+    outStream->flush();
+  });
+  OATPP_ASSERT(actualBig == expectedBig);
+
+}
+
+void testTruncatedFile() {
+
+  auto content = createFile(TEST_FILE_SIZE);
+  auto expected = sendToBuffer(requestFile(nullptr, nullptr));
+
+  for(v_int32 i = 0; i < 2; i ++) {
+
+    bool async = i == 1;
+    bool closed = false;
+
+    auto actual = receive(expected->getSize(), [async, &closed](const std::shared_ptr<oatpp::network::Connection>& connection){
+
+      auto response = requestFile(nullptr, nullptr); // Content-Length of the whole file
+      OATPP_ASSERT(::truncate(FILE_NAME, TEST_FILE_SIZE / 2) == 0);
+
+      auto outStream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(connection, oatpp::data::buffer::IOBuffer::createShared());
+      if(async) {
+        oatpp::async::Processor processor;
+        processor.execute<SendCoroutine>(response, outStream);
+        while(processor.iterate(100)) {}
+        closed = true; // coroutine ends with error - connection is dropped by the connection handler
+      } else {
+        response->send(outStream.get());
+        outStream->flush();
+        v_char8 c = 0;
+        closed = connection->write(&c, 1) < 0; // connection is shut down
+      }
+
+    });
+
+    OATPP_ASSERT(closed);
+    OATPP_ASSERT(actual->getSize() < expected->getSize());
+
+    createFile(TEST_FILE_SIZE);
+
+  }
+
+}
+
+#endif
+
+}
+
+void FileBodyTest::onRun() {
+
+  testResponses();
+
+#if !defined(WIN32) && !defined(_WIN32)
+  testConnectionOutput();
+  testTruncatedFile();
+#else
+  OATPP_LOGD(TAG, "Skipped. socketpair() is not available.");
+#endif
+
+  std::remove(FILE_NAME);
+
+}
+
+}}}}}}
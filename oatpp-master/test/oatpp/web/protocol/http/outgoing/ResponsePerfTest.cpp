@@ -0,0 +1,208 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "ResponsePerfTest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/Response.hpp"
+#include "oatpp/web/protocol/http/outgoing/BufferBody.hpp"
+#include "oatpp/core/data/stream/StreamBufferedProxy.hpp"
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+#include "oatpp/network/Connection.hpp"
+
+#include <thread>
+
+#if !defined(WIN32) && !defined(_WIN32)
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+namespace {
+
+typedef oatpp::web::protocol::http::outgoing::Response Response;
+typedef oatpp::web::protocol::http::outgoing::BufferBody BufferBody;
+
+static constexpr v_int32 RESPONSES_COUNT = 20000;
+
+/*
+ * Forward writes to the underlying stream and count calls which would hit the socket.
+ */
+class CountingStream : public oatpp::base::Countable, public oatpp::data::stream::OutputStream {
+private:
+  std::shared_ptr<oatpp::data::stream::OutputStream> m_stream;
+public:
+
+  v_int64 calls = 0;
+  v_int64 bytes = 0;
+
+  CountingStream(const std::shared_ptr<oatpp::data::stream::OutputStream>& stream)
+    : m_stream(stream)
+  {}
+
+  data::v_io_size write(const void *data, data::v_io_size count) override {
+    calls ++;
+    auto res = m_stream->write(data, count);
+    if(res > 0) bytes += res;
+    return res;
+  }
+
+  data::v_io_size writeVectored(const oatpp::data::stream::IOVector* vectors, v_int32 count) override {
+    calls ++;
+    auto res = m_stream->writeVectored(vectors, count);
+    if(res > 0) bytes += res;
+    return res;
+  }
+
+  oatpp::async::Action suggestOutputStreamAction(data::v_io_size ioResult) override {
+    return m_stream->suggestOutputStreamAction(ioResult);
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    m_stream->setOutputStreamIOMode(ioMode);
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return m_stream->getOutputStreamIOMode();
+  }
+
+};
+
+std::shared_ptr<Response> createResponse(const oatpp::String& body) {
+  auto response = Response::createShared(oatpp::web::protocol::http::Status::CODE_200, BufferBody::createShared(body));
+  response->putHeader("Content-Type", "application/json");
+  response->putHeader("Connection", "keep-alive");
+  response->putHeader("Server", "oatpp/" OATPP_VERSION);
+  return response;
+}
+
+/*
+ * Previous implementation - headers are serialized to ChunkedBuffer and flushed, then body is written separately.
+ */
+void sendLegacy(const std::shared_ptr<Response>& response, const std::shared_ptr<oatpp::web::protocol::http::outgoing::Body>& body,
+                oatpp::data::stream::OutputStream* stream)
+{
+
+  body->declareHeaders(response->getHeaders());
+
+  oatpp::data::stream::ChunkedBuffer buffer;
+
+  buffer.write("HTTP/1.1 ", 9);
+  buffer.writeAsString(response->getStatus().code);
+  buffer.write(" ", 1);
+  buffer.OutputStream::write(response->getStatus().description);
+  buffer.write("\r\n", 2);
+
+  for(auto& pair : response->getHeaders()) {
+    buffer.write(pair.first.getData(), pair.first.getSize());
+    buffer.write(": ", 2);
+    buffer.write(pair.second.getData(), pair.second.getSize());
+    buffer.write("\r\n", 2);
+  }
+
+  buffer.write("\r\n", 2);
+  buffer.flushToStream(stream);
+  body->writeToStream(stream);
+
+}
+
+#if !defined(WIN32) && !defined(_WIN32)
+
+void runSend(const char* tag, v_int32 bodySize, bool legacy) {
+
+  int fds[2];
+  OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+
+  oatpp::String body(bodySize);
+  std::memset(body->getData(), 'a', bodySize);
+
+  v_int64 responseSize = 0;
+  {
+    oatpp::data::stream::ChunkedBuffer buffer;
+    createResponse(body)->send(&buffer);
+    responseSize = buffer.getSize();
+  }
+
+  std::thread reader([fds, responseSize]{
+    v_char8 buffer[65536];
+    v_int64 total = responseSize * RESPONSES_COUNT;
+    while(total > 0) {
+      auto res = ::read(fds[1], buffer, sizeof(buffer));
+      if(res <= 0) {
+        break;
+      }
+      total -= res;
+    }
+  });
+
+  auto connection = oatpp::network::Connection::createShared(fds[0]);
+  auto counter = std::make_shared<CountingStream>(connection);
+  auto ioBuffer = oatpp::data::buffer::IOBuffer::createShared();
+  auto outStream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(counter, ioBuffer);
+
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+
+  for(v_int32 i = 0; i < RESPONSES_COUNT; i ++) {
+    auto response = createResponse(body);
+    if(legacy) {
+      sendLegacy(response, BufferBody::createShared(body), outStream.get());
+    } else {
+      response->send(outStream.get());
+    }
+    outStream->flush();
+  }
+
+  v_int64 elapsed = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  reader.join();
+  ::close(fds[1]);
+
+  OATPP_ASSERT(counter->bytes == responseSize * RESPONSES_COUNT);
+
+  OATPP_LOGD(tag, "body=%d bytes: %d responses in %lld(micro), %lld(responses/sec), syscalls per response=%.2f",
+             bodySize, RESPONSES_COUNT, elapsed, (v_int64) RESPONSES_COUNT * 1000000 / (elapsed + 1),
+             (v_float64) counter->calls / RESPONSES_COUNT);
+
+}
+
+#endif
+
+}
+
+void ResponsePerfTest::onRun() {
+
+#if !defined(WIN32) && !defined(_WIN32)
+  v_int32 bodySizes[] = {64, 2048, 16384, 65536};
+  for(auto bodySize : bodySizes) {
+    runSend("Response::send legacy ", bodySize, true);
+    runSend("Response::send writev ", bodySize, false);
+  }
+#else
+  OATPP_LOGD(TAG, "Skipped. socketpair() is not available.");
+#endif
+
+}
+
+}}}}}}
@@ -0,0 +1,208 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "ResponseTest.hpp"
+
+#include "oatpp/web/protocol/http/outgoing/Response.hpp"
+#include "oatpp/web/protocol/http/outgoing/BufferBody.hpp"
+#include "oatpp/core/data/stream/StreamBufferedProxy.hpp"
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+#include "oatpp/core/async/Processor.hpp"
+
+namespace oatpp { namespace test { namespace web { namespace protocol { namespace http { namespace outgoing {
+
+namespace {
+
+typedef oatpp::web::protocol::http::outgoing::Response Response;
+typedef oatpp::web::protocol::http::outgoing::BufferBody BufferBody;
+
+/*
+ * Forward writes to the underlying stream and count calls which would hit the socket.
+ */
+class CountingStream : public oatpp::base::Countable, public oatpp::data::stream::OutputStream {
+private:
+  std::shared_ptr<oatpp::data::stream::OutputStream> m_stream;
+public:
+
+  v_int64 calls = 0;
+  v_int64 bytes = 0;
+
+  CountingStream(const std::shared_ptr<oatpp::data::stream::OutputStream>& stream)
+    : m_stream(stream)
+  {}
+
+  data::v_io_size write(const void *data, data::v_io_size count) override {
+    calls ++;
+    auto res = m_stream->write(data, count);
+    if(res > 0) bytes += res;
+    return res;
+  }
+
+  data::v_io_size writeVectored(const oatpp::data::stream::IOVector* vectors, v_int32 count) override {
+    calls ++;
+    auto res = m_stream->writeVectored(vectors, count);
+    if(res > 0) bytes += res;
+    return res;
+  }
+
+  oatpp::async::Action suggestOutputStreamAction(data::v_io_size ioResult) override {
+    return m_stream->suggestOutputStreamAction(ioResult);
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    m_stream->setOutputStreamIOMode(ioMode);
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return m_stream->getOutputStreamIOMode();
+  }
+
+};
+
+std::shared_ptr<Response> createResponse(const oatpp::String& body) {
+  auto response = Response::createShared(oatpp::web::protocol::http::Status::CODE_200, BufferBody::createShared(body));
+  response->putHeader("Content-Type", "application/json");
+  response->putHeader("Connection", "keep-alive");
+  response->putHeader("Server", "oatpp/" OATPP_VERSION);
+  return response;
+}
+
+/*
+ * Previous implementation - headers are serialized to ChunkedBuffer and flushed, then body is written separately.
+ */
+void sendLegacy(const std::shared_ptr<Response>& response, const std::shared_ptr<oatpp::web::protocol::http::outgoing::Body>& body,
+                oatpp::data::stream::OutputStream* stream)
+{
+
+  body->declareHeaders(response->getHeaders());
+
+  oatpp::data::stream::ChunkedBuffer buffer;
+
+  buffer.write("HTTP/1.1 ", 9);
+  buffer.writeAsString(response->getStatus().code);
+  buffer.write(" ", 1);
+  buffer.OutputStream::write(response->getStatus().description);
+  buffer.write("\r\n", 2);
+
+  for(auto& pair : response->getHeaders()) {
+    buffer.write(pair.first.getData(), pair.first.getSize());
+    buffer.write(": ", 2);
+    buffer.write(pair.second.getData(), pair.second.getSize());
+    buffer.write("\r\n", 2);
+  }
+
+  buffer.write("\r\n", 2);
+  buffer.flushToStream(stream);
+  body->writeToStream(stream);
+
+}
+
+class SendCoroutine : public oatpp::async::Coroutine<SendCoroutine> {
+private:
+  std::shared_ptr<Response> m_response;
+  std::shared_ptr<oatpp::data::stream::OutputStream> m_stream;
+public:
+
+  SendCoroutine(const std::shared_ptr<Response>& response, const std::shared_ptr<oatpp::data::stream::OutputStream>& stream)
+    : m_response(response)
+    , m_stream(stream)
+  {}
+
+  Action act() override {
+    return m_response->sendAsync(m_stream).next(finish());
+  }
+
+};
+
+void testOutput() {
+
+  oatpp::String body = "{\"message\": \"Hello World!\"}";
+
+  oatpp::data::stream::ChunkedBuffer expected;
+  auto legacyResponse = createResponse(body);
+  sendLegacy(legacyResponse, BufferBody::createShared(body), &expected);
+
+  oatpp::data::stream::ChunkedBuffer actual;
+  createResponse(body)->send(&actual);
+  OATPP_ASSERT(actual.toString() == expected.toString());
+
+  auto actualAsync = oatpp::data::stream::ChunkedBuffer::createShared();
+  oatpp::async::Processor processor;
+  processor.execute<SendCoroutine>(createResponse(body), actualAsync);
+  while(processor.iterate(100)) {}
+  OATPP_ASSERT(actualAsync->toString() == expected.toString());
+
+  /* headers which don't fit the stack buffer */
+  oatpp::data::stream::ChunkedBuffer bigHeaders;
+  auto response = createResponse(body);
+  oatpp::String bigValue(2000);
+  std::memset(bigValue->getData(), 'x', bigValue->getSize());
+  response->putHeader("X-Big", bigValue);
+  response->send(&bigHeaders);
+  OATPP_ASSERT(bigHeaders.getSize() > 2000 + body->getSize());
+
+}
+
+/*
+ * Buffered response - status line, headers and body go out in a single write.
+ */
+void testWriteCalls() {
+
+  v_int32 bodySizes[] = {64, 2048, 16384, 65536};
+
+  for(auto bodySize : bodySizes) {
+
+    oatpp::String body(bodySize);
+    std::memset(body->getData(), 'a', bodySize);
+
+    oatpp::data::stream::ChunkedBuffer expected;
+    sendLegacy(createResponse(body), BufferBody::createShared(body), &expected);
+
+    auto sink = oatpp::data::stream::ChunkedBuffer::createShared();
+    auto counter = std::make_shared<CountingStream>(sink);
+    auto ioBuffer = oatpp::data::buffer::IOBuffer::createShared();
+    auto outStream = oatpp::data::stream::OutputStreamBufferedProxy::createShared(counter, ioBuffer);
+
+    createResponse(body)->send(outStream.get());
+    outStream->flush();
+
+    OATPP_ASSERT(counter->calls == 1);
+    OATPP_ASSERT(counter->bytes == expected.getSize());
+    OATPP_ASSERT(sink->toString() == expected.toString());
+
+  }
+
+}
+
+}
+
+void ResponseTest::onRun() {
+
+  testOutput();
+  testWriteCalls();
+
+}
+
+}}}}}}
@@ -0,0 +1,234 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "HttpConnectionHandlerTest.hpp"
+
+#include "oatpp/web/server/HttpConnectionHandler.hpp"
+#include "oatpp/web/server/HttpRouter.hpp"
+#include "oatpp/network/Connection.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#if !defined(WIN32) && !defined(_WIN32)
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace oatpp { namespace test { namespace web { namespace server {
+
+#if !defined(WIN32) && !defined(_WIN32)
+
+namespace {
+
+class EchoHandler : public oatpp::web::server::HttpRequestHandler {
+public:
+
+  std::shared_ptr<OutgoingResponse> handle(const std::shared_ptr<IncomingRequest>& request) override {
+    return ResponseFactory::createResponse(Status::CODE_200, request->getPathVariable("n"));
+  }
+
+};
+
+class BigHandler : public oatpp::web::server::HttpRequestHandler {
+public:
+
+  std::shared_ptr<OutgoingResponse> handle(const std::shared_ptr<IncomingRequest>& request) override {
+    (void) request;
+    return ResponseFactory::createResponse(Status::CODE_200, oatpp::String(std::string(8 * 1024 * 1024, 'x').c_str()));
+  }
+
+};
+
+void writeAll(int fd, const std::string& data) {
+  const char* p = data.data();
+  size_t left = data.size();
+  while(left > 0) {
+    auto res = ::write(fd, p, left);
+    OATPP_ASSERT(res > 0);
+    p += res;
+    left -= res;
+  }
+}
+
+/*
+ * Read until the end of the response body "ok".
+ */
+std::string readResponse(int fd) {
+  std::string result;
+  while(result.size() < 2 || result.compare(result.size() - 2, 2, "ok") != 0) {
+    char c;
+    OATPP_ASSERT(::read(fd, &c, 1) == 1);
+    result.push_back(c);
+  }
+  return result;
+}
+
+}
+
+void HttpConnectionHandlerTest::onRun() {
+
+  auto router = oatpp::web::server::HttpRouter::createShared();
+  router->route("GET", "/echo/{n}", std::make_shared<EchoHandler>());
+  router->route("GET", "/big", std::make_shared<BigHandler>());
+
+  /* single worker - the slow client occupies it until the read timeout expires */
+  auto connectionHandler = oatpp::web::server::HttpConnectionHandler::createShared(router, 1, std::chrono::milliseconds(200));
+
+  int slow[2];
+  int fast[2];
+  OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, slow) == 0);
+  OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fast) == 0);
+
+  connectionHandler->handleConnection(oatpp::network::Connection::createShared(slow[0]), nullptr);
+  connectionHandler->handleConnection(oatpp::network::Connection::createShared(fast[0]), nullptr);
+
+  {
+    OATPP_LOGI(TAG, "Keep-alive requests served by the worker pool...");
+    for(v_int32 i = 0; i < 3; i ++) {
+      writeAll(fast[1], "GET /echo/ok HTTP/1.1\r\nHost: localhost\r\n\r\n");
+      auto response = readResponse(fast[1]);
+      OATPP_ASSERT(response.compare(0, 12, "HTTP/1.1 200") == 0);
+    }
+    OATPP_LOGI(TAG, "OK");
+  }
+
+  {
+    OATPP_LOGI(TAG, "Slow client is dropped on read timeout...");
+
+    auto start = std::chrono::system_clock::now();
+
+    /* incomplete headers - worker blocks reading the rest of them */
+    writeAll(slow[1], "GET /echo/ok HTTP/1.1\r\nHost: loc");
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    /* served as soon as the slow client is dropped */
+    writeAll(fast[1], "GET /echo/ok HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    auto response = readResponse(fast[1]);
+    OATPP_ASSERT(response.compare(0, 12, "HTTP/1.1 200") == 0);
+
+    char c;
+    OATPP_ASSERT(::read(slow[1], &c, 1) <= 0);
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start).count();
+    OATPP_ASSERT(elapsed < 5000);
+    OATPP_LOGI(TAG, "OK. Dropped in %d ms", (v_int32) elapsed);
+  }
+
+  {
+    OATPP_LOGI(TAG, "Client sending request byte by byte is dropped on request deadline...");
+
+    int drip[2];
+    OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, drip) == 0);
+    connectionHandler->handleConnection(oatpp::network::Connection::createShared(drip[0]), nullptr);
+
+    auto start = std::chrono::system_clock::now();
+
+    /* every byte arrives well within the timeout - only the total deadline can drop the client */
+    std::string request = "GET /echo/ok HTTP/1.1\r\nHost: localhost\r\nX-Drip: aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\r\n\r\n";
+    for(auto c : request) {
+      if(::send(drip[1], &c, 1, MSG_NOSIGNAL) != 1) {
+        break;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    char c;
+    OATPP_ASSERT(::read(drip[1], &c, 1) <= 0);
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start).count();
+    OATPP_ASSERT(elapsed < (v_int64) request.size() * 20);
+    OATPP_LOGI(TAG, "OK. Dropped in %d ms", (v_int32) elapsed);
+
+    ::close(drip[1]);
+  }
+
+  {
+    OATPP_LOGI(TAG, "Client not reading the response is dropped on write timeout...");
+
+    int stalled[2];
+    OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, stalled) == 0);
+    connectionHandler->handleConnection(oatpp::network::Connection::createShared(stalled[0]), nullptr);
+
+    /* response doesn't fit socket buffers - worker blocks writing it */
+    writeAll(stalled[1], "GET /big HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    writeAll(fast[1], "GET /echo/ok HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    auto response = readResponse(fast[1]);
+    OATPP_ASSERT(response.compare(0, 12, "HTTP/1.1 200") == 0);
+    OATPP_LOGI(TAG, "OK");
+
+    ::close(stalled[1]);
+  }
+
+  connectionHandler->stop();
+
+  ::close(slow[1]);
+  ::close(fast[1]);
+
+  {
+    OATPP_LOGI(TAG, "stop() doesn't wait for connections blocked in I/O...");
+
+    /* no timeouts - only stop() can release the worker */
+    auto handler = oatpp::web::server::HttpConnectionHandler::createShared(router, 1, std::chrono::microseconds(0));
+
+    int blocked[2];
+    int parked[2];
+    OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, blocked) == 0);
+    OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, parked) == 0);
+
+    handler->handleConnection(oatpp::network::Connection::createShared(blocked[0]), nullptr);
+    handler->handleConnection(oatpp::network::Connection::createShared(parked[0]), nullptr);
+
+    writeAll(blocked[1], "GET /echo/ok HTTP/1.1\r\nHost: loc");
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    auto start = std::chrono::system_clock::now();
+    handler->stop();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start).count();
+    OATPP_ASSERT(elapsed < 1000);
+
+    char c;
+    OATPP_ASSERT(::read(blocked[1], &c, 1) <= 0);
+    OATPP_ASSERT(::read(parked[1], &c, 1) <= 0);
+    OATPP_LOGI(TAG, "OK. Stopped in %d ms", (v_int32) elapsed);
+
+    ::close(blocked[1]);
+    ::close(parked[1]);
+  }
+
+}
+
+#else
+
+void HttpConnectionHandlerTest::onRun() {
+  OATPP_LOGD(TAG, "Test is not supported on this platform");
+}
+
+#endif
+
+}}}}
@@ -0,0 +1,237 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "HttpPipeliningTest.hpp"
+
+#include "oatpp/web/server/HttpConnectionHandler.hpp"
+#include "oatpp/web/server/AsyncHttpConnectionHandler.hpp"
+#include "oatpp/web/server/HttpRouter.hpp"
+#include "oatpp/network/Connection.hpp"
+#include "oatpp/core/data/stream/ChunkedBuffer.hpp"
+#include "oatpp/core/utils/ConversionUtils.hpp"
+
+#include <cstring>
+#include <string>
+
+#if !defined(WIN32) && !defined(_WIN32)
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace oatpp { namespace test { namespace web { namespace server {
+
+#if !defined(WIN32) && !defined(_WIN32)
+
+namespace {
+
+static constexpr v_int32 REQUESTS_COUNT = 256;
+static constexpr v_int32 PIPELINE_DEPTH = 16;
+
+/*
+ * Respond with request number taken from the path. All numbers are of the same width so all responses are of equal size.
+ */
+class EchoHandler : public oatpp::web::server::HttpRequestHandler {
+private:
+
+  std::shared_ptr<OutgoingResponse> createResponse(const std::shared_ptr<IncomingRequest>& request) {
+    return ResponseFactory::createResponse(Status::CODE_200, request->getPathVariable("n"));
+  }
+
+public:
+
+  std::shared_ptr<OutgoingResponse> handle(const std::shared_ptr<IncomingRequest>& request) override {
+    return createResponse(request);
+  }
+
+  oatpp::async::CoroutineStarterForResult<const std::shared_ptr<OutgoingResponse>&>
+  handleAsync(const std::shared_ptr<IncomingRequest>& request) override {
+
+    class EchoCoroutine : public oatpp::async::CoroutineWithResult<EchoCoroutine, const std::shared_ptr<OutgoingResponse>&> {
+    private:
+      std::shared_ptr<OutgoingResponse> m_response;
+    public:
+
+      EchoCoroutine(const std::shared_ptr<OutgoingResponse>& response)
+        : m_response(response)
+      {}
+
+      Action act() override {
+        return _return(m_response);
+      }
+
+    };
+
+    return EchoCoroutine::startForResult(createResponse(request));
+
+  }
+
+};
+
+std::string numberToPath(v_int32 number) {
+  std::string result = std::to_string(number + 1000000);
+  return result.substr(1);
+}
+
+std::string createRequest(v_int32 number) {
+  return "GET /echo/" + numberToPath(number) + " HTTP/1.1\r\nHost: localhost\r\nUser-Agent: pipelining-test\r\n\r\n";
+}
+
+/*
+ * POST request which body is not read by the endpoint. Server has to skip it to get to the next request.
+ */
+std::string createPostRequest(v_int32 number) {
+  return "POST /echo/" + numberToPath(number) + " HTTP/1.1\r\nHost: localhost\r\nContent-Length: 12\r\n\r\nunread body!";
+}
+
+void writeAll(int fd, const std::string& data) {
+  const char* p = data.data();
+  size_t left = data.size();
+  while(left > 0) {
+    auto res = ::write(fd, p, left);
+    OATPP_ASSERT(res > 0);
+    p += res;
+    left -= res;
+  }
+}
+
+void readAll(int fd, char* buffer, v_int64 size) {
+  while(size > 0) {
+    auto res = ::read(fd, buffer, size);
+    OATPP_ASSERT(res > 0);
+    buffer += res;
+    size -= res;
+  }
+}
+
+/*
+ * Check that responses come in order of requests.
+ */
+void checkResponses(const char* data, v_int32 responseSize, v_int32 firstNumber, v_int32 count) {
+  for(v_int32 i = 0; i < count; i ++) {
+    const char* response = data + i * responseSize;
+    OATPP_ASSERT(std::strncmp(response, "HTTP/1.1 200", 12) == 0);
+    OATPP_ASSERT(std::strncmp(response + responseSize - 6, numberToPath(firstNumber + i).c_str(), 6) == 0);
+  }
+}
+
+/*
+ * Send REQUESTS_COUNT requests in batches of `depth` requests and wait for all responses of a batch before sending next one.
+ */
+void runClient(int fd, v_int32 depth) {
+
+  /* first request to learn response size */
+  writeAll(fd, createRequest(0));
+  std::string first;
+  while(first.find("\r\n\r\n") == std::string::npos || first.size() < first.find("\r\n\r\n") + 4 + 6) {
+    char c;
+    OATPP_ASSERT(::read(fd, &c, 1) == 1);
+    first.push_back(c);
+  }
+  v_int32 responseSize = (v_int32) first.size();
+  checkResponses(first.data(), responseSize, 0, 1);
+
+  /* pipelined POST with a body which endpoint ignores */
+  writeAll(fd, createPostRequest(1) + createRequest(2) + createPostRequest(3) + createRequest(4));
+  std::string mixed(responseSize * 4, '\0');
+  readAll(fd, &mixed[0], mixed.size());
+  checkResponses(mixed.data(), responseSize, 1, 4);
+
+  std::string batch;
+  std::string responses(responseSize * depth, '\0');
+
+  for(v_int32 i = 0; i < REQUESTS_COUNT; i += depth) {
+    batch.clear();
+    for(v_int32 j = 0; j < depth; j ++) {
+      batch.append(createRequest(i + j));
+    }
+    writeAll(fd, batch);
+    readAll(fd, &responses[0], responses.size());
+    checkResponses(responses.data(), responseSize, i, depth);
+  }
+
+  /* let server see EOF and wait until it closes connection */
+  ::shutdown(fd, SHUT_WR);
+  char c;
+  while(::read(fd, &c, 1) > 0) {}
+  ::close(fd);
+
+}
+
+std::shared_ptr<oatpp::web::server::HttpRouter> createRouter() {
+  auto router = oatpp::web::server::HttpRouter::createShared();
+  auto handler = std::make_shared<EchoHandler>();
+  router->route("GET", "/echo/{n}", handler);
+  router->route("POST", "/echo/{n}", handler);
+  return router;
+}
+
+void testSync(v_int32 workersCount, v_int32 depth) {
+  auto connectionHandler = oatpp::web::server::HttpConnectionHandler::createShared(createRouter(), workersCount);
+  int fds[2];
+  OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+  connectionHandler->handleConnection(oatpp::network::Connection::createShared(fds[0]), nullptr);
+  runClient(fds[1], depth);
+  connectionHandler->stop();
+}
+
+void testAsync(v_int32 depth) {
+  auto executor = std::make_shared<oatpp::async::Executor>(1, 1, 1);
+  auto connectionHandler = oatpp::web::server::AsyncHttpConnectionHandler::createShared(createRouter(), executor);
+  int fds[2];
+  OATPP_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+  connectionHandler->handleConnection(oatpp::network::Connection::createShared(fds[0]), nullptr);
+  runClient(fds[1], depth);
+  executor->waitTasksFinished();
+  executor->stop();
+  executor->join();
+}
+
+}
+
+void HttpPipeliningTest::onRun() {
+
+  OATPP_LOGD(TAG, "sync...");
+  testSync(0, 1);
+  testSync(0, PIPELINE_DEPTH);
+
+  OATPP_LOGD(TAG, "sync-workers...");
+  testSync(1, 1);
+  testSync(1, PIPELINE_DEPTH);
+
+  OATPP_LOGD(TAG, "async...");
+  testAsync(1);
+  testAsync(PIPELINE_DEPTH);
+
+}
+
+#else
+
+void HttpPipeliningTest::onRun() {
+  OATPP_LOGD(TAG, "Test is not supported on this platform");
+}
+
+#endif
+
+}}}}
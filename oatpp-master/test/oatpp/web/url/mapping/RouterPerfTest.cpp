@@ -0,0 +1,169 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "RouterPerfTest.hpp"
+
+#include "oatpp/web/url/mapping/Router.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace test { namespace web { namespace url { namespace mapping {
+
+namespace {
+
+typedef oatpp::web::url::mapping::Pattern Pattern;
+typedef oatpp::data::share::StringKeyLabel StringKeyLabel;
+
+struct Endpoint {
+  v_int32 index;
+};
+
+typedef oatpp::web::url::mapping::Router<Endpoint> Router;
+
+/*
+ * Reference router - match patterns one by one in order they were added.
+ */
+class LinearRouter {
+private:
+  std::vector<std::shared_ptr<Pattern>> m_patterns;
+public:
+
+  void route(const oatpp::String& pattern) {
+    m_patterns.push_back(Pattern::parse(pattern));
+  }
+
+  v_int32 getRoute(const StringKeyLabel& path, Pattern::MatchMap& matchMap) {
+    for(v_int32 i = 0; i < (v_int32) m_patterns.size(); i ++) {
+      Pattern::MatchMap map;
+      if(m_patterns[i]->match(path, map)) {
+        matchMap = map;
+        return i;
+      }
+    }
+    return -1;
+  }
+
+};
+
+class TestRouters {
+public:
+
+  Router router;
+  LinearRouter linearRouter;
+  v_int32 routesCount = 0;
+
+  void route(const oatpp::String& pattern) {
+    auto endpoint = std::make_shared<Endpoint>();
+    endpoint->index = routesCount ++;
+    router.route(pattern, endpoint);
+    linearRouter.route(pattern);
+  }
+
+};
+
+void generateRoutes(TestRouters& routers, v_int32 count) {
+  for(v_int32 i = 0; i < count; i ++) {
+    v_char8 buff[128];
+    v_int32 size;
+    switch(i % 4) {
+      case 0: size = snprintf((char*) buff, 128, "/api/v1/resource%d", i / 4); break;
+      case 1: size = snprintf((char*) buff, 128, "/api/v1/resource%d/{id}", i / 4); break;
+      case 2: size = snprintf((char*) buff, 128, "/api/v1/resource%d/{id}/items/{x}", i / 4); break;
+      default: size = snprintf((char*) buff, 128, "/static/group%d/*", i / 4); break;
+    }
+    routers.route(oatpp::String((const char*) buff, size, true));
+  }
+}
+
+std::vector<oatpp::String> generateUrls(v_int32 routesCount) {
+  std::vector<oatpp::String> result;
+  for(v_int32 i = 0; i < routesCount; i ++) {
+    v_char8 buff[128];
+    v_int32 size;
+    switch(i % 4) {
+      case 0: size = snprintf((char*) buff, 128, "/api/v1/resource%d", i / 4); break;
+      case 1: size = snprintf((char*) buff, 128, "/api/v1/resource%d/%d", i / 4, i); break;
+      case 2: size = snprintf((char*) buff, 128, "/api/v1/resource%d/%d/items/%d?page=1", i / 4, i, i * 7); break;
+      default: size = snprintf((char*) buff, 128, "/static/group%d/css/main.css", i / 4); break;
+    }
+    result.push_back(oatpp::String((const char*) buff, size, true));
+  }
+  result.push_back("/api/v2/not-found");
+  return result;
+}
+
+void runRouting(v_int32 routesCount) {
+
+  TestRouters routers;
+  generateRoutes(routers, routesCount);
+  auto urls = generateUrls(routesCount);
+
+  std::vector<StringKeyLabel> paths;
+  for(auto& url : urls) {
+    paths.push_back(StringKeyLabel(url));
+  }
+
+  v_int32 lookupsCount = 1000000 / routesCount;
+  if(lookupsCount < 10000) {
+    lookupsCount = 10000;
+  }
+
+  v_int32 found = 0;
+
+  v_int64 ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < lookupsCount; i ++) {
+    Pattern::MatchMap matchMap;
+    if(routers.linearRouter.getRoute(paths[i % paths.size()], matchMap) >= 0) {
+      found ++;
+    }
+  }
+  v_int64 linearTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  ticks = oatpp::base::Environment::getMicroTickCount();
+  for(v_int32 i = 0; i < lookupsCount; i ++) {
+    if(routers.router.getRoute(paths[i % paths.size()])) {
+      found --;
+    }
+  }
+  v_int64 treeTicks = oatpp::base::Environment::getMicroTickCount() - ticks;
+
+  OATPP_ASSERT(found == 0);
+
+  OATPP_LOGD("Router", "%d routes, %d lookups: linear=%lld(ns/lookup), tree=%lld(ns/lookup)",
+             routesCount, lookupsCount, linearTicks * 1000 / lookupsCount, treeTicks * 1000 / lookupsCount);
+
+}
+
+}
+
+void RouterPerfTest::onRun() {
+
+  runRouting(10);
+  runRouting(100);
+  runRouting(1000);
+
+}
+
+}}}}}
@@ -0,0 +1,221 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+
+#include "RouterTest.hpp"
+
+#include "oatpp/web/url/mapping/Router.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace test { namespace web { namespace url { namespace mapping {
+
+namespace {
+
+typedef oatpp::web::url::mapping::Pattern Pattern;
+typedef oatpp::data::share::StringKeyLabel StringKeyLabel;
+
+struct Endpoint {
+  v_int32 index;
+};
+
+typedef oatpp::web::url::mapping::Router<Endpoint> Router;
+
+/*
+ * Reference router - match patterns one by one in order they were added.
+ */
+class LinearRouter {
+private:
+  std::vector<std::shared_ptr<Pattern>> m_patterns;
+public:
+
+  void route(const oatpp::String& pattern) {
+    m_patterns.push_back(Pattern::parse(pattern));
+  }
+
+  v_int32 getRoute(const StringKeyLabel& path, Pattern::MatchMap& matchMap) {
+    for(v_int32 i = 0; i < (v_int32) m_patterns.size(); i ++) {
+      Pattern::MatchMap map;
+      if(m_patterns[i]->match(path, map)) {
+        matchMap = map;
+        return i;
+      }
+    }
+    return -1;
+  }
+
+};
+
+class TestRouters {
+public:
+
+  Router router;
+  LinearRouter linearRouter;
+  v_int32 routesCount = 0;
+
+  void route(const oatpp::String& pattern) {
+    auto endpoint = std::make_shared<Endpoint>();
+    endpoint->index = routesCount ++;
+    router.route(pattern, endpoint);
+    linearRouter.route(pattern);
+  }
+
+};
+
+bool equalStrings(const oatpp::String& a, const oatpp::String& b) {
+  if(!a || !b) {
+    return !a && !b;
+  }
+  return a == b;
+}
+
+bool equalVariables(const Pattern::MatchMap& a, const Pattern::MatchMap& b) {
+  static const char* names[] = {"id", "postId", "x", "y", "any", "name"};
+  for(auto name : names) {
+    if(!equalStrings(a.getVariable(name), b.getVariable(name))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void checkSame(TestRouters& routers, const char* url) {
+
+  StringKeyLabel path = oatpp::String(url);
+
+  Pattern::MatchMap expectedMap;
+  v_int32 expected = routers.linearRouter.getRoute(path, expectedMap);
+
+  auto route = routers.router.getRoute(path);
+
+  if(expected < 0) {
+    OATPP_ASSERT(!route);
+    return;
+  }
+
+  OATPP_ASSERT(route);
+  OATPP_ASSERT(route.getEndpoint()->index == expected);
+  OATPP_ASSERT(equalVariables(route.matchMap, expectedMap));
+  OATPP_ASSERT(equalStrings(route.matchMap.getTail(), expectedMap.getTail()));
+
+}
+
+void testPrecedence() {
+
+  TestRouters routers;
+
+  routers.route("/");
+  routers.route("/users");
+  routers.route("/users/{id}");
+  routers.route("/users/{id}/posts/{postId}");
+  routers.route("/users/me");
+  routers.route("/files/*");
+  routers.route("/files/static");
+  routers.route("/a/{x}/c");
+  routers.route("/a/b/c");
+  routers.route("/q");
+  routers.route("/{any}/tail/*");
+  routers.route("/{x}/{y}");
+  routers.route("/x?y");
+  routers.route("/v/{id}/*");
+  routers.route("/w/{name}/z");
+  routers.route("/w/{id}/*");
+
+  const char* urls[] = {
+    "", "/", "//", "/users", "/users/", "users", "//users//", "/users/123", "/users/me", "/users/123?x=1",
+    "/users/1/posts/2", "/users/1?q/posts/2", "/users/1/posts/2?p", "/users?x", "/users/?x",
+    "/files", "/files/", "/files/a/b?c", "/files/static", "/files?x",
+    "/a/b/c", "/a/z/c", "/a/b/c?d", "/a//c", "/q?x", "/q/", "/q/r/s",
+    "/foo/tail/bar", "/foo/tail", "/foo/tail?x", "/foo/bar", "/foo/bar/baz", "/x?y", "/x?y?z", "/x?",
+    "/v/1?t", "/v/1/a/b", "/v/1", "/w/1/z", "/w/1?a/z", "/w/1/y", "/nothing/at/all/here", "users//123"
+  };
+
+  for(auto url : urls) {
+    checkSame(routers, url);
+  }
+
+  Router empty;
+  OATPP_ASSERT(!empty.getRoute("/"));
+
+}
+
+void generateRoutes(TestRouters& routers, v_int32 count) {
+  for(v_int32 i = 0; i < count; i ++) {
+    v_char8 buff[128];
+    v_int32 size;
+    switch(i % 4) {
+      case 0: size = snprintf((char*) buff, 128, "/api/v1/resource%d", i / 4); break;
+      case 1: size = snprintf((char*) buff, 128, "/api/v1/resource%d/{id}", i / 4); break;
+      case 2: size = snprintf((char*) buff, 128, "/api/v1/resource%d/{id}/items/{x}", i / 4); break;
+      default: size = snprintf((char*) buff, 128, "/static/group%d/*", i / 4); break;
+    }
+    routers.route(oatpp::String((const char*) buff, size, true));
+  }
+}
+
+std::vector<oatpp::String> generateUrls(v_int32 routesCount) {
+  std::vector<oatpp::String> result;
+  for(v_int32 i = 0; i < routesCount; i ++) {
+    v_char8 buff[128];
+    v_int32 size;
+    switch(i % 4) {
+      case 0: size = snprintf((char*) buff, 128, "/api/v1/resource%d", i / 4); break;
+      case 1: size = snprintf((char*) buff, 128, "/api/v1/resource%d/%d", i / 4, i); break;
+      case 2: size = snprintf((char*) buff, 128, "/api/v1/resource%d/%d/items/%d?page=1", i / 4, i, i * 7); break;
+      default: size = snprintf((char*) buff, 128, "/static/group%d/css/main.css", i / 4); break;
+    }
+    result.push_back(oatpp::String((const char*) buff, size, true));
+  }
+  result.push_back("/api/v2/not-found");
+  return result;
+}
+
+/*
+ * Tree router must resolve generated urls exactly like the linear reference router.
+ */
+void testGeneratedRoutes(v_int32 routesCount) {
+
+  TestRouters routers;
+  generateRoutes(routers, routesCount);
+  auto urls = generateUrls(routesCount);
+
+  for(auto& url : urls) {
+    checkSame(routers, (const char*) url->getData());
+  }
+
+}
+
+}
+
+void RouterTest::onRun() {
+
+  testPrecedence();
+
+  testGeneratedRoutes(10);
+  testGeneratedRoutes(100);
+  testGeneratedRoutes(1000);
+
+}
+
+}}}}}